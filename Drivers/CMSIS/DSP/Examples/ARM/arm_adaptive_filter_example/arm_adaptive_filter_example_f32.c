@@ -0,0 +1,342 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2026 ARM Limited. All rights reserved.
+*
+* $Date:         18. October 2026
+* $Revision:     V1.0.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_adaptive_filter_example_f32.c
+*
+* Description:   Example code comparing the convergence of the
+*                normalized LMS, frequency-domain block LMS and RLS
+*                adaptive filters.
+*
+* Target Processor: Cortex-M/Cortex-A
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup AdaptiveFilterConvergence Adaptive Filter Convergence Example
+ * \par Description:
+ * \par
+ * Compares the convergence of the three floating-point adaptive filters of the library
+ * when they "learn" the transfer functions of two FIR filters, as in the
+ * \ref SignalConvergence "Signal Convergence Example".
+ * \par Algorithm:
+ * \par
+ * The input signal is passed through two FIR filters: the lowpass filter of the
+ * Signal Convergence Example and the highpass filter obtained by alternating the
+ * signs of its coefficients. Their outputs are the reference signals of two channels
+ * which share the input signal, as the signals of two error microphones in active
+ * noise control.
+ * \par
+ * Three adaptive filters learn the transfer functions:
+ * - a normalized LMS filter (one instance for the first channel),
+ * - a frequency-domain block LMS filter with 2 channels,
+ * - an RLS filter with 2 channels.
+ * \par
+ * The test is run with the white noise input of the Signal Convergence Example and with
+ * a colored (lowpass) version of it, for which the normalized LMS filter converges slowly.
+ * For each filter, the example records the number of input samples after which all the
+ * coefficients are within DELTA_COEFF of the coefficients of the FIR filters.
+ * The test succeeds when the frequency-domain block LMS and RLS filters converge on both
+ * channels and both inputs.
+ * \par Variables Description:
+ * \par
+ * \li \c testInput_f32 points to the input data
+ * \li \c FIRCoeff_f32 points to the coefficients of the lowpass filter
+ * \li \c highpassCoeff_f32 points to the coefficients of the highpass filter
+ * \li \c fdafBuffer points to the arena of the frequency-domain block LMS filter
+ * \li \c rlsCoeff_f32 points to the coefficients of the channels of the RLS filter
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_fir_init_f32()
+ * - arm_fir_f32()
+ * - arm_lms_norm_init_f32()
+ * - arm_lms_norm_f32()
+ * - arm_fdaf_get_buffer_size_f32()
+ * - arm_fdaf_init_f32()
+ * - arm_fdaf_f32()
+ * - arm_fdaf_get_coeffs_f32()
+ * - arm_rls_init_f32()
+ * - arm_rls_f32()
+ * - arm_sub_f32()
+ * - arm_abs_f32()
+ * - arm_max_f32()
+ * <b> Refer  </b>
+ * \link arm_adaptive_filter_example_f32.c \endlink
+ */
+
+
+/** \example arm_adaptive_filter_example_f32.c
+  */
+
+#include "arm_math.h"
+
+#if defined(SEMIHOSTING)
+#include <stdio.h>
+#endif
+
+/* ----------------------------------------------------------------------
+** Global defines for the simulation
+* ------------------------------------------------------------------- */
+
+#define TEST_LENGTH_SAMPLES 1536
+#define NUMTAPS               32
+#define BLOCKSIZE             32
+#define NUMCHANNELS            2
+#define DELTA_COEFF         0.0001f
+#define NLMS_MU             0.5f
+#define FDAF_MU             0.5f
+#define FDAF_BETA           0.9f
+#define RLS_LAMBDA          0.999f
+#define RLS_DELTA           100.0f
+#define COLOR_POLE          0.9f
+
+#define NUMFRAMES (TEST_LENGTH_SAMPLES / BLOCKSIZE)
+
+/* Frequency-domain block LMS arena: 9 * NUMTAPS + 1 + 2 * NUMTAPS * NUMCHANNELS words */
+#define FDAF_BUFFER_SIZE (9 * NUMTAPS + 1 + 2 * NUMTAPS * NUMCHANNELS)
+
+/* ----------------------------------------------------------------------
+* External Declarations (data of the Signal Convergence Example)
+* ------------------------------------------------------------------- */
+extern float32_t testInput_f32[TEST_LENGTH_SAMPLES];
+extern const float32_t FIRCoeff_f32[NUMTAPS];
+
+/* ----------------------------------------------------------------------
+* Declare FIR state buffers and structures
+* ------------------------------------------------------------------- */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+float32_t firStateF32[NUMCHANNELS][2 * BLOCKSIZE + NUMTAPS - 1];
+#else
+float32_t firStateF32[NUMCHANNELS][NUMTAPS + BLOCKSIZE];
+#endif
+
+arm_fir_instance_f32 FIR_instance[NUMCHANNELS];
+float32_t highpassCoeff_f32[NUMTAPS];
+
+/* ----------------------------------------------------------------------
+* Declare adaptive filter buffers and structures
+* ------------------------------------------------------------------- */
+
+float32_t lmsStateF32[NUMTAPS + BLOCKSIZE];
+float32_t lmsNormCoeffs_f32[NUMTAPS];
+arm_lms_norm_instance_f32 lmsNorm_instance;
+
+float32_t fdafBuffer[FDAF_BUFFER_SIZE];
+float32_t fdafCoeff_f32[NUMTAPS];
+arm_fdaf_instance_f32 fdaf_instance;
+
+float32_t rlsStateF32[NUMTAPS + BLOCKSIZE];
+float32_t rlsCoeff_f32[NUMCHANNELS * NUMTAPS];
+float32_t rlsInvCorr_f32[NUMTAPS * NUMTAPS];
+float32_t rlsGain_f32[NUMTAPS];
+arm_rls_instance_f32 rls_instance;
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+
+float32_t input[BLOCKSIZE];
+float32_t reference[NUMCHANNELS * BLOCKSIZE];
+float32_t output[NUMCHANNELS * BLOCKSIZE];
+float32_t error[NUMCHANNELS * BLOCKSIZE];
+float32_t coeffError[NUMTAPS];
+
+/* Number of samples needed to converge, 0 while not converged */
+uint32_t nlmsConverged;
+uint32_t fdafConverged[NUMCHANNELS];
+uint32_t rlsConverged[NUMCHANNELS];
+
+/* ----------------------------------------------------------------------
+* Test whether the coefficients are within DELTA_COEFF of the FIR filter
+* ------------------------------------------------------------------- */
+
+static int32_t test_coeffs_converged(const float32_t *pCoeffs,
+                                     const float32_t *pExpected)
+{
+  float32_t maxValue;
+  uint32_t index;
+
+  arm_sub_f32(pCoeffs, pExpected, coeffError, NUMTAPS);
+  arm_abs_f32(coeffError, coeffError, NUMTAPS);
+  arm_max_f32(coeffError, NUMTAPS, &maxValue, &index);
+
+  return (maxValue < DELTA_COEFF);
+}
+
+static void update_converged(uint32_t *pConverged,
+                             const float32_t *pCoeffs,
+                             const float32_t *pExpected,
+                             uint32_t nbSamples)
+{
+  if (test_coeffs_converged(pCoeffs, pExpected))
+  {
+    if (*pConverged == 0)
+    {
+      *pConverged = nbSamples;
+    }
+  }
+  else
+  {
+    *pConverged = 0;
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Run the three adaptive filters on the white or colored input
+* ------------------------------------------------------------------- */
+
+static arm_status run_adaptive_filters(int32_t colored)
+{
+  const float32_t *pExpected[NUMCHANNELS] = { FIRCoeff_f32, highpassCoeff_f32 };
+  float32_t state = 0.0f;
+  uint32_t i, j, ch;
+
+  arm_fir_init_f32(&FIR_instance[0], NUMTAPS, (float32_t *)FIRCoeff_f32, firStateF32[0], BLOCKSIZE);
+  arm_fir_init_f32(&FIR_instance[1], NUMTAPS, highpassCoeff_f32, firStateF32[1], BLOCKSIZE);
+
+  memset(lmsNormCoeffs_f32, 0, sizeof(lmsNormCoeffs_f32));
+  arm_lms_norm_init_f32(&lmsNorm_instance, NUMTAPS, lmsNormCoeffs_f32, lmsStateF32, NLMS_MU, BLOCKSIZE);
+
+  if (arm_fdaf_get_buffer_size_f32(NUMTAPS, NUMCHANNELS) > FDAF_BUFFER_SIZE)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+  if (arm_fdaf_init_f32(&fdaf_instance, NUMTAPS, NUMCHANNELS, FDAF_MU, FDAF_BETA, fdafBuffer) != ARM_MATH_SUCCESS)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  memset(rlsCoeff_f32, 0, sizeof(rlsCoeff_f32));
+  arm_rls_init_f32(&rls_instance, NUMTAPS, NUMCHANNELS, rlsCoeff_f32, rlsStateF32,
+                   rlsInvCorr_f32, rlsGain_f32, RLS_LAMBDA, RLS_DELTA, BLOCKSIZE);
+
+  nlmsConverged = 0;
+  for (ch = 0; ch < NUMCHANNELS; ch++)
+  {
+    fdafConverged[ch] = 0;
+    rlsConverged[ch] = 0;
+  }
+
+  for (i = 0; i < NUMFRAMES; i++)
+  {
+    /* Read the input data - white noise, lowpass filtered if colored */
+    for (j = 0; j < BLOCKSIZE; j++)
+    {
+      state = colored ? (COLOR_POLE * state + testInput_f32[i * BLOCKSIZE + j]) : testInput_f32[i * BLOCKSIZE + j];
+      input[j] = state;
+    }
+
+    /* Reference signals of the channels, one block after the other */
+    for (ch = 0; ch < NUMCHANNELS; ch++)
+    {
+      arm_fir_f32(&FIR_instance[ch], input, reference + ch * BLOCKSIZE, BLOCKSIZE);
+    }
+
+    arm_lms_norm_f32(&lmsNorm_instance, input, reference, output, error, BLOCKSIZE);
+    update_converged(&nlmsConverged, lmsNormCoeffs_f32, FIRCoeff_f32, (i + 1) * BLOCKSIZE);
+
+    arm_fdaf_f32(&fdaf_instance, input, reference, output, error, BLOCKSIZE);
+    for (ch = 0; ch < NUMCHANNELS; ch++)
+    {
+      arm_fdaf_get_coeffs_f32(&fdaf_instance, ch, fdafCoeff_f32);
+      update_converged(&fdafConverged[ch], fdafCoeff_f32, pExpected[ch], (i + 1) * BLOCKSIZE);
+    }
+
+    arm_rls_f32(&rls_instance, input, reference, output, error, BLOCKSIZE);
+    for (ch = 0; ch < NUMCHANNELS; ch++)
+    {
+      update_converged(&rlsConverged[ch], rlsCoeff_f32 + ch * NUMTAPS, pExpected[ch], (i + 1) * BLOCKSIZE);
+    }
+  }
+
+#if defined(SEMIHOSTING)
+  printf("%s input, samples to converge (0: not converged)\n", colored ? "Colored" : "White");
+  printf("  normalized LMS        : %u\n", (unsigned)nlmsConverged);
+  printf("  frequency-domain LMS  : %u %u\n", (unsigned)fdafConverged[0], (unsigned)fdafConverged[1]);
+  printf("  RLS                   : %u %u\n", (unsigned)rlsConverged[0], (unsigned)rlsConverged[1]);
+#endif
+
+  for (ch = 0; ch < NUMCHANNELS; ch++)
+  {
+    if ((fdafConverged[ch] == 0) || (rlsConverged[ch] == 0))
+    {
+      return (ARM_MATH_TEST_FAILURE);
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/* ----------------------------------------------------------------------
+* Adaptive filter convergence test
+* ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  arm_status status;
+  uint32_t i;
+
+  /* Highpass filter: lowpass filter with alternating signs */
+  for (i = 0; i < NUMTAPS; i++)
+  {
+    highpassCoeff_f32[i] = (i & 1) ? -FIRCoeff_f32[i] : FIRCoeff_f32[i];
+  }
+
+  status = run_adaptive_filters(0);
+  if (status == ARM_MATH_SUCCESS)
+  {
+    status = run_adaptive_filters(1);
+  }
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+#if defined (SEMIHOSTING)
+    printf("FAILURE\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+  else
+  {
+#if defined (SEMIHOSTING)
+    printf("SUCCESS\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+}
+
+ /** \endlink */
@@ -0,0 +1,362 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2026 ARM Limited. All rights reserved.
+*
+* $Date:         18. October 2026
+* $Revision:     V1.0.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_bayes_fast_example_f32.c
+*
+* Description:   Example code checking the precomputed, batched and
+*                incremental naive Gaussian Bayes functions against
+*                arm_gaussian_naive_bayes_predict_f32.
+*
+* Target Processor: Cortex-M/Cortex-A
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup BayesFastExample Precomputed Bayes Example
+ * \par Description:
+ * \par
+ * Checks that the precomputed, batched and incremental naive Gaussian Bayes functions give
+ * the same classes and probabilities as arm_gaussian_naive_bayes_predict_f32().
+ * \par Algorithm:
+ * \par
+ * A model with NB_OF_CLASSES classes of dimension VECTOR_DIMENSION is drawn at random.
+ * NUM_VECTORS test vectors are drawn around the means of random classes. For each vector,
+ * the reference is arm_gaussian_naive_bayes_predict_f32():
+ * - arm_gaussian_naive_bayes_predict_fast_f32() must return the same class and the same
+ *   log-likelihoods within LOG_TOLERANCE (relative to the largest magnitude),
+ * - arm_gaussian_naive_bayes_predict_class_f32() and
+ *   arm_gaussian_naive_bayes_predict_batch_f32() must return the same class,
+ * - arm_gaussian_naive_bayes_posterior_f32() must return the same class and posterior
+ *   probabilities within PROBA_TOLERANCE of the normalized exponentials of the reference
+ *   log-likelihoods.
+ * \par
+ * The model is then learnt again by arm_gaussian_naive_bayes_fit_update_f32() from
+ * TRAINING_VECTORS vectors per class. The learnt means and variances must match the ones
+ * computed by arm_mean_f32() and arm_var_f32() on the training vectors, and the checks above
+ * are repeated with the learnt model.
+ * \par Variables Description:
+ * \par
+ * \li \c theta, \c sigma and \c classPriors describe the model
+ * \li \c testVectors are the vectors to classify
+ * \li \c trainingVectors are the vectors of the incremental fit, class by class
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_gaussian_naive_bayes_predict_f32()
+ * - arm_gaussian_naive_bayes_fast_init_f32()
+ * - arm_gaussian_naive_bayes_predict_fast_f32()
+ * - arm_gaussian_naive_bayes_predict_class_f32()
+ * - arm_gaussian_naive_bayes_predict_batch_f32()
+ * - arm_gaussian_naive_bayes_posterior_f32()
+ * - arm_gaussian_naive_bayes_fit_init_f32()
+ * - arm_gaussian_naive_bayes_fit_update_f32()
+ * - arm_gaussian_naive_bayes_fit_export_f32()
+ * - arm_mean_f32()
+ * - arm_var_f32()
+ * <b> Refer  </b>
+ * \link arm_bayes_fast_example_f32.c \endlink
+ */
+
+
+/** \example arm_bayes_fast_example_f32.c
+  */
+
+#include <math.h>
+#include "arm_math.h"
+
+#if defined(SEMIHOSTING)
+#include <stdio.h>
+#endif
+
+/* ----------------------------------------------------------------------
+** Global defines for the simulation
+* ------------------------------------------------------------------- */
+
+#define NB_OF_CLASSES       5
+#define VECTOR_DIMENSION   16
+#define NUM_VECTORS       101
+#define TRAINING_VECTORS  200
+#define LOG_TOLERANCE     1.0e-5f
+#define PROBA_TOLERANCE   1.0e-5f
+#define FIT_TOLERANCE     1.0e-4f
+
+/* ----------------------------------------------------------------------
+* Declare the models and the vectors
+* ------------------------------------------------------------------- */
+
+float32_t theta[NB_OF_CLASSES * VECTOR_DIMENSION];
+float32_t sigma[NB_OF_CLASSES * VECTOR_DIMENSION];
+float32_t classPriors[NB_OF_CLASSES];
+arm_gaussian_naive_bayes_instance_f32 S;
+
+float32_t halfInvSigma[NB_OF_CLASSES * VECTOR_DIMENSION];
+float32_t logConst[NB_OF_CLASSES];
+arm_gaussian_naive_bayes_fast_instance_f32 SFast;
+
+uint32_t fitCount[NB_OF_CLASSES];
+float32_t fitMean[NB_OF_CLASSES * VECTOR_DIMENSION];
+float32_t fitM2[NB_OF_CLASSES * VECTOR_DIMENSION];
+arm_gaussian_naive_bayes_fit_instance_f32 SFit;
+
+float32_t testVectors[NUM_VECTORS * VECTOR_DIMENSION];
+uint32_t batchClasses[NUM_VECTORS];
+float32_t trainingVectors[NB_OF_CLASSES][TRAINING_VECTORS * VECTOR_DIMENSION];
+float32_t column[TRAINING_VECTORS];
+
+/* ----------------------------------------------------------------------
+* Pseudo-random values in [0, 1)
+* ------------------------------------------------------------------- */
+
+static uint32_t randomState = 7U;
+
+static float32_t random_value(void)
+{
+  randomState = randomState * 1664525U + 1013904223U;
+  return (float32_t) (randomState >> 8) / 16777216.0f;
+}
+
+/* ----------------------------------------------------------------------
+* Vector drawn around the mean of a class: uniform noise with the
+* variance of the class in each dimension
+* ------------------------------------------------------------------- */
+
+static void draw_vector(uint32_t classId, float32_t *pVector)
+{
+  uint32_t d;
+  float32_t stdDev;
+
+  for (d = 0; d < VECTOR_DIMENSION; d++)
+  {
+    arm_sqrt_f32(12.0f * sigma[classId * VECTOR_DIMENSION + d], &stdDev);
+    pVector[d] = theta[classId * VECTOR_DIMENSION + d] + stdDev * (random_value() - 0.5f);
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Compare the precomputed functions to arm_gaussian_naive_bayes_predict_f32
+* for all the test vectors
+* ------------------------------------------------------------------- */
+
+static arm_status check_predictions(void)
+{
+  float32_t refLog[NB_OF_CLASSES], temp[NB_OF_CLASSES];
+  float32_t fastLog[NB_OF_CLASSES], posterior[NB_OF_CLASSES];
+  float32_t maxLog, sum, scale, proba;
+  const float32_t *pVector;
+  uint32_t refClass, v, c;
+
+  if (arm_gaussian_naive_bayes_fast_init_f32(&SFast, &S, halfInvSigma, logConst) != ARM_MATH_SUCCESS)
+  {
+    return (ARM_MATH_TEST_FAILURE);
+  }
+
+  arm_gaussian_naive_bayes_predict_batch_f32(&SFast, testVectors, NUM_VECTORS, batchClasses);
+
+  for (v = 0; v < NUM_VECTORS; v++)
+  {
+    pVector = &testVectors[v * VECTOR_DIMENSION];
+
+    refClass = arm_gaussian_naive_bayes_predict_f32(&S, pVector, refLog, temp);
+
+    if ((arm_gaussian_naive_bayes_predict_fast_f32(&SFast, pVector, fastLog) != refClass)
+     || (arm_gaussian_naive_bayes_predict_class_f32(&SFast, pVector) != refClass)
+     || (arm_gaussian_naive_bayes_posterior_f32(&SFast, pVector, posterior) != refClass)
+     || (batchClasses[v] != refClass))
+    {
+      return (ARM_MATH_TEST_FAILURE);
+    }
+
+    /* Log-likelihoods */
+    scale = 0.0f;
+    for (c = 0; c < NB_OF_CLASSES; c++)
+    {
+      scale = (fabsf(refLog[c]) > scale) ? fabsf(refLog[c]) : scale;
+    }
+    for (c = 0; c < NB_OF_CLASSES; c++)
+    {
+      if (fabsf(fastLog[c] - refLog[c]) > LOG_TOLERANCE * scale)
+      {
+        return (ARM_MATH_TEST_FAILURE);
+      }
+    }
+
+    /* Posterior probabilities from the reference log-likelihoods */
+    maxLog = refLog[refClass];
+    sum = 0.0f;
+    for (c = 0; c < NB_OF_CLASSES; c++)
+    {
+      sum += expf(refLog[c] - maxLog);
+    }
+    for (c = 0; c < NB_OF_CLASSES; c++)
+    {
+      proba = expf(refLog[c] - maxLog) / sum;
+      if (fabsf(posterior[c] - proba) > PROBA_TOLERANCE)
+      {
+        return (ARM_MATH_TEST_FAILURE);
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/* ----------------------------------------------------------------------
+* Compare the learnt means and variances to the batch statistics
+* of the training vectors
+* ------------------------------------------------------------------- */
+
+static arm_status check_fit(void)
+{
+  float32_t mean, var;
+  uint32_t c, d, n;
+
+  for (c = 0; c < NB_OF_CLASSES; c++)
+  {
+    for (d = 0; d < VECTOR_DIMENSION; d++)
+    {
+      for (n = 0; n < TRAINING_VECTORS; n++)
+      {
+        column[n] = trainingVectors[c][n * VECTOR_DIMENSION + d];
+      }
+      arm_mean_f32(column, TRAINING_VECTORS, &mean);
+      arm_var_f32(column, TRAINING_VECTORS, &var);
+
+      /* The fit exports the population variance */
+      var = var * (float32_t) (TRAINING_VECTORS - 1) / (float32_t) TRAINING_VECTORS;
+
+      if ((fabsf(fitMean[c * VECTOR_DIMENSION + d] - mean) > FIT_TOLERANCE * var)
+       || (fabsf(sigma[c * VECTOR_DIMENSION + d] - var) > FIT_TOLERANCE * var))
+      {
+        return (ARM_MATH_TEST_FAILURE);
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/* ----------------------------------------------------------------------
+* Precomputed and incremental naive Gaussian Bayes test
+* ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  arm_status status;
+  float32_t sum = 0.0f;
+  uint32_t i, c;
+
+  /* Random model */
+  for (i = 0; i < NB_OF_CLASSES * VECTOR_DIMENSION; i++)
+  {
+    theta[i] = 4.0f * (random_value() - 0.5f);
+    sigma[i] = 0.2f + 2.0f * random_value();
+  }
+  for (c = 0; c < NB_OF_CLASSES; c++)
+  {
+    classPriors[c] = 0.5f + random_value();
+    sum += classPriors[c];
+  }
+  for (c = 0; c < NB_OF_CLASSES; c++)
+  {
+    classPriors[c] /= sum;
+  }
+
+  S.vectorDimension = VECTOR_DIMENSION;
+  S.numberOfClasses = NB_OF_CLASSES;
+  S.theta = theta;
+  S.sigma = sigma;
+  S.classPriors = classPriors;
+  S.epsilon = 4.328939296523643e-09f;
+
+  for (i = 0; i < NUM_VECTORS; i++)
+  {
+    draw_vector((uint32_t) (random_value() * NB_OF_CLASSES), &testVectors[i * VECTOR_DIMENSION]);
+  }
+
+  status = check_predictions();
+
+  /* Incremental fit on vectors drawn from the model */
+  if (status == ARM_MATH_SUCCESS)
+  {
+    arm_gaussian_naive_bayes_fit_init_f32(&SFit, VECTOR_DIMENSION, NB_OF_CLASSES, 0U,
+                                          fitCount, fitMean, fitM2);
+
+    for (i = 0; i < TRAINING_VECTORS; i++)
+    {
+      for (c = 0; c < NB_OF_CLASSES; c++)
+      {
+        draw_vector(c, &trainingVectors[c][i * VECTOR_DIMENSION]);
+        if (arm_gaussian_naive_bayes_fit_update_f32(&SFit, &trainingVectors[c][i * VECTOR_DIMENSION], c)
+            != ARM_MATH_SUCCESS)
+        {
+          status = ARM_MATH_TEST_FAILURE;
+        }
+      }
+    }
+
+    /* The learnt model replaces the random one */
+    arm_gaussian_naive_bayes_fit_export_f32(&SFit, sigma, classPriors);
+    S.theta = fitMean;
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    status = check_fit();
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    status = check_predictions();
+  }
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+#if defined (SEMIHOSTING)
+    printf("FAILURE\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+  else
+  {
+#if defined (SEMIHOSTING)
+    printf("SUCCESS\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+}
+
+ /** \endlink */
@@ -0,0 +1,268 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2026 ARM Limited. All rights reserved.
+*
+* $Date:         18. October 2026
+* $Revision:     V1.0.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_cfft_mixed_example_f32.c
+*
+* Description:   Example code comparing the accuracy of the mixed-radix
+*                and Bluestein complex FFT to the power of two CFFT.
+*
+* Target Processor: Cortex-M/Cortex-A
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup CFFTMixedExample Mixed-Radix CFFT Example
+ * \par Description:
+ * \par
+ * Compares the accuracy of the mixed-radix and Bluestein complex FFTs with the accuracy
+ * of the radix-8/4 complex FFT of a close power of two length.
+ * \par Algorithm:
+ * \par
+ * A pseudo-random complex signal is transformed by:
+ * - arm_cfft_f32() with a length of 1024,
+ * - arm_cfft_mixed_f32() with the mixed-radix lengths 1000 and 1200,
+ * - arm_cfft_mixed_f32() with the Bluestein algorithm and a length of 1000.
+ * \par
+ * Each result is compared to a double precision DFT of the same signal. The error is the
+ * rms of the difference divided by the rms of the DFT. The test succeeds when the error of
+ * the mixed-radix transforms is below MIXED_RATIO times the error of arm_cfft_f32() and the
+ * error of the Bluestein transform is below BLUESTEIN_RATIO times the error of arm_cfft_f32().
+ * \par
+ * The cycles of each transform can be compared by measuring the calls to arm_cfft_f32() and
+ * arm_cfft_mixed_f32() in this example with the cycle counter of the target.
+ * \par Variables Description:
+ * \par
+ * \li \c testInput points to the input signal
+ * \li \c testOutput points to the transformed signal
+ * \li \c dftOutput points to the double precision DFT
+ * \li \c bluesteinBuffer holds the chirp and the kernel spectrum of the Bluestein transform
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_cfft_init_f32()
+ * - arm_cfft_f32()
+ * - arm_cfft_mixed_init_f32()
+ * - arm_cfft_bluestein_get_buffer_size_f32()
+ * - arm_cfft_bluestein_init_f32()
+ * - arm_cfft_mixed_f32()
+ * <b> Refer  </b>
+ * \link arm_cfft_mixed_example_f32.c \endlink
+ */
+
+
+/** \example arm_cfft_mixed_example_f32.c
+  */
+
+#include <math.h>
+#include "arm_math.h"
+
+#if defined(SEMIHOSTING)
+#include <stdio.h>
+#endif
+
+/* ----------------------------------------------------------------------
+** Global defines for the simulation
+* ------------------------------------------------------------------- */
+
+#define MAX_LENGTH          1200
+#define POW2_LENGTH         1024
+#define BLUESTEIN_LENGTH    1000
+#define BLUESTEIN_BUFFER    (2 * BLUESTEIN_LENGTH + 2 * 2048)
+#define MIXED_RATIO         2.0
+#define BLUESTEIN_RATIO     5.0
+
+static const uint16_t mixedLengths[2] = { 1000, 1200 };
+
+/* ----------------------------------------------------------------------
+* Declare the signals and the buffers of the transforms
+* ------------------------------------------------------------------- */
+
+float32_t testInput[2 * MAX_LENGTH];
+float32_t testOutput[2 * MAX_LENGTH];
+float32_t tmpBuffer[2 * 2048];
+float32_t bluesteinBuffer[BLUESTEIN_BUFFER];
+float64_t dftOutput[2 * MAX_LENGTH];
+
+arm_cfft_instance_f32 cfftInstance;
+arm_cfft_mixed_instance_f32 mixedInstance;
+
+/* ----------------------------------------------------------------------
+* Pseudo-random values in [-0.5, 0.5]
+* ------------------------------------------------------------------- */
+
+static uint32_t randomState = 3U;
+
+static float32_t random_value(void)
+{
+  randomState = randomState * 1664525U + 1013904223U;
+  return ((float32_t) (randomState >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* New input signal, its double precision DFT and a copy in testOutput
+* ------------------------------------------------------------------- */
+
+static void prepare(uint32_t fftLen)
+{
+  float64_t re, im, angle;
+  uint32_t k, n;
+
+  for (n = 0; n < 2 * fftLen; n++)
+  {
+    testInput[n] = random_value();
+  }
+
+  for (k = 0; k < fftLen; k++)
+  {
+    re = 0.0;
+    im = 0.0;
+    for (n = 0; n < fftLen; n++)
+    {
+      angle = -2.0 * PI * (float64_t) ((k * n) % fftLen) / (float64_t) fftLen;
+      re += testInput[2 * n] * cos(angle) - testInput[2 * n + 1] * sin(angle);
+      im += testInput[2 * n] * sin(angle) + testInput[2 * n + 1] * cos(angle);
+    }
+    dftOutput[2 * k] = re;
+    dftOutput[2 * k + 1] = im;
+  }
+
+  memcpy(testOutput, testInput, 2 * fftLen * sizeof(float32_t));
+}
+
+/* ----------------------------------------------------------------------
+* Relative rms error of testOutput
+* ------------------------------------------------------------------- */
+
+static float64_t relative_error(uint32_t fftLen)
+{
+  float64_t err = 0.0, ref = 0.0, d;
+  uint32_t n;
+
+  for (n = 0; n < 2 * fftLen; n++)
+  {
+    d = testOutput[n] - dftOutput[n];
+    err += d * d;
+    ref += dftOutput[n] * dftOutput[n];
+  }
+
+  return (sqrt(err / ref));
+}
+
+/* ----------------------------------------------------------------------
+* Mixed-radix CFFT test
+* ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  float64_t pow2Error, err;
+  uint32_t i;
+
+  /* Radix-8/4 power of two CFFT */
+  if (arm_cfft_init_f32(&cfftInstance, POW2_LENGTH) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  prepare(POW2_LENGTH);
+  arm_cfft_f32(&cfftInstance, testOutput, 0, 1);
+  pow2Error = relative_error(POW2_LENGTH);
+
+#if defined(SEMIHOSTING)
+  printf("Radix-8/4 %u : relative error %g\n", (unsigned)POW2_LENGTH, pow2Error);
+#endif
+
+  /* Mixed-radix CFFT */
+  for (i = 0; i < 2; i++)
+  {
+    if (arm_cfft_mixed_init_f32(&mixedInstance, mixedLengths[i]) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+      continue;
+    }
+    prepare(mixedLengths[i]);
+    arm_cfft_mixed_f32(&mixedInstance, testOutput, 0, tmpBuffer);
+    err = relative_error(mixedLengths[i]);
+
+#if defined(SEMIHOSTING)
+    printf("Mixed-radix %u : relative error %g\n", (unsigned)mixedLengths[i], err);
+#endif
+
+    if (err > MIXED_RATIO * pow2Error)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  /* Bluestein CFFT */
+  if ((arm_cfft_bluestein_get_buffer_size_f32(BLUESTEIN_LENGTH) > BLUESTEIN_BUFFER)
+   || (arm_cfft_bluestein_init_f32(&mixedInstance, BLUESTEIN_LENGTH, bluesteinBuffer) != ARM_MATH_SUCCESS))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  else
+  {
+    prepare(BLUESTEIN_LENGTH);
+    arm_cfft_mixed_f32(&mixedInstance, testOutput, 0, tmpBuffer);
+    err = relative_error(BLUESTEIN_LENGTH);
+
+#if defined(SEMIHOSTING)
+    printf("Bluestein %u : relative error %g\n", (unsigned)BLUESTEIN_LENGTH, err);
+#endif
+
+    if (err > BLUESTEIN_RATIO * pow2Error)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+#if defined (SEMIHOSTING)
+    printf("FAILURE\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+  else
+  {
+#if defined (SEMIHOSTING)
+    printf("SUCCESS\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+}
+
+ /** \endlink */
@@ -0,0 +1,464 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2026 ARM Limited. All rights reserved.
+*
+* $Date:         18. October 2026
+* $Revision:     V1.0.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_f16_storage_example_f32.c
+*
+* Description:   Example code checking the accuracy of a spectrum
+*                computed with the storage f16 kernels against the
+*                f32 kernels.
+*
+* Target Processor: Cortex-M/Cortex-A
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup F16StorageExample Storage f16 Spectrum Example
+ * \par Description:
+ * \par
+ * Computes the magnitude spectrum of a signal with the f32 kernels and with the
+ * storage f16 kernels (f16s suffix). The f16s kernels keep the signal, window and
+ * spectrum buffers in half precision (float16s_t) and compute in single precision,
+ * so they are available on all the targets, with or without a native float16_t,
+ * and they divide by two the memory of those buffers.
+ * \par
+ * With ARM_MATH_F16_STORAGE (CMake option F16STORAGE) the native f16 kernels are
+ * not built and the f16s kernels are the only half precision kernels. On targets
+ * without a native float16_t, they are the fallback.
+ * \par Algorithm:
+ * \par
+ * The input signal of the \ref SignalConvergence "Signal Convergence Example" is split
+ * in frames of FFT_SIZE samples. Each frame is multiplied by a Hann window and the
+ * magnitude of its real FFT is computed by both pipelines. The inverse FFT of the half
+ * precision spectrum is also compared to the windowed frame.
+ * \par
+ * The test succeeds when the SNR of the half precision results, with the single
+ * precision results as reference, is above SNR_THRESHOLD for all the frames.
+ * \par
+ * The conversions and the element-wise kernels are also checked bit by bit:
+ * - all the 65536 half precision values are converted to single precision and compared
+ *   to a decoding written in the example, then converted back to the same value,
+ * - the rounding to the nearest even value, the overflow to infinity, the subnormal
+ *   values, the signed zeros and NaN are checked on chosen single precision values,
+ * - each f16s kernel is compared to the f32 kernel applied to the same half precision
+ *   inputs, with the f32 result rounded to half precision. The kernels compute in single
+ *   precision, so the results must be identical.
+ * \par Variables Description:
+ * \par
+ * \li \c testInput_f32 points to the input data
+ * \li \c window16 points to the Hann window in half precision
+ * \li \c spectrum16 points to the half precision spectrum of a frame
+ * \li \c tmp32 points to the single precision temporary buffer of the f16s real FFT
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_rfft_fast_init_f32()
+ * - arm_rfft_fast_f32()
+ * - arm_rfft_fast_f16s()
+ * - arm_mult_f32()
+ * - arm_mult_f16s()
+ * - arm_add_f32()
+ * - arm_add_f16s()
+ * - arm_scale_f32()
+ * - arm_scale_f16s()
+ * - arm_dot_prod_f32()
+ * - arm_dot_prod_f16s()
+ * - arm_cmplx_mag_f32()
+ * - arm_cmplx_mag_f16s()
+ * - arm_cmplx_mag_squared_f32()
+ * - arm_cmplx_mag_squared_f16s()
+ * - arm_cmplx_mult_cmplx_f32()
+ * - arm_cmplx_mult_cmplx_f16s()
+ * - arm_float_to_f16s()
+ * - arm_f16s_to_float()
+ * - arm_cos_f32()
+ * <b> Refer  </b>
+ * \link arm_f16_storage_example_f32.c \endlink
+ */
+
+
+/** \example arm_f16_storage_example_f32.c
+  */
+
+#include "arm_math.h"
+#include "math_helper.h"
+
+#if defined(SEMIHOSTING)
+#include <stdio.h>
+#endif
+
+/* ----------------------------------------------------------------------
+** Global defines for the simulation
+* ------------------------------------------------------------------- */
+
+#define TEST_LENGTH_SAMPLES 1536
+#define FFT_SIZE             512
+#define NUMFRAMES (TEST_LENGTH_SAMPLES / FFT_SIZE)
+
+/* Half precision has 11 significant bits (about 66 dB) */
+#define SNR_THRESHOLD        50.0f
+
+/* Length of the vectors of the kernel checks (complex samples for the complex kernels) */
+#define KERNEL_SIZE          256
+
+/* ----------------------------------------------------------------------
+* External Declarations (data of the Signal Convergence Example)
+* ------------------------------------------------------------------- */
+extern float32_t testInput_f32[TEST_LENGTH_SAMPLES];
+
+/* ----------------------------------------------------------------------
+* Single precision buffers
+* ------------------------------------------------------------------- */
+
+float32_t window32[FFT_SIZE];
+float32_t windowed32[FFT_SIZE];
+float32_t work32[FFT_SIZE];
+float32_t spectrum32[FFT_SIZE];
+float32_t mag32[FFT_SIZE / 2];
+
+/* ----------------------------------------------------------------------
+* Half precision buffers and the shared temporary buffer
+* ------------------------------------------------------------------- */
+
+float16s_t window16[FFT_SIZE];
+float16s_t frame16[FFT_SIZE];
+float16s_t spectrum16[FFT_SIZE];
+float16s_t mag16[FFT_SIZE / 2];
+float32_t tmp32[FFT_SIZE];
+
+/* Half precision results converted for the comparison */
+float32_t testOutput[FFT_SIZE];
+
+arm_rfft_fast_instance_f32 rfft_instance;
+
+/* ----------------------------------------------------------------------
+* Buffers of the kernel checks
+* ------------------------------------------------------------------- */
+
+float16s_t srcA16[2 * KERNEL_SIZE];
+float16s_t srcB16[2 * KERNEL_SIZE];
+float16s_t dst16[2 * KERNEL_SIZE];
+float16s_t ref16[2 * KERNEL_SIZE];
+float32_t srcA32[2 * KERNEL_SIZE];
+float32_t srcB32[2 * KERNEL_SIZE];
+float32_t dst32[2 * KERNEL_SIZE];
+
+/* ----------------------------------------------------------------------
+* Single precision value of a binary16 bit pattern, decoded field by field
+* ------------------------------------------------------------------- */
+
+static float32_t decode_f16(uint16_t h)
+{
+  int32_t e = (h >> 10) & 0x1F;
+  float32_t m = (float32_t) (h & 0x3FFU);
+  float32_t v;
+
+  if (e == 0x1F)
+  {
+    v = (m == 0.0f) ? INFINITY : NAN;
+  }
+  else if (e == 0)
+  {
+    v = ldexpf(m, -24);
+  }
+  else
+  {
+    v = ldexpf(m + 1024.0f, e - 25);
+  }
+
+  return ((h & 0x8000U) ? -v : v);
+}
+
+static uint32_t f32_bits(float32_t x)
+{
+  uint32_t u;
+
+  memcpy(&u, &x, sizeof(u));
+  return (u);
+}
+
+static int32_t is_nan_f16(uint16_t h)
+{
+  return (((h & 0x7C00U) == 0x7C00U) && ((h & 0x3FFU) != 0U));
+}
+
+/* ----------------------------------------------------------------------
+* All the binary16 values: decoding and round trip
+* ------------------------------------------------------------------- */
+
+static arm_status check_all_f16(void)
+{
+  float16s_t h, back;
+  float32_t x, ref;
+  uint32_t i;
+
+  for (i = 0; i < 65536U; i++)
+  {
+    h = (float16s_t) i;
+    arm_f16s_to_float(&h, &x, 1);
+    arm_float_to_f16s(&x, &back, 1);
+    ref = decode_f16(h);
+
+    if (isnan(ref))
+    {
+      if (!isnan(x) || !is_nan_f16(back))
+      {
+        return (ARM_MATH_TEST_FAILURE);
+      }
+    }
+    else if ((f32_bits(x) != f32_bits(ref)) || (back != h))
+    {
+      return (ARM_MATH_TEST_FAILURE);
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/* ----------------------------------------------------------------------
+* Rounding, overflow, subnormals, zeros and NaN of the f32 to f16s conversion
+* ------------------------------------------------------------------- */
+
+typedef struct
+{
+  float32_t x;
+  uint16_t  h;
+} f16_edge_case;
+
+static arm_status check_f16_edges(void)
+{
+  const f16_edge_case cases[] = {
+    { 1.0f,                       0x3C00U },
+    { 1.0f + 0x1.0p-11f,          0x3C00U },   /* tie, rounded to even */
+    { 1.0f + 0x3.0p-11f,          0x3C02U },   /* tie, rounded to even */
+    { 1.0f + 0x1.2p-11f,          0x3C01U },
+    { 65504.0f,                   0x7BFFU },   /* largest value */
+    { 65519.0f,                   0x7BFFU },
+    { 65520.0f,                   0x7C00U },   /* tie above the largest value */
+    { 1.0e6f,                     0x7C00U },
+    { -1.0e6f,                    0xFC00U },
+    { INFINITY,                   0x7C00U },
+    { -INFINITY,                  0xFC00U },
+    { 0x1.0p-14f,                 0x0400U },   /* smallest normal value */
+    { 0x1.0p-14f - 0x1.0p-24f,    0x03FFU },   /* largest subnormal value */
+    { 0x1.0p-24f,                 0x0001U },   /* smallest subnormal value */
+    { 0x1.0p-25f,                 0x0000U },   /* tie, rounded to even */
+    { 0x1.8p-24f,                 0x0002U },   /* tie, rounded to even */
+    { 0x1.004p-25f,               0x0001U },
+    { -0x1.0p-24f,                0x8001U },
+    { 1.0e-10f,                   0x0000U },
+    { -1.0e-10f,                  0x8000U },
+    { 0.0f,                       0x0000U },
+    { -0.0f,                      0x8000U }
+  };
+  float32_t x;
+  float16s_t h;
+  uint32_t i;
+
+  for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+  {
+    arm_float_to_f16s(&cases[i].x, &h, 1);
+    if (h != cases[i].h)
+    {
+#if defined(SEMIHOSTING)
+      printf("Conversion of %a : 0x%04X instead of 0x%04X\n",
+             (double)cases[i].x, (unsigned)h, (unsigned)cases[i].h);
+#endif
+      return (ARM_MATH_TEST_FAILURE);
+    }
+  }
+
+  x = NAN;
+  arm_float_to_f16s(&x, &h, 1);
+
+  return (is_nan_f16(h) ? ARM_MATH_SUCCESS : ARM_MATH_TEST_FAILURE);
+}
+
+/* ----------------------------------------------------------------------
+* f16s kernels against the f32 kernels rounded to half precision
+* ------------------------------------------------------------------- */
+
+static arm_status compare_f16s(uint32_t n)
+{
+  arm_float_to_f16s(dst32, ref16, n);
+
+  return ((memcmp(dst16, ref16, n * sizeof(float16s_t)) == 0) ? ARM_MATH_SUCCESS : ARM_MATH_TEST_FAILURE);
+}
+
+static arm_status check_kernels(void)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  float32_t dot16, dot32;
+
+  /* Half precision inputs and their exact single precision values */
+  arm_float_to_f16s(testInput_f32, srcA16, 2 * KERNEL_SIZE);
+  arm_float_to_f16s(testInput_f32 + 2 * KERNEL_SIZE, srcB16, 2 * KERNEL_SIZE);
+  arm_f16s_to_float(srcA16, srcA32, 2 * KERNEL_SIZE);
+  arm_f16s_to_float(srcB16, srcB32, 2 * KERNEL_SIZE);
+
+  arm_add_f16s(srcA16, srcB16, dst16, 2 * KERNEL_SIZE);
+  arm_add_f32(srcA32, srcB32, dst32, 2 * KERNEL_SIZE);
+  status |= compare_f16s(2 * KERNEL_SIZE);
+
+  arm_mult_f16s(srcA16, srcB16, dst16, 2 * KERNEL_SIZE);
+  arm_mult_f32(srcA32, srcB32, dst32, 2 * KERNEL_SIZE);
+  status |= compare_f16s(2 * KERNEL_SIZE);
+
+  arm_scale_f16s(srcA16, 0.3f, dst16, 2 * KERNEL_SIZE);
+  arm_scale_f32(srcA32, 0.3f, dst32, 2 * KERNEL_SIZE);
+  status |= compare_f16s(2 * KERNEL_SIZE);
+
+  arm_cmplx_mag_f16s(srcA16, dst16, KERNEL_SIZE);
+  arm_cmplx_mag_f32(srcA32, dst32, KERNEL_SIZE);
+  status |= compare_f16s(KERNEL_SIZE);
+
+  arm_cmplx_mag_squared_f16s(srcA16, dst16, KERNEL_SIZE);
+  arm_cmplx_mag_squared_f32(srcA32, dst32, KERNEL_SIZE);
+  status |= compare_f16s(KERNEL_SIZE);
+
+  arm_cmplx_mult_cmplx_f16s(srcA16, srcB16, dst16, KERNEL_SIZE);
+  arm_cmplx_mult_cmplx_f32(srcA32, srcB32, dst32, KERNEL_SIZE);
+  status |= compare_f16s(2 * KERNEL_SIZE);
+
+  /* The dot product is returned in single precision */
+  arm_dot_prod_f16s(srcA16, srcB16, 2 * KERNEL_SIZE, &dot16);
+  arm_dot_prod_f32(srcA32, srcB32, 2 * KERNEL_SIZE, &dot32);
+  if (f32_bits(dot16) != f32_bits(dot32))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  return ((status == ARM_MATH_SUCCESS) ? ARM_MATH_SUCCESS : ARM_MATH_TEST_FAILURE);
+}
+
+/* ----------------------------------------------------------------------
+* Storage f16 spectrum test
+* ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  float32_t snrMag, snrInverse;
+  uint32_t i, frame;
+
+  if (arm_rfft_fast_init_f32(&rfft_instance, FFT_SIZE) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Bit exact checks of the conversions and of the kernels */
+  if ((status == ARM_MATH_SUCCESS) && (check_all_f16() != ARM_MATH_SUCCESS))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  if ((status == ARM_MATH_SUCCESS) && (check_f16_edges() != ARM_MATH_SUCCESS))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  if ((status == ARM_MATH_SUCCESS) && (check_kernels() != ARM_MATH_SUCCESS))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+#if defined(SEMIHOSTING)
+  printf("Conversions and kernels : %s\n", (status == ARM_MATH_SUCCESS) ? "bit exact" : "mismatch");
+#endif
+
+  /* Hann window */
+  for (i = 0; i < FFT_SIZE; i++)
+  {
+    window32[i] = 0.5f - 0.5f * arm_cos_f32(2.0f * PI * (float32_t)i / FFT_SIZE);
+  }
+  arm_float_to_f16s(window32, window16, FFT_SIZE);
+
+  for (frame = 0; (frame < NUMFRAMES) && (status == ARM_MATH_SUCCESS); frame++)
+  {
+    const float32_t *pInput = testInput_f32 + frame * FFT_SIZE;
+
+    /* Single precision reference: the source of arm_rfft_fast_f32 is modified */
+    arm_mult_f32(pInput, window32, windowed32, FFT_SIZE);
+    memcpy(work32, windowed32, sizeof(work32));
+    arm_rfft_fast_f32(&rfft_instance, work32, spectrum32, 0);
+    arm_cmplx_mag_f32(spectrum32, mag32, FFT_SIZE / 2);
+
+    /* Half precision pipeline */
+    arm_float_to_f16s(pInput, frame16, FFT_SIZE);
+    arm_mult_f16s(frame16, window16, frame16, FFT_SIZE);
+    arm_rfft_fast_f16s(&rfft_instance, frame16, spectrum16, tmp32, 0);
+    arm_cmplx_mag_f16s(spectrum16, mag16, FFT_SIZE / 2);
+
+    arm_f16s_to_float(mag16, testOutput, FFT_SIZE / 2);
+    snrMag = arm_snr_f32(mag32, testOutput, FFT_SIZE / 2);
+
+    /* Inverse transform of the half precision spectrum */
+    arm_rfft_fast_f16s(&rfft_instance, spectrum16, frame16, tmp32, 1);
+    arm_f16s_to_float(frame16, testOutput, FFT_SIZE);
+    snrInverse = arm_snr_f32(windowed32, testOutput, FFT_SIZE);
+
+#if defined(SEMIHOSTING)
+    printf("Frame %u : magnitude SNR %.1f dB, inverse FFT SNR %.1f dB\n",
+           (unsigned)frame, (double)snrMag, (double)snrInverse);
+#endif
+
+    if ((snrMag < SNR_THRESHOLD) || (snrInverse < SNR_THRESHOLD))
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+#if defined(SEMIHOSTING)
+  printf("Signal, window and spectrum buffers : %u bytes in f32, %u bytes in f16s\n",
+         (unsigned)(sizeof(windowed32) + sizeof(window32) + sizeof(spectrum32)),
+         (unsigned)(sizeof(frame16) + sizeof(window16) + sizeof(spectrum16)));
+#endif
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+#if defined (SEMIHOSTING)
+    printf("FAILURE\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+  else
+  {
+#if defined (SEMIHOSTING)
+    printf("SUCCESS\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+}
+
+ /** \endlink */
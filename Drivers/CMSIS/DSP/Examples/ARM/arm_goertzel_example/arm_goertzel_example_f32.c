@@ -0,0 +1,343 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2026 ARM Limited. All rights reserved.
+*
+* $Date:         18. October 2026
+* $Revision:     V1.0.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_goertzel_example_f32.c
+*
+* Description:   Example code comparing the Goertzel bank with the real FFT:
+*                results and crossover of the processing time.
+*
+* Target Processor: Cortex-M/Cortex-A
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup GoertzelExample Goertzel Bank Example
+ * \par Description:
+ * \par
+ * Compares the Goertzel bank with the real FFT when only a few bins of the spectrum
+ * are needed, and measures the number of bins above which the real FFT is faster.
+ * \par Algorithm:
+ * \par
+ * The input is a sum of harmonics and of a small pseudo-random noise. A frame of
+ * FFT_LENGTH samples is processed by:
+ * - arm_rfft_fast_f32() which computes all the bins,
+ * - arm_goertzel_f32() tracking up to MAX_BINS harmonics on the DFT grid,
+ * - arm_goertzel_f32() tracking a frequency which is not on the DFT grid.
+ * \par
+ * The test succeeds when:
+ * - the Goertzel bins on the grid are within BIN_TOLERANCE of the FFT bins, relative to the
+ *   largest magnitude,
+ * - the bin out of the grid, multiplied by <code>exp(-j*w*FFT_LENGTH)</code>, is within
+ *   BIN_TOLERANCE of a double precision DFT. This checks the phase convention of the
+ *   Goertzel bank which is referenced to the sample following the frame.
+ * \par
+ * When SEMIHOSTING is defined, the processing times of a frame by arm_rfft_fast_f32() and
+ * by arm_goertzel_f32() for 1 to MAX_BINS bins are measured with clock() over NB_FRAMES frames.
+ * The smallest number of bins for which the Goertzel bank is slower than the FFT is printed.
+ * The timing is only printed: it depends on the core, the memory wait states and the
+ * resolution of clock() on the target.
+ * \par Variables Description:
+ * \par
+ * \li \c testInput points to the input signal
+ * \li \c fftOutput points to the output of the real FFT
+ * \li \c goertzelOutput points to the output of the Goertzel bank
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_rfft_fast_init_f32()
+ * - arm_rfft_fast_f32()
+ * - arm_goertzel_init_f32()
+ * - arm_goertzel_f32()
+ * <b> Refer  </b>
+ * \link arm_goertzel_example_f32.c \endlink
+ */
+
+
+/** \example arm_goertzel_example_f32.c
+  */
+
+#include "arm_math.h"
+
+#if defined(SEMIHOSTING)
+#include <stdio.h>
+#include <time.h>
+#endif
+
+/* ----------------------------------------------------------------------
+** Global defines for the simulation
+* ------------------------------------------------------------------- */
+
+#define FFT_LENGTH          1024
+#define MAX_BINS              16
+#define HARMONIC_SPACING      20
+#define OFF_GRID_FREQ    0.1237f
+#define BIN_TOLERANCE     5.0e-4f
+#define NB_FRAMES            200
+
+/* ----------------------------------------------------------------------
+* Declare the signals, the buffers of the Goertzel bank and the FFT instance
+* ------------------------------------------------------------------- */
+
+float32_t testInput[FFT_LENGTH];
+float32_t fftInput[FFT_LENGTH];
+float32_t fftOutput[FFT_LENGTH];
+float32_t goertzelOutput[2 * MAX_BINS];
+
+float32_t binFreqs[MAX_BINS];
+float32_t goertzelCoeffs[3 * MAX_BINS];
+float32_t goertzelState[2 * MAX_BINS];
+
+arm_rfft_fast_instance_f32 rfftInstance;
+arm_goertzel_instance_f32 goertzelInstance;
+
+/* ----------------------------------------------------------------------
+* Pseudo-random values in [-0.5, 0.5]
+* ------------------------------------------------------------------- */
+
+static uint32_t randomState = 7U;
+
+static float32_t random_value(void)
+{
+  randomState = randomState * 1664525U + 1013904223U;
+  return ((float32_t) (randomState >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Goertzel bins on the grid compared to the real FFT
+* ------------------------------------------------------------------- */
+
+static arm_status check_grid_bins(void)
+{
+  float32_t maxMag = 0.0f, maxErr = 0.0f, re, im, err;
+  uint32_t i, k;
+
+  /* The real FFT works in place on its input */
+  memcpy(fftInput, testInput, sizeof(fftInput));
+  arm_rfft_fast_f32(&rfftInstance, fftInput, fftOutput, 0);
+
+  for (i = 0; i < MAX_BINS; i++)
+  {
+    binFreqs[i] = (float32_t) ((i + 1) * HARMONIC_SPACING) / (float32_t) FFT_LENGTH;
+  }
+  arm_goertzel_init_f32(&goertzelInstance, MAX_BINS, FFT_LENGTH, binFreqs, goertzelCoeffs, goertzelState);
+
+  if (arm_goertzel_f32(&goertzelInstance, testInput, FFT_LENGTH, goertzelOutput) != 1U)
+  {
+    return (ARM_MATH_TEST_FAILURE);
+  }
+
+  for (i = 0; i < MAX_BINS; i++)
+  {
+    k = (i + 1) * HARMONIC_SPACING;
+    re = fftOutput[2 * k];
+    im = fftOutput[2 * k + 1];
+    maxMag = fmaxf(maxMag, sqrtf(re * re + im * im));
+
+    err = fmaxf(fabsf(goertzelOutput[2 * i] - re), fabsf(goertzelOutput[2 * i + 1] - im));
+    maxErr = fmaxf(maxErr, err);
+  }
+
+#if defined(SEMIHOSTING)
+  printf("Bins on the grid : max error %g (largest magnitude %g)\n", (double)maxErr, (double)maxMag);
+#endif
+
+  return ((maxErr <= BIN_TOLERANCE * maxMag) ? ARM_MATH_SUCCESS : ARM_MATH_TEST_FAILURE);
+}
+
+/* ----------------------------------------------------------------------
+* Goertzel bin out of the grid compared to a double precision DFT
+* ------------------------------------------------------------------- */
+
+static arm_status check_off_grid_bin(void)
+{
+  float64_t w, angle, re = 0.0, im = 0.0, gRe, gIm, err;
+  uint32_t n;
+
+  binFreqs[0] = OFF_GRID_FREQ;
+  arm_goertzel_init_f32(&goertzelInstance, 1, FFT_LENGTH, binFreqs, goertzelCoeffs, goertzelState);
+  arm_goertzel_f32(&goertzelInstance, testInput, FFT_LENGTH, goertzelOutput);
+
+  w = 2.0 * PI * (float64_t) OFF_GRID_FREQ;
+  for (n = 0; n < FFT_LENGTH; n++)
+  {
+    re += testInput[n] * cos(w * n);
+    im -= testInput[n] * sin(w * n);
+  }
+
+  /* Phase of the Goertzel output referenced to the first sample of the frame */
+  angle = -w * FFT_LENGTH;
+  gRe = goertzelOutput[0] * cos(angle) - goertzelOutput[1] * sin(angle);
+  gIm = goertzelOutput[0] * sin(angle) + goertzelOutput[1] * cos(angle);
+
+  err = sqrt((gRe - re) * (gRe - re) + (gIm - im) * (gIm - im)) / sqrt(re * re + im * im);
+
+#if defined(SEMIHOSTING)
+  printf("Bin out of the grid : relative error %g\n", (double)err);
+#endif
+
+  return ((err <= BIN_TOLERANCE) ? ARM_MATH_SUCCESS : ARM_MATH_TEST_FAILURE);
+}
+
+#if defined(SEMIHOSTING)
+/* ----------------------------------------------------------------------
+* Processing time of a frame, in microseconds
+* ------------------------------------------------------------------- */
+
+static float64_t rfft_time(void)
+{
+  clock_t start;
+  uint32_t i;
+
+  start = clock();
+  for (i = 0; i < NB_FRAMES; i++)
+  {
+    memcpy(fftInput, testInput, sizeof(fftInput));
+    arm_rfft_fast_f32(&rfftInstance, fftInput, fftOutput, 0);
+  }
+
+  return ((float64_t) (clock() - start) * 1.0e6 / CLOCKS_PER_SEC / NB_FRAMES);
+}
+
+static float64_t goertzel_time(uint16_t numBins)
+{
+  clock_t start;
+  uint32_t i;
+
+  arm_goertzel_init_f32(&goertzelInstance, numBins, FFT_LENGTH, binFreqs, goertzelCoeffs, goertzelState);
+
+  start = clock();
+  for (i = 0; i < NB_FRAMES; i++)
+  {
+    arm_goertzel_f32(&goertzelInstance, testInput, FFT_LENGTH, goertzelOutput);
+  }
+
+  return ((float64_t) (clock() - start) * 1.0e6 / CLOCKS_PER_SEC / NB_FRAMES);
+}
+
+/* ----------------------------------------------------------------------
+* Number of bins above which the real FFT is faster
+* ------------------------------------------------------------------- */
+
+static void crossover(void)
+{
+  float64_t fftTime, binTime;
+  uint16_t numBins, cross = 0;
+
+  for (numBins = 0; numBins < MAX_BINS; numBins++)
+  {
+    binFreqs[numBins] = (float32_t) ((numBins + 1) * HARMONIC_SPACING) / (float32_t) FFT_LENGTH;
+  }
+
+  fftTime = rfft_time();
+  printf("arm_rfft_fast_f32 %d : %.2f us per frame\n", FFT_LENGTH, fftTime);
+
+  for (numBins = 1; numBins <= MAX_BINS; numBins++)
+  {
+    binTime = goertzel_time(numBins);
+    printf("arm_goertzel_f32 %2d bins : %.2f us per frame\n", numBins, binTime);
+    if ((cross == 0) && (binTime > fftTime))
+    {
+      cross = numBins;
+    }
+  }
+
+  if (cross != 0)
+  {
+    printf("The real FFT is faster from %d bins\n", cross);
+  }
+  else
+  {
+    printf("The Goertzel bank is faster up to %d bins\n", MAX_BINS);
+  }
+}
+#endif
+
+/* ----------------------------------------------------------------------
+* Goertzel bank test
+* ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  arm_status status;
+  uint32_t i, h;
+
+  /* Harmonics on the grid, a tone out of the grid and noise */
+  for (i = 0; i < FFT_LENGTH; i++)
+  {
+    testInput[i] = 0.01f * random_value() + 0.2f * arm_sin_f32(2.0f * PI * OFF_GRID_FREQ * i);
+    for (h = 1; h <= MAX_BINS; h += 3)
+    {
+      testInput[i] += arm_cos_f32(2.0f * PI * (float32_t) ((h * HARMONIC_SPACING * i) % FFT_LENGTH) / FFT_LENGTH + h) / h;
+    }
+  }
+
+  status = arm_rfft_fast_init_f32(&rfftInstance, FFT_LENGTH);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    status = check_grid_bins();
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    status = check_off_grid_bin();
+  }
+
+#if defined(SEMIHOSTING)
+  if (status == ARM_MATH_SUCCESS)
+  {
+    crossover();
+  }
+#endif
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+#if defined (SEMIHOSTING)
+    printf("FAILURE\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+  else
+  {
+#if defined (SEMIHOSTING)
+    printf("SUCCESS\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+}
+
+ /** \endlink */
@@ -0,0 +1,263 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2026 ARM Limited. All rights reserved.
+*
+* $Date:         18. October 2026
+* $Revision:     V1.0.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_pid_bank_example_f32.c
+*
+* Description:   Example code checking the batched PID controllers
+*                against arm_pid_f32.
+*
+* Target Processor: Cortex-M/Cortex-A
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup PIDBankExample Batched PID Controllers Example
+ * \par Description:
+ * \par
+ * Checks that a bank of PID controllers gives the same outputs as arm_pid_f32() when the
+ * setpoint weights are 1, the derivative filter is disabled and the output limits are
+ * never reached.
+ * \par Algorithm:
+ * \par
+ * NUM_CONTROLLERS controllers with different gains are run by arm_pid_bank_f32() and, in
+ * parallel, by one arm_pid_f32() instance each. Each controller receives its own
+ * pseudo-random setpoint and measurement sequences. arm_pid_f32() is fed with the error
+ * <code>setpoint - measurement</code>, as the bank computes it.
+ * \par
+ * arm_pid_f32() uses the difference equation form of the controller while the bank keeps
+ * the integral term in its state, so the outputs are only equal up to rounding. The test
+ * succeeds when, at each step, the outputs agree within TOLERANCE relative to the largest
+ * output of the run.
+ * \par
+ * The bank is then reset and run again with limits on the outputs of half the controllers:
+ * their outputs must stay between the limits.
+ * \par Variables Description:
+ * \par
+ * \li \c pidBankCoeffs holds the gains, setpoint weights, filter coefficients and limits of the bank
+ * \li \c pidBankState holds the state of the bank
+ * \li \c pidInstances are the arm_pid_f32() instances with the same gains
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_pid_bank_init_f32()
+ * - arm_pid_bank_reset_f32()
+ * - arm_pid_bank_f32()
+ * - arm_pid_init_f32()
+ * - arm_pid_f32()
+ * <b> Refer  </b>
+ * \link arm_pid_bank_example_f32.c \endlink
+ */
+
+
+/** \example arm_pid_bank_example_f32.c
+  */
+
+#include "arm_math.h"
+
+#if defined(SEMIHOSTING)
+#include <stdio.h>
+#endif
+
+/* ----------------------------------------------------------------------
+** Global defines for the simulation
+* ------------------------------------------------------------------- */
+
+#define NUM_CONTROLLERS  5
+#define NUM_STEPS        1000
+#define LIMIT            2.0f
+#define TOLERANCE        1.0e-5f
+
+/* ----------------------------------------------------------------------
+* Gains of the controllers
+* ------------------------------------------------------------------- */
+
+static const float32_t Kp[NUM_CONTROLLERS] = { 1.0f, 0.5f, 2.0f, 0.1f, 0.8f };
+static const float32_t Ki[NUM_CONTROLLERS] = { 0.01f, 0.1f, 0.0f, 0.05f, 0.002f };
+static const float32_t Kd[NUM_CONTROLLERS] = { 0.0f, 0.2f, 0.5f, 1.0f, 0.05f };
+
+/* ----------------------------------------------------------------------
+* Declare the bank, the arm_pid_f32 instances and the outputs
+* ------------------------------------------------------------------- */
+
+float32_t pidBankCoeffs[8 * NUM_CONTROLLERS];
+float32_t pidBankState[3 * NUM_CONTROLLERS];
+arm_pid_bank_instance_f32 pidBank;
+
+arm_pid_instance_f32 pidInstances[NUM_CONTROLLERS];
+
+float32_t setpoints[NUM_CONTROLLERS];
+float32_t measures[NUM_CONTROLLERS];
+float32_t bankOutputs[NUM_STEPS][NUM_CONTROLLERS];
+float32_t refOutputs[NUM_STEPS][NUM_CONTROLLERS];
+
+/* ----------------------------------------------------------------------
+* Pseudo-random values in [-1, 1]
+* ------------------------------------------------------------------- */
+
+static uint32_t randomState = 1U;
+
+static float32_t random_value(void)
+{
+  randomState = randomState * 1664525U + 1013904223U;
+  return ((float32_t) (randomState >> 8) / 8388608.0f) - 1.0f;
+}
+
+/* ----------------------------------------------------------------------
+* Set the coefficients of the bank. Half of the controllers have output
+* limits when limited is not 0.
+* ------------------------------------------------------------------- */
+
+static void set_bank_coeffs(uint32_t limited)
+{
+  uint32_t i;
+
+  for (i = 0; i < NUM_CONTROLLERS; i++)
+  {
+    pidBankCoeffs[0 * NUM_CONTROLLERS + i] = Kp[i];
+    pidBankCoeffs[1 * NUM_CONTROLLERS + i] = Ki[i];
+    pidBankCoeffs[2 * NUM_CONTROLLERS + i] = Kd[i];
+    pidBankCoeffs[3 * NUM_CONTROLLERS + i] = 1.0f;
+    pidBankCoeffs[4 * NUM_CONTROLLERS + i] = 1.0f;
+    pidBankCoeffs[5 * NUM_CONTROLLERS + i] = 0.0f;
+    pidBankCoeffs[6 * NUM_CONTROLLERS + i] = ((limited != 0U) && (i & 1U)) ? -LIMIT : -1.0e30f;
+    pidBankCoeffs[7 * NUM_CONTROLLERS + i] = ((limited != 0U) && (i & 1U)) ? LIMIT : 1.0e30f;
+  }
+}
+
+/* ----------------------------------------------------------------------
+* PID bank test
+* ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  float32_t maxOutput = 0.0f, maxError = 0.0f, err;
+  uint32_t i, n;
+
+  /* Bank without limits and arm_pid_f32 instances with the same gains */
+  set_bank_coeffs(0U);
+  arm_pid_bank_init_f32(&pidBank, NUM_CONTROLLERS, pidBankCoeffs, pidBankState);
+
+  for (i = 0; i < NUM_CONTROLLERS; i++)
+  {
+    pidInstances[i].Kp = Kp[i];
+    pidInstances[i].Ki = Ki[i];
+    pidInstances[i].Kd = Kd[i];
+    arm_pid_init_f32(&pidInstances[i], 1);
+  }
+
+  for (n = 0; n < NUM_STEPS; n++)
+  {
+    for (i = 0; i < NUM_CONTROLLERS; i++)
+    {
+      setpoints[i] = random_value();
+      measures[i] = random_value();
+      refOutputs[n][i] = arm_pid_f32(&pidInstances[i], setpoints[i] - measures[i]);
+    }
+
+    arm_pid_bank_f32(&pidBank, setpoints, measures, bankOutputs[n]);
+  }
+
+  for (n = 0; n < NUM_STEPS; n++)
+  {
+    for (i = 0; i < NUM_CONTROLLERS; i++)
+    {
+      err = fabsf(refOutputs[n][i]);
+      maxOutput = (err > maxOutput) ? err : maxOutput;
+    }
+  }
+
+  for (n = 0; n < NUM_STEPS; n++)
+  {
+    for (i = 0; i < NUM_CONTROLLERS; i++)
+    {
+      err = fabsf(bankOutputs[n][i] - refOutputs[n][i]);
+      maxError = (err > maxError) ? err : maxError;
+    }
+  }
+
+#if defined(SEMIHOSTING)
+  printf("Largest difference with arm_pid_f32 : %g (largest output %g)\n",
+         (double)maxError, (double)maxOutput);
+#endif
+
+  if (maxError > TOLERANCE * maxOutput)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  /* Same sequences with limits on half of the controllers */
+  set_bank_coeffs(1U);
+  arm_pid_bank_reset_f32(&pidBank);
+  randomState = 1U;
+
+  for (n = 0; n < NUM_STEPS; n++)
+  {
+    for (i = 0; i < NUM_CONTROLLERS; i++)
+    {
+      setpoints[i] = random_value();
+      measures[i] = random_value();
+    }
+
+    arm_pid_bank_f32(&pidBank, setpoints, measures, bankOutputs[n]);
+
+    for (i = 1; i < NUM_CONTROLLERS; i += 2)
+    {
+      if ((bankOutputs[n][i] > LIMIT) || (bankOutputs[n][i] < -LIMIT))
+      {
+        status = ARM_MATH_TEST_FAILURE;
+      }
+    }
+  }
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+#if defined (SEMIHOSTING)
+    printf("FAILURE\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+  else
+  {
+#if defined (SEMIHOSTING)
+    printf("SUCCESS\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+}
+
+ /** \endlink */
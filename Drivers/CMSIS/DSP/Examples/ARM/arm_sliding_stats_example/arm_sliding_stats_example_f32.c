@@ -0,0 +1,266 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2026 ARM Limited. All rights reserved.
+*
+* $Date:         18. October 2026
+* $Revision:     V1.0.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_sliding_stats_example_f32.c
+*
+* Description:   Example code checking the sliding window statistics
+*                against the batch statistics functions over long runs.
+*
+* Target Processor: Cortex-M/Cortex-A
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup SlidingStatsExample Sliding Window Statistics Example
+ * \par Description:
+ * \par
+ * Checks the numerical stability of the floating-point sliding window statistics over
+ * long runs. After each new sample, the statistics of the window are compared to the ones
+ * computed by the batch functions on the same window.
+ * \par Algorithm:
+ * \par
+ * The input is a long pseudo-random noise of small amplitude added to a level which
+ * changes by large steps (+1000, -1750, +750, then alternating +1000 and -1000) and to
+ * short bursts of large amplitude. When the window leaves a step or a burst, the variance
+ * of the window drops by several orders of magnitude: this is where the rounding errors
+ * of a sliding update would show.
+ * \par
+ * The test is run for two window sizes. It succeeds when, for all the windows:
+ * - the mean is within MEAN_TOLERANCE times the rms of the window of arm_mean_f32(),
+ * - the variance is within VAR_TOLERANCE (relative) of arm_var_f32(). The variance does
+ *   not depend on the level of the signal, so arm_var_f32() is computed on the window minus
+ *   its first sample: its sum would otherwise lose the low bits of the samples far from zero,
+ * - the rms is within RMS_TOLERANCE (relative) of arm_rms_f32(),
+ * - the minimum and maximum are the ones of arm_min_f32() and arm_max_f32().
+ * \par Variables Description:
+ * \par
+ * \li \c testInput points to the input signal
+ * \li \c slidingHistory points to the history of the sliding window statistics
+ * \li \c slidingQueue points to the minimum and maximum queues
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_sliding_stats_init_f32()
+ * - arm_sliding_stats_f32()
+ * - arm_sliding_stats_get_f32()
+ * - arm_mean_f32()
+ * - arm_offset_f32()
+ * - arm_var_f32()
+ * - arm_rms_f32()
+ * - arm_min_f32()
+ * - arm_max_f32()
+ * <b> Refer  </b>
+ * \link arm_sliding_stats_example_f32.c \endlink
+ */
+
+
+/** \example arm_sliding_stats_example_f32.c
+  */
+
+#include "arm_math.h"
+
+#if defined(SEMIHOSTING)
+#include <stdio.h>
+#endif
+
+/* ----------------------------------------------------------------------
+** Global defines for the simulation
+* ------------------------------------------------------------------- */
+
+#define TEST_LENGTH_SAMPLES 200000
+#define MAX_WINDOW_SIZE        250
+#define NOISE_AMPLITUDE       0.5f
+#define BURST_AMPLITUDE     100.0f
+#define BURST_LENGTH            40
+#define BURST_PERIOD         13001
+#define MEAN_TOLERANCE      1.0e-5f
+#define VAR_TOLERANCE       1.0e-3f
+#define RMS_TOLERANCE       5.0e-5f
+
+static const uint32_t windowSizes[2] = { 64, MAX_WINDOW_SIZE };
+
+/* ----------------------------------------------------------------------
+* Declare the input, the buffers of the sliding window statistics
+* and the window minus its first sample
+* ------------------------------------------------------------------- */
+
+float32_t testInput[TEST_LENGTH_SAMPLES];
+
+float32_t shiftedWindow[MAX_WINDOW_SIZE];
+
+float32_t slidingHistory[MAX_WINDOW_SIZE];
+uint32_t slidingQueue[2 * MAX_WINDOW_SIZE];
+arm_sliding_stats_instance_f32 sliding_instance;
+
+/* Largest errors of the run */
+float32_t maxMeanError, maxVarError, maxRmsError;
+
+/* ----------------------------------------------------------------------
+* Pseudo-random noise in [-0.5, 0.5]
+* ------------------------------------------------------------------- */
+
+static uint32_t noiseState = 12345U;
+
+static float32_t noise(void)
+{
+  noiseState = noiseState * 1664525U + 1013904223U;
+  return ((float32_t) (noiseState >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Level of the signal: large steps
+* ------------------------------------------------------------------- */
+
+static float32_t level(uint32_t i)
+{
+  if (i < TEST_LENGTH_SAMPLES / 4)
+  {
+    return 0.0f;
+  }
+  if (i < TEST_LENGTH_SAMPLES / 2)
+  {
+    return 1000.0f;
+  }
+  if (i < 3 * (TEST_LENGTH_SAMPLES / 4))
+  {
+    return -750.0f;
+  }
+  return ((i / 7919U) & 1U) ? 1000.0f : 0.0f;
+}
+
+/* ----------------------------------------------------------------------
+* Run the sliding window statistics for a window size
+* ------------------------------------------------------------------- */
+
+static arm_status run_sliding_stats(uint32_t windowSize)
+{
+  arm_sliding_stats_result_f32 result;
+  const float32_t *pWindow;
+  float32_t mean, var, rms, minValue, maxValue, err;
+  uint32_t i, index;
+
+  arm_sliding_stats_init_f32(&sliding_instance, windowSize, slidingHistory, slidingQueue);
+
+  for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+  {
+    arm_sliding_stats_f32(&sliding_instance, &testInput[i], 1);
+
+    if (i + 1 < windowSize)
+    {
+      continue;
+    }
+
+    /* Batch statistics of the same window */
+    arm_sliding_stats_get_f32(&sliding_instance, &result);
+    pWindow = &testInput[i + 1 - windowSize];
+    arm_mean_f32(pWindow, windowSize, &mean);
+    arm_offset_f32(pWindow, -pWindow[0], shiftedWindow, windowSize);
+    arm_var_f32(shiftedWindow, windowSize, &var);
+    arm_rms_f32(pWindow, windowSize, &rms);
+    arm_min_f32(pWindow, windowSize, &minValue, &index);
+    arm_max_f32(pWindow, windowSize, &maxValue, &index);
+
+    err = fabsf(result.mean - mean) / rms;
+    maxMeanError = (err > maxMeanError) ? err : maxMeanError;
+    err = fabsf(result.var - var) / var;
+    maxVarError = (err > maxVarError) ? err : maxVarError;
+    err = fabsf(result.rms - rms) / rms;
+    maxRmsError = (err > maxRmsError) ? err : maxRmsError;
+
+    if ((result.min != minValue) || (result.max != maxValue))
+    {
+      return (ARM_MATH_TEST_FAILURE);
+    }
+  }
+
+#if defined(SEMIHOSTING)
+  printf("Window %u : max errors mean %g, variance %g, rms %g\n", (unsigned)windowSize,
+         (double)maxMeanError, (double)maxVarError, (double)maxRmsError);
+#endif
+
+  if ((maxMeanError > MEAN_TOLERANCE) || (maxVarError > VAR_TOLERANCE) || (maxRmsError > RMS_TOLERANCE))
+  {
+    return (ARM_MATH_TEST_FAILURE);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/* ----------------------------------------------------------------------
+* Sliding window statistics test
+* ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  uint32_t i;
+
+  /* Noise on large level steps, with bursts of large amplitude */
+  for (i = 0; i < TEST_LENGTH_SAMPLES; i++)
+  {
+    testInput[i] = level(i) + NOISE_AMPLITUDE * noise();
+    if ((i % BURST_PERIOD) < BURST_LENGTH)
+    {
+      testInput[i] += BURST_AMPLITUDE * noise();
+    }
+  }
+
+  for (i = 0; (i < 2) && (status == ARM_MATH_SUCCESS); i++)
+  {
+    maxMeanError = 0.0f;
+    maxVarError = 0.0f;
+    maxRmsError = 0.0f;
+    status = run_sliding_stats(windowSizes[i]);
+  }
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+#if defined (SEMIHOSTING)
+    printf("FAILURE\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+  else
+  {
+#if defined (SEMIHOSTING)
+    printf("SUCCESS\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+}
+
+ /** \endlink */
@@ -140,6 +140,15 @@
    * This is only valid for scalar. When vector architecture is
    * supporting f16 then it can't be disabled.
    *
+   * - ARM_MATH_F16_STORAGE:
+   *
+   * Select the storage f16 mode: the native float16_t kernels are not built
+   * even when __fp16 is supported, and half precision buffers are processed
+   * by the f16s kernels (float16s_t data, single precision arithmetic).
+   * The f16s kernels are always built, so they are also the fallback on
+   * targets without a native float16_t (Cortex-M33, host).
+   * Like DISABLEFLOAT16, it can't disable the Helium f16 kernels.
+   *
    * - ARM_MATH_AUTOVECTORIZE:
    *
    * With Helium or Neon, disable the use of vectorized code with C intrinsics
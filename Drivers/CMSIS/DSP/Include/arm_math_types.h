@@ -67,16 +67,19 @@ extern "C"
 #define __STATIC_FORCEINLINE static __forceinline
 #define __STATIC_INLINE static __inline
 #define __ALIGNED(x) __declspec(align(x))
+#define __RESTRICT __restrict
 #elif defined ( __APPLE_CC__ )
 #include <stdint.h>
 #define  __ALIGNED(x) __attribute__((aligned(x)))
 #define __STATIC_FORCEINLINE static inline __attribute__((always_inline)) 
 #define __STATIC_INLINE static inline
+#define __RESTRICT __restrict
 #elif defined (__GNUC_PYTHON__)
 #include <stdint.h>
 #define  __ALIGNED(x) __attribute__((aligned(x)))
 #define __STATIC_FORCEINLINE static inline __attribute__((always_inline)) 
 #define __STATIC_INLINE static inline
+#define __RESTRICT __restrict
 
 #else
 #include "cmsis_compiler.h"
@@ -308,6 +311,12 @@ extern "C"
    */
   typedef double float64_t;
 
+  /**
+   * @brief IEEE binary16 value stored in a 16-bit integer.
+   * Data type of the f16s kernels, which are available on all targets.
+   */
+  typedef uint16_t float16s_t;
+
   /**
    * @brief vector types
    */
@@ -605,7 +614,8 @@ extern "C"
     ARM_MATH_NANINF                  = -4,        /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR                = -5,        /**< Input matrix is singular and cannot be inverted */
     ARM_MATH_TEST_FAILURE            = -6,        /**< Test Failed */
-    ARM_MATH_DECOMPOSITION_FAILURE   = -7         /**< Decomposition Failed */
+    ARM_MATH_DECOMPOSITION_FAILURE   = -7,        /**< Decomposition Failed */
+    ARM_MATH_BUSY                    = -8         /**< Resource is in use, the call must be retried later */
   } arm_status;
 
 
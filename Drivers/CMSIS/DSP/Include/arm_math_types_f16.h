@@ -45,12 +45,13 @@ extern "C"
 /*
 
 Check if the type __fp16 is available.
-If it is not available, f16 version of the kernels
-won't be built.
+If it is not available, or if the storage f16 mode is selected
+with ARM_MATH_F16_STORAGE, f16 version of the kernels
+won't be built and the f16s kernels must be used instead.
 
 */
 #if !(__ARM_FEATURE_MVE & 2)
-  #if !defined(DISABLEFLOAT16)
+  #if !defined(DISABLEFLOAT16) && !defined(ARM_MATH_F16_STORAGE)
     #if defined(__ARM_FP16_FORMAT_IEEE) || defined(__ARM_FP16_FORMAT_ALTERNATIVE)
       typedef __fp16 float16_t;
       #define ARM_FLOAT16_SUPPORTED
@@ -99,6 +99,20 @@ extern "C"
         uint32_t blockSize);
 
 
+  /**
+   * @brief Storage f16 vector multiplication.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_mult_f16s(
+  const float16s_t * pSrcA,
+  const float16s_t * pSrcB,
+        float16s_t * pDst,
+        uint32_t blockSize);
+
+
 
 /**
  * @brief Floating-point vector multiplication.
@@ -129,6 +143,20 @@ const float64_t * pSrcB,
         uint32_t blockSize);
 
 
+  /**
+   * @brief Storage f16 vector addition.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_add_f16s(
+  const float16s_t * pSrcA,
+  const float16s_t * pSrcB,
+        float16s_t * pDst,
+        uint32_t blockSize);
+
+
 
 /**
   * @brief Floating-point vector addition.
@@ -273,6 +301,20 @@ const float64_t * pSrcB,
         uint32_t blockSize);
 
 
+  /**
+   * @brief Multiplies a storage f16 vector by a scalar.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scale      scale factor to be applied
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in the vector
+   */
+  void arm_scale_f16s(
+  const float16s_t * pSrc,
+        float32_t scale,
+        float16s_t * pDst,
+        uint32_t blockSize);
+
+
 
   /**
    * @brief Multiplies a floating-point vector by a scalar.
@@ -413,6 +455,20 @@ const float64_t * pSrc,
         float32_t * result);
 
 
+  /**
+   * @brief Dot product of storage f16 vectors.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @param[out] result     output result returned here
+   */
+  void arm_dot_prod_f16s(
+  const float16s_t * pSrcA,
+  const float16s_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result);
+
+
 
 /**
  * @brief Dot product of floating-point vectors.
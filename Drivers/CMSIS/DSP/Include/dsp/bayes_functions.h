@@ -81,6 +81,153 @@ uint32_t arm_gaussian_naive_bayes_predict_f32(const arm_gaussian_naive_bayes_ins
    float32_t *pOutputProbabilities,
    float32_t *pBufferB);
 
+/**
+ * @brief Instance structure for the precomputed naive Gaussian Bayesian estimator.
+ *
+ * The log-likelihood of class c is
+ * logConst[c] - sum over d of halfInvSigma[c,d] * (x[d] - theta[c,d])^2.
+ * The model arrays are stored class by class (numberOfClasses rows of
+ * vectorDimension values).
+ */
+typedef struct
+{
+  uint32_t vectorDimension;        /**< Dimension of vector space */
+  uint32_t numberOfClasses;        /**< Number of different classes  */
+  const float32_t *theta;          /**< Mean values for the Gaussians */
+  const float32_t *halfInvSigma;   /**< 0.5 / (variance + epsilon) */
+  const float32_t *logConst;       /**< Log prior minus the log normalization of each class */
+} arm_gaussian_naive_bayes_fast_instance_f32;
+
+/**
+ * @brief Instance structure for the incremental fit of a naive Gaussian Bayesian estimator.
+ *
+ * The means and the sums of squared deviations are updated with the
+ * Welford algorithm, one training vector at a time.
+ */
+typedef struct
+{
+  uint32_t vectorDimension;        /**< Dimension of vector space */
+  uint32_t numberOfClasses;        /**< Number of different classes  */
+  uint32_t maxCount;               /**< Saturation of the class counts (exponential forgetting), 0 for none */
+  uint32_t *pCount;                /**< Number of training vectors of each class */
+  float32_t *pMean;                /**< Mean values for the Gaussians */
+  float32_t *pM2;                  /**< Sums of squared deviations from the means */
+} arm_gaussian_naive_bayes_fit_instance_f32;
+
+/**
+ * @brief Initialization of the precomputed naive Gaussian Bayesian estimator
+ *
+ * @param[out] S                        points to a precomputed naive bayes instance structure
+ * @param[in]  pModel                   points to a naive bayes instance structure
+ * @param[out] pHalfInvSigma            points to a buffer of numberOfClasses * vectorDimension values
+ * @param[out] pLogConst                points to a buffer of numberOfClasses values
+ * @return execution status
+ *
+ */
+arm_status arm_gaussian_naive_bayes_fast_init_f32(arm_gaussian_naive_bayes_fast_instance_f32 *S,
+   const arm_gaussian_naive_bayes_instance_f32 *pModel,
+   float32_t *pHalfInvSigma,
+   float32_t *pLogConst);
+
+/**
+ * @brief Precomputed naive Gaussian Bayesian estimator
+ *
+ * @param[in]  S                        points to a precomputed naive bayes instance structure
+ * @param[in]  in                       points to the elements of the input vector.
+ * @param[out] pOutputProbabilities     points to a buffer of length numberOfClasses containing estimated probabilities
+ * @return The predicted class
+ *
+ */
+uint32_t arm_gaussian_naive_bayes_predict_fast_f32(const arm_gaussian_naive_bayes_fast_instance_f32 *S,
+   const float32_t * in,
+   float32_t *pOutputProbabilities);
+
+/**
+ * @brief Precomputed naive Gaussian Bayesian estimator with early exit
+ *
+ * @param[in]  S                        points to a precomputed naive bayes instance structure
+ * @param[in]  in                       points to the elements of the input vector.
+ * @return The predicted class
+ *
+ */
+uint32_t arm_gaussian_naive_bayes_predict_class_f32(const arm_gaussian_naive_bayes_fast_instance_f32 *S,
+   const float32_t * in);
+
+/**
+ * @brief Precomputed naive Gaussian Bayesian estimator on a batch of vectors
+ *
+ * @param[in]  S                        points to a precomputed naive bayes instance structure
+ * @param[in]  in                       points to numVectors input vectors
+ * @param[in]  numVectors               number of input vectors
+ * @param[out] pClasses                 points to the numVectors predicted classes
+ * @return none
+ *
+ */
+void arm_gaussian_naive_bayes_predict_batch_f32(const arm_gaussian_naive_bayes_fast_instance_f32 *S,
+   const float32_t * in,
+   uint32_t numVectors,
+   uint32_t *pClasses);
+
+/**
+ * @brief Posterior probabilities of the precomputed naive Gaussian Bayesian estimator
+ *
+ * @param[in]  S                        points to a precomputed naive bayes instance structure
+ * @param[in]  in                       points to the elements of the input vector.
+ * @param[out] pPosterior               points to a buffer of length numberOfClasses containing the posterior probabilities
+ * @return The predicted class
+ *
+ */
+uint32_t arm_gaussian_naive_bayes_posterior_f32(const arm_gaussian_naive_bayes_fast_instance_f32 *S,
+   const float32_t * in,
+   float32_t *pPosterior);
+
+/**
+ * @brief Initialization of the incremental fit of a naive Gaussian Bayesian estimator
+ *
+ * @param[out] S                        points to a fit instance structure
+ * @param[in]  vectorDimension          dimension of vector space
+ * @param[in]  numberOfClasses          number of different classes
+ * @param[in]  maxCount                 saturation of the class counts, 0 for none
+ * @param[in]  pCount                   points to a buffer of numberOfClasses counts
+ * @param[in]  pMean                    points to a buffer of numberOfClasses * vectorDimension means
+ * @param[in]  pM2                      points to a buffer of numberOfClasses * vectorDimension values
+ * @return none
+ *
+ */
+void arm_gaussian_naive_bayes_fit_init_f32(arm_gaussian_naive_bayes_fit_instance_f32 *S,
+   uint32_t vectorDimension,
+   uint32_t numberOfClasses,
+   uint32_t maxCount,
+   uint32_t *pCount,
+   float32_t *pMean,
+   float32_t *pM2);
+
+/**
+ * @brief Update of the incremental fit with one training vector
+ *
+ * @param[in,out] S                     points to a fit instance structure
+ * @param[in]  in                       points to the elements of the training vector.
+ * @param[in]  classId                  class of the training vector
+ * @return execution status
+ *
+ */
+arm_status arm_gaussian_naive_bayes_fit_update_f32(arm_gaussian_naive_bayes_fit_instance_f32 *S,
+   const float32_t * in,
+   uint32_t classId);
+
+/**
+ * @brief Export of the incremental fit as a naive Gaussian Bayesian model
+ *
+ * @param[in]  S                        points to a fit instance structure
+ * @param[out] pSigma                   points to a buffer of numberOfClasses * vectorDimension variances
+ * @param[out] pClassPriors             points to a buffer of numberOfClasses prior probabilities
+ * @return none
+ *
+ */
+void arm_gaussian_naive_bayes_fit_export_f32(const arm_gaussian_naive_bayes_fit_instance_f32 *S,
+   float32_t *pSigma,
+   float32_t *pClassPriors);
+
 
 #ifdef   __cplusplus
 }
@@ -96,6 +96,18 @@ extern "C"
         uint32_t numSamples);
 
 
+  /**
+   * @brief  Storage f16 complex magnitude squared
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_squared_f16s(
+  const float16s_t * pSrc,
+        float16s_t * pDst,
+        uint32_t numSamples);
+
+
   /**
    * @brief  Floating-point complex magnitude squared
    * @param[in]  pSrc        points to the complex input vector
@@ -144,6 +156,18 @@ extern "C"
         uint32_t numSamples);
 
 
+  /**
+   * @brief  Storage f16 complex magnitude
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_f16s(
+  const float16s_t * pSrc,
+        float16s_t * pDst,
+        uint32_t numSamples);
+
+
 /**
    * @brief  Floating-point complex magnitude
    * @param[in]  pSrc        points to the complex input vector
@@ -322,6 +346,20 @@ extern "C"
         uint32_t numSamples);
 
 
+  /**
+   * @brief  Storage f16 complex-by-complex multiplication
+   * @param[in]  pSrcA       points to the first input vector
+   * @param[in]  pSrcB       points to the second input vector
+   * @param[out] pDst        points to the output vector
+   * @param[in]  numSamples  number of complex samples in each vector
+   */
+  void arm_cmplx_mult_cmplx_f16s(
+  const float16s_t * pSrcA,
+  const float16s_t * pSrcB,
+        float16s_t * pDst,
+        uint32_t numSamples);
+
+
 
 /**
  * @brief  Floating-point complex-by-complex multiplication
@@ -392,6 +392,248 @@ __STATIC_FORCEINLINE q15_t arm_pid_q15(
    * @ingroup groupController
    */
 
+  /**
+   * @defgroup StateSpace State Space Model
+   *
+   * Discrete-time linear state space model with one input and one output.
+   *
+   * \par Algorithm:
+   * <pre>
+   *    y[n]   = C * x[n] + D * u[n]
+   *    x[n+1] = A * x[n] + B * u[n]
+   * </pre>
+   *
+   * \par
+   * where \c x is the state vector of length \c numStates, \c A is a square matrix,
+   * \c B a column vector, \c C a row vector and \c D a scalar.
+   *
+   * \par
+   * Like the PID functions, the processing functions are inline and operate on a single sample.
+   * They are intended for observers and compensators running inside a control loop where
+   * the overhead of a block function would dominate.
+   * arm_state_space_2_f32() is a fully unrolled version for second order models which keeps
+   * the whole computation in registers.
+   *
+   * \par Coefficient Ordering
+   * The coefficients are stored in the array <code>pCoeffs</code> in the following order:
+   * <pre>
+   *    {A (numStates * numStates values, row-major), B (numStates values), C (numStates values), D}
+   * </pre>
+   * The array has a total length of <code>numStates * (numStates + 2) + 1</code> values.
+   *
+   * \par State
+   * The state array has a length of <code>2 * numStates</code>. The first half holds the current state.
+   * The second half is used as a working area when the new state is computed.
+   * The state array must not overlap the coefficient array.
+   */
+
+  /**
+   * @brief Instance structure for the floating-point state space model.
+   */
+  typedef struct
+  {
+          uint16_t numStates;    /**< number of states of the model. */
+          float32_t *pState;     /**< points to the state array of length 2*numStates. */
+    const float32_t *pCoeffs;    /**< points to the coefficient array of length numStates*(numStates+2)+1. */
+  } arm_state_space_instance_f32;
+
+
+  /**
+   * @brief  Initialization function for the floating-point state space model.
+   * @param[in,out] S          points to an instance of the state space structure.
+   * @param[in]     numStates  number of states of the model.
+   * @param[in]     pCoeffs    points to the coefficient array.
+   * @param[in]     pState     points to the state array.
+   */
+  void arm_state_space_init_f32(
+        arm_state_space_instance_f32 * S,
+        uint16_t numStates,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
+  /**
+   * @addtogroup StateSpace
+   * @{
+   */
+
+  /**
+   * @brief         Process function for the floating-point state space model.
+   * @param[in,out] S   points to an instance of the state space structure
+   * @param[in]     in  input sample to process
+   * @return        processed output sample.
+   */
+  __STATIC_FORCEINLINE float32_t arm_state_space_f32(
+  arm_state_space_instance_f32 * S,
+  float32_t in)
+  {
+          uint32_t n = S->numStates;
+    const float32_t * __RESTRICT pA = S->pCoeffs;
+    const float32_t * __RESTRICT pB = pA + (n * n);
+    const float32_t * __RESTRICT pC = pB + n;
+          float32_t * __RESTRICT pX = S->pState;
+          float32_t * __RESTRICT pXNext = pX + n;
+          float32_t out, acc;
+          uint32_t i, j;
+
+    /* y[n] = C * x[n] + D * u[n] */
+    out = pC[n] * in;
+    for (i = 0U; i < n; i++)
+    {
+      out += pC[i] * pX[i];
+    }
+
+    /* x[n+1] = A * x[n] + B * u[n] */
+    for (i = 0U; i < n; i++)
+    {
+      acc = pB[i] * in;
+      for (j = 0U; j < n; j++)
+      {
+        acc += pA[j] * pX[j];
+      }
+      pA += n;
+      pXNext[i] = acc;
+    }
+
+    /* Update state */
+    for (i = 0U; i < n; i++)
+    {
+      pX[i] = pXNext[i];
+    }
+
+    /* return to application */
+    return (out);
+  }
+
+  /**
+   * @brief         Process function for a second order floating-point state space model.
+   * @param[in,out] S   points to an instance of the state space structure
+   * @param[in]     in  input sample to process
+   * @return        processed output sample.
+   *
+   * @par           The <code>numStates</code> field of the instance is not read and must be 2.
+   */
+  __STATIC_FORCEINLINE float32_t arm_state_space_2_f32(
+  arm_state_space_instance_f32 * S,
+  float32_t in)
+  {
+    const float32_t * __RESTRICT pCoeffs = S->pCoeffs;
+          float32_t * __RESTRICT pState = S->pState;
+          float32_t x0 = pState[0];
+          float32_t x1 = pState[1];
+          float32_t out;
+
+    /* y[n] = C * x[n] + D * u[n] */
+    out = (pCoeffs[6] * x0) + (pCoeffs[7] * x1) + (pCoeffs[8] * in);
+
+    /* x[n+1] = A * x[n] + B * u[n] */
+    pState[0] = (pCoeffs[0] * x0) + (pCoeffs[1] * x1) + (pCoeffs[4] * in);
+    pState[1] = (pCoeffs[2] * x0) + (pCoeffs[3] * x1) + (pCoeffs[5] * in);
+
+    /* return to application */
+    return (out);
+  }
+
+  /**
+   * @} end of StateSpace group
+   */
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup PIDBank Batched PID Controllers
+   *
+   * Updates a bank of independent floating-point PID controllers in a single call.
+   * The parameters and states of the controllers are stored as structure of arrays so
+   * that the same operation is applied to consecutive controllers in the inner loop.
+   *
+   * \par Algorithm:
+   * For each controller, with \c r the setpoint and \c y the measurement:
+   * <pre>
+   *    e[n] = r[n] - y[n]
+   *    P[n] = Kp * (b * r[n] - y[n])
+   *    I[n] = I[n-1] + Ki * e[n]
+   *    D[n] = alpha * D[n-1] + (1 - alpha) * Kd * ((c * r[n] - y[n]) - (c * r[n-1] - y[n-1]))
+   *    u[n] = min(max(P[n] + I[n] + D[n], uMin), uMax)
+   * </pre>
+   *
+   * \par
+   * \c b and \c c are the setpoint weights of the proportional and derivative terms.
+   * \c alpha is the coefficient of the first order filter on the derivative term (0 disables the filter).
+   * When the output is saturated and the error would drive it further into saturation,
+   * the integrator is not updated (conditional integration) so that it does not wind up.
+   *
+   * \par
+   * With <code>b = c = 1</code>, <code>alpha = 0</code> and output limits which are never reached,
+   * a controller of the bank gives the same output as arm_pid_f32() with the same gains.
+   * As for arm_pid_f32(), \c Ki and \c Kd include the sampling period.
+   *
+   * \par Coefficient Ordering
+   * The coefficient array has a length of <code>8 * numControllers</code> values and is made
+   * of 8 consecutive arrays of <code>numControllers</code> values:
+   * <pre>
+   *    {Kp[0..N-1], Ki[0..N-1], Kd[0..N-1], b[0..N-1], c[0..N-1], alpha[0..N-1], uMin[0..N-1], uMax[0..N-1]}
+   * </pre>
+   *
+   * \par State Ordering
+   * The state array has a length of <code>3 * numControllers</code> values:
+   * <pre>
+   *    {I[0..N-1], (c * r - y)[0..N-1], D[0..N-1]}
+   * </pre>
+   */
+
+  /**
+   * @brief Instance structure for the floating-point batched PID controllers.
+   */
+  typedef struct
+  {
+          uint16_t numControllers; /**< number of controllers in the bank. */
+          float32_t *pState;       /**< points to the state array of length 3*numControllers. */
+    const float32_t *pCoeffs;      /**< points to the coefficient array of length 8*numControllers. */
+  } arm_pid_bank_instance_f32;
+
+
+  /**
+   * @brief  Initialization function for the floating-point batched PID controllers.
+   * @param[in,out] S               points to an instance of the PID bank structure.
+   * @param[in]     numControllers  number of controllers in the bank.
+   * @param[in]     pCoeffs         points to the coefficient array.
+   * @param[in]     pState          points to the state array.
+   */
+  void arm_pid_bank_init_f32(
+        arm_pid_bank_instance_f32 * S,
+        uint16_t numControllers,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
+  /**
+   * @brief  Reset function for the floating-point batched PID controllers.
+   * @param[in,out] S  points to an instance of the PID bank structure.
+   */
+  void arm_pid_bank_reset_f32(
+        arm_pid_bank_instance_f32 * S);
+
+
+  /**
+   * @brief  Process function for the floating-point batched PID controllers.
+   * @param[in,out] S          points to an instance of the PID bank structure.
+   * @param[in]     pSetpoint  points to the setpoints, one per controller.
+   * @param[in]     pMeasure   points to the measurements, one per controller.
+   * @param[out]    pOut       points to the outputs, one per controller.
+   */
+  void arm_pid_bank_f32(
+        arm_pid_bank_instance_f32 * S,
+  const float32_t * pSetpoint,
+  const float32_t * pMeasure,
+        float32_t * pOut);
+
+  /**
+   * @ingroup groupController
+   */
+
   /**
    * @defgroup park Vector Park Transform
    *
@@ -781,6 +1023,245 @@ __STATIC_FORCEINLINE void arm_inv_clarke_q31(
    * @} end of inv_clarke group
    */
 
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup foc Field Oriented Control Step
+   *
+   * Fused transforms for the current loop of a field oriented control.
+   *
+   * The forward function goes from the phase currents and the rotor angle to the
+   * rotor reference frame (Clarke then Park transform). The sine and cosine of the angle
+   * are computed once with arm_sin_cos_f32() or arm_sin_cos_q31() and kept in the instance.
+   * The inverse function reuses them to bring the voltage command computed by the
+   * controllers back to the stator reference frame (inverse Park transform), so there is
+   * a single sine and cosine evaluation per control period.
+   *
+   * An optional space vector modulation function converts the stator voltage to the
+   * duty cycles of the three inverter legs. It uses the min-max zero sequence injection
+   * which gives the same duty cycles as the sector based space vector modulation.
+   *
+   * \par Typical use
+   * <pre>
+   *     arm_foc_forward_f32(&foc, theta, Ia, Ib, &Id, &Iq);
+   *     Vd = arm_pid_f32(&pidD, IdRef - Id);
+   *     Vq = arm_pid_f32(&pidQ, IqRef - Iq);
+   *     arm_foc_inverse_f32(&foc, Vd, Vq, &Valpha, &Vbeta);
+   *     arm_svpwm_f32(Valpha, Vbeta, 1.0f / Vdc, duty);
+   * </pre>
+   *
+   * \par Angle format
+   * The angle has the format of the corresponding sine and cosine function: degrees for
+   * the floating-point version, and [-1 0.9999] mapped to [-180 179] degrees for the Q31 version.
+   */
+
+  /**
+   * @brief Instance structure for the floating-point field oriented control step.
+   */
+  typedef struct
+  {
+          float32_t sinVal;      /**< sine of the angle given to the last forward transform. */
+          float32_t cosVal;      /**< cosine of the angle given to the last forward transform. */
+  } arm_foc_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 field oriented control step.
+   */
+  typedef struct
+  {
+          q31_t sinVal;          /**< sine of the angle given to the last forward transform. */
+          q31_t cosVal;          /**< cosine of the angle given to the last forward transform. */
+  } arm_foc_instance_q31;
+
+  /**
+   * @addtogroup foc
+   * @{
+   */
+
+  /**
+   * @brief         Floating-point forward transform of the field oriented control step.
+   * @param[out]    S      points to an instance of the FOC structure
+   * @param[in]     theta  rotor angle in degrees
+   * @param[in]     Ia     phase current <code>a</code>
+   * @param[in]     Ib     phase current <code>b</code>
+   * @param[out]    pId    points to the direct axis current
+   * @param[out]    pIq    points to the quadrature axis current
+   * @return        none
+   */
+  __STATIC_FORCEINLINE void arm_foc_forward_f32(
+  arm_foc_instance_f32 * S,
+  float32_t theta,
+  float32_t Ia,
+  float32_t Ib,
+  float32_t * pId,
+  float32_t * pIq)
+  {
+    float32_t Ialpha, Ibeta;
+
+    /* Single evaluation of the sine and cosine for the whole step */
+    arm_sin_cos_f32(theta, &S->sinVal, &S->cosVal);
+
+    arm_clarke_f32(Ia, Ib, &Ialpha, &Ibeta);
+    arm_park_f32(Ialpha, Ibeta, pId, pIq, S->sinVal, S->cosVal);
+  }
+
+  /**
+   * @brief         Floating-point inverse transform of the field oriented control step.
+   * @param[in]     S        points to an instance of the FOC structure
+   * @param[in]     Vd       direct axis voltage
+   * @param[in]     Vq       quadrature axis voltage
+   * @param[out]    pValpha  points to the alpha axis voltage
+   * @param[out]    pVbeta   points to the beta axis voltage
+   * @return        none
+   */
+  __STATIC_FORCEINLINE void arm_foc_inverse_f32(
+  const arm_foc_instance_f32 * S,
+  float32_t Vd,
+  float32_t Vq,
+  float32_t * pValpha,
+  float32_t * pVbeta)
+  {
+    arm_inv_park_f32(Vd, Vq, pValpha, pVbeta, S->sinVal, S->cosVal);
+  }
+
+  /**
+   * @brief         Floating-point space vector modulation.
+   * @param[in]     Valpha  alpha axis voltage
+   * @param[in]     Vbeta   beta axis voltage
+   * @param[in]     invVdc  inverse of the DC bus voltage
+   * @param[out]    pDuty   points to the 3 duty cycles, in the range [0 1]
+   * @return        none
+   */
+  __STATIC_FORCEINLINE void arm_svpwm_f32(
+  float32_t Valpha,
+  float32_t Vbeta,
+  float32_t invVdc,
+  float32_t * pDuty)
+  {
+    float32_t Va, Vb, Vc, vMax, vMin, offset, duty;
+    int32_t i;
+
+    arm_inv_clarke_f32(Valpha, Vbeta, &Va, &Vb);
+    Vc = -Va - Vb;
+
+    /* Zero sequence centering the three phases in the available range */
+    vMax = (Va > Vb) ? Va : Vb;
+    vMax = (vMax > Vc) ? vMax : Vc;
+    vMin = (Va < Vb) ? Va : Vb;
+    vMin = (vMin < Vc) ? vMin : Vc;
+    offset = -0.5f * (vMax + vMin);
+
+    pDuty[0] = Va;
+    pDuty[1] = Vb;
+    pDuty[2] = Vc;
+
+    for (i = 0; i < 3; i++)
+    {
+      duty = 0.5f + (pDuty[i] + offset) * invVdc;
+      duty = (duty > 1.0f) ? 1.0f : duty;
+      pDuty[i] = (duty < 0.0f) ? 0.0f : duty;
+    }
+  }
+
+  /**
+   * @brief         Q31 forward transform of the field oriented control step.
+   * @param[out]    S      points to an instance of the FOC structure
+   * @param[in]     theta  scaled rotor angle
+   * @param[in]     Ia     phase current <code>a</code>
+   * @param[in]     Ib     phase current <code>b</code>
+   * @param[out]    pId    points to the direct axis current
+   * @param[out]    pIq    points to the quadrature axis current
+   * @return        none
+   *
+   * @par           Scaling and Overflow Behavior
+   *                  Same as arm_clarke_q31() followed by arm_park_q31().
+   */
+  __STATIC_FORCEINLINE void arm_foc_forward_q31(
+  arm_foc_instance_q31 * S,
+  q31_t theta,
+  q31_t Ia,
+  q31_t Ib,
+  q31_t * pId,
+  q31_t * pIq)
+  {
+    q31_t Ialpha, Ibeta;
+
+    /* Single evaluation of the sine and cosine for the whole step */
+    arm_sin_cos_q31(theta, &S->sinVal, &S->cosVal);
+
+    arm_clarke_q31(Ia, Ib, &Ialpha, &Ibeta);
+    arm_park_q31(Ialpha, Ibeta, pId, pIq, S->sinVal, S->cosVal);
+  }
+
+  /**
+   * @brief         Q31 inverse transform of the field oriented control step.
+   * @param[in]     S        points to an instance of the FOC structure
+   * @param[in]     Vd       direct axis voltage
+   * @param[in]     Vq       quadrature axis voltage
+   * @param[out]    pValpha  points to the alpha axis voltage
+   * @param[out]    pVbeta   points to the beta axis voltage
+   * @return        none
+   *
+   * @par           Scaling and Overflow Behavior
+   *                  Same as arm_inv_park_q31().
+   */
+  __STATIC_FORCEINLINE void arm_foc_inverse_q31(
+  const arm_foc_instance_q31 * S,
+  q31_t Vd,
+  q31_t Vq,
+  q31_t * pValpha,
+  q31_t * pVbeta)
+  {
+    arm_inv_park_q31(Vd, Vq, pValpha, pVbeta, S->sinVal, S->cosVal);
+  }
+
+  /**
+   * @brief         Q31 space vector modulation.
+   * @param[in]     Valpha  alpha axis voltage, normalized to the DC bus voltage
+   * @param[in]     Vbeta   beta axis voltage, normalized to the DC bus voltage
+   * @param[out]    pDuty   points to the 3 duty cycles, in the range [0 0.9999]
+   * @return        none
+   *
+   * @par           Scaling and Overflow Behavior
+   *                  The phase voltages are computed with arm_inv_clarke_q31().
+   *                  The additions are saturated and the duty cycles are clipped to the [0 0.9999] range.
+   */
+  __STATIC_FORCEINLINE void arm_svpwm_q31(
+  q31_t Valpha,
+  q31_t Vbeta,
+  q31_t * pDuty)
+  {
+    q31_t Va, Vb, Vc, vMax, vMin, offset, duty;
+    int32_t i;
+
+    arm_inv_clarke_q31(Valpha, Vbeta, &Va, &Vb);
+    Vc = __QSUB(__QSUB(0, Va), Vb);
+
+    /* Zero sequence centering the three phases in the available range */
+    vMax = (Va > Vb) ? Va : Vb;
+    vMax = (vMax > Vc) ? vMax : Vc;
+    vMin = (Va < Vb) ? Va : Vb;
+    vMin = (vMin < Vc) ? vMin : Vc;
+    offset = -(q31_t) (((q63_t) vMax + vMin) >> 1);
+
+    pDuty[0] = Va;
+    pDuty[1] = Vb;
+    pDuty[2] = Vc;
+
+    for (i = 0; i < 3; i++)
+    {
+      /* duty = 0.5 + V + offset */
+      duty = __QADD(__QADD(pDuty[i], offset), 0x40000000);
+      pDuty[i] = (duty < 0) ? 0 : duty;
+    }
+  }
+
+  /**
+   * @} end of foc group
+   */
+
 
 
   
@@ -332,6 +332,123 @@ float32_t arm_sokalsneath_distance(const uint32_t *pA, const uint32_t *pB, uint3
 
 float32_t arm_yule_distance(const uint32_t *pA, const uint32_t *pB, uint32_t numberOfBools);
 
+/**
+ * @brief        Squared norms of a set of vectors
+ *
+ * @param[in]    pSrc        Vectors, one after the other
+ * @param[in]    numVectors  Number of vectors
+ * @param[in]    dimension   Length of the vectors
+ * @param[out]   pNorms      Squared norm of each vector
+ * @return none
+ *
+ */
+
+void arm_distance_sqnorms_f32(const float32_t *pSrc, uint32_t numVectors, uint32_t dimension, float32_t *pNorms);
+
+/**
+ * @brief        Euclidean distance matrix
+ *
+ * @param[in]    pA          Vectors of the first set
+ * @param[in]    pNormA      Squared norms of the first set
+ * @param[in]    numA        Number of vectors of the first set
+ * @param[in]    pB          Vectors of the second set
+ * @param[in]    pNormB      Squared norms of the second set
+ * @param[in]    numB        Number of vectors of the second set
+ * @param[in]    dimension   Length of the vectors
+ * @param[out]   pDst        numA x numB distances
+ * @return none
+ *
+ */
+
+void arm_euclidean_distance_matrix_f32(const float32_t *pA, const float32_t *pNormA, uint32_t numA,
+                                       const float32_t *pB, const float32_t *pNormB, uint32_t numB,
+                                       uint32_t dimension, float32_t *pDst);
+
+/**
+ * @brief        Cosine distance matrix
+ *
+ * @param[in]    pA          Vectors of the first set
+ * @param[in]    pNormA      Squared norms of the first set
+ * @param[in]    numA        Number of vectors of the first set
+ * @param[in]    pB          Vectors of the second set
+ * @param[in]    pNormB      Squared norms of the second set
+ * @param[in]    numB        Number of vectors of the second set
+ * @param[in]    dimension   Length of the vectors
+ * @param[out]   pDst        numA x numB distances
+ * @return none
+ *
+ */
+
+void arm_cosine_distance_matrix_f32(const float32_t *pA, const float32_t *pNormA, uint32_t numA,
+                                    const float32_t *pB, const float32_t *pNormB, uint32_t numB,
+                                    uint32_t dimension, float32_t *pDst);
+
+/**
+ * @brief        Cityblock (Manhattan) distance matrix
+ *
+ * @param[in]    pA          Vectors of the first set
+ * @param[in]    numA        Number of vectors of the first set
+ * @param[in]    pB          Vectors of the second set
+ * @param[in]    numB        Number of vectors of the second set
+ * @param[in]    dimension   Length of the vectors
+ * @param[out]   pDst        numA x numB distances
+ * @return none
+ *
+ */
+
+void arm_cityblock_distance_matrix_f32(const float32_t *pA, uint32_t numA,
+                                       const float32_t *pB, uint32_t numB,
+                                       uint32_t dimension, float32_t *pDst);
+
+/**
+ * @brief        Hamming distance matrix of packed boolean vectors
+ *
+ * @param[in]    pA              Vectors of packed booleans of the first set
+ * @param[in]    numA            Number of vectors of the first set
+ * @param[in]    pB              Vectors of packed booleans of the second set
+ * @param[in]    numB            Number of vectors of the second set
+ * @param[in]    numberOfBools   Number of booleans of a vector (greater than 0)
+ * @param[out]   pDst            numA x numB distances
+ * @return none
+ *
+ */
+
+void arm_hamming_distance_matrix(const uint32_t *pA, uint32_t numA,
+                                 const uint32_t *pB, uint32_t numB,
+                                 uint32_t numberOfBools, float32_t *pDst);
+
+/**
+ * @brief        Jaccard distance matrix of packed boolean vectors
+ *
+ * @param[in]    pA              Vectors of packed booleans of the first set
+ * @param[in]    numA            Number of vectors of the first set
+ * @param[in]    pB              Vectors of packed booleans of the second set
+ * @param[in]    numB            Number of vectors of the second set
+ * @param[in]    numberOfBools   Number of booleans of a vector (greater than 0)
+ * @param[out]   pDst            numA x numB distances
+ * @return none
+ *
+ */
+
+void arm_jaccard_distance_matrix(const uint32_t *pA, uint32_t numA,
+                                 const uint32_t *pB, uint32_t numB,
+                                 uint32_t numberOfBools, float32_t *pDst);
+
+/**
+ * @brief        Nearest neighbors selection
+ *
+ * @param[in]    pSrc        Distances to the candidates
+ * @param[in]    numDist     Number of candidates
+ * @param[in]    k           Number of neighbors to select
+ * @param[out]   pIndex      Indexes of the k nearest candidates, by increasing distance
+ * @param[out]   pDist       Distances of the k nearest candidates, by increasing distance
+ * @return execution status
+ *
+ */
+
+arm_status arm_knn_select_f32(const float32_t *pSrc, uint32_t numDist, uint32_t k,
+                              uint32_t *pIndex, float32_t *pDist);
+
 
 
 #ifdef   __cplusplus
@@ -382,6 +382,119 @@ arm_status arm_divide_q31(q31_t numerator,
    */
   arm_status arm_atan2_q15(q15_t y,q15_t x,q15_t *result);
 
+  /**
+   * @brief Accuracy tier of the vector elementary functions.
+   */
+  typedef enum
+  {
+    ARM_ACCURACY_PRECISE = 0,
+             /**< Results within a few ULP */
+    ARM_ACCURACY_FAST = 1
+             /**< Lower degree polynomials, absolute error below 1e-4 */
+  } arm_math_accuracy;
+
+/**
+  @brief         Floating-point vector of sine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     accuracy   accuracy tier
+  @return        none
+ */
+  void arm_vsin_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        arm_math_accuracy accuracy);
+
+/**
+  @brief         Floating-point vector of cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     accuracy   accuracy tier
+  @return        none
+ */
+  void arm_vcos_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        arm_math_accuracy accuracy);
+
+/**
+  @brief         Floating-point vectors of sine and cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pSin       points to the output vector of sines
+  @param[out]    pCos       points to the output vector of cosines
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     accuracy   accuracy tier
+  @return        none
+ */
+  void arm_vsincos_f32(
+  const float32_t * pSrc,
+        float32_t * pSin,
+        float32_t * pCos,
+        uint32_t blockSize,
+        arm_math_accuracy accuracy);
+
+/**
+  @brief         Floating-point vector of arc tangents of y/x in the right quadrant.
+  @param[in]     pSrcY      points to the input vector of y coordinates
+  @param[in]     pSrcX      points to the input vector of x coordinates
+  @param[out]    pDst       points to the output vector of angles in [-pi, pi]
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     accuracy   accuracy tier
+  @return        none
+ */
+  void arm_vatan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+        float32_t * pDst,
+        uint32_t blockSize,
+        arm_math_accuracy accuracy);
+
+/**
+  @brief         Floating-point vector of hyperbolic tangent values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     accuracy   accuracy tier
+  @return        none
+ */
+  void arm_vtanh_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        arm_math_accuracy accuracy);
+
+/**
+  @brief         Floating-point vector of logistic sigmoid values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     accuracy   accuracy tier
+  @return        none
+ */
+  void arm_vsigmoid_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        arm_math_accuracy accuracy);
+
+/**
+  @brief         Floating-point vector of square root values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     accuracy   accuracy tier
+  @return        none
+ */
+  void arm_vsqrt_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        arm_math_accuracy accuracy);
+
 #ifdef   __cplusplus
 }
 #endif
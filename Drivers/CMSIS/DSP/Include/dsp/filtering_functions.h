@@ -35,6 +35,8 @@
 
 #include "dsp/support_functions.h"
 #include "dsp/fast_math_functions.h"
+#include "dsp/matrix_functions.h"
+#include "dsp/transform_functions.h"
 
 #ifdef   __cplusplus
 extern "C"
@@ -1265,6 +1267,186 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         float64_t * pState);
 
 
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter
+   *        with double-buffered coefficients.
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint8_t interpolate;       /**< when non zero, the coefficients are interpolated over the block following an update. */
+          float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+          float32_t *pCoeffs;        /**< points to the two coefficient banks.  The array is of length 10*numStages. */
+    volatile uint32_t activeBank;    /**< index of the bank used by the processing function. */
+    volatile uint32_t pending;       /**< set by the update function, cleared by the processing function once the new bank is active. */
+  } arm_biquad_cascade_df2T_swap_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter
+   *        with double-buffered coefficients.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_df2T_swap_f32(
+        arm_biquad_cascade_df2T_swap_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter
+   *         with double-buffered coefficients.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs      points to the initial filter coefficients.
+   * @param[in]     pCoeffBanks  points to the coefficient banks (10*numStages values).
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     interpolate  interpolate the coefficients over one block after an update when non zero.
+   */
+  void arm_biquad_cascade_df2T_swap_init_f32(
+        arm_biquad_cascade_df2T_swap_instance_f32 * S,
+        uint8_t numStages,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffBanks,
+        float32_t * pState,
+        uint8_t interpolate);
+
+
+  /**
+   * @brief  Publish new coefficients for the floating-point transposed direct form II Biquad cascade filter
+   *         with double-buffered coefficients.
+   * @param[in,out] S        points to an instance of the filter data structure.
+   * @param[in]     pCoeffs  points to the new filter coefficients (5*numStages values).
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_BUSY when the previous update has not been consumed yet.
+   */
+  arm_status arm_biquad_cascade_df2T_swap_update_f32(
+        arm_biquad_cascade_df2T_swap_instance_f32 * S,
+  const float32_t * pCoeffs);
+
+
+  /**
+   * @addtogroup BiquadCascadeDF2T
+   * @{
+   */
+
+  /**
+   * @par          Single sample processing
+   *               arm_biquad_cascade_df2T_f32() is organized for blocks: each stage filters the
+   *               whole block before the next stage starts. Inside a control loop running one
+   *               sample per period, the loop and pointer setup of the block function dominates.
+   *               The inline functions below process one sample through the cascade. The output of
+   *               a stage is passed to the next one in a register and only the two state variables
+   *               of each stage are written back to memory.
+   * @par
+   *               arm_biquad_cascade_df2T_sample_2_f32() and arm_biquad_cascade_df2T_sample_4_f32()
+   *               are fully unrolled versions for cascades of exactly 2 and 4 stages. They do not
+   *               read <code>numStages</code> from the instance.
+   * @par
+   *               They use the same instance as arm_biquad_cascade_df2T_f32() and can be mixed
+   *               with the block function on the same instance. The Neon coefficient layout
+   *               is not supported.
+   * @par
+   *               The coefficient and state pointers are declared restrict: the state array must not
+   *               overlap the coefficient array, so that the coefficients can stay in registers across
+   *               the state writes.
+   */
+
+  /**
+   * @brief         Single sample processing of one floating-point transposed direct form II Biquad stage.
+   * @param[in]     pCoeffs  points to the 5 coefficients of the stage
+   * @param[in,out] pState   points to the 2 state variables of the stage
+   * @param[in]     in       input sample
+   * @return        output sample of the stage
+   */
+  __STATIC_FORCEINLINE float32_t arm_biquad_df2T_stage_f32(
+  const float32_t * __RESTRICT pCoeffs,
+        float32_t * __RESTRICT pState,
+        float32_t in)
+  {
+    float32_t out;
+
+    /* y[n] = b0 * x[n] + d1 */
+    out = (pCoeffs[0] * in) + pState[0];
+
+    /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+    pState[0] = ((pCoeffs[1] * in) + (pCoeffs[3] * out)) + pState[1];
+
+    /* d2 = b2 * x[n] + a2 * y[n] */
+    pState[1] = (pCoeffs[2] * in) + (pCoeffs[4] * out);
+
+    return (out);
+  }
+
+  /**
+   * @brief         Single sample processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]     S   points to an instance of the filter data structure
+   * @param[in]     in  input sample
+   * @return        output sample
+   */
+  __STATIC_FORCEINLINE float32_t arm_biquad_cascade_df2T_sample_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+        float32_t in)
+  {
+          float32_t * __RESTRICT pState = S->pState;
+    const float32_t * __RESTRICT pCoeffs = S->pCoeffs;
+          uint32_t stage = S->numStages;
+
+    while (stage > 0U)
+    {
+      in = arm_biquad_df2T_stage_f32(pCoeffs, pState, in);
+
+      pCoeffs += 5U;
+      pState += 2U;
+
+      stage--;
+    }
+
+    return (in);
+  }
+
+  /**
+   * @brief         Single sample processing function for a 2 stages floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]     S   points to an instance of the filter data structure
+   * @param[in]     in  input sample
+   * @return        output sample
+   */
+  __STATIC_FORCEINLINE float32_t arm_biquad_cascade_df2T_sample_2_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+        float32_t in)
+  {
+    in = arm_biquad_df2T_stage_f32(&S->pCoeffs[0], &S->pState[0], in);
+    in = arm_biquad_df2T_stage_f32(&S->pCoeffs[5], &S->pState[2], in);
+
+    return (in);
+  }
+
+  /**
+   * @brief         Single sample processing function for a 4 stages floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]     S   points to an instance of the filter data structure
+   * @param[in]     in  input sample
+   * @return        output sample
+   */
+  __STATIC_FORCEINLINE float32_t arm_biquad_cascade_df2T_sample_4_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+        float32_t in)
+  {
+    in = arm_biquad_df2T_stage_f32(&S->pCoeffs[0],  &S->pState[0], in);
+    in = arm_biquad_df2T_stage_f32(&S->pCoeffs[5],  &S->pState[2], in);
+    in = arm_biquad_df2T_stage_f32(&S->pCoeffs[10], &S->pState[4], in);
+    in = arm_biquad_df2T_stage_f32(&S->pCoeffs[15], &S->pState[6], in);
+
+    return (in);
+  }
+
+  /**
+   * @} end of BiquadCascadeDF2T group
+   */
+
+
   /**
    * @brief Instance structure for the Q15 FIR lattice filter.
    */
@@ -1818,6 +2000,146 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         uint8_t postShift);
 
 
+  /**
+   * @brief Instance structure for the floating-point frequency-domain block LMS filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;     /**< number of coefficients of each channel, also the block length. */
+          uint16_t numChannels; /**< number of adaptive filters sharing the input signal. */
+          float32_t mu;         /**< step size that controls filter coefficient updates. */
+          float32_t beta;       /**< smoothing factor of the power estimate of the input bins. */
+          float32_t delta;      /**< regularization added to the power estimate. */
+          float32_t *pInput;    /**< points to the last 2*numTaps input samples. */
+          float32_t *pSpectrum; /**< points to the spectrum of the last 2*numTaps input samples. */
+          float32_t *pPower;    /**< points to the power estimate of the numTaps+1 input bins. */
+          float32_t *pTmpA;     /**< points to a working buffer of 2*numTaps values. */
+          float32_t *pTmpB;     /**< points to a working buffer of 2*numTaps values. */
+          float32_t *pCoeffs;   /**< points to the frequency-domain coefficients, 2*numTaps values per channel. */
+          uint32_t blockCount;  /**< number of blocks processed, saturated, for the power estimate start. */
+          arm_rfft_fast_instance_f32 rfft; /**< real FFT of length 2*numTaps. */
+  } arm_fdaf_instance_f32;
+
+
+  /**
+   * @brief Size of the arena needed by the floating-point frequency-domain block LMS filter.
+   * @param[in] numTaps      number of coefficients of each channel.
+   * @param[in] numChannels  number of channels.
+   * @return    arena size in float32_t words
+   */
+  uint32_t arm_fdaf_get_buffer_size_f32(
+        uint16_t numTaps,
+        uint16_t numChannels);
+
+
+  /**
+   * @brief Initialization function for the floating-point frequency-domain block LMS filter.
+   * @param[out] S            points to an instance of the floating-point frequency-domain block LMS filter structure.
+   * @param[in]  numTaps      number of coefficients of each channel.
+   * @param[in]  numChannels  number of channels.
+   * @param[in]  mu           step size that controls filter coefficient updates.
+   * @param[in]  beta         smoothing factor of the power estimate.
+   * @param[in]  pBuffer      points to the arena of arm_fdaf_get_buffer_size_f32() words.
+   * @return     execution status
+   */
+  arm_status arm_fdaf_init_f32(
+        arm_fdaf_instance_f32 * S,
+        uint16_t numTaps,
+        uint16_t numChannels,
+        float32_t mu,
+        float32_t beta,
+        float32_t * pBuffer);
+
+
+  /**
+   * @brief Processing function for the floating-point frequency-domain block LMS filter.
+   * @param[in,out] S          points to an instance of the floating-point frequency-domain block LMS filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     pRef       points to the blocks of reference data of the channels.
+   * @param[out]    pOut       points to the blocks of output data of the channels.
+   * @param[out]    pErr       points to the blocks of error data of the channels.
+   * @param[in]     blockSize  number of samples to process, a multiple of numTaps.
+   */
+  void arm_fdaf_f32(
+        arm_fdaf_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Time-domain coefficients of a channel of the floating-point frequency-domain block LMS filter.
+   * @param[in,out] S        points to an instance of the floating-point frequency-domain block LMS filter structure.
+   * @param[in]     channel  channel index.
+   * @param[out]    pCoeffs  points to the numTaps coefficients in time reversed order.
+   */
+  void arm_fdaf_get_coeffs_f32(
+        arm_fdaf_instance_f32 * S,
+        uint16_t channel,
+        float32_t * pCoeffs);
+
+
+  /**
+   * @brief Instance structure for the floating-point RLS filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;     /**< number of coefficients of each channel. */
+          uint16_t numChannels; /**< number of adaptive filters sharing the input signal. */
+          float32_t lambda;     /**< forgetting factor. */
+          float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+          float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numChannels*numTaps. */
+          float32_t *pInvCorr;  /**< points to the inverse correlation matrix of numTaps*numTaps values. */
+          float32_t *pGain;     /**< points to a working buffer of numTaps values. */
+  } arm_rls_instance_f32;
+
+
+  /**
+   * @brief Initialization function for the floating-point RLS filter.
+   * @param[out] S            points to an instance of the floating-point RLS filter structure.
+   * @param[in]  numTaps      number of coefficients of each channel.
+   * @param[in]  numChannels  number of channels.
+   * @param[in]  pCoeffs      points to the coefficient buffer.
+   * @param[in]  pState       points to the state buffer.
+   * @param[in]  pInvCorr     points to the inverse correlation matrix buffer.
+   * @param[in]  pGain        points to a working buffer of numTaps values.
+   * @param[in]  lambda       forgetting factor.
+   * @param[in]  delta        initial value of the diagonal of the inverse correlation matrix.
+   * @param[in]  blockSize    number of samples to process.
+   */
+  void arm_rls_init_f32(
+        arm_rls_instance_f32 * S,
+        uint16_t numTaps,
+        uint16_t numChannels,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t * pInvCorr,
+        float32_t * pGain,
+        float32_t lambda,
+        float32_t delta,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point RLS filter.
+   * @param[in,out] S          points to an instance of the floating-point RLS filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     pRef       points to the blocks of reference data of the channels.
+   * @param[out]    pOut       points to the blocks of output data of the channels.
+   * @param[out]    pErr       points to the blocks of error data of the channels.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_rls_f32(
+  const arm_rls_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr,
+        uint32_t blockSize);
+
+
   /**
    * @brief Correlation of floating-point sequences.
    * @param[in]  pSrcA    points to the first input sequence.
@@ -2522,6 +2844,98 @@ void arm_levinson_durbin_q31(const q31_t *phi,
   q31_t *err,
   int nbCoefs);
 
+  /**
+   * @brief Instance structure for the floating-point Kalman filter.
+   */
+  typedef struct
+  {
+          uint16_t numStates;       /**< number of states n. */
+          uint16_t numMeas;         /**< number of measurements m. */
+          float32_t *pState;        /**< points to the state vector of n values. */
+          float32_t *pCov;          /**< points to the n x n state covariance matrix. */
+          float32_t *pScratch;      /**< points to the work buffer of arm_kalman_get_buffer_size_f32() values. */
+  } arm_kalman_instance_f32;
+
+  /**
+   * @brief  Size of the work buffer of the floating-point Kalman filter.
+   * @param[in] numStates  number of states
+   * @param[in] numMeas    number of measurements
+   * @return    number of float32_t values of the work buffer
+   */
+  uint32_t arm_kalman_get_buffer_size_f32(
+        uint16_t numStates,
+        uint16_t numMeas);
+
+  /**
+   * @brief  Initialization function for the floating-point Kalman filter.
+   * @param[in,out] S          points to an instance of the Kalman filter structure
+   * @param[in]     numStates  number of states
+   * @param[in]     numMeas    number of measurements
+   * @param[in]     pState     points to the initial state vector
+   * @param[in]     pCov       points to the initial state covariance matrix
+   * @param[in]     pScratch   points to the work buffer
+   * @return        execution status
+   */
+  arm_status arm_kalman_init_f32(
+        arm_kalman_instance_f32 * S,
+        uint16_t numStates,
+        uint16_t numMeas,
+        float32_t * pState,
+        float32_t * pCov,
+        float32_t * pScratch);
+
+  /**
+   * @brief  Floating-point Kalman filter prediction of state and covariance.
+   * @param[in,out] S   points to an instance of the Kalman filter structure
+   * @param[in]     pF  points to the transition matrix
+   * @param[in]     pQ  points to the process noise covariance
+   * @return        execution status
+   */
+  arm_status arm_kalman_predict_f32(
+        arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pF,
+  const arm_matrix_instance_f32 * pQ);
+
+  /**
+   * @brief  Floating-point Kalman filter prediction of the covariance only.
+   * @param[in,out] S   points to an instance of the Kalman filter structure
+   * @param[in]     pF  points to the transition matrix or its Jacobian
+   * @param[in]     pQ  points to the process noise covariance
+   * @return        execution status
+   */
+  arm_status arm_kalman_predict_cov_f32(
+        arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pF,
+  const arm_matrix_instance_f32 * pQ);
+
+  /**
+   * @brief  Floating-point Kalman filter update from a measurement.
+   * @param[in,out] S   points to an instance of the Kalman filter structure
+   * @param[in]     pH  points to the observation matrix
+   * @param[in]     pR  points to the measurement noise covariance
+   * @param[in]     pZ  points to the measurement
+   * @return        execution status
+   */
+  arm_status arm_kalman_update_f32(
+        arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pH,
+  const arm_matrix_instance_f32 * pR,
+  const float32_t * pZ);
+
+  /**
+   * @brief  Floating-point Kalman filter update from an innovation.
+   * @param[in,out] S       points to an instance of the Kalman filter structure
+   * @param[in]     pH      points to the observation matrix or its Jacobian
+   * @param[in]     pR      points to the measurement noise covariance
+   * @param[in]     pInnov  points to the innovation
+   * @return        execution status
+   */
+  arm_status arm_kalman_update_innov_f32(
+        arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pH,
+  const arm_matrix_instance_f32 * pR,
+  const float32_t * pInnov);
+
 #ifdef   __cplusplus
 }
 #endif
@@ -120,6 +120,57 @@ extern "C"
     float32_t * coeffs;        /**< Coefficients buffer (b,c, and d) */
   } arm_spline_instance_f32;
 
+  /**
+   * @brief Search structure of a non-uniform interpolation axis.
+   */
+  typedef struct
+  {
+          uint32_t nValues;           /**< number of breakpoints */
+    const float32_t *pValues;         /**< points to the strictly increasing breakpoints */
+          uint32_t numBuckets;        /**< number of buckets of the index (0 : binary search) */
+    const uint16_t *pBucket;          /**< points to the first segment of each bucket */
+          float32_t invBucketWidth;   /**< number of buckets per unit of the axis */
+          uint32_t segment;           /**< segment of the last query */
+  } arm_interp_axis_f32;
+
+  /**
+   * @brief Instance structure for the floating-point non-uniform linear interpolation.
+   */
+  typedef struct
+  {
+          arm_interp_axis_f32 axis;   /**< x breakpoints */
+    const float32_t *pYData;          /**< points to the table of Y values */
+  } arm_nonuniform_interp_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point non-uniform bilinear interpolation.
+   */
+  typedef struct
+  {
+          arm_interp_axis_f32 xAxis;  /**< x breakpoints (columns of the table) */
+          arm_interp_axis_f32 yAxis;  /**< y breakpoints (rows of the table) */
+    const float32_t *pData;           /**< points to the data table */
+  } arm_nonuniform_bilinear_interp_instance_f32;
+
+  /**
+   * @brief Instance structure for the streaming evaluation of a floating-point cubic spline.
+   */
+  typedef struct
+  {
+    const arm_spline_instance_f32 * pSpline;  /**< points to the initialized spline */
+          arm_interp_axis_f32 axis;           /**< knots of the spline, segment of the last sample */
+  } arm_spline_stream_instance_f32;
+
+  /**
+   * @brief Instance structure for the evaluation of a floating-point cubic spline on uniform knots.
+   */
+  typedef struct
+  {
+    const arm_spline_instance_f32 * pSpline;  /**< points to the initialized spline */
+          float32_t x1;                       /**< first knot */
+          float32_t invSpacing;               /**< inverse of the knot spacing */
+  } arm_spline_uniform_instance_f32;
+
 
 
 
@@ -165,6 +216,58 @@ extern "C"
           float32_t * coeffs,
           float32_t * tempBuffer);
 
+  /**
+   * @brief Initialization function for the streaming evaluation of a floating-point cubic spline.
+   * @param[out] S           points to an instance of the streaming spline structure.
+   * @param[in]  pSpline     points to an initialized spline instance.
+   * @param[out] pBucket     points to the bucket index of numBuckets values (NULL when numBuckets is 0).
+   * @param[in]  numBuckets  number of buckets of the knot index, 0 for a binary search.
+   * @return execution status, see arm_interp_axis_init_f32
+   */
+  arm_status arm_spline_stream_init_f32(
+          arm_spline_stream_instance_f32 * S,
+    const arm_spline_instance_f32 * pSpline,
+          uint16_t * pBucket,
+          uint32_t numBuckets);
+
+  /**
+   * @brief Streaming evaluation of a floating-point cubic spline.
+   * @param[in,out] S          points to an instance of the streaming spline structure.
+   * @param[in]     xq         points to the x values of the interpolated data points.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples of output data.
+   */
+  void arm_spline_stream_f32(
+          arm_spline_stream_instance_f32 * S,
+    const float32_t * xq,
+          float32_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the evaluation of a floating-point cubic spline on uniform knots.
+   * @param[out] S        points to an instance of the uniform spline structure.
+   * @param[in]  pSpline  points to an initialized spline instance with uniformly spaced knots.
+   * @return execution status
+   *                - \ref ARM_MATH_SUCCESS       : Operation successful
+   *                - \ref ARM_MATH_ARGUMENT_ERROR : knots are not uniformly spaced
+   */
+  arm_status arm_spline_uniform_init_f32(
+          arm_spline_uniform_instance_f32 * S,
+    const arm_spline_instance_f32 * pSpline);
+
+  /**
+   * @brief Evaluation of a floating-point cubic spline on uniform knots.
+   * @param[in]  S          points to an instance of the uniform spline structure.
+   * @param[in]  xq         points to the x values of the interpolated data points.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples of output data.
+   */
+  void arm_spline_uniform_f32(
+    const arm_spline_uniform_instance_f32 * S,
+    const float32_t * xq,
+          float32_t * pDst,
+          uint32_t blockSize);
+
 
   /**
    * @} end of SplineInterpolate group
@@ -311,6 +414,129 @@ q7_t arm_linear_interp_q7(
    */
 
 
+  /**
+   * @addtogroup NonUniformInterpolate
+   * @{
+   */
+
+  /**
+   * @brief Initialization function for a non-uniform interpolation axis.
+   * @param[out] A           points to the axis structure.
+   * @param[in]  pValues     points to the strictly increasing breakpoints.
+   * @param[in]  nValues     number of breakpoints.
+   * @param[out] pBucket     points to the bucket index of numBuckets values (NULL when numBuckets is 0).
+   * @param[in]  numBuckets  number of buckets of the index, 0 for a binary search.
+   * @return execution status
+   *                - \ref ARM_MATH_SUCCESS       : Operation successful
+   *                - \ref ARM_MATH_ARGUMENT_ERROR : less than 2 breakpoints or more than 65536
+   *                                                 with a bucket index
+   */
+  arm_status arm_interp_axis_init_f32(
+          arm_interp_axis_f32 * A,
+    const float32_t * pValues,
+          uint32_t nValues,
+          uint16_t * pBucket,
+          uint32_t numBuckets);
+
+  /**
+   * @brief Initialization function for the floating-point non-uniform linear interpolation.
+   * @param[out] S           points to an instance of the non-uniform interpolation structure.
+   * @param[in]  pXData      points to the strictly increasing x breakpoints.
+   * @param[in]  pYData      points to the y values at the breakpoints.
+   * @param[in]  nValues     number of breakpoints.
+   * @param[out] pBucket     points to the bucket index of numBuckets values (NULL when numBuckets is 0).
+   * @param[in]  numBuckets  number of buckets of the index, 0 for a binary search.
+   * @return execution status, see arm_interp_axis_init_f32
+   */
+  arm_status arm_nonuniform_interp_init_f32(
+          arm_nonuniform_interp_instance_f32 * S,
+    const float32_t * pXData,
+    const float32_t * pYData,
+          uint32_t nValues,
+          uint16_t * pBucket,
+          uint32_t numBuckets);
+
+  /**
+   * @brief Floating-point non-uniform linear interpolation of one point.
+   * @param[in,out] S  points to an instance of the non-uniform interpolation structure.
+   * @param[in]     x  input sample to process
+   * @return interpolated value
+   */
+  float32_t arm_nonuniform_interp_f32(
+    arm_nonuniform_interp_instance_f32 * S,
+    float32_t x);
+
+  /**
+   * @brief Floating-point non-uniform linear interpolation of a block of points.
+   * @param[in,out] S          points to an instance of the non-uniform interpolation structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of interpolated values.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_nonuniform_interp_block_f32(
+          arm_nonuniform_interp_instance_f32 * S,
+    const float32_t * pSrc,
+          float32_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the floating-point non-uniform bilinear interpolation.
+   * @param[out] S            points to an instance of the non-uniform bilinear interpolation structure.
+   * @param[in]  pXValues     points to the numCols strictly increasing x breakpoints.
+   * @param[in]  numCols      number of columns of the table.
+   * @param[in]  pYValues     points to the numRows strictly increasing y breakpoints.
+   * @param[in]  numRows      number of rows of the table.
+   * @param[in]  pData        points to the numRows*numCols table, element (x,y) at pData[x + y*numCols].
+   * @param[out] pXBucket     points to the bucket index of the x axis (NULL when numXBuckets is 0).
+   * @param[in]  numXBuckets  number of buckets of the x axis.
+   * @param[out] pYBucket     points to the bucket index of the y axis (NULL when numYBuckets is 0).
+   * @param[in]  numYBuckets  number of buckets of the y axis.
+   * @return execution status, see arm_interp_axis_init_f32
+   */
+  arm_status arm_nonuniform_bilinear_interp_init_f32(
+          arm_nonuniform_bilinear_interp_instance_f32 * S,
+    const float32_t * pXValues,
+          uint32_t numCols,
+    const float32_t * pYValues,
+          uint32_t numRows,
+    const float32_t * pData,
+          uint16_t * pXBucket,
+          uint32_t numXBuckets,
+          uint16_t * pYBucket,
+          uint32_t numYBuckets);
+
+  /**
+   * @brief Floating-point non-uniform bilinear interpolation of one point.
+   * @param[in,out] S  points to an instance of the non-uniform bilinear interpolation structure.
+   * @param[in]     X  interpolation coordinate.
+   * @param[in]     Y  interpolation coordinate.
+   * @return interpolated value
+   */
+  float32_t arm_nonuniform_bilinear_interp_f32(
+    arm_nonuniform_bilinear_interp_instance_f32 * S,
+    float32_t X,
+    float32_t Y);
+
+  /**
+   * @brief Floating-point non-uniform bilinear interpolation of a block of points.
+   * @param[in,out] S          points to an instance of the non-uniform bilinear interpolation structure.
+   * @param[in]     pX         points to the block of x coordinates.
+   * @param[in]     pY         points to the block of y coordinates.
+   * @param[out]    pDst       points to the block of interpolated values.
+   * @param[in]     blockSize  number of points to process.
+   */
+  void arm_nonuniform_bilinear_interp_block_f32(
+          arm_nonuniform_bilinear_interp_instance_f32 * S,
+    const float32_t * pX,
+    const float32_t * pY,
+          float32_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @} end of NonUniformInterpolate group
+   */
+
+
 
 #ifdef   __cplusplus
 }
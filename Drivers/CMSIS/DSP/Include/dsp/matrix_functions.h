@@ -159,6 +159,34 @@ extern "C"
     q31_t *pData;         /**< points to the data of the matrix. */
   } arm_matrix_instance_q31;
 
+  /**
+   * @brief Instance structure for the floating-point packed symmetric matrix structure.
+   *
+   * Only the lower triangle is stored, row by row.
+   * Element (i,j) with j <= i is at <code>pData[i*(i+1)/2 + j]</code>.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows and columns of the matrix.                   */
+    float32_t *pData;     /**< points to the numRows*(numRows+1)/2 values of the matrix.   */
+  } arm_matrix_sym_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point banded matrix structure.
+   *
+   * Each row stores its numLower + numUpper + 1 values inside the band contiguously.
+   * Element (i,j) with i - numLower <= j <= i + numUpper is at
+   * <code>pData[i*(numLower+numUpper) + j]</code>, so the data array holds
+   * <code>(numRows-1)*(numLower+numUpper+1) + 1</code> values.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows and columns of the matrix.   */
+    uint16_t numLower;    /**< number of sub-diagonals inside the band.    */
+    uint16_t numUpper;    /**< number of super-diagonals inside the band.  */
+    float32_t *pData;     /**< points to the data of the matrix.           */
+  } arm_matrix_band_instance_f32;
+
   /**
    * @brief Floating-point matrix addition.
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -334,12 +362,26 @@ arm_status arm_mat_cmplx_trans_q31(
    * @param[out] pDst   points to output matrix structure
    * @return     The function returns either
    * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @par    The generic (non Neon, non Helium) version is tiled only when ARM_MATH_LOOPUNROLL is defined.
    */
 arm_status arm_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcA,
   const arm_matrix_instance_f32 * pSrcB,
         arm_matrix_instance_f32 * pDst);
 
+  /**
+   * @brief Floating-point matrix multiplication by a transposed matrix with accumulation
+   * @param[in]     pSrcA  points to the first input matrix structure
+   * @param[in]     pSrcB  points to the second input matrix structure
+   * @param[in,out] pDst   points to output matrix structure, pDst += pSrcA * pSrcB'
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_trans_acc_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
   /**
    * @brief Floating-point matrix multiplication
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -750,6 +792,215 @@ void arm_mat_init_f32(
   arm_matrix_instance_f64 * d,
   uint16_t * pp);
 
+  /**
+   * @brief Floating-point packed symmetric matrix initialization.
+   * @param[in,out] S      points to an instance of the packed symmetric matrix structure
+   * @param[in]     nRows  number of rows and columns of the matrix
+   * @param[in]     pData  points to the packed lower triangle
+   */
+  void arm_mat_sym_init_f32(
+        arm_matrix_sym_instance_f32 * S,
+        uint16_t nRows,
+        float32_t * pData);
+
+  /**
+   * @brief Floating-point packed symmetric matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to input vector
+   * @param[out] pDst     points to output vector
+   */
+  void arm_mat_sym_vec_mult_f32(
+  const arm_matrix_sym_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst);
+
+  /**
+   * @brief Floating-point Cholesky decomposition of a packed symmetric positive-definite matrix.
+   * @param[in]  src  points to the instance of the input matrix structure
+   * @param[out] dst  points to the instance of the packed lower triangular factor
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_DECOMPOSITION_FAILURE, if the matrix is not positive definite.
+   */
+  arm_status arm_mat_sym_cholesky_f32(
+  const arm_matrix_sym_instance_f32 * src,
+        arm_matrix_sym_instance_f32 * dst);
+
+  /**
+   * @brief Solve A x = b from the packed Cholesky factor of A.
+   * @param[in]  l    points to the packed lower triangular factor
+   * @param[in]  pB   points to the right hand side vector
+   * @param[out] pX   points to the solution vector
+   */
+  void arm_mat_sym_cholesky_solve_f32(
+  const arm_matrix_sym_instance_f32 * l,
+  const float32_t * pB,
+        float32_t * pX);
+
+  /**
+   * @brief Floating-point banded matrix initialization.
+   * @param[in,out] S          points to an instance of the banded matrix structure
+   * @param[in]     nRows      number of rows and columns of the matrix
+   * @param[in]     numLower   number of sub-diagonals
+   * @param[in]     numUpper   number of super-diagonals
+   * @param[in]     pData      points to the band values
+   */
+  void arm_mat_band_init_f32(
+        arm_matrix_band_instance_f32 * S,
+        uint16_t nRows,
+        uint16_t numLower,
+        uint16_t numUpper,
+        float32_t * pData);
+
+  /**
+   * @brief Floating-point banded matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to input vector
+   * @param[out] pDst     points to output vector
+   */
+  void arm_mat_band_vec_mult_f32(
+  const arm_matrix_band_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst);
+
+  /**
+   * @brief In-place LU decomposition without pivoting of a banded matrix.
+   * @param[in,out] S  points to the banded matrix, overwritten by its L and U factors
+   * @return The function returns ARM_MATH_SINGULAR if a pivot is zero.
+   */
+  arm_status arm_mat_band_lu_f32(
+        arm_matrix_band_instance_f32 * S);
+
+  /**
+   * @brief Solve A x = b from the banded LU factors of A.
+   * @param[in]  lu   points to the factors computed by arm_mat_band_lu_f32()
+   * @param[in]  pB   points to the right hand side vector
+   * @param[out] pX   points to the solution vector
+   */
+  void arm_mat_band_lu_solve_f32(
+  const arm_matrix_band_instance_f32 * lu,
+  const float32_t * pB,
+        float32_t * pX);
+
+  /**
+   * @brief Floating-point Cholesky decomposition of a symmetric positive-definite banded matrix.
+   * @param[in]  src  points to the instance of the input matrix structure
+   * @param[out] dst  points to the instance of the banded lower triangular factor
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_DECOMPOSITION_FAILURE, if the matrix is not positive definite.
+   */
+  arm_status arm_mat_band_cholesky_f32(
+  const arm_matrix_band_instance_f32 * src,
+        arm_matrix_band_instance_f32 * dst);
+
+  /**
+   * @brief Solve A x = b from the banded Cholesky factor of A.
+   * @param[in]  l    points to the factor computed by arm_mat_band_cholesky_f32()
+   * @param[in]  pB   points to the right hand side vector
+   * @param[out] pX   points to the solution vector
+   */
+  void arm_mat_band_cholesky_solve_f32(
+  const arm_matrix_band_instance_f32 * l,
+  const float32_t * pB,
+        float32_t * pX);
+
+  /**
+   * @brief Floating-point batched 3x3 matrix multiplication
+   * @param[in]  pSrcA        points to the first batch of input matrices
+   * @param[in]  pSrcB        points to the second batch of input matrices
+   * @param[out] pDst         points to the batch of output matrices
+   * @param[in]  numMatrices  number of matrices in each batch
+   */
+  void arm_mat_mult_batch_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t numMatrices);
+
+  /**
+   * @brief Floating-point batched 4x4 matrix multiplication
+   * @param[in]  pSrcA        points to the first batch of input matrices
+   * @param[in]  pSrcB        points to the second batch of input matrices
+   * @param[out] pDst         points to the batch of output matrices
+   * @param[in]  numMatrices  number of matrices in each batch
+   */
+  void arm_mat_mult_batch_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t numMatrices);
+
+  /**
+   * @brief Floating-point batched 3x3 matrix and vector multiplication
+   * @param[in]  pSrcMat      points to the batch of input matrices
+   * @param[in]  pVec         points to the batch of input vectors
+   * @param[out] pDst         points to the batch of output vectors
+   * @param[in]  numMatrices  number of matrices in each batch
+   */
+  void arm_mat_vec_mult_batch_3x3_f32(
+  const float32_t * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst,
+        uint32_t numMatrices);
+
+  /**
+   * @brief Floating-point batched 4x4 matrix and vector multiplication
+   * @param[in]  pSrcMat      points to the batch of input matrices
+   * @param[in]  pVec         points to the batch of input vectors
+   * @param[out] pDst         points to the batch of output vectors
+   * @param[in]  numMatrices  number of matrices in each batch
+   */
+  void arm_mat_vec_mult_batch_4x4_f32(
+  const float32_t * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst,
+        uint32_t numMatrices);
+
+  /**
+   * @brief Floating-point batched 3x3 matrix inversion
+   * @param[in]  pSrc         points to the batch of input matrices
+   * @param[out] pDst         points to the batch of output matrices
+   * @param[in]  numMatrices  number of matrices in each batch
+   * @return     ARM_MATH_SINGULAR if one of the matrices is singular, ARM_MATH_SUCCESS otherwise
+   */
+  arm_status arm_mat_inverse_batch_3x3_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numMatrices);
+
+  /**
+   * @brief Floating-point batched 4x4 matrix inversion
+   * @param[in]  pSrc         points to the batch of input matrices
+   * @param[out] pDst         points to the batch of output matrices
+   * @param[in]  numMatrices  number of matrices in each batch
+   * @return     ARM_MATH_SINGULAR if one of the matrices is singular, ARM_MATH_SUCCESS otherwise
+   */
+  arm_status arm_mat_inverse_batch_4x4_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numMatrices);
+
+  /**
+   * @brief Floating-point batched 3x3 matrix transposition
+   * @param[in]  pSrc         points to the batch of input matrices
+   * @param[out] pDst         points to the batch of output matrices
+   * @param[in]  numMatrices  number of matrices in each batch
+   */
+  void arm_mat_trans_batch_3x3_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numMatrices);
+
+  /**
+   * @brief Floating-point batched 4x4 matrix transposition
+   * @param[in]  pSrc         points to the batch of input matrices
+   * @param[out] pDst         points to the batch of output matrices
+   * @param[in]  numMatrices  number of matrices in each batch
+   */
+  void arm_mat_trans_batch_4x4_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numMatrices);
+
 #ifdef   __cplusplus
 }
 #endif
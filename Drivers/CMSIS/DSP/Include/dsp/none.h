@@ -127,6 +127,23 @@ __STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
   return (op1 >> op2) | (op1 << (32U - op2));
 }
 
+ /**
+  \brief   Data Memory Barrier
+  \details Full memory barrier of the host compiler.
+ */
+#if defined ( _MSC_VER )
+#include <intrin.h>
+__STATIC_FORCEINLINE void __DMB(void)
+{
+  _ReadWriteBarrier();
+}
+#else
+__STATIC_FORCEINLINE void __DMB(void)
+{
+  __sync_synchronize();
+}
+#endif
+
 
 #endif
 
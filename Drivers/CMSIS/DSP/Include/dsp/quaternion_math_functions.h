@@ -152,6 +152,109 @@ void arm_rotation2quaternion_f32(const float32_t *pInputRotations,
     float32_t *pOutputQuaternions,  
     uint32_t nbQuaternions);
 
+/**
+  @brief         Floating-point elementwise product of quaternions in structure of arrays layout.
+  @param[in]     qa                  First array of quaternions
+  @param[in]     qb                  Second array of quaternions
+  @param[out]    qr                  Elementwise product of quaternions
+  @param[in]     nbQuaternions       Number of quaternions in the array
+  @return        none
+ */
+void arm_quaternion_product_soa_f32(const float32_t *qa, 
+    const float32_t *qb, 
+    float32_t *qr,
+    uint32_t nbQuaternions);
+
+/**
+  @brief         Floating-point normalization of quaternions in structure of arrays layout.
+  @param[in]     pInputQuaternions            points to the input array of quaternions
+  @param[out]    pNormalizedQuaternions       points to the output array of normalized quaternions
+  @param[in]     nbQuaternions                number of quaternions in each array
+  @return        none
+ */
+void arm_quaternion_normalize_soa_f32(const float32_t *pInputQuaternions, 
+    float32_t *pNormalizedQuaternions, 
+    uint32_t nbQuaternions);
+
+/**
+  @brief         Conversion of quaternions to equivalent rotation matrices in structure of arrays layout.
+  @param[in]     pInputQuaternions   points to an array of normalized quaternions
+  @param[out]    pOutputRotations    points to an array of 3x3 rotations
+  @param[in]     nbQuaternions       number of quaternions in the array
+  @return        none
+ */
+void arm_quaternion2rotation_soa_f32(const float32_t *pInputQuaternions, 
+    float32_t *pOutputRotations, 
+    uint32_t nbQuaternions);
+
+/**
+  @brief Instance structure for the floating-point attitude estimation.
+ */
+typedef struct
+{
+  float32_t state[4];     /**< attitude quaternion, rotating the body frame into the reference frame */
+  float32_t dt;           /**< sampling period in seconds */
+  float32_t gain;         /**< correction gain in rad/s */
+} arm_attitude_instance_f32;
+
+/**
+  @brief         Initialization function for the floating-point attitude estimation.
+  @param[out]    S             points to an instance of the attitude structure
+  @param[in]     samplePeriod  sampling period in seconds
+  @param[in]     gain          correction gain in rad/s
+  @return        none
+ */
+void arm_attitude_init_f32(
+  arm_attitude_instance_f32 * S,
+  float32_t samplePeriod,
+  float32_t gain);
+
+/**
+  @brief         Floating-point attitude integration of gyroscope samples.
+  @param[in,out] S          points to an instance of the attitude structure
+  @param[in]     pGyro      points to the angular rates (3 values per sample)
+  @param[out]    pDst       points to the attitudes (4 values per sample)
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_attitude_gyro_f32(
+        arm_attitude_instance_f32 * S,
+  const float32_t * pGyro,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point complementary attitude filter.
+  @param[in,out] S          points to an instance of the attitude structure
+  @param[in]     pGyro      points to the angular rates (3 values per sample)
+  @param[in]     pAccel     points to the accelerations (3 values per sample)
+  @param[out]    pDst       points to the attitudes (4 values per sample)
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_attitude_complementary_f32(
+        arm_attitude_instance_f32 * S,
+  const float32_t * pGyro,
+  const float32_t * pAccel,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point Madgwick attitude filter.
+  @param[in,out] S          points to an instance of the attitude structure
+  @param[in]     pGyro      points to the angular rates (3 values per sample)
+  @param[in]     pAccel     points to the accelerations (3 values per sample)
+  @param[out]    pDst       points to the attitudes (4 values per sample)
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_attitude_madgwick_f32(
+        arm_attitude_instance_f32 * S,
+  const float32_t * pGyro,
+  const float32_t * pAccel,
+        float32_t * pDst,
+        uint32_t blockSize);
+
 #ifdef   __cplusplus
 }
 #endif
@@ -970,6 +970,210 @@ void arm_mse_f64(
         uint32_t blockSize,
         float64_t * pResult);
 
+/**
+ * @brief Instance structure for the floating-point sliding window statistics.
+ */
+typedef struct
+{
+          uint32_t windowSize;        /**< number of samples of the window. */
+          uint32_t numSamples;        /**< number of samples currently in the window. */
+          uint32_t writeIndex;        /**< position of the next sample in the history. */
+          uint32_t maxHead;           /**< position of the first element of the maximum queue. */
+          uint32_t maxCount;          /**< number of elements of the maximum queue. */
+          uint32_t minHead;           /**< position of the first element of the minimum queue. */
+          uint32_t minCount;          /**< number of elements of the minimum queue. */
+          float32_t reference;        /**< reference subtracted from the samples by the Welford updates. */
+          float32_t mean;             /**< running mean of the window minus the reference (Welford). */
+          float32_t m2;               /**< running sum of squared differences to the mean (Welford). */
+          float32_t m2Max;            /**< largest value of m2 since it was last computed exactly. */
+          float32_t invWindowSize;    /**< inverse of the window size. */
+          float32_t freshMean;        /**< mean of the samples received since the history index wrapped. */
+          float32_t freshM2;          /**< sum of squared differences of the samples received since the history index wrapped. */
+          float32_t *pHistory;        /**< points to the history of length windowSize. */
+          uint32_t *pQueue;           /**< points to the minimum and maximum queues of length 2*windowSize. */
+} arm_sliding_stats_instance_f32;
+
+/**
+ * @brief Result structure for the floating-point sliding window statistics.
+ */
+typedef struct
+{
+          float32_t mean;             /**< mean of the window. */
+          float32_t var;              /**< variance of the window. */
+          float32_t rms;              /**< root mean square of the window. */
+          float32_t min;              /**< minimum of the window. */
+          float32_t max;              /**< maximum of the window. */
+} arm_sliding_stats_result_f32;
+
+/**
+  @brief         Initialization function for the floating-point sliding window statistics.
+  @param[in,out] S           points to an instance of the sliding window statistics structure
+  @param[in]     windowSize  number of samples of the window
+  @param[in]     pHistory    points to the history buffer of length windowSize
+  @param[in]     pQueue      points to the queue buffer of length 2*windowSize
+  @return        none
+ */
+void arm_sliding_stats_init_f32(
+        arm_sliding_stats_instance_f32 * S,
+        uint32_t windowSize,
+        float32_t * pHistory,
+        uint32_t * pQueue);
+
+/**
+  @brief         Adds a block of samples to the floating-point sliding window statistics.
+  @param[in,out] S          points to an instance of the sliding window statistics structure
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @return        none
+ */
+void arm_sliding_stats_f32(
+        arm_sliding_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+/**
+  @brief         Statistics of the current window for the floating-point sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  points to the statistics of the window
+  @return        none
+ */
+void arm_sliding_stats_get_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        arm_sliding_stats_result_f32 * pResult);
+
+/**
+ * @brief Instance structure for the Q31 sliding window statistics.
+ */
+typedef struct
+{
+          uint32_t windowSize;        /**< number of samples of the window. */
+          uint32_t numSamples;        /**< number of samples currently in the window. */
+          uint32_t writeIndex;        /**< position of the next sample in the history. */
+          uint32_t maxHead;           /**< position of the first element of the maximum queue. */
+          uint32_t maxCount;          /**< number of elements of the maximum queue. */
+          uint32_t minHead;           /**< position of the first element of the minimum queue. */
+          uint32_t minCount;          /**< number of elements of the minimum queue. */
+          q63_t sum;                  /**< sum of the samples of the window. */
+          q63_t sumScaled;            /**< sum of the samples of the window in 9.23 format. */
+          q63_t sumOfSquares;         /**< sum of the squares of the samples of the window in 18.46 format. */
+          q31_t *pHistory;            /**< points to the history of length windowSize. */
+          uint32_t *pQueue;           /**< points to the minimum and maximum queues of length 2*windowSize. */
+} arm_sliding_stats_instance_q31;
+
+/**
+ * @brief Result structure for the Q31 sliding window statistics.
+ */
+typedef struct
+{
+          q31_t mean;                 /**< mean of the window. */
+          q31_t var;                  /**< variance of the window. */
+          q31_t rms;                  /**< root mean square of the window. */
+          q31_t min;                  /**< minimum of the window. */
+          q31_t max;                  /**< maximum of the window. */
+} arm_sliding_stats_result_q31;
+
+/**
+  @brief         Initialization function for the Q31 sliding window statistics.
+  @param[in,out] S           points to an instance of the sliding window statistics structure
+  @param[in]     windowSize  number of samples of the window
+  @param[in]     pHistory    points to the history buffer of length windowSize
+  @param[in]     pQueue      points to the queue buffer of length 2*windowSize
+  @return        none
+ */
+void arm_sliding_stats_init_q31(
+        arm_sliding_stats_instance_q31 * S,
+        uint32_t windowSize,
+        q31_t * pHistory,
+        uint32_t * pQueue);
+
+/**
+  @brief         Adds a block of samples to the Q31 sliding window statistics.
+  @param[in,out] S          points to an instance of the sliding window statistics structure
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @return        none
+ */
+void arm_sliding_stats_q31(
+        arm_sliding_stats_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize);
+
+/**
+  @brief         Statistics of the current window for the Q31 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  points to the statistics of the window
+  @return        none
+ */
+void arm_sliding_stats_get_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        arm_sliding_stats_result_q31 * pResult);
+
+/**
+ * @brief Instance structure for the Q15 sliding window statistics.
+ */
+typedef struct
+{
+          uint32_t windowSize;        /**< number of samples of the window. */
+          uint32_t numSamples;        /**< number of samples currently in the window. */
+          uint32_t writeIndex;        /**< position of the next sample in the history. */
+          uint32_t maxHead;           /**< position of the first element of the maximum queue. */
+          uint32_t maxCount;          /**< number of elements of the maximum queue. */
+          uint32_t minHead;           /**< position of the first element of the minimum queue. */
+          uint32_t minCount;          /**< number of elements of the minimum queue. */
+          q63_t sum;                  /**< sum of the samples of the window. */
+          q63_t sumOfSquares;         /**< sum of the squares of the samples of the window in 34.30 format. */
+          q15_t *pHistory;            /**< points to the history of length windowSize. */
+          uint32_t *pQueue;           /**< points to the minimum and maximum queues of length 2*windowSize. */
+} arm_sliding_stats_instance_q15;
+
+/**
+ * @brief Result structure for the Q15 sliding window statistics.
+ */
+typedef struct
+{
+          q15_t mean;                 /**< mean of the window. */
+          q15_t var;                  /**< variance of the window. */
+          q15_t rms;                  /**< root mean square of the window. */
+          q15_t min;                  /**< minimum of the window. */
+          q15_t max;                  /**< maximum of the window. */
+} arm_sliding_stats_result_q15;
+
+/**
+  @brief         Initialization function for the Q15 sliding window statistics.
+  @param[in,out] S           points to an instance of the sliding window statistics structure
+  @param[in]     windowSize  number of samples of the window
+  @param[in]     pHistory    points to the history buffer of length windowSize
+  @param[in]     pQueue      points to the queue buffer of length 2*windowSize
+  @return        none
+ */
+void arm_sliding_stats_init_q15(
+        arm_sliding_stats_instance_q15 * S,
+        uint32_t windowSize,
+        q15_t * pHistory,
+        uint32_t * pQueue);
+
+/**
+  @brief         Adds a block of samples to the Q15 sliding window statistics.
+  @param[in,out] S          points to an instance of the sliding window statistics structure
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @return        none
+ */
+void arm_sliding_stats_q15(
+        arm_sliding_stats_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize);
+
+/**
+  @brief         Statistics of the current window for the Q15 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  points to the statistics of the window
+  @return        none
+ */
+void arm_sliding_stats_get_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        arm_sliding_stats_result_q15 * pResult);
+
 #ifdef   __cplusplus
 }
 #endif
@@ -79,6 +79,30 @@ extern "C"
         uint32_t blockSize);
 
 
+  /**
+   * @brief Converts the elements of the floating-point vector to f16s vector.
+   * @param[in]  pSrc       points to the floating-point input vector
+   * @param[out] pDst       points to the f16s output vector
+   * @param[in]  blockSize  length of the input vector
+   */
+  void arm_float_to_f16s(
+  const float32_t * pSrc,
+        float16s_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Converts the elements of the f16s vector to floating-point vector.
+   * @param[in]  pSrc       points to the f16s input vector
+   * @param[out] pDst       points to the floating-point output vector
+   * @param[in]  blockSize  length of the input vector
+   */
+  void arm_f16s_to_float(
+  const float16s_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
   /**
    * @brief  Converts the elements of the Q31 vector to floating-point vector.
    * @param[in]  pSrc       is input pointer
@@ -282,6 +306,264 @@ extern "C"
     arm_sort_dir dir,
     float32_t * buffer);
 
+  /**
+   * @brief Selection of the k-th smallest floating-point value.
+   * @param[in,out] pSrc       points to the input vector, reordered by the selection.
+   * @param[in]     blockSize  number of samples in the vector.
+   * @param[in]     k          rank of the value to select (0 for the smallest).
+   * @param[out]    pResult    k-th smallest value.
+   * @return        execution status
+   */
+  arm_status arm_select_f32(
+    float32_t * pSrc,
+    uint32_t blockSize,
+    uint32_t k,
+    float32_t * pResult);
+
+  /**
+   * @brief Selection of the k-th smallest Q31 value.
+   * @param[in,out] pSrc       points to the input vector, reordered by the selection.
+   * @param[in]     blockSize  number of samples in the vector.
+   * @param[in]     k          rank of the value to select (0 for the smallest).
+   * @param[out]    pResult    k-th smallest value.
+   * @return        execution status
+   */
+  arm_status arm_select_q31(
+    q31_t * pSrc,
+    uint32_t blockSize,
+    uint32_t k,
+    q31_t * pResult);
+
+  /**
+   * @brief Selection of the k-th smallest Q15 value.
+   * @param[in,out] pSrc       points to the input vector, reordered by the selection.
+   * @param[in]     blockSize  number of samples in the vector.
+   * @param[in]     k          rank of the value to select (0 for the smallest).
+   * @param[out]    pResult    k-th smallest value.
+   * @return        execution status
+   */
+  arm_status arm_select_q15(
+    q15_t * pSrc,
+    uint32_t blockSize,
+    uint32_t k,
+    q15_t * pResult);
+
+  /**
+   * @brief Instance structure for the floating-point streaming top-k.
+   */
+  typedef struct
+  {
+    uint32_t numTop;         /**< Number of largest values to keep */
+    uint32_t numValues;      /**< Number of values currently kept */
+    float32_t * pHeap;       /**< Heap of the kept values */
+  } arm_topk_instance_f32;
+
+  /**
+   * @param[out]    S          points to an instance of the top-k structure.
+   * @param[in]     numTop     number of largest values to keep.
+   * @param[in]     pHeap      points to a buffer of numTop values.
+   */
+  void arm_topk_init_f32(
+    arm_topk_instance_f32 * S,
+    uint32_t numTop,
+    float32_t * pHeap);
+
+  /**
+   * @param[in,out] S          points to an instance of the top-k structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_topk_f32(
+          arm_topk_instance_f32 * S,
+    const float32_t * pSrc,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]     S          points to an instance of the top-k structure.
+   * @param[out]    pDst       points to the S->numValues largest values in descending order.
+   */
+  void arm_topk_get_f32(
+    const arm_topk_instance_f32 * S,
+          float32_t * pDst);
+
+  /**
+   * @brief Instance structure for the Q31 streaming top-k.
+   */
+  typedef struct
+  {
+    uint32_t numTop;         /**< Number of largest values to keep */
+    uint32_t numValues;      /**< Number of values currently kept */
+    q31_t * pHeap;           /**< Heap of the kept values */
+  } arm_topk_instance_q31;
+
+  /**
+   * @param[out]    S          points to an instance of the top-k structure.
+   * @param[in]     numTop     number of largest values to keep.
+   * @param[in]     pHeap      points to a buffer of numTop values.
+   */
+  void arm_topk_init_q31(
+    arm_topk_instance_q31 * S,
+    uint32_t numTop,
+    q31_t * pHeap);
+
+  /**
+   * @param[in,out] S          points to an instance of the top-k structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_topk_q31(
+          arm_topk_instance_q31 * S,
+    const q31_t * pSrc,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]     S          points to an instance of the top-k structure.
+   * @param[out]    pDst       points to the S->numValues largest values in descending order.
+   */
+  void arm_topk_get_q31(
+    const arm_topk_instance_q31 * S,
+          q31_t * pDst);
+
+  /**
+   * @brief Instance structure for the Q15 streaming top-k.
+   */
+  typedef struct
+  {
+    uint32_t numTop;         /**< Number of largest values to keep */
+    uint32_t numValues;      /**< Number of values currently kept */
+    q15_t * pHeap;           /**< Heap of the kept values */
+  } arm_topk_instance_q15;
+
+  /**
+   * @param[out]    S          points to an instance of the top-k structure.
+   * @param[in]     numTop     number of largest values to keep.
+   * @param[in]     pHeap      points to a buffer of numTop values.
+   */
+  void arm_topk_init_q15(
+    arm_topk_instance_q15 * S,
+    uint32_t numTop,
+    q15_t * pHeap);
+
+  /**
+   * @param[in,out] S          points to an instance of the top-k structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_topk_q15(
+          arm_topk_instance_q15 * S,
+    const q15_t * pSrc,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]     S          points to an instance of the top-k structure.
+   * @param[out]    pDst       points to the S->numValues largest values in descending order.
+   */
+  void arm_topk_get_q15(
+    const arm_topk_instance_q15 * S,
+          q15_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point running median.
+   */
+  typedef struct
+  {
+    uint32_t windowSize;     /**< Number of samples in the sliding window */
+    uint32_t numValues;      /**< Number of samples currently in the window */
+    uint32_t index;          /**< Position of the oldest sample in the history */
+    float32_t * pState;      /**< History followed by the sorted window (2*windowSize values) */
+  } arm_running_median_instance_f32;
+
+  /**
+   * @param[out]    S           points to an instance of the running median structure.
+   * @param[in]     windowSize  number of samples in the sliding window.
+   * @param[in]     pState      points to the state buffer of 2*windowSize values.
+   * @return        execution status
+   */
+  arm_status arm_running_median_init_f32(
+    arm_running_median_instance_f32 * S,
+    uint32_t windowSize,
+    float32_t * pState);
+
+  /**
+   * @param[in,out] S          points to an instance of the running median structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of medians.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_running_median_f32(
+          arm_running_median_instance_f32 * S,
+    const float32_t * pSrc,
+          float32_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 running median.
+   */
+  typedef struct
+  {
+    uint32_t windowSize;     /**< Number of samples in the sliding window */
+    uint32_t numValues;      /**< Number of samples currently in the window */
+    uint32_t index;          /**< Position of the oldest sample in the history */
+    q31_t * pState;          /**< History followed by the sorted window (2*windowSize values) */
+  } arm_running_median_instance_q31;
+
+  /**
+   * @param[out]    S           points to an instance of the running median structure.
+   * @param[in]     windowSize  number of samples in the sliding window.
+   * @param[in]     pState      points to the state buffer of 2*windowSize values.
+   * @return        execution status
+   */
+  arm_status arm_running_median_init_q31(
+    arm_running_median_instance_q31 * S,
+    uint32_t windowSize,
+    q31_t * pState);
+
+  /**
+   * @param[in,out] S          points to an instance of the running median structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of medians.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_running_median_q31(
+          arm_running_median_instance_q31 * S,
+    const q31_t * pSrc,
+          q31_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 running median.
+   */
+  typedef struct
+  {
+    uint32_t windowSize;     /**< Number of samples in the sliding window */
+    uint32_t numValues;      /**< Number of samples currently in the window */
+    uint32_t index;          /**< Position of the oldest sample in the history */
+    q15_t * pState;          /**< History followed by the sorted window (2*windowSize values) */
+  } arm_running_median_instance_q15;
+
+  /**
+   * @param[out]    S           points to an instance of the running median structure.
+   * @param[in]     windowSize  number of samples in the sliding window.
+   * @param[in]     pState      points to the state buffer of 2*windowSize values.
+   * @return        execution status
+   */
+  arm_status arm_running_median_init_q15(
+    arm_running_median_instance_q15 * S,
+    uint32_t windowSize,
+    q15_t * pState);
+
+  /**
+   * @param[in,out] S          points to an instance of the running median structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of medians.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_running_median_q15(
+          arm_running_median_instance_q15 * S,
+    const q15_t * pSrc,
+          q15_t * pDst,
+          uint32_t blockSize);
+
  
  
   /**
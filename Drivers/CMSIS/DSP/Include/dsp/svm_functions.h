@@ -122,6 +122,31 @@ typedef struct
   float32_t       gamma;                  /**< Gamma factor */
 } arm_svm_rbf_instance_f32;
 
+/**
+ * @brief Storage format of quantized support vectors.
+ */
+typedef enum
+{
+  ARM_SVM_SV_Q7  = 0,                     /**< int8 values, one scale per support vector */
+  ARM_SVM_SV_F16 = 1                      /**< IEEE half precision values stored as uint16_t */
+} arm_svm_sv_format;
+
+/**
+ * @brief Instance structure for rbf SVM prediction with quantized support vectors.
+ */
+typedef struct
+{
+  uint32_t        nbOfSupportVectors;     /**< Number of support vectors */
+  uint32_t        vectorDimension;        /**< Dimension of vector space */
+  float32_t       intercept;              /**< Intercept */
+  const float32_t *dualCoefficients;      /**< Dual coefficients */
+  arm_svm_sv_format format;               /**< Storage format of the support vectors */
+  const void      *supportVectors;        /**< Quantized support vectors */
+  const float32_t *supportScales;         /**< Scale of each support vector (NULL : 1) */
+  const int32_t   *classes;               /**< The two SVM classes */
+  float32_t       gamma;                  /**< Gamma factor */
+} arm_svm_rbf_quantized_instance_f32;
+
 /**
  * @brief Instance structure for sigmoid SVM prediction function.
  */
@@ -251,6 +276,77 @@ void arm_svm_rbf_predict_f32(const arm_svm_rbf_instance_f32 *S,
    const float32_t * in, 
    int32_t * pResult);
 
+/**
+ * @brief SVM rbf prediction of a batch of vectors
+ * @param[in]    S           Pointer to an instance of the rbf SVM structure.
+ * @param[in]    in          Pointer to the input vectors, one after the other
+ * @param[in]    numVectors  Number of input vectors
+ * @param[out]   pResult     Decision value of each input vector
+ * @return none.
+ *
+ */
+void arm_svm_rbf_predict_batch_f32(const arm_svm_rbf_instance_f32 *S,
+   const float32_t * in,
+   uint32_t numVectors,
+   int32_t * pResult);
+
+/**
+ * @brief        Quantization of support vectors to int8 with one scale per vector
+ * @param[in]    pSrc                   Support vectors, one after the other
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[out]   pDst                   Quantized support vectors
+ * @param[out]   pScales                Scale of each support vector
+ * @return none.
+ *
+ */
+void arm_svm_quantize_q7(const float32_t *pSrc,
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  q7_t *pDst,
+  float32_t *pScales);
+
+/**
+ * @brief        SVM rbf instance init function with quantized support vectors
+ * @param[in]    S                      points to an instance of the quantized rbf SVM structure.
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[in]    intercept              Intercept
+ * @param[in]    dualCoefficients       Array of dual coefficients
+ * @param[in]    format                 Storage format of the support vectors
+ * @param[in]    supportVectors         Array of quantized support vectors
+ * @param[in]    supportScales          Array of support vector scales (NULL : 1)
+ * @param[in]    classes                Array of 2 classes ID
+ * @param[in]    gamma                  gamma (scikit-learn terminology)
+ * @return none.
+ *
+ */
+void arm_svm_rbf_quantized_init_f32(arm_svm_rbf_quantized_instance_f32 *S,
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  float32_t intercept,
+  const float32_t *dualCoefficients,
+  arm_svm_sv_format format,
+  const void *supportVectors,
+  const float32_t *supportScales,
+  const int32_t   *classes,
+  float32_t gamma
+  );
+
+/**
+ * @brief SVM rbf prediction of a batch of vectors with quantized support vectors
+ * @param[in]    S           Pointer to an instance of the quantized rbf SVM structure.
+ * @param[in]    in          Pointer to the input vectors, one after the other
+ * @param[in]    numVectors  Number of input vectors
+ * @param[out]   pResult     Decision value of each input vector
+ * @return none.
+ *
+ */
+void arm_svm_rbf_quantized_predict_f32(const arm_svm_rbf_quantized_instance_f32 *S,
+   const float32_t * in,
+   uint32_t numVectors,
+   int32_t * pResult);
+
 /**
  * @brief        SVM sigmoid instance init function
  * @param[in]    S                      points to an instance of the rbf SVM structure.
@@ -271,6 +271,17 @@ void arm_svm_sigmoid_predict_f16(const arm_svm_sigmoid_instance_f16 *S,
    const float16_t * in, 
    int32_t * pResult);
 
+/**
+ * @brief        Conversion of support vectors to half precision
+ * @param[in]    pSrc       Support vector values
+ * @param[out]   pDst       Half precision values stored as uint16_t
+ * @param[in]    numValues  Number of values
+ * @return none.
+ *
+ */
+void arm_svm_quantize_f16(const float32_t *pSrc,
+  uint16_t *pDst,
+  uint32_t numValues);
 
 
 #endif /*defined(ARM_FLOAT16_SUPPORTED)*/
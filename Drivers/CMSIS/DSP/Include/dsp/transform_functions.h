@@ -298,6 +298,69 @@ void arm_cfft_q31(
         uint8_t ifftFlag,
         uint8_t bitReverseFlag);
 
+#define ARM_CFFT_MIXED_MAX_STAGES 16 /**< Maximum number of radix stages of the mixed-radix CFFT */
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix and Bluestein CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                              /**< length of the FFT. */
+          uint16_t numStages;                           /**< number of radix stages (0 for Bluestein or after a failed init). */
+          uint8_t factors[ARM_CFFT_MIXED_MAX_STAGES];   /**< radix (2, 3, 4 or 5) of each stage. */
+    const float32_t *pTwiddle;                          /**< points to the twiddle factor table of fftLen complex values. */
+          uint16_t convLen;                             /**< power of two length of the Bluestein convolution. */
+    const float32_t *pChirp;                            /**< points to the Bluestein chirp of fftLen complex values (NULL when not used). */
+    const float32_t *pChirpFft;                         /**< points to the CFFT of the Bluestein kernel (convLen complex values). */
+          arm_cfft_instance_f32 cfft;                   /**< power of two CFFT used by the Bluestein algorithm. */
+  } arm_cfft_mixed_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point mixed-radix CFFT.
+   * @param[in,out] S       points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in]     fftLen  length of the FFT: 120, 240, 360, 480, 720, 1000, 1200 or 1500.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR when fftLen has no twiddle table.
+   */
+  arm_status arm_cfft_mixed_init_f32(
+        arm_cfft_mixed_instance_f32 * S,
+        uint16_t fftLen);
+
+  /**
+   * @brief  Size of the buffer of the floating-point Bluestein CFFT.
+   * @param[in]  fftLen  length of the FFT, from 2 to 2048.
+   * @return     number of float32_t values of the buffer, 0 when fftLen is not supported.
+   */
+  uint32_t arm_cfft_bluestein_get_buffer_size_f32(
+        uint16_t fftLen);
+
+  /**
+   * @brief  Initialization function for the floating-point Bluestein CFFT.
+   * @param[in,out] S        points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in]     fftLen   length of the FFT, from 2 to 2048.
+   * @param[in]     pBuffer  points to a buffer of arm_cfft_bluestein_get_buffer_size_f32() values.
+   *                         It is used by the instance and must stay valid while the instance is used.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR when fftLen is not supported
+   *                or the power of two CFFT of the convolution is not available.
+   */
+  arm_status arm_cfft_bluestein_init_f32(
+        arm_cfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pBuffer);
+
+  /**
+   * @brief  Processing function for the floating-point mixed-radix and Bluestein CFFT.
+   * @param[in]     S         points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in,out] p1        points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+   * @param[in]     ifftFlag  flag that selects the forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in,out] pTmp      points to a temporary buffer of <code>2*fftLen</code> values
+   *                          (<code>2*convLen</code> values when the Bluestein algorithm is used).
+   */
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag,
+        float32_t * pTmp);
+
 
   /**
    * @brief Instance structure for the Double Precision Floating-point CFFT/CIFFT function.
@@ -378,6 +441,10 @@ void arm_cfft_q31(
         q31_t * pSrc,
         q31_t * pDst);
 
+  void arm_rfft_inplace_q31(
+  const arm_rfft_instance_q31 * S,
+        q31_t * pSrc);
+
   /**
    * @brief Instance structure for the floating-point RFFT/RIFFT function.
    */
@@ -446,6 +513,217 @@ arm_status arm_rfft_fast_init_f32 (
         float32_t * p, float32_t * pOut,
         uint8_t ifftFlag);
 
+  void arm_rfft_fast_inplace_f32(
+        const arm_rfft_fast_instance_f32 * S,
+        float32_t * p,
+        uint8_t ifftFlag);
+
+  void arm_rfft_fast_f16s(
+        const arm_rfft_fast_instance_f32 * S,
+        const float16s_t * p, float16s_t * pOut,
+        float32_t * pTmp,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Output format of the STFT frames.
+   */
+  typedef enum
+  {
+    ARM_STFT_MAGNITUDE = 0,  /**< Frames contain the magnitude of each bin */
+    ARM_STFT_POWER = 1       /**< Frames contain the squared magnitude of each bin */
+  } arm_stft_output_type;
+
+  /**
+   * @brief Instance structure for the floating-point streaming STFT.
+   */
+  typedef struct
+  {
+          arm_rfft_fast_instance_f32 rfft; /**< Internal RFFT instance. */
+          uint16_t fftLen;                 /**< FFT length. */
+          uint16_t hopSize;                /**< Number of new samples between two frames. */
+          uint16_t numFrames;              /**< Number of frames in the output ring. */
+          uint16_t outputType;             /**< Output format (arm_stft_output_type). */
+    const float32_t *pWindow;              /**< Points to the analysis window of fftLen samples. */
+          float32_t *pHistory;             /**< Circular input history of fftLen samples. */
+          float32_t *pTmp;                 /**< FFT working buffer of fftLen samples. */
+          float32_t *pFrames;              /**< Output ring of numFrames frames of fftLen/2+1 bins. */
+          uint32_t historyIndex;           /**< Write position in the input history. */
+          uint32_t samplesToFrame;         /**< Number of samples still needed before next frame. */
+          uint32_t overrunCount;           /**< Number of frames dropped because the ring was full. */
+    volatile uint32_t writeCount;          /**< Number of frames produced (written by producer only). */
+    volatile uint32_t readCount;           /**< Number of frames consumed (written by consumer only). */
+  } arm_stft_instance_f32;
+
+  /**
+   * @brief  Size of the arena needed by the floating-point STFT.
+   * @param[in]     fftLen     FFT length
+   * @param[in]     numFrames  number of frames in the output ring
+   * @return        arena size in float32_t words
+   */
+  uint32_t arm_stft_get_buffer_size_f32(
+        uint16_t fftLen,
+        uint16_t numFrames);
+
+  /**
+   * @brief  Initialization function for the floating-point STFT.
+   * @param[out]    S           points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen      FFT length
+   * @param[in]     hopSize     number of new samples between two frames
+   * @param[in]     pWindow     points to the analysis window of fftLen samples
+   * @param[in]     numFrames   number of frames in the output ring
+   * @param[in]     outputType  magnitude or power output
+   * @param[in]     pBuffer     points to the arena of arm_stft_get_buffer_size_f32() words
+   * @return        execution status
+   */
+  arm_status arm_stft_init_f32(
+        arm_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        uint16_t numFrames,
+        arm_stft_output_type outputType,
+        float32_t * pBuffer);
+
+  /**
+   * @brief  Processing function for the floating-point STFT.
+   * @param[in,out] S          points to an instance of the floating-point STFT structure.
+   * @param[in]     pSrc       points to the block of new input samples
+   * @param[in]     blockSize  number of samples to process
+   * @return        number of frames written to the output ring
+   */
+  uint32_t arm_stft_f32(
+        arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Oldest frame available in the STFT output ring.
+   * @param[in]     S          points to an instance of the floating-point STFT structure.
+   * @return        points to fftLen/2+1 bins or NULL when the ring is empty
+   */
+  const float32_t *arm_stft_get_frame_f32(
+  const arm_stft_instance_f32 * S);
+
+  /**
+   * @brief  Release the frame returned by arm_stft_get_frame_f32.
+   * @param[in,out] S          points to an instance of the floating-point STFT structure.
+   * @return        none
+   */
+  void arm_stft_release_frame_f32(
+        arm_stft_instance_f32 * S);
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;      /**< number of tracked frequencies. */
+          uint16_t blockLen;     /**< number of samples of each evaluation. */
+          uint16_t sampleCount;  /**< number of samples of the current block already processed. */
+          float32_t *pCoeffs;    /**< points to the coefficients {2*cos(w), cos(w), sin(w)} of each bin. */
+          float32_t *pState;     /**< points to the state {s1, s2} of each bin. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;      /**< number of tracked frequencies. */
+          uint16_t blockLen;     /**< number of samples of each evaluation. */
+          uint16_t sampleCount;  /**< number of samples of the current block already processed. */
+          q31_t *pCoeffs;        /**< points to the coefficients {cos(w), sin(w)} of each bin. */
+          q63_t *pState;         /**< points to the state {s1, s2} of each bin. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel bank.
+   * @param[out]    S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numBins    number of tracked frequencies
+   * @param[in]     blockLen   number of samples of each evaluation
+   * @param[in]     pFreqs     points to numBins normalized frequencies (f/fs in [0, 0.5))
+   * @param[in]     pCoeffs    points to the coefficient buffer of 3*numBins values
+   * @param[in]     pState     points to the state buffer of 2*numBins values
+   * @return        execution status
+   */
+  arm_status arm_goertzel_init_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t numBins,
+        uint16_t blockLen,
+  const float32_t * pFreqs,
+        float32_t * pCoeffs,
+        float32_t * pState);
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel bank.
+   * @param[out]    S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numBins    number of tracked frequencies
+   * @param[in]     blockLen   number of samples of each evaluation
+   * @param[in]     pFreqs     points to numBins normalized frequencies (f/fs in [0, 0.5))
+   * @param[in]     pCoeffs    points to the coefficient buffer of 2*numBins values
+   * @param[in]     pState     points to the state buffer of 2*numBins values
+   * @return        execution status
+   */
+  arm_status arm_goertzel_init_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t numBins,
+        uint16_t blockLen,
+  const q31_t * pFreqs,
+        q31_t * pCoeffs,
+        q63_t * pState);
+
+  /**
+   * @brief  Retune one bin of the floating-point Goertzel bank.
+   * @param[in,out] S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]     bin        index of the bin
+   * @param[in]     freq       new normalized frequency (f/fs in [0, 0.5))
+   * @return        none
+   */
+  void arm_goertzel_set_freq_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t bin,
+        float32_t freq);
+
+  /**
+   * @brief  Retune one bin of the Q31 Goertzel bank.
+   * @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]     bin        index of the bin
+   * @param[in]     freq       new normalized frequency (f/fs in [0, 0.5))
+   * @return        none
+   */
+  void arm_goertzel_set_freq_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t bin,
+        q31_t freq);
+
+  /**
+   * @brief  Processing function for the floating-point Goertzel bank.
+   * @param[in,out] S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]     pSrc       points to the block of input samples
+   * @param[in]     blockSize  number of samples to process
+   * @param[out]    pDst       points to the output buffer (2*numBins complex values per completed block)
+   * @return        number of completed blocks written to pDst
+   */
+  uint32_t arm_goertzel_f32(
+        arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst);
+
+  /**
+   * @brief  Processing function for the Q31 Goertzel bank.
+   * @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]     pSrc       points to the block of input samples
+   * @param[in]     blockSize  number of samples to process
+   * @param[out]    pDst       points to the output buffer (2*numBins complex values per completed block)
+   * @return        number of completed blocks written to pDst
+   */
+  uint32_t arm_goertzel_q31(
+        arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        q31_t * pDst);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -727,6 +1005,185 @@ arm_status arm_mfcc_init_q15(
   q31_t *pTmp
   );
 
+/**
+  @brief         Log-Mel energies F32
+  @param[in]    S       points to the mfcc instance structure
+  @param[in]     pSrc points to the input samples
+  @param[out]     pDst  points to the nbMelFilters log-Mel energies
+  @param[inout]     pTmp  points to a temporary buffer of complex
+  @return        none
+ */
+  void arm_mfcc_logmel_f32(
+  const arm_mfcc_instance_f32 * S,
+  float32_t *pSrc,
+  float32_t *pDst,
+  float32_t *pTmp
+  );
+
+/**
+  @brief         Log-Mel energies Q15
+  @param[in]    S       points to the mfcc instance structure
+  @param[in]     pSrc points to the input samples
+  @param[out]     pDst  points to the nbMelFilters log-Mel energies in q8.7 format
+  @param[inout]     pTmp  points to a temporary buffer of complex
+  @return        error status
+ */
+  arm_status arm_mfcc_logmel_q15(
+  const arm_mfcc_instance_q15 * S,
+  q15_t *pSrc,
+  q15_t *pDst,
+  q31_t *pTmp
+  );
+
+  /**
+   * @brief Features computed by the streaming MFCC.
+   */
+  typedef enum
+  {
+    ARM_MFCC_STREAM_MFCC = 0,    /**< nbDctOutputs MFCC per frame */
+    ARM_MFCC_STREAM_LOGMEL = 1   /**< nbMelFilters log-Mel energies per frame */
+  } arm_mfcc_stream_feature;
+
+  /**
+   * @brief Instance structure for the floating-point streaming MFCC.
+   */
+  typedef struct
+  {
+    const arm_mfcc_instance_f32 *pMfcc;    /**< MFCC instance (FFT, window, Mel filters and DCT). */
+          uint16_t hopSize;                /**< Number of new samples between two frames. */
+          uint16_t numFrames;              /**< Number of frames (H) of the output tensor. */
+          uint16_t numFeatures;            /**< Number of features per frame (W) of the output tensor. */
+          uint16_t feature;                /**< Computed features (arm_mfcc_stream_feature). */
+          float32_t *pHistory;             /**< Circular input history of fftLen samples. */
+          float32_t *pFrame;               /**< Frame buffer of fftLen samples. */
+          float32_t *pTmp;                 /**< FFT working buffer of 2*fftLen samples. */
+          float32_t *pTensor;              /**< Output tensor of 2*numFrames frames. */
+          uint32_t historyIndex;           /**< Write position in the input history. */
+          uint32_t samplesToFrame;         /**< Number of samples still needed before next frame. */
+          uint32_t writeRow;               /**< Tensor row of the next frame. */
+          uint32_t frameCount;             /**< Number of frames produced, saturated to numFrames. */
+  } arm_mfcc_stream_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 streaming MFCC.
+   */
+  typedef struct
+  {
+    const arm_mfcc_instance_q15 *pMfcc;    /**< MFCC instance (FFT, window, Mel filters and DCT). */
+          uint16_t hopSize;                /**< Number of new samples between two frames. */
+          uint16_t numFrames;              /**< Number of frames (H) of the output tensor. */
+          uint16_t numFeatures;            /**< Number of features per frame (W) of the output tensor. */
+          uint16_t feature;                /**< Computed features (arm_mfcc_stream_feature). */
+          q15_t *pHistory;                 /**< Circular input history of fftLen samples. */
+          q15_t *pFrame;                   /**< Frame buffer of fftLen samples. */
+          q31_t *pTmp;                     /**< FFT working buffer of 2*fftLen values. */
+          q15_t *pTensor;                  /**< Output tensor of 2*numFrames frames. */
+          uint32_t historyIndex;           /**< Write position in the input history. */
+          uint32_t samplesToFrame;         /**< Number of samples still needed before next frame. */
+          uint32_t writeRow;               /**< Tensor row of the next frame. */
+          uint32_t frameCount;             /**< Number of frames produced, saturated to numFrames. */
+  } arm_mfcc_stream_instance_q15;
+
+  /**
+   * @brief  Size of the arena needed by the floating-point streaming MFCC.
+   * @param[in]     fftLen       FFT length of the MFCC instance
+   * @param[in]     numFeatures  number of features per frame
+   * @param[in]     numFrames    number of frames of the output tensor
+   * @return        arena size in float32_t words
+   */
+  uint32_t arm_mfcc_stream_get_buffer_size_f32(
+        uint32_t fftLen,
+        uint16_t numFeatures,
+        uint16_t numFrames);
+
+  /**
+   * @brief  Initialization function for the floating-point streaming MFCC.
+   * @param[out]    S          points to an instance of the floating-point streaming MFCC structure.
+   * @param[in]     pMfcc      points to an initialized MFCC instance
+   * @param[in]     hopSize    number of new samples between two frames
+   * @param[in]     feature    MFCC or log-Mel features
+   * @param[in]     numFrames  number of frames of the output tensor
+   * @param[in]     pBuffer    points to the arena of arm_mfcc_stream_get_buffer_size_f32() words
+   * @return        execution status
+   */
+  arm_status arm_mfcc_stream_init_f32(
+        arm_mfcc_stream_instance_f32 * S,
+  const arm_mfcc_instance_f32 * pMfcc,
+        uint16_t hopSize,
+        arm_mfcc_stream_feature feature,
+        uint16_t numFrames,
+        float32_t * pBuffer);
+
+  /**
+   * @brief  Processing function for the floating-point streaming MFCC.
+   * @param[in,out] S          points to an instance of the floating-point streaming MFCC structure.
+   * @param[in]     pSrc       points to the block of new input samples
+   * @param[in]     blockSize  number of samples to process
+   * @return        number of frames written to the output tensor
+   */
+  uint32_t arm_mfcc_stream_f32(
+        arm_mfcc_stream_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Output tensor of the floating-point streaming MFCC.
+   * @param[in]     S          points to an instance of the floating-point streaming MFCC structure.
+   * @return        points to the last numFrames frames or NULL when fewer frames were produced
+   */
+  const float32_t *arm_mfcc_stream_get_tensor_f32(
+  const arm_mfcc_stream_instance_f32 * S);
+
+  /**
+   * @brief  Size of the arena needed by the Q15 streaming MFCC.
+   * @param[in]     fftLen       FFT length of the MFCC instance
+   * @param[in]     numFeatures  number of features per frame
+   * @param[in]     numFrames    number of frames of the output tensor
+   * @return        arena size in q31_t words
+   */
+  uint32_t arm_mfcc_stream_get_buffer_size_q15(
+        uint32_t fftLen,
+        uint16_t numFeatures,
+        uint16_t numFrames);
+
+  /**
+   * @brief  Initialization function for the Q15 streaming MFCC.
+   * @param[out]    S          points to an instance of the Q15 streaming MFCC structure.
+   * @param[in]     pMfcc      points to an initialized MFCC instance
+   * @param[in]     hopSize    number of new samples between two frames
+   * @param[in]     feature    MFCC or log-Mel features
+   * @param[in]     numFrames  number of frames of the output tensor
+   * @param[in]     pBuffer    points to the arena of arm_mfcc_stream_get_buffer_size_q15() words
+   * @return        execution status
+   */
+  arm_status arm_mfcc_stream_init_q15(
+        arm_mfcc_stream_instance_q15 * S,
+  const arm_mfcc_instance_q15 * pMfcc,
+        uint16_t hopSize,
+        arm_mfcc_stream_feature feature,
+        uint16_t numFrames,
+        q31_t * pBuffer);
+
+  /**
+   * @brief  Processing function for the Q15 streaming MFCC.
+   * @param[in,out] S          points to an instance of the Q15 streaming MFCC structure.
+   * @param[in]     pSrc       points to the block of new input samples
+   * @param[in]     blockSize  number of samples to process
+   * @return        number of frames written to the output tensor
+   */
+  uint32_t arm_mfcc_stream_q15(
+        arm_mfcc_stream_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Output tensor of the Q15 streaming MFCC.
+   * @param[in]     S          points to an instance of the Q15 streaming MFCC structure.
+   * @return        points to the last numFrames frames in q8.7 or NULL when fewer frames were produced
+   */
+  const q15_t *arm_mfcc_stream_get_tensor_q15(
+  const arm_mfcc_stream_instance_q15 * S);
+
 
 #ifdef   __cplusplus
 }
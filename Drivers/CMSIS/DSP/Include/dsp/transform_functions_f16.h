@@ -123,6 +123,11 @@ arm_status arm_rfft_fast_init_f16 (
         float16_t * p, float16_t * pOut,
         uint8_t ifftFlag);
 
+  void arm_rfft_fast_inplace_f16(
+        const arm_rfft_fast_instance_f16 * S,
+        float16_t * p,
+        uint8_t ifftFlag);
+
 /* Deprecated */
   arm_status arm_cfft_radix4_init_f16(
         arm_cfft_radix4_instance_f16 * S,
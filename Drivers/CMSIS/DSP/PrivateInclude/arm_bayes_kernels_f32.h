@@ -0,0 +1,135 @@
+/******************************************************************************
+ * @file     arm_bayes_kernels_f32.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _ARM_BAYES_KERNELS_F32_H_
+#define _ARM_BAYES_KERNELS_F32_H_
+
+#include "arm_math.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+Kernels of the precomputed naive Gaussian Bayesian estimator.
+
+The weighted distance of an input vector to the mean of a class is
+sum over d of w[d] * (x[d] - theta[d])^2, with w = 0.5 / variance.
+It is accumulated in 4 independent sums so that the loads and the
+multiply-accumulates of consecutive dimensions can be pipelined.
+
+*/
+
+/* Number of dimensions between two early exit tests */
+#define ARM_GNB_EXIT_BLOCK     8U
+
+/* Number of input vectors sharing the loads of a class row */
+#define ARM_GNB_BATCH          4U
+
+/* Weighted squared distance of pIn to pTheta over n dimensions */
+__STATIC_FORCEINLINE float32_t arm_gnb_dist_f32(
+  const float32_t * pIn,
+  const float32_t * pTheta,
+  const float32_t * pW,
+  uint32_t n)
+{
+  float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+  float32_t d0, d1, d2, d3;
+  uint32_t blkCnt = n >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    d0 = pIn[0] - pTheta[0];
+    d1 = pIn[1] - pTheta[1];
+    d2 = pIn[2] - pTheta[2];
+    d3 = pIn[3] - pTheta[3];
+
+    acc0 += pW[0] * d0 * d0;
+    acc1 += pW[1] * d1 * d1;
+    acc2 += pW[2] * d2 * d2;
+    acc3 += pW[3] * d3 * d3;
+
+    pIn += 4;
+    pTheta += 4;
+    pW += 4;
+    blkCnt--;
+  }
+
+  blkCnt = n & 3U;
+  while (blkCnt > 0U)
+  {
+    d0 = *pIn++ - *pTheta++;
+    acc0 += *pW++ * d0 * d0;
+    blkCnt--;
+  }
+
+  return ((acc0 + acc1) + (acc2 + acc3));
+}
+
+/* Weighted squared distances of ARM_GNB_BATCH input vectors,
+   stored with a stride of n values, to pTheta */
+__STATIC_FORCEINLINE void arm_gnb_dist_batch_f32(
+  const float32_t * pIn,
+  const float32_t * pTheta,
+  const float32_t * pW,
+  uint32_t n,
+  float32_t * pAcc)
+{
+  const float32_t *pIn0 = pIn;
+  const float32_t *pIn1 = pIn + n;
+  const float32_t *pIn2 = pIn + 2U * n;
+  const float32_t *pIn3 = pIn + 3U * n;
+  float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+  float32_t t, w, d;
+  uint32_t i;
+
+  for (i = 0U; i < n; i++)
+  {
+    t = pTheta[i];
+    w = pW[i];
+
+    d = pIn0[i] - t;
+    acc0 += w * d * d;
+    d = pIn1[i] - t;
+    acc1 += w * d * d;
+    d = pIn2[i] - t;
+    acc2 += w * d * d;
+    d = pIn3[i] - t;
+    acc3 += w * d * d;
+  }
+
+  pAcc[0] = acc0;
+  pAcc[1] = acc1;
+  pAcc[2] = acc2;
+  pAcc[3] = acc3;
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_BAYES_KERNELS_F32_H_ */
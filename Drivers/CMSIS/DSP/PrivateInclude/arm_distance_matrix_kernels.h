@@ -0,0 +1,136 @@
+/******************************************************************************
+ * @file     arm_distance_matrix_kernels.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_DISTANCE_MATRIX_KERNELS_H_
+#define _ARM_DISTANCE_MATRIX_KERNELS_H_
+
+#include "arm_math.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+Kernels of the distance matrices.
+
+A vector of the first set is compared with ARM_DIST_BLOCK vectors of
+the second set at once: each element of the first vector is loaded once
+for ARM_DIST_BLOCK accumulations, which almost halves the loads of a
+pair by pair computation.
+
+*/
+
+#define ARM_DIST_BLOCK 4U
+
+/* Dot products of pA with the 4 consecutive vectors of pB */
+__STATIC_FORCEINLINE void arm_dist_dot4_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  uint32_t dimension,
+  float32_t * pDot)
+{
+  const float32_t *pB0 = pB;
+  const float32_t *pB1 = pB0 + dimension;
+  const float32_t *pB2 = pB1 + dimension;
+  const float32_t *pB3 = pB2 + dimension;
+  float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+  uint32_t k;
+
+  for (k = 0U; k < dimension; k++)
+  {
+    float32_t a = pA[k];
+
+    acc0 += a * pB0[k];
+    acc1 += a * pB1[k];
+    acc2 += a * pB2[k];
+    acc3 += a * pB3[k];
+  }
+
+  pDot[0] = acc0;
+  pDot[1] = acc1;
+  pDot[2] = acc2;
+  pDot[3] = acc3;
+}
+
+/* Cityblock distances of pA with the 4 consecutive vectors of pB */
+__STATIC_FORCEINLINE void arm_dist_l1_4_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  uint32_t dimension,
+  float32_t * pDist)
+{
+  const float32_t *pB0 = pB;
+  const float32_t *pB1 = pB0 + dimension;
+  const float32_t *pB2 = pB1 + dimension;
+  const float32_t *pB3 = pB2 + dimension;
+  float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+  uint32_t k;
+
+  for (k = 0U; k < dimension; k++)
+  {
+    float32_t a = pA[k];
+
+    acc0 += fabsf(a - pB0[k]);
+    acc1 += fabsf(a - pB1[k]);
+    acc2 += fabsf(a - pB2[k]);
+    acc3 += fabsf(a - pB3[k]);
+  }
+
+  pDist[0] = acc0;
+  pDist[1] = acc1;
+  pDist[2] = acc2;
+  pDist[3] = acc3;
+}
+
+/* Number of bits set in x */
+__STATIC_FORCEINLINE uint32_t arm_dist_popcount_u32(uint32_t x)
+{
+  x = x - ((x >> 1) & 0x55555555U);
+  x = (x & 0x33333333U) + ((x >> 2) & 0x33333333U);
+  x = (x + (x >> 4)) & 0x0F0F0F0FU;
+  return (x * 0x01010101U) >> 24;
+}
+
+/* Number of words of a packed boolean vector */
+__STATIC_FORCEINLINE uint32_t arm_dist_bool_words(uint32_t numberOfBools)
+{
+  return (numberOfBools + 31U) >> 5;
+}
+
+/* Mask of the booleans in the last word: like arm_hamming_distance, the
+   last numberOfBools % 32 booleans are in the most significant bits */
+__STATIC_FORCEINLINE uint32_t arm_dist_bool_last_mask(uint32_t numberOfBools)
+{
+  uint32_t rem = numberOfBools & 31U;
+
+  return (rem == 0U) ? 0xFFFFFFFFU : (0xFFFFFFFFU << (32U - rem));
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_DISTANCE_MATRIX_KERNELS_H_ */
@@ -0,0 +1,150 @@
+/******************************************************************************
+ * @file     arm_f16_storage.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_F16_STORAGE_H_
+#define _ARM_F16_STORAGE_H_
+
+#include "arm_math.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+Conversions between float32_t and IEEE binary16 values stored as uint16_t.
+
+They only use integer operations, so data can be kept in half precision
+on targets without a native float16_t (Cortex-M33, host builds) and
+processed in single precision.
+
+When the compiler knows the IEEE __fp16 format (for instance with
+-mfp16-format=ieee), the conversions are done by the compiler, which uses
+the VCVTB instructions of FPv5 and later. Both versions round to nearest
+even and give the same results, except for the NaN payloads.
+
+*/
+
+#if defined(__ARM_FP16_FORMAT_IEEE)
+
+__STATIC_FORCEINLINE float32_t arm_f16_bits_to_f32(uint16_t h)
+{
+  union { uint16_t i; __fp16 f; } u;
+
+  u.i = h;
+  return (float32_t) u.f;
+}
+
+__STATIC_FORCEINLINE uint16_t arm_f32_to_f16_bits(float32_t x)
+{
+  union { uint16_t i; __fp16 f; } u;
+
+  u.f = (__fp16) x;
+  return u.i;
+}
+
+#else
+
+/* binary16 bits to float32_t (exact) */
+__STATIC_FORCEINLINE float32_t arm_f16_bits_to_f32(uint16_t h)
+{
+  union { uint32_t i; float32_t f; } u;
+  uint32_t sign = ((uint32_t) h & 0x8000U) << 16;
+  uint32_t expo = ((uint32_t) h >> 10) & 0x1FU;
+  uint32_t mant = (uint32_t) h & 0x3FFU;
+
+  if (expo == 0x1FU)
+  {
+    /* Inf and NaN */
+    u.i = sign | 0x7F800000U | (mant << 13);
+  }
+  else if (expo != 0U)
+  {
+    u.i = sign | ((expo + 112U) << 23) | (mant << 13);
+  }
+  else
+  {
+    /* Zero and subnormals: mant * 2^-24 */
+    u.f = (float32_t) mant * 5.9604644775390625e-8f;
+    u.i |= sign;
+  }
+
+  return u.f;
+}
+
+/* float32_t to binary16 bits, rounded to nearest even */
+__STATIC_FORCEINLINE uint16_t arm_f32_to_f16_bits(float32_t x)
+{
+  union { uint32_t i; float32_t f; } u;
+  uint32_t sign, absx, expo, mant, h;
+
+  u.f = x;
+  sign = (u.i >> 16) & 0x8000U;
+  absx = u.i & 0x7FFFFFFFU;
+
+  if (absx > 0x7F800000U)
+  {
+    /* NaN, kept quiet */
+    return (uint16_t) (sign | 0x7E00U);
+  }
+  if (absx >= 0x477FF000U)
+  {
+    /* Overflow to Inf (65520 and above round up) */
+    return (uint16_t) (sign | 0x7C00U);
+  }
+
+  expo = absx >> 23;
+  if (expo < 113U)
+  {
+    /* Subnormal result: round |x| / 2^-24 to an integer */
+    u.i = absx;
+    u.f = u.f * 16777216.0f;
+    h = (uint32_t) u.f;
+    if (((u.f - (float32_t) h) > 0.5f) || (((u.f - (float32_t) h) == 0.5f) && ((h & 1U) != 0U)))
+    {
+      h++;
+    }
+    return (uint16_t) (sign | h);
+  }
+
+  mant = absx & 0x7FFFFFU;
+  h = ((expo - 112U) << 10) | (mant >> 13);
+
+  /* Round to nearest even, a carry into the exponent is correct */
+  if (((mant & 0x1FFFU) > 0x1000U) || (((mant & 0x1FFFU) == 0x1000U) && ((h & 1U) != 0U)))
+  {
+    h++;
+  }
+
+  return (uint16_t) (sign | h);
+}
+
+#endif /* defined(__ARM_FP16_FORMAT_IEEE) */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_F16_STORAGE_H_ */
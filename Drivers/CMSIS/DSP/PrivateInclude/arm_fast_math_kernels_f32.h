@@ -0,0 +1,287 @@
+/******************************************************************************
+ * @file     arm_fast_math_kernels_f32.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_FAST_MATH_KERNELS_F32_H_
+#define _ARM_FAST_MATH_KERNELS_F32_H_
+
+#include "arm_math.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+Branch-free scalar kernels of the vector elementary functions.
+
+They only use arithmetic, comparisons, selects and float/int conversions,
+so a loop calling them is vectorized by the compiler on cores with SIMD
+and stays free of library calls and branches on the others.
+
+Compilers do not turn a conditional expression into a select when an
+operand may raise a floating-point exception (unless -fno-trapping-math is
+used), so the selects are done on the bit patterns by arm_fm_select_f32 and
+the comparisons use the quiet isless/isgreater macros.
+
+The precise kernels follow the Cephes single precision approximations.
+The fast kernels use lower degree minimax polynomials with an absolute
+error below 1e-4.
+
+*/
+
+#define ARM_FM_PIO2_F32        1.57079632679489661923f
+#define ARM_FM_PIO4_F32        0.78539816339744830962f
+#define ARM_FM_2OPI_F32        0.63661977236758134308f
+#define ARM_FM_LOG2E_F32       1.44269504088896341f
+#define ARM_FM_TANPIO8_F32     0.41421356237309504880f
+
+/* Largest argument of the sine and cosine: |x| * 2/pi < 2^16 keeps the
+   reduction below exact */
+#define ARM_FM_SINCOS_MAX_F32  65536.0f
+
+/* pi/2 split so that n * ARM_FM_PIO2_1_F32 is exact for |n| < 2^16 */
+#define ARM_FM_PIO2_1_F32      1.5703125f
+#define ARM_FM_PIO2_2_F32      4.837512969970703125e-4f
+#define ARM_FM_PIO2_3_F32      7.54978995489188216e-8f
+#define ARM_FM_PIO2_23_F32     4.8382679489e-4f
+
+/* ln(2) split so that n * ARM_FM_LN2_1_F32 is exact */
+#define ARM_FM_LN2_1_F32       0.693359375f
+#define ARM_FM_LN2_2_F32       -2.12194440e-4f
+
+/* Range of the exponential without overflow or denormal result */
+#define ARM_FM_EXP_MAX_F32     88.0f
+#define ARM_FM_EXP_MIN_F32     -87.0f
+
+/* cond ? a : b, cond being 0 or 1 */
+__STATIC_FORCEINLINE float32_t arm_fm_select_f32(
+  int32_t cond,
+  float32_t a,
+  float32_t b)
+{
+  union { uint32_t i; float32_t f; } ua, ub;
+  uint32_t mask = 0U - (uint32_t) cond;
+
+  ua.f = a;
+  ub.f = b;
+  ua.i = (ua.i & mask) | (ub.i & ~mask);
+  return ua.f;
+}
+
+/* Nearest integer of x for |x| < 2^30. The conversion of a value out of
+   the int32_t range is undefined, so larger values and NaN give 0 */
+__STATIC_FORCEINLINE int32_t arm_fm_round_f32(float32_t x)
+{
+  x = arm_fm_select_f32(isless(fabsf(x), 1073741824.0f), x, 0.0f);
+  return (int32_t) (x + arm_fm_select_f32(isless(x, 0.0f), -0.5f, 0.5f));
+}
+
+/* 2^n for -126 <= n <= 127 */
+__STATIC_FORCEINLINE float32_t arm_fm_pow2i_f32(int32_t n)
+{
+  union { uint32_t i; float32_t f; } u;
+
+  u.i = (uint32_t) (n + 127) << 23;
+  return u.f;
+}
+
+/* Sine and cosine of r in [-pi/4, pi/4] */
+__STATIC_FORCEINLINE void arm_fm_sincos_poly_precise_f32(
+  float32_t r,
+  float32_t * pSin,
+  float32_t * pCos)
+{
+  float32_t z = r * r;
+
+  *pSin = r + r * z * ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f);
+  *pCos = 1.0f - 0.5f * z + z * z * ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f);
+}
+
+__STATIC_FORCEINLINE void arm_fm_sincos_poly_fast_f32(
+  float32_t r,
+  float32_t * pSin,
+  float32_t * pCos)
+{
+  float32_t z = r * r;
+
+  *pSin = r * ((8.150349310e-3f * z - 1.666239607e-1f) * z + 9.999985002e-1f);
+  *pCos = (4.040053485e-2f * z - 4.997090637e-1f) * z + 9.999900823e-1f;
+}
+
+/* Sine and cosine of x: reduction to [-pi/4, pi/4] modulo pi/2, then
+   the quadrant selects and negates the polynomials.
+   x is saturated to [-ARM_FM_SINCOS_MAX_F32, ARM_FM_SINCOS_MAX_F32]
+   and NaN gives NaN */
+__STATIC_FORCEINLINE void arm_fm_sincos_f32(
+  float32_t x,
+  float32_t * pSin,
+  float32_t * pCos,
+  int32_t precise)
+{
+  int32_t n;
+  float32_t fn, r, s, c;
+
+  x = arm_fm_select_f32(isgreater(x, ARM_FM_SINCOS_MAX_F32), ARM_FM_SINCOS_MAX_F32, x);
+  x = arm_fm_select_f32(isless(x, -ARM_FM_SINCOS_MAX_F32), -ARM_FM_SINCOS_MAX_F32, x);
+
+  n = arm_fm_round_f32(x * ARM_FM_2OPI_F32);
+  fn = (float32_t) n;
+
+  if (precise)
+  {
+    r = ((x - fn * ARM_FM_PIO2_1_F32) - fn * ARM_FM_PIO2_2_F32) - fn * ARM_FM_PIO2_3_F32;
+    arm_fm_sincos_poly_precise_f32(r, &s, &c);
+  }
+  else
+  {
+    r = (x - fn * ARM_FM_PIO2_1_F32) - fn * ARM_FM_PIO2_23_F32;
+    arm_fm_sincos_poly_fast_f32(r, &s, &c);
+  }
+
+  *pSin = arm_fm_select_f32(n & 1, c, s);
+  *pCos = arm_fm_select_f32(n & 1, -s, c);
+  *pSin = arm_fm_select_f32((n >> 1) & 1, -*pSin, *pSin);
+  *pCos = arm_fm_select_f32((n >> 1) & 1, -*pCos, *pCos);
+}
+
+/* Arc tangent of y/x in [-pi, pi] */
+__STATIC_FORCEINLINE float32_t arm_fm_atan2_f32(
+  float32_t y,
+  float32_t x,
+  int32_t precise)
+{
+  float32_t ax = fabsf(x);
+  float32_t ay = fabsf(y);
+  float32_t mn = arm_fm_select_f32(isless(ay, ax), ay, ax);
+  float32_t mx = arm_fm_select_f32(isless(ay, ax), ax, ay);
+  float32_t t, z, a;
+
+  /* t = min/max in [0, 1], 0 when x = y = 0 */
+  t = mn / (mx + (float32_t) (mx == 0.0f));
+
+  if (precise)
+  {
+    int32_t big = isgreater(t, ARM_FM_TANPIO8_F32);
+    float32_t base = arm_fm_select_f32(big, ARM_FM_PIO4_F32, 0.0f);
+
+    t = arm_fm_select_f32(big, (t - 1.0f) / (t + 1.0f), t);
+    z = t * t;
+    a = base + t + t * z * (((8.05374449538e-2f * z - 1.38776856032e-1f) * z
+                             + 1.99777106478e-1f) * z - 3.33329491539e-1f);
+  }
+  else
+  {
+    z = t * t;
+    a = t * (((-3.905008867e-2f * z + 1.463575319e-1f) * z - 3.212124214e-1f) * z
+             + 9.992173598e-1f);
+  }
+
+  a = arm_fm_select_f32(isgreater(ay, ax), ARM_FM_PIO2_F32 - a, a);
+  a = arm_fm_select_f32(isless(x, 0.0f), PI - a, a);
+  return arm_fm_select_f32(isless(y, 0.0f), -a, a);
+}
+
+/* Exponential of x, saturated to the normal range */
+__STATIC_FORCEINLINE float32_t arm_fm_exp_f32(
+  float32_t x,
+  int32_t precise)
+{
+  float32_t fn, r, p;
+  int32_t n;
+
+  x = arm_fm_select_f32(isgreater(x, ARM_FM_EXP_MAX_F32), ARM_FM_EXP_MAX_F32, x);
+  x = arm_fm_select_f32(isless(x, ARM_FM_EXP_MIN_F32), ARM_FM_EXP_MIN_F32, x);
+
+  n = arm_fm_round_f32(x * ARM_FM_LOG2E_F32);
+  fn = (float32_t) n;
+
+  if (precise)
+  {
+    r = (x - fn * ARM_FM_LN2_1_F32) - fn * ARM_FM_LN2_2_F32;
+    p = (((((1.9875691500e-4f * r + 1.3981999507e-3f) * r + 8.3334519073e-3f) * r
+            + 4.1665795894e-2f) * r + 1.6666665459e-1f) * r + 5.0000001201e-1f) * r * r + r + 1.0f;
+  }
+  else
+  {
+    /* 2^f with f in [-0.5, 0.5] */
+    r = x * ARM_FM_LOG2E_F32 - fn;
+    p = ((5.517292697e-2f * r + 2.426036309e-1f) * r + 6.932602418e-1f) * r + 9.999285187e-1f;
+  }
+
+  return p * arm_fm_pow2i_f32(n);
+}
+
+/* Hyperbolic tangent of x */
+__STATIC_FORCEINLINE float32_t arm_fm_tanh_f32(
+  float32_t x,
+  int32_t precise)
+{
+  float32_t ax = fabsf(x);
+  float32_t t = 1.0f - 2.0f / (arm_fm_exp_f32(2.0f * ax, precise) + 1.0f);
+
+  if (precise)
+  {
+    /* 1 - 2/(e^2x + 1) cancels for small x */
+    float32_t z = x * x;
+    float32_t s = x + x * z * ((((-5.70498872745e-3f * z + 2.06390887954e-2f) * z
+                                 - 5.37397155531e-2f) * z + 1.33314422036e-1f) * z
+                                 - 3.33332819422e-1f);
+
+    t = arm_fm_select_f32(isless(ax, 0.625f), fabsf(s), t);
+  }
+
+  return arm_fm_select_f32(isless(x, 0.0f), -t, t);
+}
+
+/* Square root of x, 0 for negative x */
+__STATIC_FORCEINLINE float32_t arm_fm_sqrt_f32(
+  float32_t x,
+  int32_t precise)
+{
+  union { uint32_t i; float32_t f; } u;
+  float32_t r;
+
+  x = arm_fm_select_f32(isgreater(x, 0.0f), x, 0.0f);
+
+  if (precise)
+  {
+    return sqrtf(x);
+  }
+
+  /* Reciprocal square root estimate refined by two Newton steps */
+  u.f = x;
+  u.i = 0x5f375a86U - (u.i >> 1);
+  r = u.f;
+  r = r * (1.5f - 0.5f * x * r * r);
+  r = r * (1.5f - 0.5f * x * r * r);
+
+  return x * r;
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_FAST_MATH_KERNELS_F32_H_ */
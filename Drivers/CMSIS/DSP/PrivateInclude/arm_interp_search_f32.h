@@ -0,0 +1,149 @@
+/******************************************************************************
+ * @file     arm_interp_search_f32.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_INTERP_SEARCH_F32_H_
+#define _ARM_INTERP_SEARCH_F32_H_
+
+#include "arm_math.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+Segment search on a non-uniform interpolation axis.
+
+The segment of the previous query and the next one are tried first,
+so a monotonic stream of queries is located in constant time.
+Otherwise a binary search is done on the breakpoints of the bucket of x
+when the axis has a bucket index, or on the whole axis when it has none.
+
+Points outside of the axis are located in the first or last segment,
+the caller clamps the fractional position.
+
+*/
+
+__STATIC_FORCEINLINE uint32_t arm_interp_axis_search_f32(
+  arm_interp_axis_f32 * A,
+  float32_t x)
+{
+  const float32_t *pV = A->pValues;
+  uint32_t last = A->nValues - 2U;              /* last segment */
+  uint32_t seg = A->segment;
+
+  /* Same segment or the next one */
+  if (x >= pV[seg])
+  {
+    if (x < pV[seg + 1U])
+    {
+      return seg;
+    }
+    if ((seg < last) && (x < pV[seg + 2U]))
+    {
+      A->segment = seg + 1U;
+      return seg + 1U;
+    }
+  }
+
+  if (!(x > pV[0]))
+  {
+    seg = 0U;
+  }
+  else if (x >= pV[last + 1U])
+  {
+    seg = last;
+  }
+  else
+  {
+    uint32_t lo = 0U;
+    uint32_t hi = last + 1U;
+
+    if (A->numBuckets > 0U)
+    {
+      uint32_t b = (uint32_t) ((x - pV[0]) * A->invBucketWidth);
+
+      if (b >= A->numBuckets)
+      {
+        b = A->numBuckets - 1U;
+      }
+
+      /* Breakpoints of the bucket, the whole axis when the rounding of b
+         puts x out of them */
+      lo = A->pBucket[b];
+      if (b + 1U < A->numBuckets)
+      {
+        hi = (uint32_t) A->pBucket[b + 1U] + 1U;
+      }
+      if (x < pV[lo])
+      {
+        lo = 0U;
+      }
+      if (x >= pV[hi])
+      {
+        hi = last + 1U;
+      }
+    }
+
+    /* Binary search with pV[lo] <= x < pV[hi] */
+    while ((hi - lo) > 1U)
+    {
+      uint32_t mid = (lo + hi) >> 1U;
+
+      if (x < pV[mid])
+      {
+        hi = mid;
+      }
+      else
+      {
+        lo = mid;
+      }
+    }
+    seg = lo;
+  }
+
+  A->segment = seg;
+  return seg;
+}
+
+/* Fractional position of x in the segment, clamped to [0, 1] */
+__STATIC_FORCEINLINE float32_t arm_interp_axis_frac_f32(
+  const arm_interp_axis_f32 * A,
+  uint32_t seg,
+  float32_t x)
+{
+  const float32_t *pV = A->pValues;
+  float32_t t = (x - pV[seg]) / (pV[seg + 1U] - pV[seg]);
+
+  t = (t < 0.0f) ? 0.0f : t;
+  t = (t > 1.0f) ? 1.0f : t;
+  return t;
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_INTERP_SEARCH_F32_H_ */
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * @file     arm_svm_batch_kernels.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_SVM_BATCH_KERNELS_H_
+#define _ARM_SVM_BATCH_KERNELS_H_
+
+#include "arm_math.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+Batched SVM prediction.
+
+ARM_SVM_BATCH input vectors are classified together: each support vector
+is read once for the batch and its dot products with the inputs are
+accumulated at the same time, like a block of a matrix product.
+The rbf distances are then expanded as
+
+    |x - s|^2 = |x|^2 + |s|^2 - 2 x.s
+
+where |s|^2 is accumulated in the same loop and |x|^2 once per batch.
+
+*/
+
+#define ARM_SVM_BATCH 4U
+
+/* Inputs v .. v+3 of the batch; the lanes past the last input repeat it
+   so that the kernels always work on full batches */
+__STATIC_FORCEINLINE void arm_svm_batch_inputs_f32(
+  const float32_t * in,
+  uint32_t vectorDimension,
+  uint32_t v,
+  uint32_t numVectors,
+  const float32_t ** pIn,
+  float32_t * pNorm)
+{
+  uint32_t b, k;
+
+  for (b = 0U; b < ARM_SVM_BATCH; b++)
+  {
+    uint32_t idx = ((v + b) < numVectors) ? (v + b) : (numVectors - 1U);
+    float32_t acc = 0.0f;
+
+    pIn[b] = in + idx * vectorDimension;
+    for (k = 0U; k < vectorDimension; k++)
+    {
+      acc += pIn[b][k] * pIn[b][k];
+    }
+    pNorm[b] = acc;
+  }
+}
+
+/* Adds the rbf term of one support vector to the decision values */
+__STATIC_FORCEINLINE void arm_svm_batch_rbf_term_f32(
+  float32_t * pSum,
+  const float32_t * pNorm,
+  const float32_t * pDot,
+  float32_t normS,
+  float32_t dualCoef,
+  float32_t gamma)
+{
+  uint32_t b;
+
+  for (b = 0U; b < ARM_SVM_BATCH; b++)
+  {
+    float32_t d2 = pNorm[b] + normS - 2.0f * pDot[b];
+
+    d2 = (d2 > 0.0f) ? d2 : 0.0f;
+    pSum[b] += dualCoef * expf(-gamma * d2);
+  }
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_SVM_BATCH_KERNELS_H_ */
@@ -36,6 +36,7 @@
 #include "arm_add_q15.c"
 #include "arm_add_q31.c"
 #include "arm_add_q7.c"
+#include "arm_add_f16s.c"
 #include "arm_and_u16.c"
 #include "arm_and_u32.c"
 #include "arm_and_u8.c"
@@ -44,11 +45,13 @@
 #include "arm_dot_prod_q15.c"
 #include "arm_dot_prod_q31.c"
 #include "arm_dot_prod_q7.c"
+#include "arm_dot_prod_f16s.c"
 #include "arm_mult_f32.c"
 #include "arm_mult_f64.c"
 #include "arm_mult_q15.c"
 #include "arm_mult_q31.c"
 #include "arm_mult_q7.c"
+#include "arm_mult_f16s.c"
 #include "arm_negate_f32.c"
 #include "arm_negate_f64.c"
 #include "arm_negate_q15.c"
@@ -70,6 +73,7 @@
 #include "arm_scale_q15.c"
 #include "arm_scale_q31.c"
 #include "arm_scale_q7.c"
+#include "arm_scale_f16s.c"
 #include "arm_shift_q15.c"
 #include "arm_shift_q31.c"
 #include "arm_shift_q7.c"
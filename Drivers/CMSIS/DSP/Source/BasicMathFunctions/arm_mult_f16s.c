@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mult_f16s.c
+ * Description:  Storage f16 vector multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/basic_math_functions.h"
+#include "arm_f16_storage.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicMult
+  @{
+ */
+
+/**
+  @brief         Storage f16 vector multiplication.
+  @param[in]     pSrcA      points to the first input vector.
+  @param[in]     pSrcB      points to the second input vector.
+  @param[out]    pDst       points to the output vector.
+  @param[in]     blockSize  number of samples in each vector.
+  @return        none
+
+  @par           Storage f16
+                   The inputs and the output are binary16 values and the
+                   product is computed in single precision, so the result is
+                   the correctly rounded half precision product.
+                   Available on all targets.
+ */
+void arm_mult_f16s(
+  const float16s_t * pSrcA,
+  const float16s_t * pSrcB,
+        float16s_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * B */
+    pDst[0] = arm_f32_to_f16_bits(arm_f16_bits_to_f32(pSrcA[0]) * arm_f16_bits_to_f32(pSrcB[0]));
+    pDst[1] = arm_f32_to_f16_bits(arm_f16_bits_to_f32(pSrcA[1]) * arm_f16_bits_to_f32(pSrcB[1]));
+    pDst[2] = arm_f32_to_f16_bits(arm_f16_bits_to_f32(pSrcA[2]) * arm_f16_bits_to_f32(pSrcB[2]));
+    pDst[3] = arm_f32_to_f16_bits(arm_f16_bits_to_f32(pSrcA[3]) * arm_f16_bits_to_f32(pSrcB[3]));
+
+    pSrcA += 4;
+    pSrcB += 4;
+    pDst += 4;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * B */
+    *pDst++ = arm_f32_to_f16_bits(arm_f16_bits_to_f32(*pSrcA++) * arm_f16_bits_to_f32(*pSrcB++));
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of BasicMult group
+ */
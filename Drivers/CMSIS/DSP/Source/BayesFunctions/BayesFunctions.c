@@ -27,3 +27,11 @@
  */
 
 #include "arm_gaussian_naive_bayes_predict_f32.c"
+#include "arm_gaussian_naive_bayes_fast_init_f32.c"
+#include "arm_gaussian_naive_bayes_predict_fast_f32.c"
+#include "arm_gaussian_naive_bayes_predict_class_f32.c"
+#include "arm_gaussian_naive_bayes_predict_batch_f32.c"
+#include "arm_gaussian_naive_bayes_posterior_f32.c"
+#include "arm_gaussian_naive_bayes_fit_init_f32.c"
+#include "arm_gaussian_naive_bayes_fit_update_f32.c"
+#include "arm_gaussian_naive_bayes_fit_export_f32.c"
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_fast_init_f32.c
+ * Description:  Precomputation of the naive Gaussian Bayesian Estimator
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/bayes_functions.h"
+#include "dsp/fast_math_functions.h"
+#include <math.h>
+
+#define PI_F 3.1415926535897932384626433832795f
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Initialization of the precomputed naive Gaussian Bayesian estimator
+ *
+ * @param[out]  *S                      points to a precomputed naive bayes instance structure
+ * @param[in]   *pModel                 points to a naive bayes instance structure
+ * @param[out]  *pHalfInvSigma          points to a buffer of numberOfClasses * vectorDimension values
+ * @param[out]  *pLogConst              points to a buffer of numberOfClasses values
+ * @return execution status
+ *                   - \ref ARM_MATH_SUCCESS        : Operation successful
+ *                   - \ref ARM_MATH_ARGUMENT_ERROR : a variance plus epsilon is not positive
+ *
+ * @par Description
+ *   The logarithms and the divisions of arm_gaussian_naive_bayes_predict_f32
+ *   only depend on the model. They are computed once here:
+ *   - halfInvSigma = 0.5 / (sigma + epsilon) for each class and dimension,
+ *   - logConst = log(prior) - 0.5 * sum of log(2 pi (sigma + epsilon)) for each class.
+ *
+ *   The predictions are then a weighted squared distance per class, with
+ *   no logarithm and no division, and no temporary buffer.
+ *   The means are not copied: the theta array of the model must stay valid
+ *   while the precomputed instance is used.
+ *
+ *   A class with a zero prior has a logConst of minus infinity and is never
+ *   predicted.
+ */
+arm_status arm_gaussian_naive_bayes_fast_init_f32(arm_gaussian_naive_bayes_fast_instance_f32 *S,
+   const arm_gaussian_naive_bayes_instance_f32 *pModel,
+   float32_t *pHalfInvSigma,
+   float32_t *pLogConst)
+{
+    uint32_t nbClass;
+    uint32_t nbDim;
+    const float32_t *pSigma = pModel->sigma;
+    float32_t *pW = pHalfInvSigma;
+    float32_t sigma;
+    float32_t acc;
+
+    for(nbClass = 0; nbClass < pModel->numberOfClasses; nbClass++)
+    {
+        acc = 0.0f;
+        for(nbDim = 0; nbDim < pModel->vectorDimension; nbDim++)
+        {
+           sigma = *pSigma++ + pModel->epsilon;
+           if (!(sigma > 0.0f))
+           {
+              return(ARM_MATH_ARGUMENT_ERROR);
+           }
+           acc += logf(2.0f * PI_F * sigma);
+           *pW++ = 0.5f / sigma;
+        }
+        pLogConst[nbClass] = logf(pModel->classPriors[nbClass]) - 0.5f * acc;
+    }
+
+    S->vectorDimension = pModel->vectorDimension;
+    S->numberOfClasses = pModel->numberOfClasses;
+    S->theta = pModel->theta;
+    S->halfInvSigma = pHalfInvSigma;
+    S->logConst = pLogConst;
+
+    return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of groupBayes group
+ */
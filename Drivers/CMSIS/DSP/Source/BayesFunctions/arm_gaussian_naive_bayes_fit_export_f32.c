@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_fit_export_f32.c
+ * Description:  Export of the incremental fit of the naive Gaussian Bayesian Estimator
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/bayes_functions.h"
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Export of the incremental fit as a naive Gaussian Bayesian model
+ *
+ * @param[in]   *S                      points to a fit instance structure
+ * @param[out]  *pSigma                 points to a buffer of numberOfClasses * vectorDimension variances
+ * @param[out]  *pClassPriors           points to a buffer of numberOfClasses prior probabilities
+ * @return none
+ *
+ * @par Description
+ *   The variances are the population variances (as in scikit-learn) and
+ *   the priors are the relative counts of the classes.
+ *   With pMean as theta, the outputs are the parameters of an
+ *   arm_gaussian_naive_bayes_instance_f32. The epsilon of this instance
+ *   must be positive since a class with less than 2 training vectors has
+ *   zero variances. The precomputed instance is then built with
+ *   arm_gaussian_naive_bayes_fast_init_f32, after each batch of updates.
+ *
+ *   A class without training vector has a zero prior and is never
+ *   predicted. When no class has any training vector, the priors are
+ *   uniform.
+ */
+void arm_gaussian_naive_bayes_fit_export_f32(const arm_gaussian_naive_bayes_fit_instance_f32 *S,
+   float32_t *pSigma,
+   float32_t *pClassPriors)
+{
+    uint32_t nbClass;
+    uint32_t nbDim;
+    const float32_t *pM2 = S->pM2;
+    float32_t total = 0.0f;
+    float32_t invN;
+
+    for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+    {
+        total += (float32_t)S->pCount[nbClass];
+
+        invN = (S->pCount[nbClass] != 0U) ? 1.0f / (float32_t)S->pCount[nbClass] : 0.0f;
+        for(nbDim = 0; nbDim < S->vectorDimension; nbDim++)
+        {
+           *pSigma++ = *pM2++ * invN;
+        }
+    }
+
+    for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+    {
+        pClassPriors[nbClass] = (total > 0.0f) ? (float32_t)S->pCount[nbClass] / total
+                                               : 1.0f / (float32_t)S->numberOfClasses;
+    }
+}
+
+/**
+ * @} end of groupBayes group
+ */
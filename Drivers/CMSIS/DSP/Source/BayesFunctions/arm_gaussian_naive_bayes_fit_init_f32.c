@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_fit_init_f32.c
+ * Description:  Initialization of the incremental fit of the naive Gaussian Bayesian Estimator
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/bayes_functions.h"
+#include <string.h>
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Initialization of the incremental fit of a naive Gaussian Bayesian estimator
+ *
+ * @param[out]  *S                      points to a fit instance structure
+ * @param[in]   vectorDimension         dimension of vector space
+ * @param[in]   numberOfClasses         number of different classes
+ * @param[in]   maxCount                saturation of the class counts, 0 for none
+ * @param[in]   *pCount                 points to a buffer of numberOfClasses counts
+ * @param[in]   *pMean                  points to a buffer of numberOfClasses * vectorDimension means
+ * @param[in]   *pM2                    points to a buffer of numberOfClasses * vectorDimension values
+ * @return none
+ *
+ * @par Description
+ *   The buffers are cleared: the fit starts without any training vector.
+ *   To adapt a model trained offline, the buffers can instead be filled
+ *   after this call with the counts, the means (theta) and the variances
+ *   (sigma) multiplied by the counts.
+ *
+ *   With a non zero maxCount, the count of a class stops increasing at
+ *   maxCount. The mean and the variance then become exponential moving
+ *   averages with a weight of 1/maxCount for each new training vector, so
+ *   that the model follows a slow drift of the data.
+ */
+void arm_gaussian_naive_bayes_fit_init_f32(arm_gaussian_naive_bayes_fit_instance_f32 *S,
+   uint32_t vectorDimension,
+   uint32_t numberOfClasses,
+   uint32_t maxCount,
+   uint32_t *pCount,
+   float32_t *pMean,
+   float32_t *pM2)
+{
+    S->vectorDimension = vectorDimension;
+    S->numberOfClasses = numberOfClasses;
+    S->maxCount = maxCount;
+    S->pCount = pCount;
+    S->pMean = pMean;
+    S->pM2 = pM2;
+
+    memset(pCount, 0, numberOfClasses * sizeof(uint32_t));
+    memset(pMean, 0, numberOfClasses * vectorDimension * sizeof(float32_t));
+    memset(pM2, 0, numberOfClasses * vectorDimension * sizeof(float32_t));
+}
+
+/**
+ * @} end of groupBayes group
+ */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_fit_update_f32.c
+ * Description:  Update of the incremental fit of the naive Gaussian Bayesian Estimator
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/bayes_functions.h"
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Update of the incremental fit with one training vector
+ *
+ * @param[in,out] *S                    points to a fit instance structure
+ * @param[in]   *in                     points to the elements of the training vector.
+ * @param[in]   classId                 class of the training vector
+ * @return execution status
+ *                   - \ref ARM_MATH_SUCCESS        : Operation successful
+ *                   - \ref ARM_MATH_ARGUMENT_ERROR : classId is not a valid class
+ *
+ * @par Description
+ *   Welford update of the mean and of the sum of squared deviations of
+ *   the class, which is numerically stable in float32_t for long
+ *   training sequences. Only the row of the class is accessed.
+ */
+arm_status arm_gaussian_naive_bayes_fit_update_f32(arm_gaussian_naive_bayes_fit_instance_f32 *S,
+   const float32_t * in,
+   uint32_t classId)
+{
+    uint32_t nbDim;
+    uint32_t n;
+    uint32_t limit;
+    float32_t *pMean;
+    float32_t *pM2;
+    float32_t invN;
+    float32_t decay;
+    float32_t delta;
+
+    if (classId >= S->numberOfClasses)
+    {
+        return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    pMean = S->pMean + classId * S->vectorDimension;
+    pM2 = S->pM2 + classId * S->vectorDimension;
+
+    limit = (S->maxCount != 0U) ? S->maxCount : UINT32_MAX;
+    n = S->pCount[classId];
+    if (n < limit)
+    {
+        n++;
+        S->pCount[classId] = n;
+        decay = 1.0f;
+    }
+    else
+    {
+        /* Saturated count: exponential forgetting of the oldest vectors */
+        decay = (float32_t)(n - 1U) / (float32_t)n;
+    }
+    invN = 1.0f / (float32_t)n;
+
+    for(nbDim = 0; nbDim < S->vectorDimension; nbDim++)
+    {
+        delta = in[nbDim] - pMean[nbDim];
+        pMean[nbDim] += delta * invN;
+        pM2[nbDim] = pM2[nbDim] * decay + delta * (in[nbDim] - pMean[nbDim]);
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of groupBayes group
+ */
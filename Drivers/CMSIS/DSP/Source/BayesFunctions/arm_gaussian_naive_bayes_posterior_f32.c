@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_posterior_f32.c
+ * Description:  Posterior probabilities of the naive Gaussian Bayesian Estimator
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/bayes_functions.h"
+#include "dsp/basic_math_functions.h"
+#include <math.h>
+
+/* exp(x) is 0 in float32_t below this value */
+#define ARM_GNB_EXP_UNDERFLOW_F32 (-104.0f)
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Posterior probabilities of the precomputed naive Gaussian Bayesian estimator
+ *
+ * @param[in]   *S                      points to a precomputed naive bayes instance structure
+ * @param[in]   *in                     points to the elements of the input vector.
+ * @param[out]  *pPosterior             points to a buffer of length numberOfClasses containing the posterior probabilities
+ * @return The predicted class
+ *
+ * @par Description
+ *   The log-likelihoods of arm_gaussian_naive_bayes_predict_fast_f32 are
+ *   normalized with a log-sum-exp: the posterior probability of class c is
+ *   exp(ll[c] - max) / sum of exp(ll[k] - max).
+ *   Subtracting the maximum avoids the underflow of all the exponentials
+ *   for the large negative log-likelihoods of high dimension vectors.
+ *   The exponential is skipped for the classes whose log-likelihood is
+ *   so far below the maximum that their probability is 0 in float32_t.
+ */
+uint32_t arm_gaussian_naive_bayes_posterior_f32(const arm_gaussian_naive_bayes_fast_instance_f32 *S,
+   const float32_t * in,
+   float32_t *pPosterior)
+{
+    uint32_t nbClass;
+    uint32_t index;
+    float32_t maxLL;
+    float32_t diff;
+    float32_t sum = 0.0f;
+
+    index = arm_gaussian_naive_bayes_predict_fast_f32(S, in, pPosterior);
+    maxLL = pPosterior[index];
+
+    for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+    {
+        diff = pPosterior[nbClass] - maxLL;
+        if (diff > ARM_GNB_EXP_UNDERFLOW_F32)
+        {
+            pPosterior[nbClass] = expf(diff);
+            sum += pPosterior[nbClass];
+        }
+        else
+        {
+            pPosterior[nbClass] = 0.0f;
+        }
+    }
+
+    /* sum >= 1 since the maximum contributes exp(0), unless all the
+       classes have a zero prior */
+    if (sum > 0.0f)
+    {
+        arm_scale_f32(pPosterior, 1.0f / sum, pPosterior, S->numberOfClasses);
+    }
+
+    return(index);
+}
+
+/**
+ * @} end of groupBayes group
+ */
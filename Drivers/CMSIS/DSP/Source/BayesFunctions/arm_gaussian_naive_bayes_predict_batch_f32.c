@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_predict_batch_f32.c
+ * Description:  Precomputed naive Gaussian Bayesian Estimator on a batch of vectors
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/bayes_functions.h"
+#include "arm_bayes_kernels_f32.h"
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Precomputed naive Gaussian Bayesian estimator on a batch of vectors
+ *
+ * @param[in]   *S                      points to a precomputed naive bayes instance structure
+ * @param[in]   *in                     points to numVectors input vectors
+ * @param[in]   numVectors              number of input vectors
+ * @param[out]  *pClasses               points to the numVectors predicted classes
+ * @return none
+ *
+ * @par Description
+ *   The input vectors are stored one after the other (numVectors rows of
+ *   vectorDimension values). They are classified 4 at a time: each mean and
+ *   weight of the model is loaded once for the 4 vectors. The remaining
+ *   vectors are classified one by one.
+ *   The predicted classes are the ones of arm_gaussian_naive_bayes_predict_fast_f32.
+ */
+void arm_gaussian_naive_bayes_predict_batch_f32(const arm_gaussian_naive_bayes_fast_instance_f32 *S,
+   const float32_t * in,
+   uint32_t numVectors,
+   uint32_t *pClasses)
+{
+    uint32_t nbClass;
+    uint32_t dim = S->vectorDimension;
+    uint32_t blkCnt;
+    uint32_t i;
+    const float32_t *pTheta;
+    const float32_t *pW;
+    float32_t acc[ARM_GNB_BATCH];
+    float32_t bestLL[ARM_GNB_BATCH];
+    float32_t ll;
+    uint32_t best[ARM_GNB_BATCH];
+
+    blkCnt = numVectors / ARM_GNB_BATCH;
+    while (blkCnt > 0U)
+    {
+        pTheta = S->theta;
+        pW = S->halfInvSigma;
+
+        for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+        {
+            arm_gnb_dist_batch_f32(in, pTheta, pW, dim, acc);
+
+            for(i = 0; i < ARM_GNB_BATCH; i++)
+            {
+                ll = S->logConst[nbClass] - acc[i];
+                if ((nbClass == 0) || (ll > bestLL[i]))
+                {
+                    bestLL[i] = ll;
+                    best[i] = nbClass;
+                }
+            }
+
+            pTheta += dim;
+            pW += dim;
+        }
+
+        for(i = 0; i < ARM_GNB_BATCH; i++)
+        {
+            *pClasses++ = best[i];
+        }
+
+        in += ARM_GNB_BATCH * dim;
+        blkCnt--;
+    }
+
+    blkCnt = numVectors % ARM_GNB_BATCH;
+    while (blkCnt > 0U)
+    {
+        pTheta = S->theta;
+        pW = S->halfInvSigma;
+
+        for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+        {
+            ll = S->logConst[nbClass] - arm_gnb_dist_f32(in, pTheta, pW, dim);
+            if ((nbClass == 0) || (ll > bestLL[0]))
+            {
+                bestLL[0] = ll;
+                best[0] = nbClass;
+            }
+
+            pTheta += dim;
+            pW += dim;
+        }
+
+        *pClasses++ = best[0];
+
+        in += dim;
+        blkCnt--;
+    }
+}
+
+/**
+ * @} end of groupBayes group
+ */
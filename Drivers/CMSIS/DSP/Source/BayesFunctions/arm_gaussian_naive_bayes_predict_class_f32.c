@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_predict_class_f32.c
+ * Description:  Precomputed naive Gaussian Bayesian Estimator with early exit
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/bayes_functions.h"
+#include "arm_bayes_kernels_f32.h"
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Precomputed naive Gaussian Bayesian estimator with early exit
+ *
+ * @param[in]   *S                      points to a precomputed naive bayes instance structure
+ * @param[in]   *in                     points to the elements of the input vector.
+ * @return The predicted class
+ *
+ * @par Description
+ *   The log-likelihood of a class only decreases while its weighted
+ *   distance is accumulated. The accumulation of a class is stopped, every
+ *   8 dimensions, as soon as the log-likelihood is below the one of the
+ *   best class found so far: this class cannot be predicted.
+ *
+ *   The pruning is efficient when the first complete class is the
+ *   predicted one. This candidate is the class with the highest
+ *   log-likelihood on the first 8 dimensions.
+ *
+ *   The tests and the candidate search have a cost: this function is
+ *   faster than arm_gaussian_naive_bayes_predict_fast_f32 for well
+ *   separated classes and vectors of more than about 32 dimensions.
+ *
+ *   When two classes have the same log-likelihood, the first one is
+ *   returned, as for arm_gaussian_naive_bayes_predict_fast_f32.
+ */
+uint32_t arm_gaussian_naive_bayes_predict_class_f32(const arm_gaussian_naive_bayes_fast_instance_f32 *S,
+   const float32_t * in)
+{
+    uint32_t nbClass;
+    uint32_t dim = S->vectorDimension;
+    uint32_t head = (dim < ARM_GNB_EXIT_BLOCK) ? dim : ARM_GNB_EXIT_BLOCK;
+    uint32_t nbDim;
+    uint32_t blkSize;
+    uint32_t best = 0;
+    float32_t bestLL;
+    float32_t ll;
+    const float32_t *pTheta;
+    const float32_t *pW;
+
+    /* Candidate: highest log-likelihood on the first dimensions */
+    pTheta = S->theta;
+    pW = S->halfInvSigma;
+    bestLL = S->logConst[0] - arm_gnb_dist_f32(in, pTheta, pW, head);
+    for(nbClass = 1; nbClass < S->numberOfClasses; nbClass++)
+    {
+        pTheta += dim;
+        pW += dim;
+        ll = S->logConst[nbClass] - arm_gnb_dist_f32(in, pTheta, pW, head);
+        if (ll > bestLL)
+        {
+            bestLL = ll;
+            best = nbClass;
+        }
+    }
+
+    /* Complete log-likelihood of the candidate */
+    bestLL -= arm_gnb_dist_f32(in + head,
+                               S->theta + best * dim + head,
+                               S->halfInvSigma + best * dim + head,
+                               dim - head);
+
+    for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+    {
+        if (nbClass == best)
+        {
+            continue;
+        }
+
+        pTheta = S->theta + nbClass * dim;
+        pW = S->halfInvSigma + nbClass * dim;
+        ll = S->logConst[nbClass];
+
+        nbDim = 0;
+        while ((nbDim < dim) && !(ll < bestLL))
+        {
+            blkSize = dim - nbDim;
+            if (blkSize > ARM_GNB_EXIT_BLOCK)
+            {
+                blkSize = ARM_GNB_EXIT_BLOCK;
+            }
+
+            ll -= arm_gnb_dist_f32(in + nbDim, pTheta + nbDim, pW + nbDim, blkSize);
+            nbDim += blkSize;
+        }
+
+        /* Complete log-likelihood: keep the first of equal classes */
+        if ((nbDim == dim) && ((ll > bestLL) || ((ll == bestLL) && (nbClass < best))))
+        {
+            bestLL = ll;
+            best = nbClass;
+        }
+    }
+
+    return(best);
+}
+
+/**
+ * @} end of groupBayes group
+ */
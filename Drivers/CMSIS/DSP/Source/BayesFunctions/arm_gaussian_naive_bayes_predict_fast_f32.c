@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_predict_fast_f32.c
+ * Description:  Precomputed naive Gaussian Bayesian Estimator
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/bayes_functions.h"
+#include "arm_bayes_kernels_f32.h"
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Precomputed naive Gaussian Bayesian estimator
+ *
+ * @param[in]   *S                      points to a precomputed naive bayes instance structure
+ * @param[in]   *in                     points to the elements of the input vector.
+ * @param[out]  *pOutputProbabilities   points to a buffer of length numberOfClasses containing estimated probabilities
+ * @return The predicted class
+ *
+ * @par Description
+ *   Same results as arm_gaussian_naive_bayes_predict_f32 (up to rounding),
+ *   without any logarithm, division or temporary buffer.
+ *   The estimated probabilities are the logarithms of the joint
+ *   probabilities, as for arm_gaussian_naive_bayes_predict_f32.
+ */
+uint32_t arm_gaussian_naive_bayes_predict_fast_f32(const arm_gaussian_naive_bayes_fast_instance_f32 *S,
+   const float32_t * in,
+   float32_t *pOutputProbabilities)
+{
+    uint32_t nbClass;
+    uint32_t dim = S->vectorDimension;
+    const float32_t *pTheta = S->theta;
+    const float32_t *pW = S->halfInvSigma;
+    float32_t result;
+    uint32_t index;
+
+    for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+    {
+        pOutputProbabilities[nbClass] = S->logConst[nbClass] - arm_gnb_dist_f32(in, pTheta, pW, dim);
+        pTheta += dim;
+        pW += dim;
+    }
+
+    arm_max_f32(pOutputProbabilities,S->numberOfClasses,&result,&index);
+
+    return(index);
+}
+
+/**
+ * @} end of groupBayes group
+ */
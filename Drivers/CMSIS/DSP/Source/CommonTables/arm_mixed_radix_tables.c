@@ -0,0 +1,5811 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mixed_radix_tables.c
+ * Description:  Tables for the floating-point mixed-radix CFFT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math_types.h"
+#include "arm_common_tables.h"
+
+/**
+  @addtogroup MixedRadixCFFT
+  @{
+ */
+
+/**
+  @par
+  Example code for mixed-radix floating-point twiddle factors generation:
+  @par
+  <pre>for (i = 0; i< N; i++)
+  {
+ 	twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+ 	twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 120, PI = 3.14159265358979
+  @par
+  Cos and Sin values are in interleaved fashion
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_120)
+const float32_t twiddleCoef_mixed_120[240] = {
+    1.000000000f, 0.000000000f,
+    0.998629535f, 0.052335956f,
+    0.994521895f, 0.104528463f,
+    0.987688341f, 0.156434465f,
+    0.978147601f, 0.207911691f,
+    0.965925826f, 0.258819045f,
+    0.951056516f, 0.309016994f,
+    0.933580426f, 0.358367950f,
+    0.913545458f, 0.406736643f,
+    0.891006524f, 0.453990500f,
+    0.866025404f, 0.500000000f,
+    0.838670568f, 0.544639035f,
+    0.809016994f, 0.587785252f,
+    0.777145961f, 0.629320391f,
+    0.743144825f, 0.669130606f,
+    0.707106781f, 0.707106781f,
+    0.669130606f, 0.743144825f,
+    0.629320391f, 0.777145961f,
+    0.587785252f, 0.809016994f,
+    0.544639035f, 0.838670568f,
+    0.500000000f, 0.866025404f,
+    0.453990500f, 0.891006524f,
+    0.406736643f, 0.913545458f,
+    0.358367950f, 0.933580426f,
+    0.309016994f, 0.951056516f,
+    0.258819045f, 0.965925826f,
+    0.207911691f, 0.978147601f,
+    0.156434465f, 0.987688341f,
+    0.104528463f, 0.994521895f,
+    0.052335956f, 0.998629535f,
+    0.000000000f, 1.000000000f,
+    -0.052335956f, 0.998629535f,
+    -0.104528463f, 0.994521895f,
+    -0.156434465f, 0.987688341f,
+    -0.207911691f, 0.978147601f,
+    -0.258819045f, 0.965925826f,
+    -0.309016994f, 0.951056516f,
+    -0.358367950f, 0.933580426f,
+    -0.406736643f, 0.913545458f,
+    -0.453990500f, 0.891006524f,
+    -0.500000000f, 0.866025404f,
+    -0.544639035f, 0.838670568f,
+    -0.587785252f, 0.809016994f,
+    -0.629320391f, 0.777145961f,
+    -0.669130606f, 0.743144825f,
+    -0.707106781f, 0.707106781f,
+    -0.743144825f, 0.669130606f,
+    -0.777145961f, 0.629320391f,
+    -0.809016994f, 0.587785252f,
+    -0.838670568f, 0.544639035f,
+    -0.866025404f, 0.500000000f,
+    -0.891006524f, 0.453990500f,
+    -0.913545458f, 0.406736643f,
+    -0.933580426f, 0.358367950f,
+    -0.951056516f, 0.309016994f,
+    -0.965925826f, 0.258819045f,
+    -0.978147601f, 0.207911691f,
+    -0.987688341f, 0.156434465f,
+    -0.994521895f, 0.104528463f,
+    -0.998629535f, 0.052335956f,
+    -1.000000000f, 0.000000000f,
+    -0.998629535f, -0.052335956f,
+    -0.994521895f, -0.104528463f,
+    -0.987688341f, -0.156434465f,
+    -0.978147601f, -0.207911691f,
+    -0.965925826f, -0.258819045f,
+    -0.951056516f, -0.309016994f,
+    -0.933580426f, -0.358367950f,
+    -0.913545458f, -0.406736643f,
+    -0.891006524f, -0.453990500f,
+    -0.866025404f, -0.500000000f,
+    -0.838670568f, -0.544639035f,
+    -0.809016994f, -0.587785252f,
+    -0.777145961f, -0.629320391f,
+    -0.743144825f, -0.669130606f,
+    -0.707106781f, -0.707106781f,
+    -0.669130606f, -0.743144825f,
+    -0.629320391f, -0.777145961f,
+    -0.587785252f, -0.809016994f,
+    -0.544639035f, -0.838670568f,
+    -0.500000000f, -0.866025404f,
+    -0.453990500f, -0.891006524f,
+    -0.406736643f, -0.913545458f,
+    -0.358367950f, -0.933580426f,
+    -0.309016994f, -0.951056516f,
+    -0.258819045f, -0.965925826f,
+    -0.207911691f, -0.978147601f,
+    -0.156434465f, -0.987688341f,
+    -0.104528463f, -0.994521895f,
+    -0.052335956f, -0.998629535f,
+    0.000000000f, -1.000000000f,
+    0.052335956f, -0.998629535f,
+    0.104528463f, -0.994521895f,
+    0.156434465f, -0.987688341f,
+    0.207911691f, -0.978147601f,
+    0.258819045f, -0.965925826f,
+    0.309016994f, -0.951056516f,
+    0.358367950f, -0.933580426f,
+    0.406736643f, -0.913545458f,
+    0.453990500f, -0.891006524f,
+    0.500000000f, -0.866025404f,
+    0.544639035f, -0.838670568f,
+    0.587785252f, -0.809016994f,
+    0.629320391f, -0.777145961f,
+    0.669130606f, -0.743144825f,
+    0.707106781f, -0.707106781f,
+    0.743144825f, -0.669130606f,
+    0.777145961f, -0.629320391f,
+    0.809016994f, -0.587785252f,
+    0.838670568f, -0.544639035f,
+    0.866025404f, -0.500000000f,
+    0.891006524f, -0.453990500f,
+    0.913545458f, -0.406736643f,
+    0.933580426f, -0.358367950f,
+    0.951056516f, -0.309016994f,
+    0.965925826f, -0.258819045f,
+    0.978147601f, -0.207911691f,
+    0.987688341f, -0.156434465f,
+    0.994521895f, -0.104528463f,
+    0.998629535f, -0.052335956f
+};
+#endif /* !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) */
+
+/**
+  @par
+  Example code for mixed-radix floating-point twiddle factors generation:
+  @par
+  <pre>for (i = 0; i< N; i++)
+  {
+ 	twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+ 	twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 240, PI = 3.14159265358979
+  @par
+  Cos and Sin values are in interleaved fashion
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_240)
+const float32_t twiddleCoef_mixed_240[480] = {
+    1.000000000f, 0.000000000f,
+    0.999657325f, 0.026176948f,
+    0.998629535f, 0.052335956f,
+    0.996917334f, 0.078459096f,
+    0.994521895f, 0.104528463f,
+    0.991444861f, 0.130526192f,
+    0.987688341f, 0.156434465f,
+    0.983254908f, 0.182235525f,
+    0.978147601f, 0.207911691f,
+    0.972369920f, 0.233445364f,
+    0.965925826f, 0.258819045f,
+    0.958819735f, 0.284015345f,
+    0.951056516f, 0.309016994f,
+    0.942641491f, 0.333806859f,
+    0.933580426f, 0.358367950f,
+    0.923879533f, 0.382683432f,
+    0.913545458f, 0.406736643f,
+    0.902585284f, 0.430511097f,
+    0.891006524f, 0.453990500f,
+    0.878817113f, 0.477158760f,
+    0.866025404f, 0.500000000f,
+    0.852640164f, 0.522498565f,
+    0.838670568f, 0.544639035f,
+    0.824126189f, 0.566406237f,
+    0.809016994f, 0.587785252f,
+    0.793353340f, 0.608761429f,
+    0.777145961f, 0.629320391f,
+    0.760405966f, 0.649448048f,
+    0.743144825f, 0.669130606f,
+    0.725374371f, 0.688354576f,
+    0.707106781f, 0.707106781f,
+    0.688354576f, 0.725374371f,
+    0.669130606f, 0.743144825f,
+    0.649448048f, 0.760405966f,
+    0.629320391f, 0.777145961f,
+    0.608761429f, 0.793353340f,
+    0.587785252f, 0.809016994f,
+    0.566406237f, 0.824126189f,
+    0.544639035f, 0.838670568f,
+    0.522498565f, 0.852640164f,
+    0.500000000f, 0.866025404f,
+    0.477158760f, 0.878817113f,
+    0.453990500f, 0.891006524f,
+    0.430511097f, 0.902585284f,
+    0.406736643f, 0.913545458f,
+    0.382683432f, 0.923879533f,
+    0.358367950f, 0.933580426f,
+    0.333806859f, 0.942641491f,
+    0.309016994f, 0.951056516f,
+    0.284015345f, 0.958819735f,
+    0.258819045f, 0.965925826f,
+    0.233445364f, 0.972369920f,
+    0.207911691f, 0.978147601f,
+    0.182235525f, 0.983254908f,
+    0.156434465f, 0.987688341f,
+    0.130526192f, 0.991444861f,
+    0.104528463f, 0.994521895f,
+    0.078459096f, 0.996917334f,
+    0.052335956f, 0.998629535f,
+    0.026176948f, 0.999657325f,
+    0.000000000f, 1.000000000f,
+    -0.026176948f, 0.999657325f,
+    -0.052335956f, 0.998629535f,
+    -0.078459096f, 0.996917334f,
+    -0.104528463f, 0.994521895f,
+    -0.130526192f, 0.991444861f,
+    -0.156434465f, 0.987688341f,
+    -0.182235525f, 0.983254908f,
+    -0.207911691f, 0.978147601f,
+    -0.233445364f, 0.972369920f,
+    -0.258819045f, 0.965925826f,
+    -0.284015345f, 0.958819735f,
+    -0.309016994f, 0.951056516f,
+    -0.333806859f, 0.942641491f,
+    -0.358367950f, 0.933580426f,
+    -0.382683432f, 0.923879533f,
+    -0.406736643f, 0.913545458f,
+    -0.430511097f, 0.902585284f,
+    -0.453990500f, 0.891006524f,
+    -0.477158760f, 0.878817113f,
+    -0.500000000f, 0.866025404f,
+    -0.522498565f, 0.852640164f,
+    -0.544639035f, 0.838670568f,
+    -0.566406237f, 0.824126189f,
+    -0.587785252f, 0.809016994f,
+    -0.608761429f, 0.793353340f,
+    -0.629320391f, 0.777145961f,
+    -0.649448048f, 0.760405966f,
+    -0.669130606f, 0.743144825f,
+    -0.688354576f, 0.725374371f,
+    -0.707106781f, 0.707106781f,
+    -0.725374371f, 0.688354576f,
+    -0.743144825f, 0.669130606f,
+    -0.760405966f, 0.649448048f,
+    -0.777145961f, 0.629320391f,
+    -0.793353340f, 0.608761429f,
+    -0.809016994f, 0.587785252f,
+    -0.824126189f, 0.566406237f,
+    -0.838670568f, 0.544639035f,
+    -0.852640164f, 0.522498565f,
+    -0.866025404f, 0.500000000f,
+    -0.878817113f, 0.477158760f,
+    -0.891006524f, 0.453990500f,
+    -0.902585284f, 0.430511097f,
+    -0.913545458f, 0.406736643f,
+    -0.923879533f, 0.382683432f,
+    -0.933580426f, 0.358367950f,
+    -0.942641491f, 0.333806859f,
+    -0.951056516f, 0.309016994f,
+    -0.958819735f, 0.284015345f,
+    -0.965925826f, 0.258819045f,
+    -0.972369920f, 0.233445364f,
+    -0.978147601f, 0.207911691f,
+    -0.983254908f, 0.182235525f,
+    -0.987688341f, 0.156434465f,
+    -0.991444861f, 0.130526192f,
+    -0.994521895f, 0.104528463f,
+    -0.996917334f, 0.078459096f,
+    -0.998629535f, 0.052335956f,
+    -0.999657325f, 0.026176948f,
+    -1.000000000f, 0.000000000f,
+    -0.999657325f, -0.026176948f,
+    -0.998629535f, -0.052335956f,
+    -0.996917334f, -0.078459096f,
+    -0.994521895f, -0.104528463f,
+    -0.991444861f, -0.130526192f,
+    -0.987688341f, -0.156434465f,
+    -0.983254908f, -0.182235525f,
+    -0.978147601f, -0.207911691f,
+    -0.972369920f, -0.233445364f,
+    -0.965925826f, -0.258819045f,
+    -0.958819735f, -0.284015345f,
+    -0.951056516f, -0.309016994f,
+    -0.942641491f, -0.333806859f,
+    -0.933580426f, -0.358367950f,
+    -0.923879533f, -0.382683432f,
+    -0.913545458f, -0.406736643f,
+    -0.902585284f, -0.430511097f,
+    -0.891006524f, -0.453990500f,
+    -0.878817113f, -0.477158760f,
+    -0.866025404f, -0.500000000f,
+    -0.852640164f, -0.522498565f,
+    -0.838670568f, -0.544639035f,
+    -0.824126189f, -0.566406237f,
+    -0.809016994f, -0.587785252f,
+    -0.793353340f, -0.608761429f,
+    -0.777145961f, -0.629320391f,
+    -0.760405966f, -0.649448048f,
+    -0.743144825f, -0.669130606f,
+    -0.725374371f, -0.688354576f,
+    -0.707106781f, -0.707106781f,
+    -0.688354576f, -0.725374371f,
+    -0.669130606f, -0.743144825f,
+    -0.649448048f, -0.760405966f,
+    -0.629320391f, -0.777145961f,
+    -0.608761429f, -0.793353340f,
+    -0.587785252f, -0.809016994f,
+    -0.566406237f, -0.824126189f,
+    -0.544639035f, -0.838670568f,
+    -0.522498565f, -0.852640164f,
+    -0.500000000f, -0.866025404f,
+    -0.477158760f, -0.878817113f,
+    -0.453990500f, -0.891006524f,
+    -0.430511097f, -0.902585284f,
+    -0.406736643f, -0.913545458f,
+    -0.382683432f, -0.923879533f,
+    -0.358367950f, -0.933580426f,
+    -0.333806859f, -0.942641491f,
+    -0.309016994f, -0.951056516f,
+    -0.284015345f, -0.958819735f,
+    -0.258819045f, -0.965925826f,
+    -0.233445364f, -0.972369920f,
+    -0.207911691f, -0.978147601f,
+    -0.182235525f, -0.983254908f,
+    -0.156434465f, -0.987688341f,
+    -0.130526192f, -0.991444861f,
+    -0.104528463f, -0.994521895f,
+    -0.078459096f, -0.996917334f,
+    -0.052335956f, -0.998629535f,
+    -0.026176948f, -0.999657325f,
+    0.000000000f, -1.000000000f,
+    0.026176948f, -0.999657325f,
+    0.052335956f, -0.998629535f,
+    0.078459096f, -0.996917334f,
+    0.104528463f, -0.994521895f,
+    0.130526192f, -0.991444861f,
+    0.156434465f, -0.987688341f,
+    0.182235525f, -0.983254908f,
+    0.207911691f, -0.978147601f,
+    0.233445364f, -0.972369920f,
+    0.258819045f, -0.965925826f,
+    0.284015345f, -0.958819735f,
+    0.309016994f, -0.951056516f,
+    0.333806859f, -0.942641491f,
+    0.358367950f, -0.933580426f,
+    0.382683432f, -0.923879533f,
+    0.406736643f, -0.913545458f,
+    0.430511097f, -0.902585284f,
+    0.453990500f, -0.891006524f,
+    0.477158760f, -0.878817113f,
+    0.500000000f, -0.866025404f,
+    0.522498565f, -0.852640164f,
+    0.544639035f, -0.838670568f,
+    0.566406237f, -0.824126189f,
+    0.587785252f, -0.809016994f,
+    0.608761429f, -0.793353340f,
+    0.629320391f, -0.777145961f,
+    0.649448048f, -0.760405966f,
+    0.669130606f, -0.743144825f,
+    0.688354576f, -0.725374371f,
+    0.707106781f, -0.707106781f,
+    0.725374371f, -0.688354576f,
+    0.743144825f, -0.669130606f,
+    0.760405966f, -0.649448048f,
+    0.777145961f, -0.629320391f,
+    0.793353340f, -0.608761429f,
+    0.809016994f, -0.587785252f,
+    0.824126189f, -0.566406237f,
+    0.838670568f, -0.544639035f,
+    0.852640164f, -0.522498565f,
+    0.866025404f, -0.500000000f,
+    0.878817113f, -0.477158760f,
+    0.891006524f, -0.453990500f,
+    0.902585284f, -0.430511097f,
+    0.913545458f, -0.406736643f,
+    0.923879533f, -0.382683432f,
+    0.933580426f, -0.358367950f,
+    0.942641491f, -0.333806859f,
+    0.951056516f, -0.309016994f,
+    0.958819735f, -0.284015345f,
+    0.965925826f, -0.258819045f,
+    0.972369920f, -0.233445364f,
+    0.978147601f, -0.207911691f,
+    0.983254908f, -0.182235525f,
+    0.987688341f, -0.156434465f,
+    0.991444861f, -0.130526192f,
+    0.994521895f, -0.104528463f,
+    0.996917334f, -0.078459096f,
+    0.998629535f, -0.052335956f,
+    0.999657325f, -0.026176948f
+};
+#endif /* !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) */
+
+/**
+  @par
+  Example code for mixed-radix floating-point twiddle factors generation:
+  @par
+  <pre>for (i = 0; i< N; i++)
+  {
+ 	twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+ 	twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 360, PI = 3.14159265358979
+  @par
+  Cos and Sin values are in interleaved fashion
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_360)
+const float32_t twiddleCoef_mixed_360[720] = {
+    1.000000000f, 0.000000000f,
+    0.999847695f, 0.017452406f,
+    0.999390827f, 0.034899497f,
+    0.998629535f, 0.052335956f,
+    0.997564050f, 0.069756474f,
+    0.996194698f, 0.087155743f,
+    0.994521895f, 0.104528463f,
+    0.992546152f, 0.121869343f,
+    0.990268069f, 0.139173101f,
+    0.987688341f, 0.156434465f,
+    0.984807753f, 0.173648178f,
+    0.981627183f, 0.190808995f,
+    0.978147601f, 0.207911691f,
+    0.974370065f, 0.224951054f,
+    0.970295726f, 0.241921896f,
+    0.965925826f, 0.258819045f,
+    0.961261696f, 0.275637356f,
+    0.956304756f, 0.292371705f,
+    0.951056516f, 0.309016994f,
+    0.945518576f, 0.325568154f,
+    0.939692621f, 0.342020143f,
+    0.933580426f, 0.358367950f,
+    0.927183855f, 0.374606593f,
+    0.920504853f, 0.390731128f,
+    0.913545458f, 0.406736643f,
+    0.906307787f, 0.422618262f,
+    0.898794046f, 0.438371147f,
+    0.891006524f, 0.453990500f,
+    0.882947593f, 0.469471563f,
+    0.874619707f, 0.484809620f,
+    0.866025404f, 0.500000000f,
+    0.857167301f, 0.515038075f,
+    0.848048096f, 0.529919264f,
+    0.838670568f, 0.544639035f,
+    0.829037573f, 0.559192903f,
+    0.819152044f, 0.573576436f,
+    0.809016994f, 0.587785252f,
+    0.798635510f, 0.601815023f,
+    0.788010754f, 0.615661475f,
+    0.777145961f, 0.629320391f,
+    0.766044443f, 0.642787610f,
+    0.754709580f, 0.656059029f,
+    0.743144825f, 0.669130606f,
+    0.731353702f, 0.681998360f,
+    0.719339800f, 0.694658370f,
+    0.707106781f, 0.707106781f,
+    0.694658370f, 0.719339800f,
+    0.681998360f, 0.731353702f,
+    0.669130606f, 0.743144825f,
+    0.656059029f, 0.754709580f,
+    0.642787610f, 0.766044443f,
+    0.629320391f, 0.777145961f,
+    0.615661475f, 0.788010754f,
+    0.601815023f, 0.798635510f,
+    0.587785252f, 0.809016994f,
+    0.573576436f, 0.819152044f,
+    0.559192903f, 0.829037573f,
+    0.544639035f, 0.838670568f,
+    0.529919264f, 0.848048096f,
+    0.515038075f, 0.857167301f,
+    0.500000000f, 0.866025404f,
+    0.484809620f, 0.874619707f,
+    0.469471563f, 0.882947593f,
+    0.453990500f, 0.891006524f,
+    0.438371147f, 0.898794046f,
+    0.422618262f, 0.906307787f,
+    0.406736643f, 0.913545458f,
+    0.390731128f, 0.920504853f,
+    0.374606593f, 0.927183855f,
+    0.358367950f, 0.933580426f,
+    0.342020143f, 0.939692621f,
+    0.325568154f, 0.945518576f,
+    0.309016994f, 0.951056516f,
+    0.292371705f, 0.956304756f,
+    0.275637356f, 0.961261696f,
+    0.258819045f, 0.965925826f,
+    0.241921896f, 0.970295726f,
+    0.224951054f, 0.974370065f,
+    0.207911691f, 0.978147601f,
+    0.190808995f, 0.981627183f,
+    0.173648178f, 0.984807753f,
+    0.156434465f, 0.987688341f,
+    0.139173101f, 0.990268069f,
+    0.121869343f, 0.992546152f,
+    0.104528463f, 0.994521895f,
+    0.087155743f, 0.996194698f,
+    0.069756474f, 0.997564050f,
+    0.052335956f, 0.998629535f,
+    0.034899497f, 0.999390827f,
+    0.017452406f, 0.999847695f,
+    0.000000000f, 1.000000000f,
+    -0.017452406f, 0.999847695f,
+    -0.034899497f, 0.999390827f,
+    -0.052335956f, 0.998629535f,
+    -0.069756474f, 0.997564050f,
+    -0.087155743f, 0.996194698f,
+    -0.104528463f, 0.994521895f,
+    -0.121869343f, 0.992546152f,
+    -0.139173101f, 0.990268069f,
+    -0.156434465f, 0.987688341f,
+    -0.173648178f, 0.984807753f,
+    -0.190808995f, 0.981627183f,
+    -0.207911691f, 0.978147601f,
+    -0.224951054f, 0.974370065f,
+    -0.241921896f, 0.970295726f,
+    -0.258819045f, 0.965925826f,
+    -0.275637356f, 0.961261696f,
+    -0.292371705f, 0.956304756f,
+    -0.309016994f, 0.951056516f,
+    -0.325568154f, 0.945518576f,
+    -0.342020143f, 0.939692621f,
+    -0.358367950f, 0.933580426f,
+    -0.374606593f, 0.927183855f,
+    -0.390731128f, 0.920504853f,
+    -0.406736643f, 0.913545458f,
+    -0.422618262f, 0.906307787f,
+    -0.438371147f, 0.898794046f,
+    -0.453990500f, 0.891006524f,
+    -0.469471563f, 0.882947593f,
+    -0.484809620f, 0.874619707f,
+    -0.500000000f, 0.866025404f,
+    -0.515038075f, 0.857167301f,
+    -0.529919264f, 0.848048096f,
+    -0.544639035f, 0.838670568f,
+    -0.559192903f, 0.829037573f,
+    -0.573576436f, 0.819152044f,
+    -0.587785252f, 0.809016994f,
+    -0.601815023f, 0.798635510f,
+    -0.615661475f, 0.788010754f,
+    -0.629320391f, 0.777145961f,
+    -0.642787610f, 0.766044443f,
+    -0.656059029f, 0.754709580f,
+    -0.669130606f, 0.743144825f,
+    -0.681998360f, 0.731353702f,
+    -0.694658370f, 0.719339800f,
+    -0.707106781f, 0.707106781f,
+    -0.719339800f, 0.694658370f,
+    -0.731353702f, 0.681998360f,
+    -0.743144825f, 0.669130606f,
+    -0.754709580f, 0.656059029f,
+    -0.766044443f, 0.642787610f,
+    -0.777145961f, 0.629320391f,
+    -0.788010754f, 0.615661475f,
+    -0.798635510f, 0.601815023f,
+    -0.809016994f, 0.587785252f,
+    -0.819152044f, 0.573576436f,
+    -0.829037573f, 0.559192903f,
+    -0.838670568f, 0.544639035f,
+    -0.848048096f, 0.529919264f,
+    -0.857167301f, 0.515038075f,
+    -0.866025404f, 0.500000000f,
+    -0.874619707f, 0.484809620f,
+    -0.882947593f, 0.469471563f,
+    -0.891006524f, 0.453990500f,
+    -0.898794046f, 0.438371147f,
+    -0.906307787f, 0.422618262f,
+    -0.913545458f, 0.406736643f,
+    -0.920504853f, 0.390731128f,
+    -0.927183855f, 0.374606593f,
+    -0.933580426f, 0.358367950f,
+    -0.939692621f, 0.342020143f,
+    -0.945518576f, 0.325568154f,
+    -0.951056516f, 0.309016994f,
+    -0.956304756f, 0.292371705f,
+    -0.961261696f, 0.275637356f,
+    -0.965925826f, 0.258819045f,
+    -0.970295726f, 0.241921896f,
+    -0.974370065f, 0.224951054f,
+    -0.978147601f, 0.207911691f,
+    -0.981627183f, 0.190808995f,
+    -0.984807753f, 0.173648178f,
+    -0.987688341f, 0.156434465f,
+    -0.990268069f, 0.139173101f,
+    -0.992546152f, 0.121869343f,
+    -0.994521895f, 0.104528463f,
+    -0.996194698f, 0.087155743f,
+    -0.997564050f, 0.069756474f,
+    -0.998629535f, 0.052335956f,
+    -0.999390827f, 0.034899497f,
+    -0.999847695f, 0.017452406f,
+    -1.000000000f, 0.000000000f,
+    -0.999847695f, -0.017452406f,
+    -0.999390827f, -0.034899497f,
+    -0.998629535f, -0.052335956f,
+    -0.997564050f, -0.069756474f,
+    -0.996194698f, -0.087155743f,
+    -0.994521895f, -0.104528463f,
+    -0.992546152f, -0.121869343f,
+    -0.990268069f, -0.139173101f,
+    -0.987688341f, -0.156434465f,
+    -0.984807753f, -0.173648178f,
+    -0.981627183f, -0.190808995f,
+    -0.978147601f, -0.207911691f,
+    -0.974370065f, -0.224951054f,
+    -0.970295726f, -0.241921896f,
+    -0.965925826f, -0.258819045f,
+    -0.961261696f, -0.275637356f,
+    -0.956304756f, -0.292371705f,
+    -0.951056516f, -0.309016994f,
+    -0.945518576f, -0.325568154f,
+    -0.939692621f, -0.342020143f,
+    -0.933580426f, -0.358367950f,
+    -0.927183855f, -0.374606593f,
+    -0.920504853f, -0.390731128f,
+    -0.913545458f, -0.406736643f,
+    -0.906307787f, -0.422618262f,
+    -0.898794046f, -0.438371147f,
+    -0.891006524f, -0.453990500f,
+    -0.882947593f, -0.469471563f,
+    -0.874619707f, -0.484809620f,
+    -0.866025404f, -0.500000000f,
+    -0.857167301f, -0.515038075f,
+    -0.848048096f, -0.529919264f,
+    -0.838670568f, -0.544639035f,
+    -0.829037573f, -0.559192903f,
+    -0.819152044f, -0.573576436f,
+    -0.809016994f, -0.587785252f,
+    -0.798635510f, -0.601815023f,
+    -0.788010754f, -0.615661475f,
+    -0.777145961f, -0.629320391f,
+    -0.766044443f, -0.642787610f,
+    -0.754709580f, -0.656059029f,
+    -0.743144825f, -0.669130606f,
+    -0.731353702f, -0.681998360f,
+    -0.719339800f, -0.694658370f,
+    -0.707106781f, -0.707106781f,
+    -0.694658370f, -0.719339800f,
+    -0.681998360f, -0.731353702f,
+    -0.669130606f, -0.743144825f,
+    -0.656059029f, -0.754709580f,
+    -0.642787610f, -0.766044443f,
+    -0.629320391f, -0.777145961f,
+    -0.615661475f, -0.788010754f,
+    -0.601815023f, -0.798635510f,
+    -0.587785252f, -0.809016994f,
+    -0.573576436f, -0.819152044f,
+    -0.559192903f, -0.829037573f,
+    -0.544639035f, -0.838670568f,
+    -0.529919264f, -0.848048096f,
+    -0.515038075f, -0.857167301f,
+    -0.500000000f, -0.866025404f,
+    -0.484809620f, -0.874619707f,
+    -0.469471563f, -0.882947593f,
+    -0.453990500f, -0.891006524f,
+    -0.438371147f, -0.898794046f,
+    -0.422618262f, -0.906307787f,
+    -0.406736643f, -0.913545458f,
+    -0.390731128f, -0.920504853f,
+    -0.374606593f, -0.927183855f,
+    -0.358367950f, -0.933580426f,
+    -0.342020143f, -0.939692621f,
+    -0.325568154f, -0.945518576f,
+    -0.309016994f, -0.951056516f,
+    -0.292371705f, -0.956304756f,
+    -0.275637356f, -0.961261696f,
+    -0.258819045f, -0.965925826f,
+    -0.241921896f, -0.970295726f,
+    -0.224951054f, -0.974370065f,
+    -0.207911691f, -0.978147601f,
+    -0.190808995f, -0.981627183f,
+    -0.173648178f, -0.984807753f,
+    -0.156434465f, -0.987688341f,
+    -0.139173101f, -0.990268069f,
+    -0.121869343f, -0.992546152f,
+    -0.104528463f, -0.994521895f,
+    -0.087155743f, -0.996194698f,
+    -0.069756474f, -0.997564050f,
+    -0.052335956f, -0.998629535f,
+    -0.034899497f, -0.999390827f,
+    -0.017452406f, -0.999847695f,
+    0.000000000f, -1.000000000f,
+    0.017452406f, -0.999847695f,
+    0.034899497f, -0.999390827f,
+    0.052335956f, -0.998629535f,
+    0.069756474f, -0.997564050f,
+    0.087155743f, -0.996194698f,
+    0.104528463f, -0.994521895f,
+    0.121869343f, -0.992546152f,
+    0.139173101f, -0.990268069f,
+    0.156434465f, -0.987688341f,
+    0.173648178f, -0.984807753f,
+    0.190808995f, -0.981627183f,
+    0.207911691f, -0.978147601f,
+    0.224951054f, -0.974370065f,
+    0.241921896f, -0.970295726f,
+    0.258819045f, -0.965925826f,
+    0.275637356f, -0.961261696f,
+    0.292371705f, -0.956304756f,
+    0.309016994f, -0.951056516f,
+    0.325568154f, -0.945518576f,
+    0.342020143f, -0.939692621f,
+    0.358367950f, -0.933580426f,
+    0.374606593f, -0.927183855f,
+    0.390731128f, -0.920504853f,
+    0.406736643f, -0.913545458f,
+    0.422618262f, -0.906307787f,
+    0.438371147f, -0.898794046f,
+    0.453990500f, -0.891006524f,
+    0.469471563f, -0.882947593f,
+    0.484809620f, -0.874619707f,
+    0.500000000f, -0.866025404f,
+    0.515038075f, -0.857167301f,
+    0.529919264f, -0.848048096f,
+    0.544639035f, -0.838670568f,
+    0.559192903f, -0.829037573f,
+    0.573576436f, -0.819152044f,
+    0.587785252f, -0.809016994f,
+    0.601815023f, -0.798635510f,
+    0.615661475f, -0.788010754f,
+    0.629320391f, -0.777145961f,
+    0.642787610f, -0.766044443f,
+    0.656059029f, -0.754709580f,
+    0.669130606f, -0.743144825f,
+    0.681998360f, -0.731353702f,
+    0.694658370f, -0.719339800f,
+    0.707106781f, -0.707106781f,
+    0.719339800f, -0.694658370f,
+    0.731353702f, -0.681998360f,
+    0.743144825f, -0.669130606f,
+    0.754709580f, -0.656059029f,
+    0.766044443f, -0.642787610f,
+    0.777145961f, -0.629320391f,
+    0.788010754f, -0.615661475f,
+    0.798635510f, -0.601815023f,
+    0.809016994f, -0.587785252f,
+    0.819152044f, -0.573576436f,
+    0.829037573f, -0.559192903f,
+    0.838670568f, -0.544639035f,
+    0.848048096f, -0.529919264f,
+    0.857167301f, -0.515038075f,
+    0.866025404f, -0.500000000f,
+    0.874619707f, -0.484809620f,
+    0.882947593f, -0.469471563f,
+    0.891006524f, -0.453990500f,
+    0.898794046f, -0.438371147f,
+    0.906307787f, -0.422618262f,
+    0.913545458f, -0.406736643f,
+    0.920504853f, -0.390731128f,
+    0.927183855f, -0.374606593f,
+    0.933580426f, -0.358367950f,
+    0.939692621f, -0.342020143f,
+    0.945518576f, -0.325568154f,
+    0.951056516f, -0.309016994f,
+    0.956304756f, -0.292371705f,
+    0.961261696f, -0.275637356f,
+    0.965925826f, -0.258819045f,
+    0.970295726f, -0.241921896f,
+    0.974370065f, -0.224951054f,
+    0.978147601f, -0.207911691f,
+    0.981627183f, -0.190808995f,
+    0.984807753f, -0.173648178f,
+    0.987688341f, -0.156434465f,
+    0.990268069f, -0.139173101f,
+    0.992546152f, -0.121869343f,
+    0.994521895f, -0.104528463f,
+    0.996194698f, -0.087155743f,
+    0.997564050f, -0.069756474f,
+    0.998629535f, -0.052335956f,
+    0.999390827f, -0.034899497f,
+    0.999847695f, -0.017452406f
+};
+#endif /* !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) */
+
+/**
+  @par
+  Example code for mixed-radix floating-point twiddle factors generation:
+  @par
+  <pre>for (i = 0; i< N; i++)
+  {
+ 	twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+ 	twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 480, PI = 3.14159265358979
+  @par
+  Cos and Sin values are in interleaved fashion
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_480)
+const float32_t twiddleCoef_mixed_480[960] = {
+    1.000000000f, 0.000000000f,
+    0.999914328f, 0.013089596f,
+    0.999657325f, 0.026176948f,
+    0.999229036f, 0.039259816f,
+    0.998629535f, 0.052335956f,
+    0.997858923f, 0.065403129f,
+    0.996917334f, 0.078459096f,
+    0.995804928f, 0.091501619f,
+    0.994521895f, 0.104528463f,
+    0.993068457f, 0.117537397f,
+    0.991444861f, 0.130526192f,
+    0.989651387f, 0.143492622f,
+    0.987688341f, 0.156434465f,
+    0.985556059f, 0.169349504f,
+    0.983254908f, 0.182235525f,
+    0.980785280f, 0.195090322f,
+    0.978147601f, 0.207911691f,
+    0.975342321f, 0.220697435f,
+    0.972369920f, 0.233445364f,
+    0.969230910f, 0.246153293f,
+    0.965925826f, 0.258819045f,
+    0.962455236f, 0.271440450f,
+    0.958819735f, 0.284015345f,
+    0.955019944f, 0.296541575f,
+    0.951056516f, 0.309016994f,
+    0.946930129f, 0.321439465f,
+    0.942641491f, 0.333806859f,
+    0.938191336f, 0.346117057f,
+    0.933580426f, 0.358367950f,
+    0.928809553f, 0.370557438f,
+    0.923879533f, 0.382683432f,
+    0.918791210f, 0.394743856f,
+    0.913545458f, 0.406736643f,
+    0.908143174f, 0.418659738f,
+    0.902585284f, 0.430511097f,
+    0.896872742f, 0.442288690f,
+    0.891006524f, 0.453990500f,
+    0.884987637f, 0.465614520f,
+    0.878817113f, 0.477158760f,
+    0.872496007f, 0.488621241f,
+    0.866025404f, 0.500000000f,
+    0.859406412f, 0.511293086f,
+    0.852640164f, 0.522498565f,
+    0.845727822f, 0.533614516f,
+    0.838670568f, 0.544639035f,
+    0.831469612f, 0.555570233f,
+    0.824126189f, 0.566406237f,
+    0.816641555f, 0.577145190f,
+    0.809016994f, 0.587785252f,
+    0.801253813f, 0.598324601f,
+    0.793353340f, 0.608761429f,
+    0.785316931f, 0.619093949f,
+    0.777145961f, 0.629320391f,
+    0.768841832f, 0.639439002f,
+    0.760405966f, 0.649448048f,
+    0.751839807f, 0.659345815f,
+    0.743144825f, 0.669130606f,
+    0.734322509f, 0.678800746f,
+    0.725374371f, 0.688354576f,
+    0.716301943f, 0.697790460f,
+    0.707106781f, 0.707106781f,
+    0.697790460f, 0.716301943f,
+    0.688354576f, 0.725374371f,
+    0.678800746f, 0.734322509f,
+    0.669130606f, 0.743144825f,
+    0.659345815f, 0.751839807f,
+    0.649448048f, 0.760405966f,
+    0.639439002f, 0.768841832f,
+    0.629320391f, 0.777145961f,
+    0.619093949f, 0.785316931f,
+    0.608761429f, 0.793353340f,
+    0.598324601f, 0.801253813f,
+    0.587785252f, 0.809016994f,
+    0.577145190f, 0.816641555f,
+    0.566406237f, 0.824126189f,
+    0.555570233f, 0.831469612f,
+    0.544639035f, 0.838670568f,
+    0.533614516f, 0.845727822f,
+    0.522498565f, 0.852640164f,
+    0.511293086f, 0.859406412f,
+    0.500000000f, 0.866025404f,
+    0.488621241f, 0.872496007f,
+    0.477158760f, 0.878817113f,
+    0.465614520f, 0.884987637f,
+    0.453990500f, 0.891006524f,
+    0.442288690f, 0.896872742f,
+    0.430511097f, 0.902585284f,
+    0.418659738f, 0.908143174f,
+    0.406736643f, 0.913545458f,
+    0.394743856f, 0.918791210f,
+    0.382683432f, 0.923879533f,
+    0.370557438f, 0.928809553f,
+    0.358367950f, 0.933580426f,
+    0.346117057f, 0.938191336f,
+    0.333806859f, 0.942641491f,
+    0.321439465f, 0.946930129f,
+    0.309016994f, 0.951056516f,
+    0.296541575f, 0.955019944f,
+    0.284015345f, 0.958819735f,
+    0.271440450f, 0.962455236f,
+    0.258819045f, 0.965925826f,
+    0.246153293f, 0.969230910f,
+    0.233445364f, 0.972369920f,
+    0.220697435f, 0.975342321f,
+    0.207911691f, 0.978147601f,
+    0.195090322f, 0.980785280f,
+    0.182235525f, 0.983254908f,
+    0.169349504f, 0.985556059f,
+    0.156434465f, 0.987688341f,
+    0.143492622f, 0.989651387f,
+    0.130526192f, 0.991444861f,
+    0.117537397f, 0.993068457f,
+    0.104528463f, 0.994521895f,
+    0.091501619f, 0.995804928f,
+    0.078459096f, 0.996917334f,
+    0.065403129f, 0.997858923f,
+    0.052335956f, 0.998629535f,
+    0.039259816f, 0.999229036f,
+    0.026176948f, 0.999657325f,
+    0.013089596f, 0.999914328f,
+    0.000000000f, 1.000000000f,
+    -0.013089596f, 0.999914328f,
+    -0.026176948f, 0.999657325f,
+    -0.039259816f, 0.999229036f,
+    -0.052335956f, 0.998629535f,
+    -0.065403129f, 0.997858923f,
+    -0.078459096f, 0.996917334f,
+    -0.091501619f, 0.995804928f,
+    -0.104528463f, 0.994521895f,
+    -0.117537397f, 0.993068457f,
+    -0.130526192f, 0.991444861f,
+    -0.143492622f, 0.989651387f,
+    -0.156434465f, 0.987688341f,
+    -0.169349504f, 0.985556059f,
+    -0.182235525f, 0.983254908f,
+    -0.195090322f, 0.980785280f,
+    -0.207911691f, 0.978147601f,
+    -0.220697435f, 0.975342321f,
+    -0.233445364f, 0.972369920f,
+    -0.246153293f, 0.969230910f,
+    -0.258819045f, 0.965925826f,
+    -0.271440450f, 0.962455236f,
+    -0.284015345f, 0.958819735f,
+    -0.296541575f, 0.955019944f,
+    -0.309016994f, 0.951056516f,
+    -0.321439465f, 0.946930129f,
+    -0.333806859f, 0.942641491f,
+    -0.346117057f, 0.938191336f,
+    -0.358367950f, 0.933580426f,
+    -0.370557438f, 0.928809553f,
+    -0.382683432f, 0.923879533f,
+    -0.394743856f, 0.918791210f,
+    -0.406736643f, 0.913545458f,
+    -0.418659738f, 0.908143174f,
+    -0.430511097f, 0.902585284f,
+    -0.442288690f, 0.896872742f,
+    -0.453990500f, 0.891006524f,
+    -0.465614520f, 0.884987637f,
+    -0.477158760f, 0.878817113f,
+    -0.488621241f, 0.872496007f,
+    -0.500000000f, 0.866025404f,
+    -0.511293086f, 0.859406412f,
+    -0.522498565f, 0.852640164f,
+    -0.533614516f, 0.845727822f,
+    -0.544639035f, 0.838670568f,
+    -0.555570233f, 0.831469612f,
+    -0.566406237f, 0.824126189f,
+    -0.577145190f, 0.816641555f,
+    -0.587785252f, 0.809016994f,
+    -0.598324601f, 0.801253813f,
+    -0.608761429f, 0.793353340f,
+    -0.619093949f, 0.785316931f,
+    -0.629320391f, 0.777145961f,
+    -0.639439002f, 0.768841832f,
+    -0.649448048f, 0.760405966f,
+    -0.659345815f, 0.751839807f,
+    -0.669130606f, 0.743144825f,
+    -0.678800746f, 0.734322509f,
+    -0.688354576f, 0.725374371f,
+    -0.697790460f, 0.716301943f,
+    -0.707106781f, 0.707106781f,
+    -0.716301943f, 0.697790460f,
+    -0.725374371f, 0.688354576f,
+    -0.734322509f, 0.678800746f,
+    -0.743144825f, 0.669130606f,
+    -0.751839807f, 0.659345815f,
+    -0.760405966f, 0.649448048f,
+    -0.768841832f, 0.639439002f,
+    -0.777145961f, 0.629320391f,
+    -0.785316931f, 0.619093949f,
+    -0.793353340f, 0.608761429f,
+    -0.801253813f, 0.598324601f,
+    -0.809016994f, 0.587785252f,
+    -0.816641555f, 0.577145190f,
+    -0.824126189f, 0.566406237f,
+    -0.831469612f, 0.555570233f,
+    -0.838670568f, 0.544639035f,
+    -0.845727822f, 0.533614516f,
+    -0.852640164f, 0.522498565f,
+    -0.859406412f, 0.511293086f,
+    -0.866025404f, 0.500000000f,
+    -0.872496007f, 0.488621241f,
+    -0.878817113f, 0.477158760f,
+    -0.884987637f, 0.465614520f,
+    -0.891006524f, 0.453990500f,
+    -0.896872742f, 0.442288690f,
+    -0.902585284f, 0.430511097f,
+    -0.908143174f, 0.418659738f,
+    -0.913545458f, 0.406736643f,
+    -0.918791210f, 0.394743856f,
+    -0.923879533f, 0.382683432f,
+    -0.928809553f, 0.370557438f,
+    -0.933580426f, 0.358367950f,
+    -0.938191336f, 0.346117057f,
+    -0.942641491f, 0.333806859f,
+    -0.946930129f, 0.321439465f,
+    -0.951056516f, 0.309016994f,
+    -0.955019944f, 0.296541575f,
+    -0.958819735f, 0.284015345f,
+    -0.962455236f, 0.271440450f,
+    -0.965925826f, 0.258819045f,
+    -0.969230910f, 0.246153293f,
+    -0.972369920f, 0.233445364f,
+    -0.975342321f, 0.220697435f,
+    -0.978147601f, 0.207911691f,
+    -0.980785280f, 0.195090322f,
+    -0.983254908f, 0.182235525f,
+    -0.985556059f, 0.169349504f,
+    -0.987688341f, 0.156434465f,
+    -0.989651387f, 0.143492622f,
+    -0.991444861f, 0.130526192f,
+    -0.993068457f, 0.117537397f,
+    -0.994521895f, 0.104528463f,
+    -0.995804928f, 0.091501619f,
+    -0.996917334f, 0.078459096f,
+    -0.997858923f, 0.065403129f,
+    -0.998629535f, 0.052335956f,
+    -0.999229036f, 0.039259816f,
+    -0.999657325f, 0.026176948f,
+    -0.999914328f, 0.013089596f,
+    -1.000000000f, 0.000000000f,
+    -0.999914328f, -0.013089596f,
+    -0.999657325f, -0.026176948f,
+    -0.999229036f, -0.039259816f,
+    -0.998629535f, -0.052335956f,
+    -0.997858923f, -0.065403129f,
+    -0.996917334f, -0.078459096f,
+    -0.995804928f, -0.091501619f,
+    -0.994521895f, -0.104528463f,
+    -0.993068457f, -0.117537397f,
+    -0.991444861f, -0.130526192f,
+    -0.989651387f, -0.143492622f,
+    -0.987688341f, -0.156434465f,
+    -0.985556059f, -0.169349504f,
+    -0.983254908f, -0.182235525f,
+    -0.980785280f, -0.195090322f,
+    -0.978147601f, -0.207911691f,
+    -0.975342321f, -0.220697435f,
+    -0.972369920f, -0.233445364f,
+    -0.969230910f, -0.246153293f,
+    -0.965925826f, -0.258819045f,
+    -0.962455236f, -0.271440450f,
+    -0.958819735f, -0.284015345f,
+    -0.955019944f, -0.296541575f,
+    -0.951056516f, -0.309016994f,
+    -0.946930129f, -0.321439465f,
+    -0.942641491f, -0.333806859f,
+    -0.938191336f, -0.346117057f,
+    -0.933580426f, -0.358367950f,
+    -0.928809553f, -0.370557438f,
+    -0.923879533f, -0.382683432f,
+    -0.918791210f, -0.394743856f,
+    -0.913545458f, -0.406736643f,
+    -0.908143174f, -0.418659738f,
+    -0.902585284f, -0.430511097f,
+    -0.896872742f, -0.442288690f,
+    -0.891006524f, -0.453990500f,
+    -0.884987637f, -0.465614520f,
+    -0.878817113f, -0.477158760f,
+    -0.872496007f, -0.488621241f,
+    -0.866025404f, -0.500000000f,
+    -0.859406412f, -0.511293086f,
+    -0.852640164f, -0.522498565f,
+    -0.845727822f, -0.533614516f,
+    -0.838670568f, -0.544639035f,
+    -0.831469612f, -0.555570233f,
+    -0.824126189f, -0.566406237f,
+    -0.816641555f, -0.577145190f,
+    -0.809016994f, -0.587785252f,
+    -0.801253813f, -0.598324601f,
+    -0.793353340f, -0.608761429f,
+    -0.785316931f, -0.619093949f,
+    -0.777145961f, -0.629320391f,
+    -0.768841832f, -0.639439002f,
+    -0.760405966f, -0.649448048f,
+    -0.751839807f, -0.659345815f,
+    -0.743144825f, -0.669130606f,
+    -0.734322509f, -0.678800746f,
+    -0.725374371f, -0.688354576f,
+    -0.716301943f, -0.697790460f,
+    -0.707106781f, -0.707106781f,
+    -0.697790460f, -0.716301943f,
+    -0.688354576f, -0.725374371f,
+    -0.678800746f, -0.734322509f,
+    -0.669130606f, -0.743144825f,
+    -0.659345815f, -0.751839807f,
+    -0.649448048f, -0.760405966f,
+    -0.639439002f, -0.768841832f,
+    -0.629320391f, -0.777145961f,
+    -0.619093949f, -0.785316931f,
+    -0.608761429f, -0.793353340f,
+    -0.598324601f, -0.801253813f,
+    -0.587785252f, -0.809016994f,
+    -0.577145190f, -0.816641555f,
+    -0.566406237f, -0.824126189f,
+    -0.555570233f, -0.831469612f,
+    -0.544639035f, -0.838670568f,
+    -0.533614516f, -0.845727822f,
+    -0.522498565f, -0.852640164f,
+    -0.511293086f, -0.859406412f,
+    -0.500000000f, -0.866025404f,
+    -0.488621241f, -0.872496007f,
+    -0.477158760f, -0.878817113f,
+    -0.465614520f, -0.884987637f,
+    -0.453990500f, -0.891006524f,
+    -0.442288690f, -0.896872742f,
+    -0.430511097f, -0.902585284f,
+    -0.418659738f, -0.908143174f,
+    -0.406736643f, -0.913545458f,
+    -0.394743856f, -0.918791210f,
+    -0.382683432f, -0.923879533f,
+    -0.370557438f, -0.928809553f,
+    -0.358367950f, -0.933580426f,
+    -0.346117057f, -0.938191336f,
+    -0.333806859f, -0.942641491f,
+    -0.321439465f, -0.946930129f,
+    -0.309016994f, -0.951056516f,
+    -0.296541575f, -0.955019944f,
+    -0.284015345f, -0.958819735f,
+    -0.271440450f, -0.962455236f,
+    -0.258819045f, -0.965925826f,
+    -0.246153293f, -0.969230910f,
+    -0.233445364f, -0.972369920f,
+    -0.220697435f, -0.975342321f,
+    -0.207911691f, -0.978147601f,
+    -0.195090322f, -0.980785280f,
+    -0.182235525f, -0.983254908f,
+    -0.169349504f, -0.985556059f,
+    -0.156434465f, -0.987688341f,
+    -0.143492622f, -0.989651387f,
+    -0.130526192f, -0.991444861f,
+    -0.117537397f, -0.993068457f,
+    -0.104528463f, -0.994521895f,
+    -0.091501619f, -0.995804928f,
+    -0.078459096f, -0.996917334f,
+    -0.065403129f, -0.997858923f,
+    -0.052335956f, -0.998629535f,
+    -0.039259816f, -0.999229036f,
+    -0.026176948f, -0.999657325f,
+    -0.013089596f, -0.999914328f,
+    0.000000000f, -1.000000000f,
+    0.013089596f, -0.999914328f,
+    0.026176948f, -0.999657325f,
+    0.039259816f, -0.999229036f,
+    0.052335956f, -0.998629535f,
+    0.065403129f, -0.997858923f,
+    0.078459096f, -0.996917334f,
+    0.091501619f, -0.995804928f,
+    0.104528463f, -0.994521895f,
+    0.117537397f, -0.993068457f,
+    0.130526192f, -0.991444861f,
+    0.143492622f, -0.989651387f,
+    0.156434465f, -0.987688341f,
+    0.169349504f, -0.985556059f,
+    0.182235525f, -0.983254908f,
+    0.195090322f, -0.980785280f,
+    0.207911691f, -0.978147601f,
+    0.220697435f, -0.975342321f,
+    0.233445364f, -0.972369920f,
+    0.246153293f, -0.969230910f,
+    0.258819045f, -0.965925826f,
+    0.271440450f, -0.962455236f,
+    0.284015345f, -0.958819735f,
+    0.296541575f, -0.955019944f,
+    0.309016994f, -0.951056516f,
+    0.321439465f, -0.946930129f,
+    0.333806859f, -0.942641491f,
+    0.346117057f, -0.938191336f,
+    0.358367950f, -0.933580426f,
+    0.370557438f, -0.928809553f,
+    0.382683432f, -0.923879533f,
+    0.394743856f, -0.918791210f,
+    0.406736643f, -0.913545458f,
+    0.418659738f, -0.908143174f,
+    0.430511097f, -0.902585284f,
+    0.442288690f, -0.896872742f,
+    0.453990500f, -0.891006524f,
+    0.465614520f, -0.884987637f,
+    0.477158760f, -0.878817113f,
+    0.488621241f, -0.872496007f,
+    0.500000000f, -0.866025404f,
+    0.511293086f, -0.859406412f,
+    0.522498565f, -0.852640164f,
+    0.533614516f, -0.845727822f,
+    0.544639035f, -0.838670568f,
+    0.555570233f, -0.831469612f,
+    0.566406237f, -0.824126189f,
+    0.577145190f, -0.816641555f,
+    0.587785252f, -0.809016994f,
+    0.598324601f, -0.801253813f,
+    0.608761429f, -0.793353340f,
+    0.619093949f, -0.785316931f,
+    0.629320391f, -0.777145961f,
+    0.639439002f, -0.768841832f,
+    0.649448048f, -0.760405966f,
+    0.659345815f, -0.751839807f,
+    0.669130606f, -0.743144825f,
+    0.678800746f, -0.734322509f,
+    0.688354576f, -0.725374371f,
+    0.697790460f, -0.716301943f,
+    0.707106781f, -0.707106781f,
+    0.716301943f, -0.697790460f,
+    0.725374371f, -0.688354576f,
+    0.734322509f, -0.678800746f,
+    0.743144825f, -0.669130606f,
+    0.751839807f, -0.659345815f,
+    0.760405966f, -0.649448048f,
+    0.768841832f, -0.639439002f,
+    0.777145961f, -0.629320391f,
+    0.785316931f, -0.619093949f,
+    0.793353340f, -0.608761429f,
+    0.801253813f, -0.598324601f,
+    0.809016994f, -0.587785252f,
+    0.816641555f, -0.577145190f,
+    0.824126189f, -0.566406237f,
+    0.831469612f, -0.555570233f,
+    0.838670568f, -0.544639035f,
+    0.845727822f, -0.533614516f,
+    0.852640164f, -0.522498565f,
+    0.859406412f, -0.511293086f,
+    0.866025404f, -0.500000000f,
+    0.872496007f, -0.488621241f,
+    0.878817113f, -0.477158760f,
+    0.884987637f, -0.465614520f,
+    0.891006524f, -0.453990500f,
+    0.896872742f, -0.442288690f,
+    0.902585284f, -0.430511097f,
+    0.908143174f, -0.418659738f,
+    0.913545458f, -0.406736643f,
+    0.918791210f, -0.394743856f,
+    0.923879533f, -0.382683432f,
+    0.928809553f, -0.370557438f,
+    0.933580426f, -0.358367950f,
+    0.938191336f, -0.346117057f,
+    0.942641491f, -0.333806859f,
+    0.946930129f, -0.321439465f,
+    0.951056516f, -0.309016994f,
+    0.955019944f, -0.296541575f,
+    0.958819735f, -0.284015345f,
+    0.962455236f, -0.271440450f,
+    0.965925826f, -0.258819045f,
+    0.969230910f, -0.246153293f,
+    0.972369920f, -0.233445364f,
+    0.975342321f, -0.220697435f,
+    0.978147601f, -0.207911691f,
+    0.980785280f, -0.195090322f,
+    0.983254908f, -0.182235525f,
+    0.985556059f, -0.169349504f,
+    0.987688341f, -0.156434465f,
+    0.989651387f, -0.143492622f,
+    0.991444861f, -0.130526192f,
+    0.993068457f, -0.117537397f,
+    0.994521895f, -0.104528463f,
+    0.995804928f, -0.091501619f,
+    0.996917334f, -0.078459096f,
+    0.997858923f, -0.065403129f,
+    0.998629535f, -0.052335956f,
+    0.999229036f, -0.039259816f,
+    0.999657325f, -0.026176948f,
+    0.999914328f, -0.013089596f
+};
+#endif /* !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) */
+
+/**
+  @par
+  Example code for mixed-radix floating-point twiddle factors generation:
+  @par
+  <pre>for (i = 0; i< N; i++)
+  {
+ 	twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+ 	twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 720, PI = 3.14159265358979
+  @par
+  Cos and Sin values are in interleaved fashion
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_720)
+const float32_t twiddleCoef_mixed_720[1440] = {
+    1.000000000f, 0.000000000f,
+    0.999961923f, 0.008726535f,
+    0.999847695f, 0.017452406f,
+    0.999657325f, 0.026176948f,
+    0.999390827f, 0.034899497f,
+    0.999048222f, 0.043619387f,
+    0.998629535f, 0.052335956f,
+    0.998134798f, 0.061048540f,
+    0.997564050f, 0.069756474f,
+    0.996917334f, 0.078459096f,
+    0.996194698f, 0.087155743f,
+    0.995396198f, 0.095845753f,
+    0.994521895f, 0.104528463f,
+    0.993571856f, 0.113203214f,
+    0.992546152f, 0.121869343f,
+    0.991444861f, 0.130526192f,
+    0.990268069f, 0.139173101f,
+    0.989015863f, 0.147809411f,
+    0.987688341f, 0.156434465f,
+    0.986285602f, 0.165047606f,
+    0.984807753f, 0.173648178f,
+    0.983254908f, 0.182235525f,
+    0.981627183f, 0.190808995f,
+    0.979924705f, 0.199367934f,
+    0.978147601f, 0.207911691f,
+    0.976296007f, 0.216439614f,
+    0.974370065f, 0.224951054f,
+    0.972369920f, 0.233445364f,
+    0.970295726f, 0.241921896f,
+    0.968147640f, 0.250380004f,
+    0.965925826f, 0.258819045f,
+    0.963630453f, 0.267238376f,
+    0.961261696f, 0.275637356f,
+    0.958819735f, 0.284015345f,
+    0.956304756f, 0.292371705f,
+    0.953716951f, 0.300705800f,
+    0.951056516f, 0.309016994f,
+    0.948323655f, 0.317304656f,
+    0.945518576f, 0.325568154f,
+    0.942641491f, 0.333806859f,
+    0.939692621f, 0.342020143f,
+    0.936672189f, 0.350207381f,
+    0.933580426f, 0.358367950f,
+    0.930417568f, 0.366501227f,
+    0.927183855f, 0.374606593f,
+    0.923879533f, 0.382683432f,
+    0.920504853f, 0.390731128f,
+    0.917060074f, 0.398749069f,
+    0.913545458f, 0.406736643f,
+    0.909961271f, 0.414693243f,
+    0.906307787f, 0.422618262f,
+    0.902585284f, 0.430511097f,
+    0.898794046f, 0.438371147f,
+    0.894934362f, 0.446197813f,
+    0.891006524f, 0.453990500f,
+    0.887010833f, 0.461748613f,
+    0.882947593f, 0.469471563f,
+    0.878817113f, 0.477158760f,
+    0.874619707f, 0.484809620f,
+    0.870355696f, 0.492423560f,
+    0.866025404f, 0.500000000f,
+    0.861629160f, 0.507538363f,
+    0.857167301f, 0.515038075f,
+    0.852640164f, 0.522498565f,
+    0.848048096f, 0.529919264f,
+    0.843391446f, 0.537299608f,
+    0.838670568f, 0.544639035f,
+    0.833885822f, 0.551936985f,
+    0.829037573f, 0.559192903f,
+    0.824126189f, 0.566406237f,
+    0.819152044f, 0.573576436f,
+    0.814115518f, 0.580702956f,
+    0.809016994f, 0.587785252f,
+    0.803856861f, 0.594822787f,
+    0.798635510f, 0.601815023f,
+    0.793353340f, 0.608761429f,
+    0.788010754f, 0.615661475f,
+    0.782608157f, 0.622514637f,
+    0.777145961f, 0.629320391f,
+    0.771624583f, 0.636078220f,
+    0.766044443f, 0.642787610f,
+    0.760405966f, 0.649448048f,
+    0.754709580f, 0.656059029f,
+    0.748955721f, 0.662620048f,
+    0.743144825f, 0.669130606f,
+    0.737277337f, 0.675590208f,
+    0.731353702f, 0.681998360f,
+    0.725374371f, 0.688354576f,
+    0.719339800f, 0.694658370f,
+    0.713250449f, 0.700909264f,
+    0.707106781f, 0.707106781f,
+    0.700909264f, 0.713250449f,
+    0.694658370f, 0.719339800f,
+    0.688354576f, 0.725374371f,
+    0.681998360f, 0.731353702f,
+    0.675590208f, 0.737277337f,
+    0.669130606f, 0.743144825f,
+    0.662620048f, 0.748955721f,
+    0.656059029f, 0.754709580f,
+    0.649448048f, 0.760405966f,
+    0.642787610f, 0.766044443f,
+    0.636078220f, 0.771624583f,
+    0.629320391f, 0.777145961f,
+    0.622514637f, 0.782608157f,
+    0.615661475f, 0.788010754f,
+    0.608761429f, 0.793353340f,
+    0.601815023f, 0.798635510f,
+    0.594822787f, 0.803856861f,
+    0.587785252f, 0.809016994f,
+    0.580702956f, 0.814115518f,
+    0.573576436f, 0.819152044f,
+    0.566406237f, 0.824126189f,
+    0.559192903f, 0.829037573f,
+    0.551936985f, 0.833885822f,
+    0.544639035f, 0.838670568f,
+    0.537299608f, 0.843391446f,
+    0.529919264f, 0.848048096f,
+    0.522498565f, 0.852640164f,
+    0.515038075f, 0.857167301f,
+    0.507538363f, 0.861629160f,
+    0.500000000f, 0.866025404f,
+    0.492423560f, 0.870355696f,
+    0.484809620f, 0.874619707f,
+    0.477158760f, 0.878817113f,
+    0.469471563f, 0.882947593f,
+    0.461748613f, 0.887010833f,
+    0.453990500f, 0.891006524f,
+    0.446197813f, 0.894934362f,
+    0.438371147f, 0.898794046f,
+    0.430511097f, 0.902585284f,
+    0.422618262f, 0.906307787f,
+    0.414693243f, 0.909961271f,
+    0.406736643f, 0.913545458f,
+    0.398749069f, 0.917060074f,
+    0.390731128f, 0.920504853f,
+    0.382683432f, 0.923879533f,
+    0.374606593f, 0.927183855f,
+    0.366501227f, 0.930417568f,
+    0.358367950f, 0.933580426f,
+    0.350207381f, 0.936672189f,
+    0.342020143f, 0.939692621f,
+    0.333806859f, 0.942641491f,
+    0.325568154f, 0.945518576f,
+    0.317304656f, 0.948323655f,
+    0.309016994f, 0.951056516f,
+    0.300705800f, 0.953716951f,
+    0.292371705f, 0.956304756f,
+    0.284015345f, 0.958819735f,
+    0.275637356f, 0.961261696f,
+    0.267238376f, 0.963630453f,
+    0.258819045f, 0.965925826f,
+    0.250380004f, 0.968147640f,
+    0.241921896f, 0.970295726f,
+    0.233445364f, 0.972369920f,
+    0.224951054f, 0.974370065f,
+    0.216439614f, 0.976296007f,
+    0.207911691f, 0.978147601f,
+    0.199367934f, 0.979924705f,
+    0.190808995f, 0.981627183f,
+    0.182235525f, 0.983254908f,
+    0.173648178f, 0.984807753f,
+    0.165047606f, 0.986285602f,
+    0.156434465f, 0.987688341f,
+    0.147809411f, 0.989015863f,
+    0.139173101f, 0.990268069f,
+    0.130526192f, 0.991444861f,
+    0.121869343f, 0.992546152f,
+    0.113203214f, 0.993571856f,
+    0.104528463f, 0.994521895f,
+    0.095845753f, 0.995396198f,
+    0.087155743f, 0.996194698f,
+    0.078459096f, 0.996917334f,
+    0.069756474f, 0.997564050f,
+    0.061048540f, 0.998134798f,
+    0.052335956f, 0.998629535f,
+    0.043619387f, 0.999048222f,
+    0.034899497f, 0.999390827f,
+    0.026176948f, 0.999657325f,
+    0.017452406f, 0.999847695f,
+    0.008726535f, 0.999961923f,
+    0.000000000f, 1.000000000f,
+    -0.008726535f, 0.999961923f,
+    -0.017452406f, 0.999847695f,
+    -0.026176948f, 0.999657325f,
+    -0.034899497f, 0.999390827f,
+    -0.043619387f, 0.999048222f,
+    -0.052335956f, 0.998629535f,
+    -0.061048540f, 0.998134798f,
+    -0.069756474f, 0.997564050f,
+    -0.078459096f, 0.996917334f,
+    -0.087155743f, 0.996194698f,
+    -0.095845753f, 0.995396198f,
+    -0.104528463f, 0.994521895f,
+    -0.113203214f, 0.993571856f,
+    -0.121869343f, 0.992546152f,
+    -0.130526192f, 0.991444861f,
+    -0.139173101f, 0.990268069f,
+    -0.147809411f, 0.989015863f,
+    -0.156434465f, 0.987688341f,
+    -0.165047606f, 0.986285602f,
+    -0.173648178f, 0.984807753f,
+    -0.182235525f, 0.983254908f,
+    -0.190808995f, 0.981627183f,
+    -0.199367934f, 0.979924705f,
+    -0.207911691f, 0.978147601f,
+    -0.216439614f, 0.976296007f,
+    -0.224951054f, 0.974370065f,
+    -0.233445364f, 0.972369920f,
+    -0.241921896f, 0.970295726f,
+    -0.250380004f, 0.968147640f,
+    -0.258819045f, 0.965925826f,
+    -0.267238376f, 0.963630453f,
+    -0.275637356f, 0.961261696f,
+    -0.284015345f, 0.958819735f,
+    -0.292371705f, 0.956304756f,
+    -0.300705800f, 0.953716951f,
+    -0.309016994f, 0.951056516f,
+    -0.317304656f, 0.948323655f,
+    -0.325568154f, 0.945518576f,
+    -0.333806859f, 0.942641491f,
+    -0.342020143f, 0.939692621f,
+    -0.350207381f, 0.936672189f,
+    -0.358367950f, 0.933580426f,
+    -0.366501227f, 0.930417568f,
+    -0.374606593f, 0.927183855f,
+    -0.382683432f, 0.923879533f,
+    -0.390731128f, 0.920504853f,
+    -0.398749069f, 0.917060074f,
+    -0.406736643f, 0.913545458f,
+    -0.414693243f, 0.909961271f,
+    -0.422618262f, 0.906307787f,
+    -0.430511097f, 0.902585284f,
+    -0.438371147f, 0.898794046f,
+    -0.446197813f, 0.894934362f,
+    -0.453990500f, 0.891006524f,
+    -0.461748613f, 0.887010833f,
+    -0.469471563f, 0.882947593f,
+    -0.477158760f, 0.878817113f,
+    -0.484809620f, 0.874619707f,
+    -0.492423560f, 0.870355696f,
+    -0.500000000f, 0.866025404f,
+    -0.507538363f, 0.861629160f,
+    -0.515038075f, 0.857167301f,
+    -0.522498565f, 0.852640164f,
+    -0.529919264f, 0.848048096f,
+    -0.537299608f, 0.843391446f,
+    -0.544639035f, 0.838670568f,
+    -0.551936985f, 0.833885822f,
+    -0.559192903f, 0.829037573f,
+    -0.566406237f, 0.824126189f,
+    -0.573576436f, 0.819152044f,
+    -0.580702956f, 0.814115518f,
+    -0.587785252f, 0.809016994f,
+    -0.594822787f, 0.803856861f,
+    -0.601815023f, 0.798635510f,
+    -0.608761429f, 0.793353340f,
+    -0.615661475f, 0.788010754f,
+    -0.622514637f, 0.782608157f,
+    -0.629320391f, 0.777145961f,
+    -0.636078220f, 0.771624583f,
+    -0.642787610f, 0.766044443f,
+    -0.649448048f, 0.760405966f,
+    -0.656059029f, 0.754709580f,
+    -0.662620048f, 0.748955721f,
+    -0.669130606f, 0.743144825f,
+    -0.675590208f, 0.737277337f,
+    -0.681998360f, 0.731353702f,
+    -0.688354576f, 0.725374371f,
+    -0.694658370f, 0.719339800f,
+    -0.700909264f, 0.713250449f,
+    -0.707106781f, 0.707106781f,
+    -0.713250449f, 0.700909264f,
+    -0.719339800f, 0.694658370f,
+    -0.725374371f, 0.688354576f,
+    -0.731353702f, 0.681998360f,
+    -0.737277337f, 0.675590208f,
+    -0.743144825f, 0.669130606f,
+    -0.748955721f, 0.662620048f,
+    -0.754709580f, 0.656059029f,
+    -0.760405966f, 0.649448048f,
+    -0.766044443f, 0.642787610f,
+    -0.771624583f, 0.636078220f,
+    -0.777145961f, 0.629320391f,
+    -0.782608157f, 0.622514637f,
+    -0.788010754f, 0.615661475f,
+    -0.793353340f, 0.608761429f,
+    -0.798635510f, 0.601815023f,
+    -0.803856861f, 0.594822787f,
+    -0.809016994f, 0.587785252f,
+    -0.814115518f, 0.580702956f,
+    -0.819152044f, 0.573576436f,
+    -0.824126189f, 0.566406237f,
+    -0.829037573f, 0.559192903f,
+    -0.833885822f, 0.551936985f,
+    -0.838670568f, 0.544639035f,
+    -0.843391446f, 0.537299608f,
+    -0.848048096f, 0.529919264f,
+    -0.852640164f, 0.522498565f,
+    -0.857167301f, 0.515038075f,
+    -0.861629160f, 0.507538363f,
+    -0.866025404f, 0.500000000f,
+    -0.870355696f, 0.492423560f,
+    -0.874619707f, 0.484809620f,
+    -0.878817113f, 0.477158760f,
+    -0.882947593f, 0.469471563f,
+    -0.887010833f, 0.461748613f,
+    -0.891006524f, 0.453990500f,
+    -0.894934362f, 0.446197813f,
+    -0.898794046f, 0.438371147f,
+    -0.902585284f, 0.430511097f,
+    -0.906307787f, 0.422618262f,
+    -0.909961271f, 0.414693243f,
+    -0.913545458f, 0.406736643f,
+    -0.917060074f, 0.398749069f,
+    -0.920504853f, 0.390731128f,
+    -0.923879533f, 0.382683432f,
+    -0.927183855f, 0.374606593f,
+    -0.930417568f, 0.366501227f,
+    -0.933580426f, 0.358367950f,
+    -0.936672189f, 0.350207381f,
+    -0.939692621f, 0.342020143f,
+    -0.942641491f, 0.333806859f,
+    -0.945518576f, 0.325568154f,
+    -0.948323655f, 0.317304656f,
+    -0.951056516f, 0.309016994f,
+    -0.953716951f, 0.300705800f,
+    -0.956304756f, 0.292371705f,
+    -0.958819735f, 0.284015345f,
+    -0.961261696f, 0.275637356f,
+    -0.963630453f, 0.267238376f,
+    -0.965925826f, 0.258819045f,
+    -0.968147640f, 0.250380004f,
+    -0.970295726f, 0.241921896f,
+    -0.972369920f, 0.233445364f,
+    -0.974370065f, 0.224951054f,
+    -0.976296007f, 0.216439614f,
+    -0.978147601f, 0.207911691f,
+    -0.979924705f, 0.199367934f,
+    -0.981627183f, 0.190808995f,
+    -0.983254908f, 0.182235525f,
+    -0.984807753f, 0.173648178f,
+    -0.986285602f, 0.165047606f,
+    -0.987688341f, 0.156434465f,
+    -0.989015863f, 0.147809411f,
+    -0.990268069f, 0.139173101f,
+    -0.991444861f, 0.130526192f,
+    -0.992546152f, 0.121869343f,
+    -0.993571856f, 0.113203214f,
+    -0.994521895f, 0.104528463f,
+    -0.995396198f, 0.095845753f,
+    -0.996194698f, 0.087155743f,
+    -0.996917334f, 0.078459096f,
+    -0.997564050f, 0.069756474f,
+    -0.998134798f, 0.061048540f,
+    -0.998629535f, 0.052335956f,
+    -0.999048222f, 0.043619387f,
+    -0.999390827f, 0.034899497f,
+    -0.999657325f, 0.026176948f,
+    -0.999847695f, 0.017452406f,
+    -0.999961923f, 0.008726535f,
+    -1.000000000f, 0.000000000f,
+    -0.999961923f, -0.008726535f,
+    -0.999847695f, -0.017452406f,
+    -0.999657325f, -0.026176948f,
+    -0.999390827f, -0.034899497f,
+    -0.999048222f, -0.043619387f,
+    -0.998629535f, -0.052335956f,
+    -0.998134798f, -0.061048540f,
+    -0.997564050f, -0.069756474f,
+    -0.996917334f, -0.078459096f,
+    -0.996194698f, -0.087155743f,
+    -0.995396198f, -0.095845753f,
+    -0.994521895f, -0.104528463f,
+    -0.993571856f, -0.113203214f,
+    -0.992546152f, -0.121869343f,
+    -0.991444861f, -0.130526192f,
+    -0.990268069f, -0.139173101f,
+    -0.989015863f, -0.147809411f,
+    -0.987688341f, -0.156434465f,
+    -0.986285602f, -0.165047606f,
+    -0.984807753f, -0.173648178f,
+    -0.983254908f, -0.182235525f,
+    -0.981627183f, -0.190808995f,
+    -0.979924705f, -0.199367934f,
+    -0.978147601f, -0.207911691f,
+    -0.976296007f, -0.216439614f,
+    -0.974370065f, -0.224951054f,
+    -0.972369920f, -0.233445364f,
+    -0.970295726f, -0.241921896f,
+    -0.968147640f, -0.250380004f,
+    -0.965925826f, -0.258819045f,
+    -0.963630453f, -0.267238376f,
+    -0.961261696f, -0.275637356f,
+    -0.958819735f, -0.284015345f,
+    -0.956304756f, -0.292371705f,
+    -0.953716951f, -0.300705800f,
+    -0.951056516f, -0.309016994f,
+    -0.948323655f, -0.317304656f,
+    -0.945518576f, -0.325568154f,
+    -0.942641491f, -0.333806859f,
+    -0.939692621f, -0.342020143f,
+    -0.936672189f, -0.350207381f,
+    -0.933580426f, -0.358367950f,
+    -0.930417568f, -0.366501227f,
+    -0.927183855f, -0.374606593f,
+    -0.923879533f, -0.382683432f,
+    -0.920504853f, -0.390731128f,
+    -0.917060074f, -0.398749069f,
+    -0.913545458f, -0.406736643f,
+    -0.909961271f, -0.414693243f,
+    -0.906307787f, -0.422618262f,
+    -0.902585284f, -0.430511097f,
+    -0.898794046f, -0.438371147f,
+    -0.894934362f, -0.446197813f,
+    -0.891006524f, -0.453990500f,
+    -0.887010833f, -0.461748613f,
+    -0.882947593f, -0.469471563f,
+    -0.878817113f, -0.477158760f,
+    -0.874619707f, -0.484809620f,
+    -0.870355696f, -0.492423560f,
+    -0.866025404f, -0.500000000f,
+    -0.861629160f, -0.507538363f,
+    -0.857167301f, -0.515038075f,
+    -0.852640164f, -0.522498565f,
+    -0.848048096f, -0.529919264f,
+    -0.843391446f, -0.537299608f,
+    -0.838670568f, -0.544639035f,
+    -0.833885822f, -0.551936985f,
+    -0.829037573f, -0.559192903f,
+    -0.824126189f, -0.566406237f,
+    -0.819152044f, -0.573576436f,
+    -0.814115518f, -0.580702956f,
+    -0.809016994f, -0.587785252f,
+    -0.803856861f, -0.594822787f,
+    -0.798635510f, -0.601815023f,
+    -0.793353340f, -0.608761429f,
+    -0.788010754f, -0.615661475f,
+    -0.782608157f, -0.622514637f,
+    -0.777145961f, -0.629320391f,
+    -0.771624583f, -0.636078220f,
+    -0.766044443f, -0.642787610f,
+    -0.760405966f, -0.649448048f,
+    -0.754709580f, -0.656059029f,
+    -0.748955721f, -0.662620048f,
+    -0.743144825f, -0.669130606f,
+    -0.737277337f, -0.675590208f,
+    -0.731353702f, -0.681998360f,
+    -0.725374371f, -0.688354576f,
+    -0.719339800f, -0.694658370f,
+    -0.713250449f, -0.700909264f,
+    -0.707106781f, -0.707106781f,
+    -0.700909264f, -0.713250449f,
+    -0.694658370f, -0.719339800f,
+    -0.688354576f, -0.725374371f,
+    -0.681998360f, -0.731353702f,
+    -0.675590208f, -0.737277337f,
+    -0.669130606f, -0.743144825f,
+    -0.662620048f, -0.748955721f,
+    -0.656059029f, -0.754709580f,
+    -0.649448048f, -0.760405966f,
+    -0.642787610f, -0.766044443f,
+    -0.636078220f, -0.771624583f,
+    -0.629320391f, -0.777145961f,
+    -0.622514637f, -0.782608157f,
+    -0.615661475f, -0.788010754f,
+    -0.608761429f, -0.793353340f,
+    -0.601815023f, -0.798635510f,
+    -0.594822787f, -0.803856861f,
+    -0.587785252f, -0.809016994f,
+    -0.580702956f, -0.814115518f,
+    -0.573576436f, -0.819152044f,
+    -0.566406237f, -0.824126189f,
+    -0.559192903f, -0.829037573f,
+    -0.551936985f, -0.833885822f,
+    -0.544639035f, -0.838670568f,
+    -0.537299608f, -0.843391446f,
+    -0.529919264f, -0.848048096f,
+    -0.522498565f, -0.852640164f,
+    -0.515038075f, -0.857167301f,
+    -0.507538363f, -0.861629160f,
+    -0.500000000f, -0.866025404f,
+    -0.492423560f, -0.870355696f,
+    -0.484809620f, -0.874619707f,
+    -0.477158760f, -0.878817113f,
+    -0.469471563f, -0.882947593f,
+    -0.461748613f, -0.887010833f,
+    -0.453990500f, -0.891006524f,
+    -0.446197813f, -0.894934362f,
+    -0.438371147f, -0.898794046f,
+    -0.430511097f, -0.902585284f,
+    -0.422618262f, -0.906307787f,
+    -0.414693243f, -0.909961271f,
+    -0.406736643f, -0.913545458f,
+    -0.398749069f, -0.917060074f,
+    -0.390731128f, -0.920504853f,
+    -0.382683432f, -0.923879533f,
+    -0.374606593f, -0.927183855f,
+    -0.366501227f, -0.930417568f,
+    -0.358367950f, -0.933580426f,
+    -0.350207381f, -0.936672189f,
+    -0.342020143f, -0.939692621f,
+    -0.333806859f, -0.942641491f,
+    -0.325568154f, -0.945518576f,
+    -0.317304656f, -0.948323655f,
+    -0.309016994f, -0.951056516f,
+    -0.300705800f, -0.953716951f,
+    -0.292371705f, -0.956304756f,
+    -0.284015345f, -0.958819735f,
+    -0.275637356f, -0.961261696f,
+    -0.267238376f, -0.963630453f,
+    -0.258819045f, -0.965925826f,
+    -0.250380004f, -0.968147640f,
+    -0.241921896f, -0.970295726f,
+    -0.233445364f, -0.972369920f,
+    -0.224951054f, -0.974370065f,
+    -0.216439614f, -0.976296007f,
+    -0.207911691f, -0.978147601f,
+    -0.199367934f, -0.979924705f,
+    -0.190808995f, -0.981627183f,
+    -0.182235525f, -0.983254908f,
+    -0.173648178f, -0.984807753f,
+    -0.165047606f, -0.986285602f,
+    -0.156434465f, -0.987688341f,
+    -0.147809411f, -0.989015863f,
+    -0.139173101f, -0.990268069f,
+    -0.130526192f, -0.991444861f,
+    -0.121869343f, -0.992546152f,
+    -0.113203214f, -0.993571856f,
+    -0.104528463f, -0.994521895f,
+    -0.095845753f, -0.995396198f,
+    -0.087155743f, -0.996194698f,
+    -0.078459096f, -0.996917334f,
+    -0.069756474f, -0.997564050f,
+    -0.061048540f, -0.998134798f,
+    -0.052335956f, -0.998629535f,
+    -0.043619387f, -0.999048222f,
+    -0.034899497f, -0.999390827f,
+    -0.026176948f, -0.999657325f,
+    -0.017452406f, -0.999847695f,
+    -0.008726535f, -0.999961923f,
+    0.000000000f, -1.000000000f,
+    0.008726535f, -0.999961923f,
+    0.017452406f, -0.999847695f,
+    0.026176948f, -0.999657325f,
+    0.034899497f, -0.999390827f,
+    0.043619387f, -0.999048222f,
+    0.052335956f, -0.998629535f,
+    0.061048540f, -0.998134798f,
+    0.069756474f, -0.997564050f,
+    0.078459096f, -0.996917334f,
+    0.087155743f, -0.996194698f,
+    0.095845753f, -0.995396198f,
+    0.104528463f, -0.994521895f,
+    0.113203214f, -0.993571856f,
+    0.121869343f, -0.992546152f,
+    0.130526192f, -0.991444861f,
+    0.139173101f, -0.990268069f,
+    0.147809411f, -0.989015863f,
+    0.156434465f, -0.987688341f,
+    0.165047606f, -0.986285602f,
+    0.173648178f, -0.984807753f,
+    0.182235525f, -0.983254908f,
+    0.190808995f, -0.981627183f,
+    0.199367934f, -0.979924705f,
+    0.207911691f, -0.978147601f,
+    0.216439614f, -0.976296007f,
+    0.224951054f, -0.974370065f,
+    0.233445364f, -0.972369920f,
+    0.241921896f, -0.970295726f,
+    0.250380004f, -0.968147640f,
+    0.258819045f, -0.965925826f,
+    0.267238376f, -0.963630453f,
+    0.275637356f, -0.961261696f,
+    0.284015345f, -0.958819735f,
+    0.292371705f, -0.956304756f,
+    0.300705800f, -0.953716951f,
+    0.309016994f, -0.951056516f,
+    0.317304656f, -0.948323655f,
+    0.325568154f, -0.945518576f,
+    0.333806859f, -0.942641491f,
+    0.342020143f, -0.939692621f,
+    0.350207381f, -0.936672189f,
+    0.358367950f, -0.933580426f,
+    0.366501227f, -0.930417568f,
+    0.374606593f, -0.927183855f,
+    0.382683432f, -0.923879533f,
+    0.390731128f, -0.920504853f,
+    0.398749069f, -0.917060074f,
+    0.406736643f, -0.913545458f,
+    0.414693243f, -0.909961271f,
+    0.422618262f, -0.906307787f,
+    0.430511097f, -0.902585284f,
+    0.438371147f, -0.898794046f,
+    0.446197813f, -0.894934362f,
+    0.453990500f, -0.891006524f,
+    0.461748613f, -0.887010833f,
+    0.469471563f, -0.882947593f,
+    0.477158760f, -0.878817113f,
+    0.484809620f, -0.874619707f,
+    0.492423560f, -0.870355696f,
+    0.500000000f, -0.866025404f,
+    0.507538363f, -0.861629160f,
+    0.515038075f, -0.857167301f,
+    0.522498565f, -0.852640164f,
+    0.529919264f, -0.848048096f,
+    0.537299608f, -0.843391446f,
+    0.544639035f, -0.838670568f,
+    0.551936985f, -0.833885822f,
+    0.559192903f, -0.829037573f,
+    0.566406237f, -0.824126189f,
+    0.573576436f, -0.819152044f,
+    0.580702956f, -0.814115518f,
+    0.587785252f, -0.809016994f,
+    0.594822787f, -0.803856861f,
+    0.601815023f, -0.798635510f,
+    0.608761429f, -0.793353340f,
+    0.615661475f, -0.788010754f,
+    0.622514637f, -0.782608157f,
+    0.629320391f, -0.777145961f,
+    0.636078220f, -0.771624583f,
+    0.642787610f, -0.766044443f,
+    0.649448048f, -0.760405966f,
+    0.656059029f, -0.754709580f,
+    0.662620048f, -0.748955721f,
+    0.669130606f, -0.743144825f,
+    0.675590208f, -0.737277337f,
+    0.681998360f, -0.731353702f,
+    0.688354576f, -0.725374371f,
+    0.694658370f, -0.719339800f,
+    0.700909264f, -0.713250449f,
+    0.707106781f, -0.707106781f,
+    0.713250449f, -0.700909264f,
+    0.719339800f, -0.694658370f,
+    0.725374371f, -0.688354576f,
+    0.731353702f, -0.681998360f,
+    0.737277337f, -0.675590208f,
+    0.743144825f, -0.669130606f,
+    0.748955721f, -0.662620048f,
+    0.754709580f, -0.656059029f,
+    0.760405966f, -0.649448048f,
+    0.766044443f, -0.642787610f,
+    0.771624583f, -0.636078220f,
+    0.777145961f, -0.629320391f,
+    0.782608157f, -0.622514637f,
+    0.788010754f, -0.615661475f,
+    0.793353340f, -0.608761429f,
+    0.798635510f, -0.601815023f,
+    0.803856861f, -0.594822787f,
+    0.809016994f, -0.587785252f,
+    0.814115518f, -0.580702956f,
+    0.819152044f, -0.573576436f,
+    0.824126189f, -0.566406237f,
+    0.829037573f, -0.559192903f,
+    0.833885822f, -0.551936985f,
+    0.838670568f, -0.544639035f,
+    0.843391446f, -0.537299608f,
+    0.848048096f, -0.529919264f,
+    0.852640164f, -0.522498565f,
+    0.857167301f, -0.515038075f,
+    0.861629160f, -0.507538363f,
+    0.866025404f, -0.500000000f,
+    0.870355696f, -0.492423560f,
+    0.874619707f, -0.484809620f,
+    0.878817113f, -0.477158760f,
+    0.882947593f, -0.469471563f,
+    0.887010833f, -0.461748613f,
+    0.891006524f, -0.453990500f,
+    0.894934362f, -0.446197813f,
+    0.898794046f, -0.438371147f,
+    0.902585284f, -0.430511097f,
+    0.906307787f, -0.422618262f,
+    0.909961271f, -0.414693243f,
+    0.913545458f, -0.406736643f,
+    0.917060074f, -0.398749069f,
+    0.920504853f, -0.390731128f,
+    0.923879533f, -0.382683432f,
+    0.927183855f, -0.374606593f,
+    0.930417568f, -0.366501227f,
+    0.933580426f, -0.358367950f,
+    0.936672189f, -0.350207381f,
+    0.939692621f, -0.342020143f,
+    0.942641491f, -0.333806859f,
+    0.945518576f, -0.325568154f,
+    0.948323655f, -0.317304656f,
+    0.951056516f, -0.309016994f,
+    0.953716951f, -0.300705800f,
+    0.956304756f, -0.292371705f,
+    0.958819735f, -0.284015345f,
+    0.961261696f, -0.275637356f,
+    0.963630453f, -0.267238376f,
+    0.965925826f, -0.258819045f,
+    0.968147640f, -0.250380004f,
+    0.970295726f, -0.241921896f,
+    0.972369920f, -0.233445364f,
+    0.974370065f, -0.224951054f,
+    0.976296007f, -0.216439614f,
+    0.978147601f, -0.207911691f,
+    0.979924705f, -0.199367934f,
+    0.981627183f, -0.190808995f,
+    0.983254908f, -0.182235525f,
+    0.984807753f, -0.173648178f,
+    0.986285602f, -0.165047606f,
+    0.987688341f, -0.156434465f,
+    0.989015863f, -0.147809411f,
+    0.990268069f, -0.139173101f,
+    0.991444861f, -0.130526192f,
+    0.992546152f, -0.121869343f,
+    0.993571856f, -0.113203214f,
+    0.994521895f, -0.104528463f,
+    0.995396198f, -0.095845753f,
+    0.996194698f, -0.087155743f,
+    0.996917334f, -0.078459096f,
+    0.997564050f, -0.069756474f,
+    0.998134798f, -0.061048540f,
+    0.998629535f, -0.052335956f,
+    0.999048222f, -0.043619387f,
+    0.999390827f, -0.034899497f,
+    0.999657325f, -0.026176948f,
+    0.999847695f, -0.017452406f,
+    0.999961923f, -0.008726535f
+};
+#endif /* !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) */
+
+/**
+  @par
+  Example code for mixed-radix floating-point twiddle factors generation:
+  @par
+  <pre>for (i = 0; i< N; i++)
+  {
+ 	twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+ 	twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 1000, PI = 3.14159265358979
+  @par
+  Cos and Sin values are in interleaved fashion
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_1000)
+const float32_t twiddleCoef_mixed_1000[2000] = {
+    1.000000000f, 0.000000000f,
+    0.999980261f, 0.006283144f,
+    0.999921044f, 0.012566040f,
+    0.999822352f, 0.018848440f,
+    0.999684189f, 0.025130095f,
+    0.999506560f, 0.031410759f,
+    0.999289473f, 0.037690183f,
+    0.999032935f, 0.043968118f,
+    0.998736957f, 0.050244318f,
+    0.998401550f, 0.056518534f,
+    0.998026728f, 0.062790520f,
+    0.997612506f, 0.069060026f,
+    0.997158900f, 0.075326806f,
+    0.996665928f, 0.081590612f,
+    0.996133609f, 0.087851197f,
+    0.995561965f, 0.094108313f,
+    0.994951017f, 0.100361715f,
+    0.994300790f, 0.106611154f,
+    0.993611311f, 0.112856385f,
+    0.992882605f, 0.119097160f,
+    0.992114701f, 0.125333234f,
+    0.991307631f, 0.131564359f,
+    0.990461426f, 0.137790291f,
+    0.989576119f, 0.144010783f,
+    0.988651745f, 0.150225589f,
+    0.987688341f, 0.156434465f,
+    0.986685944f, 0.162637165f,
+    0.985644595f, 0.168833445f,
+    0.984564335f, 0.175023059f,
+    0.983445205f, 0.181205764f,
+    0.982287251f, 0.187381315f,
+    0.981090517f, 0.193549468f,
+    0.979855052f, 0.199709981f,
+    0.978580904f, 0.205862609f,
+    0.977268124f, 0.212007110f,
+    0.975916762f, 0.218143241f,
+    0.974526873f, 0.224270761f,
+    0.973098511f, 0.230389427f,
+    0.971631733f, 0.236498997f,
+    0.970126596f, 0.242599231f,
+    0.968583161f, 0.248689887f,
+    0.967001488f, 0.254770726f,
+    0.965381639f, 0.260841506f,
+    0.963723678f, 0.266901989f,
+    0.962027672f, 0.272951936f,
+    0.960293686f, 0.278991106f,
+    0.958521789f, 0.285019262f,
+    0.956712052f, 0.291036167f,
+    0.954864545f, 0.297041582f,
+    0.952979342f, 0.303035270f,
+    0.951056516f, 0.309016994f,
+    0.949096145f, 0.314986520f,
+    0.947098305f, 0.320943610f,
+    0.945063075f, 0.326888030f,
+    0.942990536f, 0.332819545f,
+    0.940880769f, 0.338737920f,
+    0.938733858f, 0.344642923f,
+    0.936549887f, 0.350534320f,
+    0.934328942f, 0.356411879f,
+    0.932071112f, 0.362275367f,
+    0.929776486f, 0.368124553f,
+    0.927445153f, 0.373959206f,
+    0.925077207f, 0.379779096f,
+    0.922672740f, 0.385583992f,
+    0.920231847f, 0.391373667f,
+    0.917754626f, 0.397147891f,
+    0.915241173f, 0.402906436f,
+    0.912691587f, 0.408649075f,
+    0.910105971f, 0.414375581f,
+    0.907484425f, 0.420085728f,
+    0.904827052f, 0.425779292f,
+    0.902133959f, 0.431456046f,
+    0.899405252f, 0.437115767f,
+    0.896641037f, 0.442758231f,
+    0.893841424f, 0.448383216f,
+    0.891006524f, 0.453990500f,
+    0.888136449f, 0.459579861f,
+    0.885231311f, 0.465151078f,
+    0.882291226f, 0.470703932f,
+    0.879316310f, 0.476238204f,
+    0.876306680f, 0.481753674f,
+    0.873262455f, 0.487250126f,
+    0.870183755f, 0.492727342f,
+    0.867070701f, 0.498185105f,
+    0.863923417f, 0.503623202f,
+    0.860742027f, 0.509041416f,
+    0.857526656f, 0.514439534f,
+    0.854277432f, 0.519817343f,
+    0.850994482f, 0.525174630f,
+    0.847677936f, 0.530511184f,
+    0.844327926f, 0.535826795f,
+    0.840944582f, 0.541121252f,
+    0.837528040f, 0.546394347f,
+    0.834078434f, 0.551645871f,
+    0.830595899f, 0.556875616f,
+    0.827080574f, 0.562083378f,
+    0.823532598f, 0.567268949f,
+    0.819952109f, 0.572432126f,
+    0.816339251f, 0.577572703f,
+    0.812694164f, 0.582690480f,
+    0.809016994f, 0.587785252f,
+    0.805307886f, 0.592856820f,
+    0.801566985f, 0.597904983f,
+    0.797794440f, 0.602929542f,
+    0.793990399f, 0.607930298f,
+    0.790155012f, 0.612907054f,
+    0.786288432f, 0.617859613f,
+    0.782390811f, 0.622787780f,
+    0.778462302f, 0.627691361f,
+    0.774503060f, 0.632570162f,
+    0.770513243f, 0.637423990f,
+    0.766493007f, 0.642252653f,
+    0.762442511f, 0.647055962f,
+    0.758361915f, 0.651833725f,
+    0.754251381f, 0.656585756f,
+    0.750111070f, 0.661311865f,
+    0.745941145f, 0.666011867f,
+    0.741741773f, 0.670685577f,
+    0.737513117f, 0.675332808f,
+    0.733255346f, 0.679953379f,
+    0.728968627f, 0.684547106f,
+    0.724653130f, 0.689113808f,
+    0.720309025f, 0.693653306f,
+    0.715936483f, 0.698165419f,
+    0.711535677f, 0.702649970f,
+    0.707106781f, 0.707106781f,
+    0.702649970f, 0.711535677f,
+    0.698165419f, 0.715936483f,
+    0.693653306f, 0.720309025f,
+    0.689113808f, 0.724653130f,
+    0.684547106f, 0.728968627f,
+    0.679953379f, 0.733255346f,
+    0.675332808f, 0.737513117f,
+    0.670685577f, 0.741741773f,
+    0.666011867f, 0.745941145f,
+    0.661311865f, 0.750111070f,
+    0.656585756f, 0.754251381f,
+    0.651833725f, 0.758361915f,
+    0.647055962f, 0.762442511f,
+    0.642252653f, 0.766493007f,
+    0.637423990f, 0.770513243f,
+    0.632570162f, 0.774503060f,
+    0.627691361f, 0.778462302f,
+    0.622787780f, 0.782390811f,
+    0.617859613f, 0.786288432f,
+    0.612907054f, 0.790155012f,
+    0.607930298f, 0.793990399f,
+    0.602929542f, 0.797794440f,
+    0.597904983f, 0.801566985f,
+    0.592856820f, 0.805307886f,
+    0.587785252f, 0.809016994f,
+    0.582690480f, 0.812694164f,
+    0.577572703f, 0.816339251f,
+    0.572432126f, 0.819952109f,
+    0.567268949f, 0.823532598f,
+    0.562083378f, 0.827080574f,
+    0.556875616f, 0.830595899f,
+    0.551645871f, 0.834078434f,
+    0.546394347f, 0.837528040f,
+    0.541121252f, 0.840944582f,
+    0.535826795f, 0.844327926f,
+    0.530511184f, 0.847677936f,
+    0.525174630f, 0.850994482f,
+    0.519817343f, 0.854277432f,
+    0.514439534f, 0.857526656f,
+    0.509041416f, 0.860742027f,
+    0.503623202f, 0.863923417f,
+    0.498185105f, 0.867070701f,
+    0.492727342f, 0.870183755f,
+    0.487250126f, 0.873262455f,
+    0.481753674f, 0.876306680f,
+    0.476238204f, 0.879316310f,
+    0.470703932f, 0.882291226f,
+    0.465151078f, 0.885231311f,
+    0.459579861f, 0.888136449f,
+    0.453990500f, 0.891006524f,
+    0.448383216f, 0.893841424f,
+    0.442758231f, 0.896641037f,
+    0.437115767f, 0.899405252f,
+    0.431456046f, 0.902133959f,
+    0.425779292f, 0.904827052f,
+    0.420085728f, 0.907484425f,
+    0.414375581f, 0.910105971f,
+    0.408649075f, 0.912691587f,
+    0.402906436f, 0.915241173f,
+    0.397147891f, 0.917754626f,
+    0.391373667f, 0.920231847f,
+    0.385583992f, 0.922672740f,
+    0.379779096f, 0.925077207f,
+    0.373959206f, 0.927445153f,
+    0.368124553f, 0.929776486f,
+    0.362275367f, 0.932071112f,
+    0.356411879f, 0.934328942f,
+    0.350534320f, 0.936549887f,
+    0.344642923f, 0.938733858f,
+    0.338737920f, 0.940880769f,
+    0.332819545f, 0.942990536f,
+    0.326888030f, 0.945063075f,
+    0.320943610f, 0.947098305f,
+    0.314986520f, 0.949096145f,
+    0.309016994f, 0.951056516f,
+    0.303035270f, 0.952979342f,
+    0.297041582f, 0.954864545f,
+    0.291036167f, 0.956712052f,
+    0.285019262f, 0.958521789f,
+    0.278991106f, 0.960293686f,
+    0.272951936f, 0.962027672f,
+    0.266901989f, 0.963723678f,
+    0.260841506f, 0.965381639f,
+    0.254770726f, 0.967001488f,
+    0.248689887f, 0.968583161f,
+    0.242599231f, 0.970126596f,
+    0.236498997f, 0.971631733f,
+    0.230389427f, 0.973098511f,
+    0.224270761f, 0.974526873f,
+    0.218143241f, 0.975916762f,
+    0.212007110f, 0.977268124f,
+    0.205862609f, 0.978580904f,
+    0.199709981f, 0.979855052f,
+    0.193549468f, 0.981090517f,
+    0.187381315f, 0.982287251f,
+    0.181205764f, 0.983445205f,
+    0.175023059f, 0.984564335f,
+    0.168833445f, 0.985644595f,
+    0.162637165f, 0.986685944f,
+    0.156434465f, 0.987688341f,
+    0.150225589f, 0.988651745f,
+    0.144010783f, 0.989576119f,
+    0.137790291f, 0.990461426f,
+    0.131564359f, 0.991307631f,
+    0.125333234f, 0.992114701f,
+    0.119097160f, 0.992882605f,
+    0.112856385f, 0.993611311f,
+    0.106611154f, 0.994300790f,
+    0.100361715f, 0.994951017f,
+    0.094108313f, 0.995561965f,
+    0.087851197f, 0.996133609f,
+    0.081590612f, 0.996665928f,
+    0.075326806f, 0.997158900f,
+    0.069060026f, 0.997612506f,
+    0.062790520f, 0.998026728f,
+    0.056518534f, 0.998401550f,
+    0.050244318f, 0.998736957f,
+    0.043968118f, 0.999032935f,
+    0.037690183f, 0.999289473f,
+    0.031410759f, 0.999506560f,
+    0.025130095f, 0.999684189f,
+    0.018848440f, 0.999822352f,
+    0.012566040f, 0.999921044f,
+    0.006283144f, 0.999980261f,
+    0.000000000f, 1.000000000f,
+    -0.006283144f, 0.999980261f,
+    -0.012566040f, 0.999921044f,
+    -0.018848440f, 0.999822352f,
+    -0.025130095f, 0.999684189f,
+    -0.031410759f, 0.999506560f,
+    -0.037690183f, 0.999289473f,
+    -0.043968118f, 0.999032935f,
+    -0.050244318f, 0.998736957f,
+    -0.056518534f, 0.998401550f,
+    -0.062790520f, 0.998026728f,
+    -0.069060026f, 0.997612506f,
+    -0.075326806f, 0.997158900f,
+    -0.081590612f, 0.996665928f,
+    -0.087851197f, 0.996133609f,
+    -0.094108313f, 0.995561965f,
+    -0.100361715f, 0.994951017f,
+    -0.106611154f, 0.994300790f,
+    -0.112856385f, 0.993611311f,
+    -0.119097160f, 0.992882605f,
+    -0.125333234f, 0.992114701f,
+    -0.131564359f, 0.991307631f,
+    -0.137790291f, 0.990461426f,
+    -0.144010783f, 0.989576119f,
+    -0.150225589f, 0.988651745f,
+    -0.156434465f, 0.987688341f,
+    -0.162637165f, 0.986685944f,
+    -0.168833445f, 0.985644595f,
+    -0.175023059f, 0.984564335f,
+    -0.181205764f, 0.983445205f,
+    -0.187381315f, 0.982287251f,
+    -0.193549468f, 0.981090517f,
+    -0.199709981f, 0.979855052f,
+    -0.205862609f, 0.978580904f,
+    -0.212007110f, 0.977268124f,
+    -0.218143241f, 0.975916762f,
+    -0.224270761f, 0.974526873f,
+    -0.230389427f, 0.973098511f,
+    -0.236498997f, 0.971631733f,
+    -0.242599231f, 0.970126596f,
+    -0.248689887f, 0.968583161f,
+    -0.254770726f, 0.967001488f,
+    -0.260841506f, 0.965381639f,
+    -0.266901989f, 0.963723678f,
+    -0.272951936f, 0.962027672f,
+    -0.278991106f, 0.960293686f,
+    -0.285019262f, 0.958521789f,
+    -0.291036167f, 0.956712052f,
+    -0.297041582f, 0.954864545f,
+    -0.303035270f, 0.952979342f,
+    -0.309016994f, 0.951056516f,
+    -0.314986520f, 0.949096145f,
+    -0.320943610f, 0.947098305f,
+    -0.326888030f, 0.945063075f,
+    -0.332819545f, 0.942990536f,
+    -0.338737920f, 0.940880769f,
+    -0.344642923f, 0.938733858f,
+    -0.350534320f, 0.936549887f,
+    -0.356411879f, 0.934328942f,
+    -0.362275367f, 0.932071112f,
+    -0.368124553f, 0.929776486f,
+    -0.373959206f, 0.927445153f,
+    -0.379779096f, 0.925077207f,
+    -0.385583992f, 0.922672740f,
+    -0.391373667f, 0.920231847f,
+    -0.397147891f, 0.917754626f,
+    -0.402906436f, 0.915241173f,
+    -0.408649075f, 0.912691587f,
+    -0.414375581f, 0.910105971f,
+    -0.420085728f, 0.907484425f,
+    -0.425779292f, 0.904827052f,
+    -0.431456046f, 0.902133959f,
+    -0.437115767f, 0.899405252f,
+    -0.442758231f, 0.896641037f,
+    -0.448383216f, 0.893841424f,
+    -0.453990500f, 0.891006524f,
+    -0.459579861f, 0.888136449f,
+    -0.465151078f, 0.885231311f,
+    -0.470703932f, 0.882291226f,
+    -0.476238204f, 0.879316310f,
+    -0.481753674f, 0.876306680f,
+    -0.487250126f, 0.873262455f,
+    -0.492727342f, 0.870183755f,
+    -0.498185105f, 0.867070701f,
+    -0.503623202f, 0.863923417f,
+    -0.509041416f, 0.860742027f,
+    -0.514439534f, 0.857526656f,
+    -0.519817343f, 0.854277432f,
+    -0.525174630f, 0.850994482f,
+    -0.530511184f, 0.847677936f,
+    -0.535826795f, 0.844327926f,
+    -0.541121252f, 0.840944582f,
+    -0.546394347f, 0.837528040f,
+    -0.551645871f, 0.834078434f,
+    -0.556875616f, 0.830595899f,
+    -0.562083378f, 0.827080574f,
+    -0.567268949f, 0.823532598f,
+    -0.572432126f, 0.819952109f,
+    -0.577572703f, 0.816339251f,
+    -0.582690480f, 0.812694164f,
+    -0.587785252f, 0.809016994f,
+    -0.592856820f, 0.805307886f,
+    -0.597904983f, 0.801566985f,
+    -0.602929542f, 0.797794440f,
+    -0.607930298f, 0.793990399f,
+    -0.612907054f, 0.790155012f,
+    -0.617859613f, 0.786288432f,
+    -0.622787780f, 0.782390811f,
+    -0.627691361f, 0.778462302f,
+    -0.632570162f, 0.774503060f,
+    -0.637423990f, 0.770513243f,
+    -0.642252653f, 0.766493007f,
+    -0.647055962f, 0.762442511f,
+    -0.651833725f, 0.758361915f,
+    -0.656585756f, 0.754251381f,
+    -0.661311865f, 0.750111070f,
+    -0.666011867f, 0.745941145f,
+    -0.670685577f, 0.741741773f,
+    -0.675332808f, 0.737513117f,
+    -0.679953379f, 0.733255346f,
+    -0.684547106f, 0.728968627f,
+    -0.689113808f, 0.724653130f,
+    -0.693653306f, 0.720309025f,
+    -0.698165419f, 0.715936483f,
+    -0.702649970f, 0.711535677f,
+    -0.707106781f, 0.707106781f,
+    -0.711535677f, 0.702649970f,
+    -0.715936483f, 0.698165419f,
+    -0.720309025f, 0.693653306f,
+    -0.724653130f, 0.689113808f,
+    -0.728968627f, 0.684547106f,
+    -0.733255346f, 0.679953379f,
+    -0.737513117f, 0.675332808f,
+    -0.741741773f, 0.670685577f,
+    -0.745941145f, 0.666011867f,
+    -0.750111070f, 0.661311865f,
+    -0.754251381f, 0.656585756f,
+    -0.758361915f, 0.651833725f,
+    -0.762442511f, 0.647055962f,
+    -0.766493007f, 0.642252653f,
+    -0.770513243f, 0.637423990f,
+    -0.774503060f, 0.632570162f,
+    -0.778462302f, 0.627691361f,
+    -0.782390811f, 0.622787780f,
+    -0.786288432f, 0.617859613f,
+    -0.790155012f, 0.612907054f,
+    -0.793990399f, 0.607930298f,
+    -0.797794440f, 0.602929542f,
+    -0.801566985f, 0.597904983f,
+    -0.805307886f, 0.592856820f,
+    -0.809016994f, 0.587785252f,
+    -0.812694164f, 0.582690480f,
+    -0.816339251f, 0.577572703f,
+    -0.819952109f, 0.572432126f,
+    -0.823532598f, 0.567268949f,
+    -0.827080574f, 0.562083378f,
+    -0.830595899f, 0.556875616f,
+    -0.834078434f, 0.551645871f,
+    -0.837528040f, 0.546394347f,
+    -0.840944582f, 0.541121252f,
+    -0.844327926f, 0.535826795f,
+    -0.847677936f, 0.530511184f,
+    -0.850994482f, 0.525174630f,
+    -0.854277432f, 0.519817343f,
+    -0.857526656f, 0.514439534f,
+    -0.860742027f, 0.509041416f,
+    -0.863923417f, 0.503623202f,
+    -0.867070701f, 0.498185105f,
+    -0.870183755f, 0.492727342f,
+    -0.873262455f, 0.487250126f,
+    -0.876306680f, 0.481753674f,
+    -0.879316310f, 0.476238204f,
+    -0.882291226f, 0.470703932f,
+    -0.885231311f, 0.465151078f,
+    -0.888136449f, 0.459579861f,
+    -0.891006524f, 0.453990500f,
+    -0.893841424f, 0.448383216f,
+    -0.896641037f, 0.442758231f,
+    -0.899405252f, 0.437115767f,
+    -0.902133959f, 0.431456046f,
+    -0.904827052f, 0.425779292f,
+    -0.907484425f, 0.420085728f,
+    -0.910105971f, 0.414375581f,
+    -0.912691587f, 0.408649075f,
+    -0.915241173f, 0.402906436f,
+    -0.917754626f, 0.397147891f,
+    -0.920231847f, 0.391373667f,
+    -0.922672740f, 0.385583992f,
+    -0.925077207f, 0.379779096f,
+    -0.927445153f, 0.373959206f,
+    -0.929776486f, 0.368124553f,
+    -0.932071112f, 0.362275367f,
+    -0.934328942f, 0.356411879f,
+    -0.936549887f, 0.350534320f,
+    -0.938733858f, 0.344642923f,
+    -0.940880769f, 0.338737920f,
+    -0.942990536f, 0.332819545f,
+    -0.945063075f, 0.326888030f,
+    -0.947098305f, 0.320943610f,
+    -0.949096145f, 0.314986520f,
+    -0.951056516f, 0.309016994f,
+    -0.952979342f, 0.303035270f,
+    -0.954864545f, 0.297041582f,
+    -0.956712052f, 0.291036167f,
+    -0.958521789f, 0.285019262f,
+    -0.960293686f, 0.278991106f,
+    -0.962027672f, 0.272951936f,
+    -0.963723678f, 0.266901989f,
+    -0.965381639f, 0.260841506f,
+    -0.967001488f, 0.254770726f,
+    -0.968583161f, 0.248689887f,
+    -0.970126596f, 0.242599231f,
+    -0.971631733f, 0.236498997f,
+    -0.973098511f, 0.230389427f,
+    -0.974526873f, 0.224270761f,
+    -0.975916762f, 0.218143241f,
+    -0.977268124f, 0.212007110f,
+    -0.978580904f, 0.205862609f,
+    -0.979855052f, 0.199709981f,
+    -0.981090517f, 0.193549468f,
+    -0.982287251f, 0.187381315f,
+    -0.983445205f, 0.181205764f,
+    -0.984564335f, 0.175023059f,
+    -0.985644595f, 0.168833445f,
+    -0.986685944f, 0.162637165f,
+    -0.987688341f, 0.156434465f,
+    -0.988651745f, 0.150225589f,
+    -0.989576119f, 0.144010783f,
+    -0.990461426f, 0.137790291f,
+    -0.991307631f, 0.131564359f,
+    -0.992114701f, 0.125333234f,
+    -0.992882605f, 0.119097160f,
+    -0.993611311f, 0.112856385f,
+    -0.994300790f, 0.106611154f,
+    -0.994951017f, 0.100361715f,
+    -0.995561965f, 0.094108313f,
+    -0.996133609f, 0.087851197f,
+    -0.996665928f, 0.081590612f,
+    -0.997158900f, 0.075326806f,
+    -0.997612506f, 0.069060026f,
+    -0.998026728f, 0.062790520f,
+    -0.998401550f, 0.056518534f,
+    -0.998736957f, 0.050244318f,
+    -0.999032935f, 0.043968118f,
+    -0.999289473f, 0.037690183f,
+    -0.999506560f, 0.031410759f,
+    -0.999684189f, 0.025130095f,
+    -0.999822352f, 0.018848440f,
+    -0.999921044f, 0.012566040f,
+    -0.999980261f, 0.006283144f,
+    -1.000000000f, 0.000000000f,
+    -0.999980261f, -0.006283144f,
+    -0.999921044f, -0.012566040f,
+    -0.999822352f, -0.018848440f,
+    -0.999684189f, -0.025130095f,
+    -0.999506560f, -0.031410759f,
+    -0.999289473f, -0.037690183f,
+    -0.999032935f, -0.043968118f,
+    -0.998736957f, -0.050244318f,
+    -0.998401550f, -0.056518534f,
+    -0.998026728f, -0.062790520f,
+    -0.997612506f, -0.069060026f,
+    -0.997158900f, -0.075326806f,
+    -0.996665928f, -0.081590612f,
+    -0.996133609f, -0.087851197f,
+    -0.995561965f, -0.094108313f,
+    -0.994951017f, -0.100361715f,
+    -0.994300790f, -0.106611154f,
+    -0.993611311f, -0.112856385f,
+    -0.992882605f, -0.119097160f,
+    -0.992114701f, -0.125333234f,
+    -0.991307631f, -0.131564359f,
+    -0.990461426f, -0.137790291f,
+    -0.989576119f, -0.144010783f,
+    -0.988651745f, -0.150225589f,
+    -0.987688341f, -0.156434465f,
+    -0.986685944f, -0.162637165f,
+    -0.985644595f, -0.168833445f,
+    -0.984564335f, -0.175023059f,
+    -0.983445205f, -0.181205764f,
+    -0.982287251f, -0.187381315f,
+    -0.981090517f, -0.193549468f,
+    -0.979855052f, -0.199709981f,
+    -0.978580904f, -0.205862609f,
+    -0.977268124f, -0.212007110f,
+    -0.975916762f, -0.218143241f,
+    -0.974526873f, -0.224270761f,
+    -0.973098511f, -0.230389427f,
+    -0.971631733f, -0.236498997f,
+    -0.970126596f, -0.242599231f,
+    -0.968583161f, -0.248689887f,
+    -0.967001488f, -0.254770726f,
+    -0.965381639f, -0.260841506f,
+    -0.963723678f, -0.266901989f,
+    -0.962027672f, -0.272951936f,
+    -0.960293686f, -0.278991106f,
+    -0.958521789f, -0.285019262f,
+    -0.956712052f, -0.291036167f,
+    -0.954864545f, -0.297041582f,
+    -0.952979342f, -0.303035270f,
+    -0.951056516f, -0.309016994f,
+    -0.949096145f, -0.314986520f,
+    -0.947098305f, -0.320943610f,
+    -0.945063075f, -0.326888030f,
+    -0.942990536f, -0.332819545f,
+    -0.940880769f, -0.338737920f,
+    -0.938733858f, -0.344642923f,
+    -0.936549887f, -0.350534320f,
+    -0.934328942f, -0.356411879f,
+    -0.932071112f, -0.362275367f,
+    -0.929776486f, -0.368124553f,
+    -0.927445153f, -0.373959206f,
+    -0.925077207f, -0.379779096f,
+    -0.922672740f, -0.385583992f,
+    -0.920231847f, -0.391373667f,
+    -0.917754626f, -0.397147891f,
+    -0.915241173f, -0.402906436f,
+    -0.912691587f, -0.408649075f,
+    -0.910105971f, -0.414375581f,
+    -0.907484425f, -0.420085728f,
+    -0.904827052f, -0.425779292f,
+    -0.902133959f, -0.431456046f,
+    -0.899405252f, -0.437115767f,
+    -0.896641037f, -0.442758231f,
+    -0.893841424f, -0.448383216f,
+    -0.891006524f, -0.453990500f,
+    -0.888136449f, -0.459579861f,
+    -0.885231311f, -0.465151078f,
+    -0.882291226f, -0.470703932f,
+    -0.879316310f, -0.476238204f,
+    -0.876306680f, -0.481753674f,
+    -0.873262455f, -0.487250126f,
+    -0.870183755f, -0.492727342f,
+    -0.867070701f, -0.498185105f,
+    -0.863923417f, -0.503623202f,
+    -0.860742027f, -0.509041416f,
+    -0.857526656f, -0.514439534f,
+    -0.854277432f, -0.519817343f,
+    -0.850994482f, -0.525174630f,
+    -0.847677936f, -0.530511184f,
+    -0.844327926f, -0.535826795f,
+    -0.840944582f, -0.541121252f,
+    -0.837528040f, -0.546394347f,
+    -0.834078434f, -0.551645871f,
+    -0.830595899f, -0.556875616f,
+    -0.827080574f, -0.562083378f,
+    -0.823532598f, -0.567268949f,
+    -0.819952109f, -0.572432126f,
+    -0.816339251f, -0.577572703f,
+    -0.812694164f, -0.582690480f,
+    -0.809016994f, -0.587785252f,
+    -0.805307886f, -0.592856820f,
+    -0.801566985f, -0.597904983f,
+    -0.797794440f, -0.602929542f,
+    -0.793990399f, -0.607930298f,
+    -0.790155012f, -0.612907054f,
+    -0.786288432f, -0.617859613f,
+    -0.782390811f, -0.622787780f,
+    -0.778462302f, -0.627691361f,
+    -0.774503060f, -0.632570162f,
+    -0.770513243f, -0.637423990f,
+    -0.766493007f, -0.642252653f,
+    -0.762442511f, -0.647055962f,
+    -0.758361915f, -0.651833725f,
+    -0.754251381f, -0.656585756f,
+    -0.750111070f, -0.661311865f,
+    -0.745941145f, -0.666011867f,
+    -0.741741773f, -0.670685577f,
+    -0.737513117f, -0.675332808f,
+    -0.733255346f, -0.679953379f,
+    -0.728968627f, -0.684547106f,
+    -0.724653130f, -0.689113808f,
+    -0.720309025f, -0.693653306f,
+    -0.715936483f, -0.698165419f,
+    -0.711535677f, -0.702649970f,
+    -0.707106781f, -0.707106781f,
+    -0.702649970f, -0.711535677f,
+    -0.698165419f, -0.715936483f,
+    -0.693653306f, -0.720309025f,
+    -0.689113808f, -0.724653130f,
+    -0.684547106f, -0.728968627f,
+    -0.679953379f, -0.733255346f,
+    -0.675332808f, -0.737513117f,
+    -0.670685577f, -0.741741773f,
+    -0.666011867f, -0.745941145f,
+    -0.661311865f, -0.750111070f,
+    -0.656585756f, -0.754251381f,
+    -0.651833725f, -0.758361915f,
+    -0.647055962f, -0.762442511f,
+    -0.642252653f, -0.766493007f,
+    -0.637423990f, -0.770513243f,
+    -0.632570162f, -0.774503060f,
+    -0.627691361f, -0.778462302f,
+    -0.622787780f, -0.782390811f,
+    -0.617859613f, -0.786288432f,
+    -0.612907054f, -0.790155012f,
+    -0.607930298f, -0.793990399f,
+    -0.602929542f, -0.797794440f,
+    -0.597904983f, -0.801566985f,
+    -0.592856820f, -0.805307886f,
+    -0.587785252f, -0.809016994f,
+    -0.582690480f, -0.812694164f,
+    -0.577572703f, -0.816339251f,
+    -0.572432126f, -0.819952109f,
+    -0.567268949f, -0.823532598f,
+    -0.562083378f, -0.827080574f,
+    -0.556875616f, -0.830595899f,
+    -0.551645871f, -0.834078434f,
+    -0.546394347f, -0.837528040f,
+    -0.541121252f, -0.840944582f,
+    -0.535826795f, -0.844327926f,
+    -0.530511184f, -0.847677936f,
+    -0.525174630f, -0.850994482f,
+    -0.519817343f, -0.854277432f,
+    -0.514439534f, -0.857526656f,
+    -0.509041416f, -0.860742027f,
+    -0.503623202f, -0.863923417f,
+    -0.498185105f, -0.867070701f,
+    -0.492727342f, -0.870183755f,
+    -0.487250126f, -0.873262455f,
+    -0.481753674f, -0.876306680f,
+    -0.476238204f, -0.879316310f,
+    -0.470703932f, -0.882291226f,
+    -0.465151078f, -0.885231311f,
+    -0.459579861f, -0.888136449f,
+    -0.453990500f, -0.891006524f,
+    -0.448383216f, -0.893841424f,
+    -0.442758231f, -0.896641037f,
+    -0.437115767f, -0.899405252f,
+    -0.431456046f, -0.902133959f,
+    -0.425779292f, -0.904827052f,
+    -0.420085728f, -0.907484425f,
+    -0.414375581f, -0.910105971f,
+    -0.408649075f, -0.912691587f,
+    -0.402906436f, -0.915241173f,
+    -0.397147891f, -0.917754626f,
+    -0.391373667f, -0.920231847f,
+    -0.385583992f, -0.922672740f,
+    -0.379779096f, -0.925077207f,
+    -0.373959206f, -0.927445153f,
+    -0.368124553f, -0.929776486f,
+    -0.362275367f, -0.932071112f,
+    -0.356411879f, -0.934328942f,
+    -0.350534320f, -0.936549887f,
+    -0.344642923f, -0.938733858f,
+    -0.338737920f, -0.940880769f,
+    -0.332819545f, -0.942990536f,
+    -0.326888030f, -0.945063075f,
+    -0.320943610f, -0.947098305f,
+    -0.314986520f, -0.949096145f,
+    -0.309016994f, -0.951056516f,
+    -0.303035270f, -0.952979342f,
+    -0.297041582f, -0.954864545f,
+    -0.291036167f, -0.956712052f,
+    -0.285019262f, -0.958521789f,
+    -0.278991106f, -0.960293686f,
+    -0.272951936f, -0.962027672f,
+    -0.266901989f, -0.963723678f,
+    -0.260841506f, -0.965381639f,
+    -0.254770726f, -0.967001488f,
+    -0.248689887f, -0.968583161f,
+    -0.242599231f, -0.970126596f,
+    -0.236498997f, -0.971631733f,
+    -0.230389427f, -0.973098511f,
+    -0.224270761f, -0.974526873f,
+    -0.218143241f, -0.975916762f,
+    -0.212007110f, -0.977268124f,
+    -0.205862609f, -0.978580904f,
+    -0.199709981f, -0.979855052f,
+    -0.193549468f, -0.981090517f,
+    -0.187381315f, -0.982287251f,
+    -0.181205764f, -0.983445205f,
+    -0.175023059f, -0.984564335f,
+    -0.168833445f, -0.985644595f,
+    -0.162637165f, -0.986685944f,
+    -0.156434465f, -0.987688341f,
+    -0.150225589f, -0.988651745f,
+    -0.144010783f, -0.989576119f,
+    -0.137790291f, -0.990461426f,
+    -0.131564359f, -0.991307631f,
+    -0.125333234f, -0.992114701f,
+    -0.119097160f, -0.992882605f,
+    -0.112856385f, -0.993611311f,
+    -0.106611154f, -0.994300790f,
+    -0.100361715f, -0.994951017f,
+    -0.094108313f, -0.995561965f,
+    -0.087851197f, -0.996133609f,
+    -0.081590612f, -0.996665928f,
+    -0.075326806f, -0.997158900f,
+    -0.069060026f, -0.997612506f,
+    -0.062790520f, -0.998026728f,
+    -0.056518534f, -0.998401550f,
+    -0.050244318f, -0.998736957f,
+    -0.043968118f, -0.999032935f,
+    -0.037690183f, -0.999289473f,
+    -0.031410759f, -0.999506560f,
+    -0.025130095f, -0.999684189f,
+    -0.018848440f, -0.999822352f,
+    -0.012566040f, -0.999921044f,
+    -0.006283144f, -0.999980261f,
+    0.000000000f, -1.000000000f,
+    0.006283144f, -0.999980261f,
+    0.012566040f, -0.999921044f,
+    0.018848440f, -0.999822352f,
+    0.025130095f, -0.999684189f,
+    0.031410759f, -0.999506560f,
+    0.037690183f, -0.999289473f,
+    0.043968118f, -0.999032935f,
+    0.050244318f, -0.998736957f,
+    0.056518534f, -0.998401550f,
+    0.062790520f, -0.998026728f,
+    0.069060026f, -0.997612506f,
+    0.075326806f, -0.997158900f,
+    0.081590612f, -0.996665928f,
+    0.087851197f, -0.996133609f,
+    0.094108313f, -0.995561965f,
+    0.100361715f, -0.994951017f,
+    0.106611154f, -0.994300790f,
+    0.112856385f, -0.993611311f,
+    0.119097160f, -0.992882605f,
+    0.125333234f, -0.992114701f,
+    0.131564359f, -0.991307631f,
+    0.137790291f, -0.990461426f,
+    0.144010783f, -0.989576119f,
+    0.150225589f, -0.988651745f,
+    0.156434465f, -0.987688341f,
+    0.162637165f, -0.986685944f,
+    0.168833445f, -0.985644595f,
+    0.175023059f, -0.984564335f,
+    0.181205764f, -0.983445205f,
+    0.187381315f, -0.982287251f,
+    0.193549468f, -0.981090517f,
+    0.199709981f, -0.979855052f,
+    0.205862609f, -0.978580904f,
+    0.212007110f, -0.977268124f,
+    0.218143241f, -0.975916762f,
+    0.224270761f, -0.974526873f,
+    0.230389427f, -0.973098511f,
+    0.236498997f, -0.971631733f,
+    0.242599231f, -0.970126596f,
+    0.248689887f, -0.968583161f,
+    0.254770726f, -0.967001488f,
+    0.260841506f, -0.965381639f,
+    0.266901989f, -0.963723678f,
+    0.272951936f, -0.962027672f,
+    0.278991106f, -0.960293686f,
+    0.285019262f, -0.958521789f,
+    0.291036167f, -0.956712052f,
+    0.297041582f, -0.954864545f,
+    0.303035270f, -0.952979342f,
+    0.309016994f, -0.951056516f,
+    0.314986520f, -0.949096145f,
+    0.320943610f, -0.947098305f,
+    0.326888030f, -0.945063075f,
+    0.332819545f, -0.942990536f,
+    0.338737920f, -0.940880769f,
+    0.344642923f, -0.938733858f,
+    0.350534320f, -0.936549887f,
+    0.356411879f, -0.934328942f,
+    0.362275367f, -0.932071112f,
+    0.368124553f, -0.929776486f,
+    0.373959206f, -0.927445153f,
+    0.379779096f, -0.925077207f,
+    0.385583992f, -0.922672740f,
+    0.391373667f, -0.920231847f,
+    0.397147891f, -0.917754626f,
+    0.402906436f, -0.915241173f,
+    0.408649075f, -0.912691587f,
+    0.414375581f, -0.910105971f,
+    0.420085728f, -0.907484425f,
+    0.425779292f, -0.904827052f,
+    0.431456046f, -0.902133959f,
+    0.437115767f, -0.899405252f,
+    0.442758231f, -0.896641037f,
+    0.448383216f, -0.893841424f,
+    0.453990500f, -0.891006524f,
+    0.459579861f, -0.888136449f,
+    0.465151078f, -0.885231311f,
+    0.470703932f, -0.882291226f,
+    0.476238204f, -0.879316310f,
+    0.481753674f, -0.876306680f,
+    0.487250126f, -0.873262455f,
+    0.492727342f, -0.870183755f,
+    0.498185105f, -0.867070701f,
+    0.503623202f, -0.863923417f,
+    0.509041416f, -0.860742027f,
+    0.514439534f, -0.857526656f,
+    0.519817343f, -0.854277432f,
+    0.525174630f, -0.850994482f,
+    0.530511184f, -0.847677936f,
+    0.535826795f, -0.844327926f,
+    0.541121252f, -0.840944582f,
+    0.546394347f, -0.837528040f,
+    0.551645871f, -0.834078434f,
+    0.556875616f, -0.830595899f,
+    0.562083378f, -0.827080574f,
+    0.567268949f, -0.823532598f,
+    0.572432126f, -0.819952109f,
+    0.577572703f, -0.816339251f,
+    0.582690480f, -0.812694164f,
+    0.587785252f, -0.809016994f,
+    0.592856820f, -0.805307886f,
+    0.597904983f, -0.801566985f,
+    0.602929542f, -0.797794440f,
+    0.607930298f, -0.793990399f,
+    0.612907054f, -0.790155012f,
+    0.617859613f, -0.786288432f,
+    0.622787780f, -0.782390811f,
+    0.627691361f, -0.778462302f,
+    0.632570162f, -0.774503060f,
+    0.637423990f, -0.770513243f,
+    0.642252653f, -0.766493007f,
+    0.647055962f, -0.762442511f,
+    0.651833725f, -0.758361915f,
+    0.656585756f, -0.754251381f,
+    0.661311865f, -0.750111070f,
+    0.666011867f, -0.745941145f,
+    0.670685577f, -0.741741773f,
+    0.675332808f, -0.737513117f,
+    0.679953379f, -0.733255346f,
+    0.684547106f, -0.728968627f,
+    0.689113808f, -0.724653130f,
+    0.693653306f, -0.720309025f,
+    0.698165419f, -0.715936483f,
+    0.702649970f, -0.711535677f,
+    0.707106781f, -0.707106781f,
+    0.711535677f, -0.702649970f,
+    0.715936483f, -0.698165419f,
+    0.720309025f, -0.693653306f,
+    0.724653130f, -0.689113808f,
+    0.728968627f, -0.684547106f,
+    0.733255346f, -0.679953379f,
+    0.737513117f, -0.675332808f,
+    0.741741773f, -0.670685577f,
+    0.745941145f, -0.666011867f,
+    0.750111070f, -0.661311865f,
+    0.754251381f, -0.656585756f,
+    0.758361915f, -0.651833725f,
+    0.762442511f, -0.647055962f,
+    0.766493007f, -0.642252653f,
+    0.770513243f, -0.637423990f,
+    0.774503060f, -0.632570162f,
+    0.778462302f, -0.627691361f,
+    0.782390811f, -0.622787780f,
+    0.786288432f, -0.617859613f,
+    0.790155012f, -0.612907054f,
+    0.793990399f, -0.607930298f,
+    0.797794440f, -0.602929542f,
+    0.801566985f, -0.597904983f,
+    0.805307886f, -0.592856820f,
+    0.809016994f, -0.587785252f,
+    0.812694164f, -0.582690480f,
+    0.816339251f, -0.577572703f,
+    0.819952109f, -0.572432126f,
+    0.823532598f, -0.567268949f,
+    0.827080574f, -0.562083378f,
+    0.830595899f, -0.556875616f,
+    0.834078434f, -0.551645871f,
+    0.837528040f, -0.546394347f,
+    0.840944582f, -0.541121252f,
+    0.844327926f, -0.535826795f,
+    0.847677936f, -0.530511184f,
+    0.850994482f, -0.525174630f,
+    0.854277432f, -0.519817343f,
+    0.857526656f, -0.514439534f,
+    0.860742027f, -0.509041416f,
+    0.863923417f, -0.503623202f,
+    0.867070701f, -0.498185105f,
+    0.870183755f, -0.492727342f,
+    0.873262455f, -0.487250126f,
+    0.876306680f, -0.481753674f,
+    0.879316310f, -0.476238204f,
+    0.882291226f, -0.470703932f,
+    0.885231311f, -0.465151078f,
+    0.888136449f, -0.459579861f,
+    0.891006524f, -0.453990500f,
+    0.893841424f, -0.448383216f,
+    0.896641037f, -0.442758231f,
+    0.899405252f, -0.437115767f,
+    0.902133959f, -0.431456046f,
+    0.904827052f, -0.425779292f,
+    0.907484425f, -0.420085728f,
+    0.910105971f, -0.414375581f,
+    0.912691587f, -0.408649075f,
+    0.915241173f, -0.402906436f,
+    0.917754626f, -0.397147891f,
+    0.920231847f, -0.391373667f,
+    0.922672740f, -0.385583992f,
+    0.925077207f, -0.379779096f,
+    0.927445153f, -0.373959206f,
+    0.929776486f, -0.368124553f,
+    0.932071112f, -0.362275367f,
+    0.934328942f, -0.356411879f,
+    0.936549887f, -0.350534320f,
+    0.938733858f, -0.344642923f,
+    0.940880769f, -0.338737920f,
+    0.942990536f, -0.332819545f,
+    0.945063075f, -0.326888030f,
+    0.947098305f, -0.320943610f,
+    0.949096145f, -0.314986520f,
+    0.951056516f, -0.309016994f,
+    0.952979342f, -0.303035270f,
+    0.954864545f, -0.297041582f,
+    0.956712052f, -0.291036167f,
+    0.958521789f, -0.285019262f,
+    0.960293686f, -0.278991106f,
+    0.962027672f, -0.272951936f,
+    0.963723678f, -0.266901989f,
+    0.965381639f, -0.260841506f,
+    0.967001488f, -0.254770726f,
+    0.968583161f, -0.248689887f,
+    0.970126596f, -0.242599231f,
+    0.971631733f, -0.236498997f,
+    0.973098511f, -0.230389427f,
+    0.974526873f, -0.224270761f,
+    0.975916762f, -0.218143241f,
+    0.977268124f, -0.212007110f,
+    0.978580904f, -0.205862609f,
+    0.979855052f, -0.199709981f,
+    0.981090517f, -0.193549468f,
+    0.982287251f, -0.187381315f,
+    0.983445205f, -0.181205764f,
+    0.984564335f, -0.175023059f,
+    0.985644595f, -0.168833445f,
+    0.986685944f, -0.162637165f,
+    0.987688341f, -0.156434465f,
+    0.988651745f, -0.150225589f,
+    0.989576119f, -0.144010783f,
+    0.990461426f, -0.137790291f,
+    0.991307631f, -0.131564359f,
+    0.992114701f, -0.125333234f,
+    0.992882605f, -0.119097160f,
+    0.993611311f, -0.112856385f,
+    0.994300790f, -0.106611154f,
+    0.994951017f, -0.100361715f,
+    0.995561965f, -0.094108313f,
+    0.996133609f, -0.087851197f,
+    0.996665928f, -0.081590612f,
+    0.997158900f, -0.075326806f,
+    0.997612506f, -0.069060026f,
+    0.998026728f, -0.062790520f,
+    0.998401550f, -0.056518534f,
+    0.998736957f, -0.050244318f,
+    0.999032935f, -0.043968118f,
+    0.999289473f, -0.037690183f,
+    0.999506560f, -0.031410759f,
+    0.999684189f, -0.025130095f,
+    0.999822352f, -0.018848440f,
+    0.999921044f, -0.012566040f,
+    0.999980261f, -0.006283144f
+};
+#endif /* !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) */
+
+/**
+  @par
+  Example code for mixed-radix floating-point twiddle factors generation:
+  @par
+  <pre>for (i = 0; i< N; i++)
+  {
+ 	twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+ 	twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 1200, PI = 3.14159265358979
+  @par
+  Cos and Sin values are in interleaved fashion
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_1200)
+const float32_t twiddleCoef_mixed_1200[2400] = {
+    1.000000000f, 0.000000000f,
+    0.999986292f, 0.005235964f,
+    0.999945169f, 0.010471784f,
+    0.999876632f, 0.015707317f,
+    0.999780683f, 0.020942420f,
+    0.999657325f, 0.026176948f,
+    0.999506560f, 0.031410759f,
+    0.999328394f, 0.036643709f,
+    0.999122830f, 0.041875654f,
+    0.998889875f, 0.047106451f,
+    0.998629535f, 0.052335956f,
+    0.998341817f, 0.057564027f,
+    0.998026728f, 0.062790520f,
+    0.997684279f, 0.068015291f,
+    0.997314477f, 0.073238197f,
+    0.996917334f, 0.078459096f,
+    0.996492859f, 0.083677843f,
+    0.996041065f, 0.088894297f,
+    0.995561965f, 0.094108313f,
+    0.995055570f, 0.099319750f,
+    0.994521895f, 0.104528463f,
+    0.993960955f, 0.109734311f,
+    0.993372766f, 0.114937150f,
+    0.992757342f, 0.120136839f,
+    0.992114701f, 0.125333234f,
+    0.991444861f, 0.130526192f,
+    0.990747840f, 0.135715572f,
+    0.990023658f, 0.140901232f,
+    0.989272333f, 0.146083029f,
+    0.988493887f, 0.151260820f,
+    0.987688341f, 0.156434465f,
+    0.986855716f, 0.161603821f,
+    0.985996037f, 0.166768747f,
+    0.985109326f, 0.171929100f,
+    0.984195608f, 0.177084740f,
+    0.983254908f, 0.182235525f,
+    0.982287251f, 0.187381315f,
+    0.981292664f, 0.192521967f,
+    0.980271175f, 0.197657340f,
+    0.979222811f, 0.202787295f,
+    0.978147601f, 0.207911691f,
+    0.977045574f, 0.213030386f,
+    0.975916762f, 0.218143241f,
+    0.974761194f, 0.223250116f,
+    0.973578903f, 0.228350870f,
+    0.972369920f, 0.233445364f,
+    0.971134280f, 0.238533458f,
+    0.969872015f, 0.243615012f,
+    0.968583161f, 0.248689887f,
+    0.967267753f, 0.253757945f,
+    0.965925826f, 0.258819045f,
+    0.964557418f, 0.263873050f,
+    0.963162567f, 0.268919821f,
+    0.961741310f, 0.273959219f,
+    0.960293686f, 0.278991106f,
+    0.958819735f, 0.284015345f,
+    0.957319498f, 0.289031797f,
+    0.955793015f, 0.294040325f,
+    0.954240329f, 0.299040792f,
+    0.952661481f, 0.304033061f,
+    0.951056516f, 0.309016994f,
+    0.949425478f, 0.313992456f,
+    0.947768410f, 0.318959309f,
+    0.946085359f, 0.323917418f,
+    0.944376370f, 0.328866647f,
+    0.942641491f, 0.333806859f,
+    0.940880769f, 0.338737920f,
+    0.939094252f, 0.343659695f,
+    0.937281989f, 0.348572047f,
+    0.935444031f, 0.353474844f,
+    0.933580426f, 0.358367950f,
+    0.931691228f, 0.363251230f,
+    0.929776486f, 0.368124553f,
+    0.927836254f, 0.372987783f,
+    0.925870585f, 0.377840787f,
+    0.923879533f, 0.382683432f,
+    0.921863152f, 0.387515586f,
+    0.919821497f, 0.392337117f,
+    0.917754626f, 0.397147891f,
+    0.915662593f, 0.401947777f,
+    0.913545458f, 0.406736643f,
+    0.911403277f, 0.411514359f,
+    0.909236109f, 0.416280792f,
+    0.907044014f, 0.421035813f,
+    0.904827052f, 0.425779292f,
+    0.902585284f, 0.430511097f,
+    0.900318771f, 0.435231099f,
+    0.898027576f, 0.439939170f,
+    0.895711760f, 0.444635179f,
+    0.893371388f, 0.449318999f,
+    0.891006524f, 0.453990500f,
+    0.888617233f, 0.458649554f,
+    0.886203579f, 0.463296035f,
+    0.883765630f, 0.467929814f,
+    0.881303452f, 0.472550765f,
+    0.878817113f, 0.477158760f,
+    0.876306680f, 0.481753674f,
+    0.873772223f, 0.486335380f,
+    0.871213811f, 0.490903754f,
+    0.868631514f, 0.495458668f,
+    0.866025404f, 0.500000000f,
+    0.863395551f, 0.504527624f,
+    0.860742027f, 0.509041416f,
+    0.858064906f, 0.513541252f,
+    0.855364260f, 0.518027009f,
+    0.852640164f, 0.522498565f,
+    0.849892693f, 0.526955795f,
+    0.847121921f, 0.531398580f,
+    0.844327926f, 0.535826795f,
+    0.841510782f, 0.540240320f,
+    0.838670568f, 0.544639035f,
+    0.835807361f, 0.549022818f,
+    0.832921241f, 0.553391549f,
+    0.830012285f, 0.557745109f,
+    0.827080574f, 0.562083378f,
+    0.824126189f, 0.566406237f,
+    0.821149209f, 0.570713568f,
+    0.818149717f, 0.575005252f,
+    0.815127796f, 0.579281172f,
+    0.812083527f, 0.583541211f,
+    0.809016994f, 0.587785252f,
+    0.805928282f, 0.592013179f,
+    0.802817475f, 0.596224875f,
+    0.799684658f, 0.600420225f,
+    0.796529918f, 0.604599115f,
+    0.793353340f, 0.608761429f,
+    0.790155012f, 0.612907054f,
+    0.786935022f, 0.617035875f,
+    0.783693457f, 0.621147780f,
+    0.780430407f, 0.625242656f,
+    0.777145961f, 0.629320391f,
+    0.773840210f, 0.633380873f,
+    0.770513243f, 0.637423990f,
+    0.767165152f, 0.641449632f,
+    0.763796029f, 0.645457688f,
+    0.760405966f, 0.649448048f,
+    0.756995056f, 0.653420604f,
+    0.753563392f, 0.657375246f,
+    0.750111070f, 0.661311865f,
+    0.746638182f, 0.665230355f,
+    0.743144825f, 0.669130606f,
+    0.739631095f, 0.673012514f,
+    0.736097087f, 0.676875970f,
+    0.732542899f, 0.680720869f,
+    0.728968627f, 0.684547106f,
+    0.725374371f, 0.688354576f,
+    0.721760228f, 0.692143174f,
+    0.718126298f, 0.695912797f,
+    0.714472680f, 0.699663341f,
+    0.710799474f, 0.703394703f,
+    0.707106781f, 0.707106781f,
+    0.703394703f, 0.710799474f,
+    0.699663341f, 0.714472680f,
+    0.695912797f, 0.718126298f,
+    0.692143174f, 0.721760228f,
+    0.688354576f, 0.725374371f,
+    0.684547106f, 0.728968627f,
+    0.680720869f, 0.732542899f,
+    0.676875970f, 0.736097087f,
+    0.673012514f, 0.739631095f,
+    0.669130606f, 0.743144825f,
+    0.665230355f, 0.746638182f,
+    0.661311865f, 0.750111070f,
+    0.657375246f, 0.753563392f,
+    0.653420604f, 0.756995056f,
+    0.649448048f, 0.760405966f,
+    0.645457688f, 0.763796029f,
+    0.641449632f, 0.767165152f,
+    0.637423990f, 0.770513243f,
+    0.633380873f, 0.773840210f,
+    0.629320391f, 0.777145961f,
+    0.625242656f, 0.780430407f,
+    0.621147780f, 0.783693457f,
+    0.617035875f, 0.786935022f,
+    0.612907054f, 0.790155012f,
+    0.608761429f, 0.793353340f,
+    0.604599115f, 0.796529918f,
+    0.600420225f, 0.799684658f,
+    0.596224875f, 0.802817475f,
+    0.592013179f, 0.805928282f,
+    0.587785252f, 0.809016994f,
+    0.583541211f, 0.812083527f,
+    0.579281172f, 0.815127796f,
+    0.575005252f, 0.818149717f,
+    0.570713568f, 0.821149209f,
+    0.566406237f, 0.824126189f,
+    0.562083378f, 0.827080574f,
+    0.557745109f, 0.830012285f,
+    0.553391549f, 0.832921241f,
+    0.549022818f, 0.835807361f,
+    0.544639035f, 0.838670568f,
+    0.540240320f, 0.841510782f,
+    0.535826795f, 0.844327926f,
+    0.531398580f, 0.847121921f,
+    0.526955795f, 0.849892693f,
+    0.522498565f, 0.852640164f,
+    0.518027009f, 0.855364260f,
+    0.513541252f, 0.858064906f,
+    0.509041416f, 0.860742027f,
+    0.504527624f, 0.863395551f,
+    0.500000000f, 0.866025404f,
+    0.495458668f, 0.868631514f,
+    0.490903754f, 0.871213811f,
+    0.486335380f, 0.873772223f,
+    0.481753674f, 0.876306680f,
+    0.477158760f, 0.878817113f,
+    0.472550765f, 0.881303452f,
+    0.467929814f, 0.883765630f,
+    0.463296035f, 0.886203579f,
+    0.458649554f, 0.888617233f,
+    0.453990500f, 0.891006524f,
+    0.449318999f, 0.893371388f,
+    0.444635179f, 0.895711760f,
+    0.439939170f, 0.898027576f,
+    0.435231099f, 0.900318771f,
+    0.430511097f, 0.902585284f,
+    0.425779292f, 0.904827052f,
+    0.421035813f, 0.907044014f,
+    0.416280792f, 0.909236109f,
+    0.411514359f, 0.911403277f,
+    0.406736643f, 0.913545458f,
+    0.401947777f, 0.915662593f,
+    0.397147891f, 0.917754626f,
+    0.392337117f, 0.919821497f,
+    0.387515586f, 0.921863152f,
+    0.382683432f, 0.923879533f,
+    0.377840787f, 0.925870585f,
+    0.372987783f, 0.927836254f,
+    0.368124553f, 0.929776486f,
+    0.363251230f, 0.931691228f,
+    0.358367950f, 0.933580426f,
+    0.353474844f, 0.935444031f,
+    0.348572047f, 0.937281989f,
+    0.343659695f, 0.939094252f,
+    0.338737920f, 0.940880769f,
+    0.333806859f, 0.942641491f,
+    0.328866647f, 0.944376370f,
+    0.323917418f, 0.946085359f,
+    0.318959309f, 0.947768410f,
+    0.313992456f, 0.949425478f,
+    0.309016994f, 0.951056516f,
+    0.304033061f, 0.952661481f,
+    0.299040792f, 0.954240329f,
+    0.294040325f, 0.955793015f,
+    0.289031797f, 0.957319498f,
+    0.284015345f, 0.958819735f,
+    0.278991106f, 0.960293686f,
+    0.273959219f, 0.961741310f,
+    0.268919821f, 0.963162567f,
+    0.263873050f, 0.964557418f,
+    0.258819045f, 0.965925826f,
+    0.253757945f, 0.967267753f,
+    0.248689887f, 0.968583161f,
+    0.243615012f, 0.969872015f,
+    0.238533458f, 0.971134280f,
+    0.233445364f, 0.972369920f,
+    0.228350870f, 0.973578903f,
+    0.223250116f, 0.974761194f,
+    0.218143241f, 0.975916762f,
+    0.213030386f, 0.977045574f,
+    0.207911691f, 0.978147601f,
+    0.202787295f, 0.979222811f,
+    0.197657340f, 0.980271175f,
+    0.192521967f, 0.981292664f,
+    0.187381315f, 0.982287251f,
+    0.182235525f, 0.983254908f,
+    0.177084740f, 0.984195608f,
+    0.171929100f, 0.985109326f,
+    0.166768747f, 0.985996037f,
+    0.161603821f, 0.986855716f,
+    0.156434465f, 0.987688341f,
+    0.151260820f, 0.988493887f,
+    0.146083029f, 0.989272333f,
+    0.140901232f, 0.990023658f,
+    0.135715572f, 0.990747840f,
+    0.130526192f, 0.991444861f,
+    0.125333234f, 0.992114701f,
+    0.120136839f, 0.992757342f,
+    0.114937150f, 0.993372766f,
+    0.109734311f, 0.993960955f,
+    0.104528463f, 0.994521895f,
+    0.099319750f, 0.995055570f,
+    0.094108313f, 0.995561965f,
+    0.088894297f, 0.996041065f,
+    0.083677843f, 0.996492859f,
+    0.078459096f, 0.996917334f,
+    0.073238197f, 0.997314477f,
+    0.068015291f, 0.997684279f,
+    0.062790520f, 0.998026728f,
+    0.057564027f, 0.998341817f,
+    0.052335956f, 0.998629535f,
+    0.047106451f, 0.998889875f,
+    0.041875654f, 0.999122830f,
+    0.036643709f, 0.999328394f,
+    0.031410759f, 0.999506560f,
+    0.026176948f, 0.999657325f,
+    0.020942420f, 0.999780683f,
+    0.015707317f, 0.999876632f,
+    0.010471784f, 0.999945169f,
+    0.005235964f, 0.999986292f,
+    0.000000000f, 1.000000000f,
+    -0.005235964f, 0.999986292f,
+    -0.010471784f, 0.999945169f,
+    -0.015707317f, 0.999876632f,
+    -0.020942420f, 0.999780683f,
+    -0.026176948f, 0.999657325f,
+    -0.031410759f, 0.999506560f,
+    -0.036643709f, 0.999328394f,
+    -0.041875654f, 0.999122830f,
+    -0.047106451f, 0.998889875f,
+    -0.052335956f, 0.998629535f,
+    -0.057564027f, 0.998341817f,
+    -0.062790520f, 0.998026728f,
+    -0.068015291f, 0.997684279f,
+    -0.073238197f, 0.997314477f,
+    -0.078459096f, 0.996917334f,
+    -0.083677843f, 0.996492859f,
+    -0.088894297f, 0.996041065f,
+    -0.094108313f, 0.995561965f,
+    -0.099319750f, 0.995055570f,
+    -0.104528463f, 0.994521895f,
+    -0.109734311f, 0.993960955f,
+    -0.114937150f, 0.993372766f,
+    -0.120136839f, 0.992757342f,
+    -0.125333234f, 0.992114701f,
+    -0.130526192f, 0.991444861f,
+    -0.135715572f, 0.990747840f,
+    -0.140901232f, 0.990023658f,
+    -0.146083029f, 0.989272333f,
+    -0.151260820f, 0.988493887f,
+    -0.156434465f, 0.987688341f,
+    -0.161603821f, 0.986855716f,
+    -0.166768747f, 0.985996037f,
+    -0.171929100f, 0.985109326f,
+    -0.177084740f, 0.984195608f,
+    -0.182235525f, 0.983254908f,
+    -0.187381315f, 0.982287251f,
+    -0.192521967f, 0.981292664f,
+    -0.197657340f, 0.980271175f,
+    -0.202787295f, 0.979222811f,
+    -0.207911691f, 0.978147601f,
+    -0.213030386f, 0.977045574f,
+    -0.218143241f, 0.975916762f,
+    -0.223250116f, 0.974761194f,
+    -0.228350870f, 0.973578903f,
+    -0.233445364f, 0.972369920f,
+    -0.238533458f, 0.971134280f,
+    -0.243615012f, 0.969872015f,
+    -0.248689887f, 0.968583161f,
+    -0.253757945f, 0.967267753f,
+    -0.258819045f, 0.965925826f,
+    -0.263873050f, 0.964557418f,
+    -0.268919821f, 0.963162567f,
+    -0.273959219f, 0.961741310f,
+    -0.278991106f, 0.960293686f,
+    -0.284015345f, 0.958819735f,
+    -0.289031797f, 0.957319498f,
+    -0.294040325f, 0.955793015f,
+    -0.299040792f, 0.954240329f,
+    -0.304033061f, 0.952661481f,
+    -0.309016994f, 0.951056516f,
+    -0.313992456f, 0.949425478f,
+    -0.318959309f, 0.947768410f,
+    -0.323917418f, 0.946085359f,
+    -0.328866647f, 0.944376370f,
+    -0.333806859f, 0.942641491f,
+    -0.338737920f, 0.940880769f,
+    -0.343659695f, 0.939094252f,
+    -0.348572047f, 0.937281989f,
+    -0.353474844f, 0.935444031f,
+    -0.358367950f, 0.933580426f,
+    -0.363251230f, 0.931691228f,
+    -0.368124553f, 0.929776486f,
+    -0.372987783f, 0.927836254f,
+    -0.377840787f, 0.925870585f,
+    -0.382683432f, 0.923879533f,
+    -0.387515586f, 0.921863152f,
+    -0.392337117f, 0.919821497f,
+    -0.397147891f, 0.917754626f,
+    -0.401947777f, 0.915662593f,
+    -0.406736643f, 0.913545458f,
+    -0.411514359f, 0.911403277f,
+    -0.416280792f, 0.909236109f,
+    -0.421035813f, 0.907044014f,
+    -0.425779292f, 0.904827052f,
+    -0.430511097f, 0.902585284f,
+    -0.435231099f, 0.900318771f,
+    -0.439939170f, 0.898027576f,
+    -0.444635179f, 0.895711760f,
+    -0.449318999f, 0.893371388f,
+    -0.453990500f, 0.891006524f,
+    -0.458649554f, 0.888617233f,
+    -0.463296035f, 0.886203579f,
+    -0.467929814f, 0.883765630f,
+    -0.472550765f, 0.881303452f,
+    -0.477158760f, 0.878817113f,
+    -0.481753674f, 0.876306680f,
+    -0.486335380f, 0.873772223f,
+    -0.490903754f, 0.871213811f,
+    -0.495458668f, 0.868631514f,
+    -0.500000000f, 0.866025404f,
+    -0.504527624f, 0.863395551f,
+    -0.509041416f, 0.860742027f,
+    -0.513541252f, 0.858064906f,
+    -0.518027009f, 0.855364260f,
+    -0.522498565f, 0.852640164f,
+    -0.526955795f, 0.849892693f,
+    -0.531398580f, 0.847121921f,
+    -0.535826795f, 0.844327926f,
+    -0.540240320f, 0.841510782f,
+    -0.544639035f, 0.838670568f,
+    -0.549022818f, 0.835807361f,
+    -0.553391549f, 0.832921241f,
+    -0.557745109f, 0.830012285f,
+    -0.562083378f, 0.827080574f,
+    -0.566406237f, 0.824126189f,
+    -0.570713568f, 0.821149209f,
+    -0.575005252f, 0.818149717f,
+    -0.579281172f, 0.815127796f,
+    -0.583541211f, 0.812083527f,
+    -0.587785252f, 0.809016994f,
+    -0.592013179f, 0.805928282f,
+    -0.596224875f, 0.802817475f,
+    -0.600420225f, 0.799684658f,
+    -0.604599115f, 0.796529918f,
+    -0.608761429f, 0.793353340f,
+    -0.612907054f, 0.790155012f,
+    -0.617035875f, 0.786935022f,
+    -0.621147780f, 0.783693457f,
+    -0.625242656f, 0.780430407f,
+    -0.629320391f, 0.777145961f,
+    -0.633380873f, 0.773840210f,
+    -0.637423990f, 0.770513243f,
+    -0.641449632f, 0.767165152f,
+    -0.645457688f, 0.763796029f,
+    -0.649448048f, 0.760405966f,
+    -0.653420604f, 0.756995056f,
+    -0.657375246f, 0.753563392f,
+    -0.661311865f, 0.750111070f,
+    -0.665230355f, 0.746638182f,
+    -0.669130606f, 0.743144825f,
+    -0.673012514f, 0.739631095f,
+    -0.676875970f, 0.736097087f,
+    -0.680720869f, 0.732542899f,
+    -0.684547106f, 0.728968627f,
+    -0.688354576f, 0.725374371f,
+    -0.692143174f, 0.721760228f,
+    -0.695912797f, 0.718126298f,
+    -0.699663341f, 0.714472680f,
+    -0.703394703f, 0.710799474f,
+    -0.707106781f, 0.707106781f,
+    -0.710799474f, 0.703394703f,
+    -0.714472680f, 0.699663341f,
+    -0.718126298f, 0.695912797f,
+    -0.721760228f, 0.692143174f,
+    -0.725374371f, 0.688354576f,
+    -0.728968627f, 0.684547106f,
+    -0.732542899f, 0.680720869f,
+    -0.736097087f, 0.676875970f,
+    -0.739631095f, 0.673012514f,
+    -0.743144825f, 0.669130606f,
+    -0.746638182f, 0.665230355f,
+    -0.750111070f, 0.661311865f,
+    -0.753563392f, 0.657375246f,
+    -0.756995056f, 0.653420604f,
+    -0.760405966f, 0.649448048f,
+    -0.763796029f, 0.645457688f,
+    -0.767165152f, 0.641449632f,
+    -0.770513243f, 0.637423990f,
+    -0.773840210f, 0.633380873f,
+    -0.777145961f, 0.629320391f,
+    -0.780430407f, 0.625242656f,
+    -0.783693457f, 0.621147780f,
+    -0.786935022f, 0.617035875f,
+    -0.790155012f, 0.612907054f,
+    -0.793353340f, 0.608761429f,
+    -0.796529918f, 0.604599115f,
+    -0.799684658f, 0.600420225f,
+    -0.802817475f, 0.596224875f,
+    -0.805928282f, 0.592013179f,
+    -0.809016994f, 0.587785252f,
+    -0.812083527f, 0.583541211f,
+    -0.815127796f, 0.579281172f,
+    -0.818149717f, 0.575005252f,
+    -0.821149209f, 0.570713568f,
+    -0.824126189f, 0.566406237f,
+    -0.827080574f, 0.562083378f,
+    -0.830012285f, 0.557745109f,
+    -0.832921241f, 0.553391549f,
+    -0.835807361f, 0.549022818f,
+    -0.838670568f, 0.544639035f,
+    -0.841510782f, 0.540240320f,
+    -0.844327926f, 0.535826795f,
+    -0.847121921f, 0.531398580f,
+    -0.849892693f, 0.526955795f,
+    -0.852640164f, 0.522498565f,
+    -0.855364260f, 0.518027009f,
+    -0.858064906f, 0.513541252f,
+    -0.860742027f, 0.509041416f,
+    -0.863395551f, 0.504527624f,
+    -0.866025404f, 0.500000000f,
+    -0.868631514f, 0.495458668f,
+    -0.871213811f, 0.490903754f,
+    -0.873772223f, 0.486335380f,
+    -0.876306680f, 0.481753674f,
+    -0.878817113f, 0.477158760f,
+    -0.881303452f, 0.472550765f,
+    -0.883765630f, 0.467929814f,
+    -0.886203579f, 0.463296035f,
+    -0.888617233f, 0.458649554f,
+    -0.891006524f, 0.453990500f,
+    -0.893371388f, 0.449318999f,
+    -0.895711760f, 0.444635179f,
+    -0.898027576f, 0.439939170f,
+    -0.900318771f, 0.435231099f,
+    -0.902585284f, 0.430511097f,
+    -0.904827052f, 0.425779292f,
+    -0.907044014f, 0.421035813f,
+    -0.909236109f, 0.416280792f,
+    -0.911403277f, 0.411514359f,
+    -0.913545458f, 0.406736643f,
+    -0.915662593f, 0.401947777f,
+    -0.917754626f, 0.397147891f,
+    -0.919821497f, 0.392337117f,
+    -0.921863152f, 0.387515586f,
+    -0.923879533f, 0.382683432f,
+    -0.925870585f, 0.377840787f,
+    -0.927836254f, 0.372987783f,
+    -0.929776486f, 0.368124553f,
+    -0.931691228f, 0.363251230f,
+    -0.933580426f, 0.358367950f,
+    -0.935444031f, 0.353474844f,
+    -0.937281989f, 0.348572047f,
+    -0.939094252f, 0.343659695f,
+    -0.940880769f, 0.338737920f,
+    -0.942641491f, 0.333806859f,
+    -0.944376370f, 0.328866647f,
+    -0.946085359f, 0.323917418f,
+    -0.947768410f, 0.318959309f,
+    -0.949425478f, 0.313992456f,
+    -0.951056516f, 0.309016994f,
+    -0.952661481f, 0.304033061f,
+    -0.954240329f, 0.299040792f,
+    -0.955793015f, 0.294040325f,
+    -0.957319498f, 0.289031797f,
+    -0.958819735f, 0.284015345f,
+    -0.960293686f, 0.278991106f,
+    -0.961741310f, 0.273959219f,
+    -0.963162567f, 0.268919821f,
+    -0.964557418f, 0.263873050f,
+    -0.965925826f, 0.258819045f,
+    -0.967267753f, 0.253757945f,
+    -0.968583161f, 0.248689887f,
+    -0.969872015f, 0.243615012f,
+    -0.971134280f, 0.238533458f,
+    -0.972369920f, 0.233445364f,
+    -0.973578903f, 0.228350870f,
+    -0.974761194f, 0.223250116f,
+    -0.975916762f, 0.218143241f,
+    -0.977045574f, 0.213030386f,
+    -0.978147601f, 0.207911691f,
+    -0.979222811f, 0.202787295f,
+    -0.980271175f, 0.197657340f,
+    -0.981292664f, 0.192521967f,
+    -0.982287251f, 0.187381315f,
+    -0.983254908f, 0.182235525f,
+    -0.984195608f, 0.177084740f,
+    -0.985109326f, 0.171929100f,
+    -0.985996037f, 0.166768747f,
+    -0.986855716f, 0.161603821f,
+    -0.987688341f, 0.156434465f,
+    -0.988493887f, 0.151260820f,
+    -0.989272333f, 0.146083029f,
+    -0.990023658f, 0.140901232f,
+    -0.990747840f, 0.135715572f,
+    -0.991444861f, 0.130526192f,
+    -0.992114701f, 0.125333234f,
+    -0.992757342f, 0.120136839f,
+    -0.993372766f, 0.114937150f,
+    -0.993960955f, 0.109734311f,
+    -0.994521895f, 0.104528463f,
+    -0.995055570f, 0.099319750f,
+    -0.995561965f, 0.094108313f,
+    -0.996041065f, 0.088894297f,
+    -0.996492859f, 0.083677843f,
+    -0.996917334f, 0.078459096f,
+    -0.997314477f, 0.073238197f,
+    -0.997684279f, 0.068015291f,
+    -0.998026728f, 0.062790520f,
+    -0.998341817f, 0.057564027f,
+    -0.998629535f, 0.052335956f,
+    -0.998889875f, 0.047106451f,
+    -0.999122830f, 0.041875654f,
+    -0.999328394f, 0.036643709f,
+    -0.999506560f, 0.031410759f,
+    -0.999657325f, 0.026176948f,
+    -0.999780683f, 0.020942420f,
+    -0.999876632f, 0.015707317f,
+    -0.999945169f, 0.010471784f,
+    -0.999986292f, 0.005235964f,
+    -1.000000000f, 0.000000000f,
+    -0.999986292f, -0.005235964f,
+    -0.999945169f, -0.010471784f,
+    -0.999876632f, -0.015707317f,
+    -0.999780683f, -0.020942420f,
+    -0.999657325f, -0.026176948f,
+    -0.999506560f, -0.031410759f,
+    -0.999328394f, -0.036643709f,
+    -0.999122830f, -0.041875654f,
+    -0.998889875f, -0.047106451f,
+    -0.998629535f, -0.052335956f,
+    -0.998341817f, -0.057564027f,
+    -0.998026728f, -0.062790520f,
+    -0.997684279f, -0.068015291f,
+    -0.997314477f, -0.073238197f,
+    -0.996917334f, -0.078459096f,
+    -0.996492859f, -0.083677843f,
+    -0.996041065f, -0.088894297f,
+    -0.995561965f, -0.094108313f,
+    -0.995055570f, -0.099319750f,
+    -0.994521895f, -0.104528463f,
+    -0.993960955f, -0.109734311f,
+    -0.993372766f, -0.114937150f,
+    -0.992757342f, -0.120136839f,
+    -0.992114701f, -0.125333234f,
+    -0.991444861f, -0.130526192f,
+    -0.990747840f, -0.135715572f,
+    -0.990023658f, -0.140901232f,
+    -0.989272333f, -0.146083029f,
+    -0.988493887f, -0.151260820f,
+    -0.987688341f, -0.156434465f,
+    -0.986855716f, -0.161603821f,
+    -0.985996037f, -0.166768747f,
+    -0.985109326f, -0.171929100f,
+    -0.984195608f, -0.177084740f,
+    -0.983254908f, -0.182235525f,
+    -0.982287251f, -0.187381315f,
+    -0.981292664f, -0.192521967f,
+    -0.980271175f, -0.197657340f,
+    -0.979222811f, -0.202787295f,
+    -0.978147601f, -0.207911691f,
+    -0.977045574f, -0.213030386f,
+    -0.975916762f, -0.218143241f,
+    -0.974761194f, -0.223250116f,
+    -0.973578903f, -0.228350870f,
+    -0.972369920f, -0.233445364f,
+    -0.971134280f, -0.238533458f,
+    -0.969872015f, -0.243615012f,
+    -0.968583161f, -0.248689887f,
+    -0.967267753f, -0.253757945f,
+    -0.965925826f, -0.258819045f,
+    -0.964557418f, -0.263873050f,
+    -0.963162567f, -0.268919821f,
+    -0.961741310f, -0.273959219f,
+    -0.960293686f, -0.278991106f,
+    -0.958819735f, -0.284015345f,
+    -0.957319498f, -0.289031797f,
+    -0.955793015f, -0.294040325f,
+    -0.954240329f, -0.299040792f,
+    -0.952661481f, -0.304033061f,
+    -0.951056516f, -0.309016994f,
+    -0.949425478f, -0.313992456f,
+    -0.947768410f, -0.318959309f,
+    -0.946085359f, -0.323917418f,
+    -0.944376370f, -0.328866647f,
+    -0.942641491f, -0.333806859f,
+    -0.940880769f, -0.338737920f,
+    -0.939094252f, -0.343659695f,
+    -0.937281989f, -0.348572047f,
+    -0.935444031f, -0.353474844f,
+    -0.933580426f, -0.358367950f,
+    -0.931691228f, -0.363251230f,
+    -0.929776486f, -0.368124553f,
+    -0.927836254f, -0.372987783f,
+    -0.925870585f, -0.377840787f,
+    -0.923879533f, -0.382683432f,
+    -0.921863152f, -0.387515586f,
+    -0.919821497f, -0.392337117f,
+    -0.917754626f, -0.397147891f,
+    -0.915662593f, -0.401947777f,
+    -0.913545458f, -0.406736643f,
+    -0.911403277f, -0.411514359f,
+    -0.909236109f, -0.416280792f,
+    -0.907044014f, -0.421035813f,
+    -0.904827052f, -0.425779292f,
+    -0.902585284f, -0.430511097f,
+    -0.900318771f, -0.435231099f,
+    -0.898027576f, -0.439939170f,
+    -0.895711760f, -0.444635179f,
+    -0.893371388f, -0.449318999f,
+    -0.891006524f, -0.453990500f,
+    -0.888617233f, -0.458649554f,
+    -0.886203579f, -0.463296035f,
+    -0.883765630f, -0.467929814f,
+    -0.881303452f, -0.472550765f,
+    -0.878817113f, -0.477158760f,
+    -0.876306680f, -0.481753674f,
+    -0.873772223f, -0.486335380f,
+    -0.871213811f, -0.490903754f,
+    -0.868631514f, -0.495458668f,
+    -0.866025404f, -0.500000000f,
+    -0.863395551f, -0.504527624f,
+    -0.860742027f, -0.509041416f,
+    -0.858064906f, -0.513541252f,
+    -0.855364260f, -0.518027009f,
+    -0.852640164f, -0.522498565f,
+    -0.849892693f, -0.526955795f,
+    -0.847121921f, -0.531398580f,
+    -0.844327926f, -0.535826795f,
+    -0.841510782f, -0.540240320f,
+    -0.838670568f, -0.544639035f,
+    -0.835807361f, -0.549022818f,
+    -0.832921241f, -0.553391549f,
+    -0.830012285f, -0.557745109f,
+    -0.827080574f, -0.562083378f,
+    -0.824126189f, -0.566406237f,
+    -0.821149209f, -0.570713568f,
+    -0.818149717f, -0.575005252f,
+    -0.815127796f, -0.579281172f,
+    -0.812083527f, -0.583541211f,
+    -0.809016994f, -0.587785252f,
+    -0.805928282f, -0.592013179f,
+    -0.802817475f, -0.596224875f,
+    -0.799684658f, -0.600420225f,
+    -0.796529918f, -0.604599115f,
+    -0.793353340f, -0.608761429f,
+    -0.790155012f, -0.612907054f,
+    -0.786935022f, -0.617035875f,
+    -0.783693457f, -0.621147780f,
+    -0.780430407f, -0.625242656f,
+    -0.777145961f, -0.629320391f,
+    -0.773840210f, -0.633380873f,
+    -0.770513243f, -0.637423990f,
+    -0.767165152f, -0.641449632f,
+    -0.763796029f, -0.645457688f,
+    -0.760405966f, -0.649448048f,
+    -0.756995056f, -0.653420604f,
+    -0.753563392f, -0.657375246f,
+    -0.750111070f, -0.661311865f,
+    -0.746638182f, -0.665230355f,
+    -0.743144825f, -0.669130606f,
+    -0.739631095f, -0.673012514f,
+    -0.736097087f, -0.676875970f,
+    -0.732542899f, -0.680720869f,
+    -0.728968627f, -0.684547106f,
+    -0.725374371f, -0.688354576f,
+    -0.721760228f, -0.692143174f,
+    -0.718126298f, -0.695912797f,
+    -0.714472680f, -0.699663341f,
+    -0.710799474f, -0.703394703f,
+    -0.707106781f, -0.707106781f,
+    -0.703394703f, -0.710799474f,
+    -0.699663341f, -0.714472680f,
+    -0.695912797f, -0.718126298f,
+    -0.692143174f, -0.721760228f,
+    -0.688354576f, -0.725374371f,
+    -0.684547106f, -0.728968627f,
+    -0.680720869f, -0.732542899f,
+    -0.676875970f, -0.736097087f,
+    -0.673012514f, -0.739631095f,
+    -0.669130606f, -0.743144825f,
+    -0.665230355f, -0.746638182f,
+    -0.661311865f, -0.750111070f,
+    -0.657375246f, -0.753563392f,
+    -0.653420604f, -0.756995056f,
+    -0.649448048f, -0.760405966f,
+    -0.645457688f, -0.763796029f,
+    -0.641449632f, -0.767165152f,
+    -0.637423990f, -0.770513243f,
+    -0.633380873f, -0.773840210f,
+    -0.629320391f, -0.777145961f,
+    -0.625242656f, -0.780430407f,
+    -0.621147780f, -0.783693457f,
+    -0.617035875f, -0.786935022f,
+    -0.612907054f, -0.790155012f,
+    -0.608761429f, -0.793353340f,
+    -0.604599115f, -0.796529918f,
+    -0.600420225f, -0.799684658f,
+    -0.596224875f, -0.802817475f,
+    -0.592013179f, -0.805928282f,
+    -0.587785252f, -0.809016994f,
+    -0.583541211f, -0.812083527f,
+    -0.579281172f, -0.815127796f,
+    -0.575005252f, -0.818149717f,
+    -0.570713568f, -0.821149209f,
+    -0.566406237f, -0.824126189f,
+    -0.562083378f, -0.827080574f,
+    -0.557745109f, -0.830012285f,
+    -0.553391549f, -0.832921241f,
+    -0.549022818f, -0.835807361f,
+    -0.544639035f, -0.838670568f,
+    -0.540240320f, -0.841510782f,
+    -0.535826795f, -0.844327926f,
+    -0.531398580f, -0.847121921f,
+    -0.526955795f, -0.849892693f,
+    -0.522498565f, -0.852640164f,
+    -0.518027009f, -0.855364260f,
+    -0.513541252f, -0.858064906f,
+    -0.509041416f, -0.860742027f,
+    -0.504527624f, -0.863395551f,
+    -0.500000000f, -0.866025404f,
+    -0.495458668f, -0.868631514f,
+    -0.490903754f, -0.871213811f,
+    -0.486335380f, -0.873772223f,
+    -0.481753674f, -0.876306680f,
+    -0.477158760f, -0.878817113f,
+    -0.472550765f, -0.881303452f,
+    -0.467929814f, -0.883765630f,
+    -0.463296035f, -0.886203579f,
+    -0.458649554f, -0.888617233f,
+    -0.453990500f, -0.891006524f,
+    -0.449318999f, -0.893371388f,
+    -0.444635179f, -0.895711760f,
+    -0.439939170f, -0.898027576f,
+    -0.435231099f, -0.900318771f,
+    -0.430511097f, -0.902585284f,
+    -0.425779292f, -0.904827052f,
+    -0.421035813f, -0.907044014f,
+    -0.416280792f, -0.909236109f,
+    -0.411514359f, -0.911403277f,
+    -0.406736643f, -0.913545458f,
+    -0.401947777f, -0.915662593f,
+    -0.397147891f, -0.917754626f,
+    -0.392337117f, -0.919821497f,
+    -0.387515586f, -0.921863152f,
+    -0.382683432f, -0.923879533f,
+    -0.377840787f, -0.925870585f,
+    -0.372987783f, -0.927836254f,
+    -0.368124553f, -0.929776486f,
+    -0.363251230f, -0.931691228f,
+    -0.358367950f, -0.933580426f,
+    -0.353474844f, -0.935444031f,
+    -0.348572047f, -0.937281989f,
+    -0.343659695f, -0.939094252f,
+    -0.338737920f, -0.940880769f,
+    -0.333806859f, -0.942641491f,
+    -0.328866647f, -0.944376370f,
+    -0.323917418f, -0.946085359f,
+    -0.318959309f, -0.947768410f,
+    -0.313992456f, -0.949425478f,
+    -0.309016994f, -0.951056516f,
+    -0.304033061f, -0.952661481f,
+    -0.299040792f, -0.954240329f,
+    -0.294040325f, -0.955793015f,
+    -0.289031797f, -0.957319498f,
+    -0.284015345f, -0.958819735f,
+    -0.278991106f, -0.960293686f,
+    -0.273959219f, -0.961741310f,
+    -0.268919821f, -0.963162567f,
+    -0.263873050f, -0.964557418f,
+    -0.258819045f, -0.965925826f,
+    -0.253757945f, -0.967267753f,
+    -0.248689887f, -0.968583161f,
+    -0.243615012f, -0.969872015f,
+    -0.238533458f, -0.971134280f,
+    -0.233445364f, -0.972369920f,
+    -0.228350870f, -0.973578903f,
+    -0.223250116f, -0.974761194f,
+    -0.218143241f, -0.975916762f,
+    -0.213030386f, -0.977045574f,
+    -0.207911691f, -0.978147601f,
+    -0.202787295f, -0.979222811f,
+    -0.197657340f, -0.980271175f,
+    -0.192521967f, -0.981292664f,
+    -0.187381315f, -0.982287251f,
+    -0.182235525f, -0.983254908f,
+    -0.177084740f, -0.984195608f,
+    -0.171929100f, -0.985109326f,
+    -0.166768747f, -0.985996037f,
+    -0.161603821f, -0.986855716f,
+    -0.156434465f, -0.987688341f,
+    -0.151260820f, -0.988493887f,
+    -0.146083029f, -0.989272333f,
+    -0.140901232f, -0.990023658f,
+    -0.135715572f, -0.990747840f,
+    -0.130526192f, -0.991444861f,
+    -0.125333234f, -0.992114701f,
+    -0.120136839f, -0.992757342f,
+    -0.114937150f, -0.993372766f,
+    -0.109734311f, -0.993960955f,
+    -0.104528463f, -0.994521895f,
+    -0.099319750f, -0.995055570f,
+    -0.094108313f, -0.995561965f,
+    -0.088894297f, -0.996041065f,
+    -0.083677843f, -0.996492859f,
+    -0.078459096f, -0.996917334f,
+    -0.073238197f, -0.997314477f,
+    -0.068015291f, -0.997684279f,
+    -0.062790520f, -0.998026728f,
+    -0.057564027f, -0.998341817f,
+    -0.052335956f, -0.998629535f,
+    -0.047106451f, -0.998889875f,
+    -0.041875654f, -0.999122830f,
+    -0.036643709f, -0.999328394f,
+    -0.031410759f, -0.999506560f,
+    -0.026176948f, -0.999657325f,
+    -0.020942420f, -0.999780683f,
+    -0.015707317f, -0.999876632f,
+    -0.010471784f, -0.999945169f,
+    -0.005235964f, -0.999986292f,
+    0.000000000f, -1.000000000f,
+    0.005235964f, -0.999986292f,
+    0.010471784f, -0.999945169f,
+    0.015707317f, -0.999876632f,
+    0.020942420f, -0.999780683f,
+    0.026176948f, -0.999657325f,
+    0.031410759f, -0.999506560f,
+    0.036643709f, -0.999328394f,
+    0.041875654f, -0.999122830f,
+    0.047106451f, -0.998889875f,
+    0.052335956f, -0.998629535f,
+    0.057564027f, -0.998341817f,
+    0.062790520f, -0.998026728f,
+    0.068015291f, -0.997684279f,
+    0.073238197f, -0.997314477f,
+    0.078459096f, -0.996917334f,
+    0.083677843f, -0.996492859f,
+    0.088894297f, -0.996041065f,
+    0.094108313f, -0.995561965f,
+    0.099319750f, -0.995055570f,
+    0.104528463f, -0.994521895f,
+    0.109734311f, -0.993960955f,
+    0.114937150f, -0.993372766f,
+    0.120136839f, -0.992757342f,
+    0.125333234f, -0.992114701f,
+    0.130526192f, -0.991444861f,
+    0.135715572f, -0.990747840f,
+    0.140901232f, -0.990023658f,
+    0.146083029f, -0.989272333f,
+    0.151260820f, -0.988493887f,
+    0.156434465f, -0.987688341f,
+    0.161603821f, -0.986855716f,
+    0.166768747f, -0.985996037f,
+    0.171929100f, -0.985109326f,
+    0.177084740f, -0.984195608f,
+    0.182235525f, -0.983254908f,
+    0.187381315f, -0.982287251f,
+    0.192521967f, -0.981292664f,
+    0.197657340f, -0.980271175f,
+    0.202787295f, -0.979222811f,
+    0.207911691f, -0.978147601f,
+    0.213030386f, -0.977045574f,
+    0.218143241f, -0.975916762f,
+    0.223250116f, -0.974761194f,
+    0.228350870f, -0.973578903f,
+    0.233445364f, -0.972369920f,
+    0.238533458f, -0.971134280f,
+    0.243615012f, -0.969872015f,
+    0.248689887f, -0.968583161f,
+    0.253757945f, -0.967267753f,
+    0.258819045f, -0.965925826f,
+    0.263873050f, -0.964557418f,
+    0.268919821f, -0.963162567f,
+    0.273959219f, -0.961741310f,
+    0.278991106f, -0.960293686f,
+    0.284015345f, -0.958819735f,
+    0.289031797f, -0.957319498f,
+    0.294040325f, -0.955793015f,
+    0.299040792f, -0.954240329f,
+    0.304033061f, -0.952661481f,
+    0.309016994f, -0.951056516f,
+    0.313992456f, -0.949425478f,
+    0.318959309f, -0.947768410f,
+    0.323917418f, -0.946085359f,
+    0.328866647f, -0.944376370f,
+    0.333806859f, -0.942641491f,
+    0.338737920f, -0.940880769f,
+    0.343659695f, -0.939094252f,
+    0.348572047f, -0.937281989f,
+    0.353474844f, -0.935444031f,
+    0.358367950f, -0.933580426f,
+    0.363251230f, -0.931691228f,
+    0.368124553f, -0.929776486f,
+    0.372987783f, -0.927836254f,
+    0.377840787f, -0.925870585f,
+    0.382683432f, -0.923879533f,
+    0.387515586f, -0.921863152f,
+    0.392337117f, -0.919821497f,
+    0.397147891f, -0.917754626f,
+    0.401947777f, -0.915662593f,
+    0.406736643f, -0.913545458f,
+    0.411514359f, -0.911403277f,
+    0.416280792f, -0.909236109f,
+    0.421035813f, -0.907044014f,
+    0.425779292f, -0.904827052f,
+    0.430511097f, -0.902585284f,
+    0.435231099f, -0.900318771f,
+    0.439939170f, -0.898027576f,
+    0.444635179f, -0.895711760f,
+    0.449318999f, -0.893371388f,
+    0.453990500f, -0.891006524f,
+    0.458649554f, -0.888617233f,
+    0.463296035f, -0.886203579f,
+    0.467929814f, -0.883765630f,
+    0.472550765f, -0.881303452f,
+    0.477158760f, -0.878817113f,
+    0.481753674f, -0.876306680f,
+    0.486335380f, -0.873772223f,
+    0.490903754f, -0.871213811f,
+    0.495458668f, -0.868631514f,
+    0.500000000f, -0.866025404f,
+    0.504527624f, -0.863395551f,
+    0.509041416f, -0.860742027f,
+    0.513541252f, -0.858064906f,
+    0.518027009f, -0.855364260f,
+    0.522498565f, -0.852640164f,
+    0.526955795f, -0.849892693f,
+    0.531398580f, -0.847121921f,
+    0.535826795f, -0.844327926f,
+    0.540240320f, -0.841510782f,
+    0.544639035f, -0.838670568f,
+    0.549022818f, -0.835807361f,
+    0.553391549f, -0.832921241f,
+    0.557745109f, -0.830012285f,
+    0.562083378f, -0.827080574f,
+    0.566406237f, -0.824126189f,
+    0.570713568f, -0.821149209f,
+    0.575005252f, -0.818149717f,
+    0.579281172f, -0.815127796f,
+    0.583541211f, -0.812083527f,
+    0.587785252f, -0.809016994f,
+    0.592013179f, -0.805928282f,
+    0.596224875f, -0.802817475f,
+    0.600420225f, -0.799684658f,
+    0.604599115f, -0.796529918f,
+    0.608761429f, -0.793353340f,
+    0.612907054f, -0.790155012f,
+    0.617035875f, -0.786935022f,
+    0.621147780f, -0.783693457f,
+    0.625242656f, -0.780430407f,
+    0.629320391f, -0.777145961f,
+    0.633380873f, -0.773840210f,
+    0.637423990f, -0.770513243f,
+    0.641449632f, -0.767165152f,
+    0.645457688f, -0.763796029f,
+    0.649448048f, -0.760405966f,
+    0.653420604f, -0.756995056f,
+    0.657375246f, -0.753563392f,
+    0.661311865f, -0.750111070f,
+    0.665230355f, -0.746638182f,
+    0.669130606f, -0.743144825f,
+    0.673012514f, -0.739631095f,
+    0.676875970f, -0.736097087f,
+    0.680720869f, -0.732542899f,
+    0.684547106f, -0.728968627f,
+    0.688354576f, -0.725374371f,
+    0.692143174f, -0.721760228f,
+    0.695912797f, -0.718126298f,
+    0.699663341f, -0.714472680f,
+    0.703394703f, -0.710799474f,
+    0.707106781f, -0.707106781f,
+    0.710799474f, -0.703394703f,
+    0.714472680f, -0.699663341f,
+    0.718126298f, -0.695912797f,
+    0.721760228f, -0.692143174f,
+    0.725374371f, -0.688354576f,
+    0.728968627f, -0.684547106f,
+    0.732542899f, -0.680720869f,
+    0.736097087f, -0.676875970f,
+    0.739631095f, -0.673012514f,
+    0.743144825f, -0.669130606f,
+    0.746638182f, -0.665230355f,
+    0.750111070f, -0.661311865f,
+    0.753563392f, -0.657375246f,
+    0.756995056f, -0.653420604f,
+    0.760405966f, -0.649448048f,
+    0.763796029f, -0.645457688f,
+    0.767165152f, -0.641449632f,
+    0.770513243f, -0.637423990f,
+    0.773840210f, -0.633380873f,
+    0.777145961f, -0.629320391f,
+    0.780430407f, -0.625242656f,
+    0.783693457f, -0.621147780f,
+    0.786935022f, -0.617035875f,
+    0.790155012f, -0.612907054f,
+    0.793353340f, -0.608761429f,
+    0.796529918f, -0.604599115f,
+    0.799684658f, -0.600420225f,
+    0.802817475f, -0.596224875f,
+    0.805928282f, -0.592013179f,
+    0.809016994f, -0.587785252f,
+    0.812083527f, -0.583541211f,
+    0.815127796f, -0.579281172f,
+    0.818149717f, -0.575005252f,
+    0.821149209f, -0.570713568f,
+    0.824126189f, -0.566406237f,
+    0.827080574f, -0.562083378f,
+    0.830012285f, -0.557745109f,
+    0.832921241f, -0.553391549f,
+    0.835807361f, -0.549022818f,
+    0.838670568f, -0.544639035f,
+    0.841510782f, -0.540240320f,
+    0.844327926f, -0.535826795f,
+    0.847121921f, -0.531398580f,
+    0.849892693f, -0.526955795f,
+    0.852640164f, -0.522498565f,
+    0.855364260f, -0.518027009f,
+    0.858064906f, -0.513541252f,
+    0.860742027f, -0.509041416f,
+    0.863395551f, -0.504527624f,
+    0.866025404f, -0.500000000f,
+    0.868631514f, -0.495458668f,
+    0.871213811f, -0.490903754f,
+    0.873772223f, -0.486335380f,
+    0.876306680f, -0.481753674f,
+    0.878817113f, -0.477158760f,
+    0.881303452f, -0.472550765f,
+    0.883765630f, -0.467929814f,
+    0.886203579f, -0.463296035f,
+    0.888617233f, -0.458649554f,
+    0.891006524f, -0.453990500f,
+    0.893371388f, -0.449318999f,
+    0.895711760f, -0.444635179f,
+    0.898027576f, -0.439939170f,
+    0.900318771f, -0.435231099f,
+    0.902585284f, -0.430511097f,
+    0.904827052f, -0.425779292f,
+    0.907044014f, -0.421035813f,
+    0.909236109f, -0.416280792f,
+    0.911403277f, -0.411514359f,
+    0.913545458f, -0.406736643f,
+    0.915662593f, -0.401947777f,
+    0.917754626f, -0.397147891f,
+    0.919821497f, -0.392337117f,
+    0.921863152f, -0.387515586f,
+    0.923879533f, -0.382683432f,
+    0.925870585f, -0.377840787f,
+    0.927836254f, -0.372987783f,
+    0.929776486f, -0.368124553f,
+    0.931691228f, -0.363251230f,
+    0.933580426f, -0.358367950f,
+    0.935444031f, -0.353474844f,
+    0.937281989f, -0.348572047f,
+    0.939094252f, -0.343659695f,
+    0.940880769f, -0.338737920f,
+    0.942641491f, -0.333806859f,
+    0.944376370f, -0.328866647f,
+    0.946085359f, -0.323917418f,
+    0.947768410f, -0.318959309f,
+    0.949425478f, -0.313992456f,
+    0.951056516f, -0.309016994f,
+    0.952661481f, -0.304033061f,
+    0.954240329f, -0.299040792f,
+    0.955793015f, -0.294040325f,
+    0.957319498f, -0.289031797f,
+    0.958819735f, -0.284015345f,
+    0.960293686f, -0.278991106f,
+    0.961741310f, -0.273959219f,
+    0.963162567f, -0.268919821f,
+    0.964557418f, -0.263873050f,
+    0.965925826f, -0.258819045f,
+    0.967267753f, -0.253757945f,
+    0.968583161f, -0.248689887f,
+    0.969872015f, -0.243615012f,
+    0.971134280f, -0.238533458f,
+    0.972369920f, -0.233445364f,
+    0.973578903f, -0.228350870f,
+    0.974761194f, -0.223250116f,
+    0.975916762f, -0.218143241f,
+    0.977045574f, -0.213030386f,
+    0.978147601f, -0.207911691f,
+    0.979222811f, -0.202787295f,
+    0.980271175f, -0.197657340f,
+    0.981292664f, -0.192521967f,
+    0.982287251f, -0.187381315f,
+    0.983254908f, -0.182235525f,
+    0.984195608f, -0.177084740f,
+    0.985109326f, -0.171929100f,
+    0.985996037f, -0.166768747f,
+    0.986855716f, -0.161603821f,
+    0.987688341f, -0.156434465f,
+    0.988493887f, -0.151260820f,
+    0.989272333f, -0.146083029f,
+    0.990023658f, -0.140901232f,
+    0.990747840f, -0.135715572f,
+    0.991444861f, -0.130526192f,
+    0.992114701f, -0.125333234f,
+    0.992757342f, -0.120136839f,
+    0.993372766f, -0.114937150f,
+    0.993960955f, -0.109734311f,
+    0.994521895f, -0.104528463f,
+    0.995055570f, -0.099319750f,
+    0.995561965f, -0.094108313f,
+    0.996041065f, -0.088894297f,
+    0.996492859f, -0.083677843f,
+    0.996917334f, -0.078459096f,
+    0.997314477f, -0.073238197f,
+    0.997684279f, -0.068015291f,
+    0.998026728f, -0.062790520f,
+    0.998341817f, -0.057564027f,
+    0.998629535f, -0.052335956f,
+    0.998889875f, -0.047106451f,
+    0.999122830f, -0.041875654f,
+    0.999328394f, -0.036643709f,
+    0.999506560f, -0.031410759f,
+    0.999657325f, -0.026176948f,
+    0.999780683f, -0.020942420f,
+    0.999876632f, -0.015707317f,
+    0.999945169f, -0.010471784f,
+    0.999986292f, -0.005235964f
+};
+#endif /* !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) */
+
+/**
+  @par
+  Example code for mixed-radix floating-point twiddle factors generation:
+  @par
+  <pre>for (i = 0; i< N; i++)
+  {
+ 	twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+ 	twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 1500, PI = 3.14159265358979
+  @par
+  Cos and Sin values are in interleaved fashion
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_1500)
+const float32_t twiddleCoef_mixed_1500[3000] = {
+    1.000000000f, 0.000000000f,
+    0.999991227f, 0.004188778f,
+    0.999964908f, 0.008377482f,
+    0.999921044f, 0.012566040f,
+    0.999859636f, 0.016754377f,
+    0.999780683f, 0.020942420f,
+    0.999684189f, 0.025130095f,
+    0.999570155f, 0.029317330f,
+    0.999438582f, 0.033504050f,
+    0.999289473f, 0.037690183f,
+    0.999122830f, 0.041875654f,
+    0.998938657f, 0.046060390f,
+    0.998736957f, 0.050244318f,
+    0.998517732f, 0.054427365f,
+    0.998280988f, 0.058609456f,
+    0.998026728f, 0.062790520f,
+    0.997754957f, 0.066970481f,
+    0.997465679f, 0.071149267f,
+    0.997158900f, 0.075326806f,
+    0.996834625f, 0.079503022f,
+    0.996492859f, 0.083677843f,
+    0.996133609f, 0.087851197f,
+    0.995756881f, 0.092023008f,
+    0.995362681f, 0.096193205f,
+    0.994951017f, 0.100361715f,
+    0.994521895f, 0.104528463f,
+    0.994075324f, 0.108693378f,
+    0.993611311f, 0.112856385f,
+    0.993129863f, 0.117017412f,
+    0.992630991f, 0.121176386f,
+    0.992114701f, 0.125333234f,
+    0.991581004f, 0.129487882f,
+    0.991029909f, 0.133640259f,
+    0.990461426f, 0.137790291f,
+    0.989875563f, 0.141937905f,
+    0.989272333f, 0.146083029f,
+    0.988651745f, 0.150225589f,
+    0.988013810f, 0.154365514f,
+    0.987358539f, 0.158502730f,
+    0.986685944f, 0.162637165f,
+    0.985996037f, 0.166768747f,
+    0.985288830f, 0.170897402f,
+    0.984564335f, 0.175023059f,
+    0.983822564f, 0.179145645f,
+    0.983063532f, 0.183265088f,
+    0.982287251f, 0.187381315f,
+    0.981493734f, 0.191494254f,
+    0.980682997f, 0.195603833f,
+    0.979855052f, 0.199709981f,
+    0.979009915f, 0.203812624f,
+    0.978147601f, 0.207911691f,
+    0.977268124f, 0.212007110f,
+    0.976371499f, 0.216098809f,
+    0.975457744f, 0.220186717f,
+    0.974526873f, 0.224270761f,
+    0.973578903f, 0.228350870f,
+    0.972613851f, 0.232426973f,
+    0.971631733f, 0.236498997f,
+    0.970632567f, 0.240566872f,
+    0.969616370f, 0.244630526f,
+    0.968583161f, 0.248689887f,
+    0.967532957f, 0.252744885f,
+    0.966465777f, 0.256795449f,
+    0.965381639f, 0.260841506f,
+    0.964280562f, 0.264882987f,
+    0.963162567f, 0.268919821f,
+    0.962027672f, 0.272951936f,
+    0.960875897f, 0.276979261f,
+    0.959707262f, 0.281001727f,
+    0.958521789f, 0.285019262f,
+    0.957319498f, 0.289031797f,
+    0.956100409f, 0.293039260f,
+    0.954864545f, 0.297041582f,
+    0.953611927f, 0.301038691f,
+    0.952342576f, 0.305030519f,
+    0.951056516f, 0.309016994f,
+    0.949753769f, 0.312998048f,
+    0.948434358f, 0.316973610f,
+    0.947098305f, 0.320943610f,
+    0.945745635f, 0.324907979f,
+    0.944376370f, 0.328866647f,
+    0.942990536f, 0.332819545f,
+    0.941588156f, 0.336766603f,
+    0.940169255f, 0.340707752f,
+    0.938733858f, 0.344642923f,
+    0.937281989f, 0.348572047f,
+    0.935813676f, 0.352495055f,
+    0.934328942f, 0.356411879f,
+    0.932827815f, 0.360322448f,
+    0.931310321f, 0.364226696f,
+    0.929776486f, 0.368124553f,
+    0.928226337f, 0.372015950f,
+    0.926659901f, 0.375900821f,
+    0.925077207f, 0.379779096f,
+    0.923478281f, 0.383650707f,
+    0.921863152f, 0.387515586f,
+    0.920231847f, 0.391373667f,
+    0.918584397f, 0.395224880f,
+    0.916920829f, 0.399069159f,
+    0.915241173f, 0.402906436f,
+    0.913545458f, 0.406736643f,
+    0.911833714f, 0.410559714f,
+    0.910105971f, 0.414375581f,
+    0.908362259f, 0.418184178f,
+    0.906602609f, 0.421985437f,
+    0.904827052f, 0.425779292f,
+    0.903035620f, 0.429565676f,
+    0.901228342f, 0.433344523f,
+    0.899405252f, 0.437115767f,
+    0.897566380f, 0.440879341f,
+    0.895711760f, 0.444635179f,
+    0.893841424f, 0.448383216f,
+    0.891955405f, 0.452123386f,
+    0.890053735f, 0.455855622f,
+    0.888136449f, 0.459579861f,
+    0.886203579f, 0.463296035f,
+    0.884255160f, 0.467004081f,
+    0.882291226f, 0.470703932f,
+    0.880311812f, 0.474395525f,
+    0.878316951f, 0.478078794f,
+    0.876306680f, 0.481753674f,
+    0.874281033f, 0.485420102f,
+    0.872240046f, 0.489078012f,
+    0.870183755f, 0.492727342f,
+    0.868112195f, 0.496368025f,
+    0.866025404f, 0.500000000f,
+    0.863923417f, 0.503623202f,
+    0.861806272f, 0.507237567f,
+    0.859674006f, 0.510843032f,
+    0.857526656f, 0.514439534f,
+    0.855364260f, 0.518027009f,
+    0.853186856f, 0.521605396f,
+    0.850994482f, 0.525174630f,
+    0.848787176f, 0.528734650f,
+    0.846564978f, 0.532285392f,
+    0.844327926f, 0.535826795f,
+    0.842076059f, 0.539358796f,
+    0.839809417f, 0.542881334f,
+    0.837528040f, 0.546394347f,
+    0.835231968f, 0.549897772f,
+    0.832921241f, 0.553391549f,
+    0.830595899f, 0.556875616f,
+    0.828255984f, 0.560349913f,
+    0.825901536f, 0.563814377f,
+    0.823532598f, 0.567268949f,
+    0.821149209f, 0.570713568f,
+    0.818751413f, 0.574148173f,
+    0.816339251f, 0.577572703f,
+    0.813912765f, 0.580987100f,
+    0.811471999f, 0.584391303f,
+    0.809016994f, 0.587785252f,
+    0.806547795f, 0.591168888f,
+    0.804064444f, 0.594542152f,
+    0.801566985f, 0.597904983f,
+    0.799055462f, 0.601257324f,
+    0.796529918f, 0.604599115f,
+    0.793990399f, 0.607930298f,
+    0.791436948f, 0.611250814f,
+    0.788869611f, 0.614560605f,
+    0.786288432f, 0.617859613f,
+    0.783693457f, 0.621147780f,
+    0.781084732f, 0.624425049f,
+    0.778462302f, 0.627691361f,
+    0.775826212f, 0.630946660f,
+    0.773176511f, 0.634190889f,
+    0.770513243f, 0.637423990f,
+    0.767836456f, 0.640645907f,
+    0.765146196f, 0.643856583f,
+    0.762442511f, 0.647055962f,
+    0.759725448f, 0.650243987f,
+    0.756995056f, 0.653420604f,
+    0.754251381f, 0.656585756f,
+    0.751494472f, 0.659739387f,
+    0.748724377f, 0.662881443f,
+    0.745941145f, 0.666011867f,
+    0.743144825f, 0.669130606f,
+    0.740335466f, 0.672237605f,
+    0.737513117f, 0.675332808f,
+    0.734677828f, 0.678416162f,
+    0.731829648f, 0.681487613f,
+    0.728968627f, 0.684547106f,
+    0.726094816f, 0.687594588f,
+    0.723208265f, 0.690630006f,
+    0.720309025f, 0.693653306f,
+    0.717397146f, 0.696664435f,
+    0.714472680f, 0.699663341f,
+    0.711535677f, 0.702649970f,
+    0.708586190f, 0.705624270f,
+    0.705624270f, 0.708586190f,
+    0.702649970f, 0.711535677f,
+    0.699663341f, 0.714472680f,
+    0.696664435f, 0.717397146f,
+    0.693653306f, 0.720309025f,
+    0.690630006f, 0.723208265f,
+    0.687594588f, 0.726094816f,
+    0.684547106f, 0.728968627f,
+    0.681487613f, 0.731829648f,
+    0.678416162f, 0.734677828f,
+    0.675332808f, 0.737513117f,
+    0.672237605f, 0.740335466f,
+    0.669130606f, 0.743144825f,
+    0.666011867f, 0.745941145f,
+    0.662881443f, 0.748724377f,
+    0.659739387f, 0.751494472f,
+    0.656585756f, 0.754251381f,
+    0.653420604f, 0.756995056f,
+    0.650243987f, 0.759725448f,
+    0.647055962f, 0.762442511f,
+    0.643856583f, 0.765146196f,
+    0.640645907f, 0.767836456f,
+    0.637423990f, 0.770513243f,
+    0.634190889f, 0.773176511f,
+    0.630946660f, 0.775826212f,
+    0.627691361f, 0.778462302f,
+    0.624425049f, 0.781084732f,
+    0.621147780f, 0.783693457f,
+    0.617859613f, 0.786288432f,
+    0.614560605f, 0.788869611f,
+    0.611250814f, 0.791436948f,
+    0.607930298f, 0.793990399f,
+    0.604599115f, 0.796529918f,
+    0.601257324f, 0.799055462f,
+    0.597904983f, 0.801566985f,
+    0.594542152f, 0.804064444f,
+    0.591168888f, 0.806547795f,
+    0.587785252f, 0.809016994f,
+    0.584391303f, 0.811471999f,
+    0.580987100f, 0.813912765f,
+    0.577572703f, 0.816339251f,
+    0.574148173f, 0.818751413f,
+    0.570713568f, 0.821149209f,
+    0.567268949f, 0.823532598f,
+    0.563814377f, 0.825901536f,
+    0.560349913f, 0.828255984f,
+    0.556875616f, 0.830595899f,
+    0.553391549f, 0.832921241f,
+    0.549897772f, 0.835231968f,
+    0.546394347f, 0.837528040f,
+    0.542881334f, 0.839809417f,
+    0.539358796f, 0.842076059f,
+    0.535826795f, 0.844327926f,
+    0.532285392f, 0.846564978f,
+    0.528734650f, 0.848787176f,
+    0.525174630f, 0.850994482f,
+    0.521605396f, 0.853186856f,
+    0.518027009f, 0.855364260f,
+    0.514439534f, 0.857526656f,
+    0.510843032f, 0.859674006f,
+    0.507237567f, 0.861806272f,
+    0.503623202f, 0.863923417f,
+    0.500000000f, 0.866025404f,
+    0.496368025f, 0.868112195f,
+    0.492727342f, 0.870183755f,
+    0.489078012f, 0.872240046f,
+    0.485420102f, 0.874281033f,
+    0.481753674f, 0.876306680f,
+    0.478078794f, 0.878316951f,
+    0.474395525f, 0.880311812f,
+    0.470703932f, 0.882291226f,
+    0.467004081f, 0.884255160f,
+    0.463296035f, 0.886203579f,
+    0.459579861f, 0.888136449f,
+    0.455855622f, 0.890053735f,
+    0.452123386f, 0.891955405f,
+    0.448383216f, 0.893841424f,
+    0.444635179f, 0.895711760f,
+    0.440879341f, 0.897566380f,
+    0.437115767f, 0.899405252f,
+    0.433344523f, 0.901228342f,
+    0.429565676f, 0.903035620f,
+    0.425779292f, 0.904827052f,
+    0.421985437f, 0.906602609f,
+    0.418184178f, 0.908362259f,
+    0.414375581f, 0.910105971f,
+    0.410559714f, 0.911833714f,
+    0.406736643f, 0.913545458f,
+    0.402906436f, 0.915241173f,
+    0.399069159f, 0.916920829f,
+    0.395224880f, 0.918584397f,
+    0.391373667f, 0.920231847f,
+    0.387515586f, 0.921863152f,
+    0.383650707f, 0.923478281f,
+    0.379779096f, 0.925077207f,
+    0.375900821f, 0.926659901f,
+    0.372015950f, 0.928226337f,
+    0.368124553f, 0.929776486f,
+    0.364226696f, 0.931310321f,
+    0.360322448f, 0.932827815f,
+    0.356411879f, 0.934328942f,
+    0.352495055f, 0.935813676f,
+    0.348572047f, 0.937281989f,
+    0.344642923f, 0.938733858f,
+    0.340707752f, 0.940169255f,
+    0.336766603f, 0.941588156f,
+    0.332819545f, 0.942990536f,
+    0.328866647f, 0.944376370f,
+    0.324907979f, 0.945745635f,
+    0.320943610f, 0.947098305f,
+    0.316973610f, 0.948434358f,
+    0.312998048f, 0.949753769f,
+    0.309016994f, 0.951056516f,
+    0.305030519f, 0.952342576f,
+    0.301038691f, 0.953611927f,
+    0.297041582f, 0.954864545f,
+    0.293039260f, 0.956100409f,
+    0.289031797f, 0.957319498f,
+    0.285019262f, 0.958521789f,
+    0.281001727f, 0.959707262f,
+    0.276979261f, 0.960875897f,
+    0.272951936f, 0.962027672f,
+    0.268919821f, 0.963162567f,
+    0.264882987f, 0.964280562f,
+    0.260841506f, 0.965381639f,
+    0.256795449f, 0.966465777f,
+    0.252744885f, 0.967532957f,
+    0.248689887f, 0.968583161f,
+    0.244630526f, 0.969616370f,
+    0.240566872f, 0.970632567f,
+    0.236498997f, 0.971631733f,
+    0.232426973f, 0.972613851f,
+    0.228350870f, 0.973578903f,
+    0.224270761f, 0.974526873f,
+    0.220186717f, 0.975457744f,
+    0.216098809f, 0.976371499f,
+    0.212007110f, 0.977268124f,
+    0.207911691f, 0.978147601f,
+    0.203812624f, 0.979009915f,
+    0.199709981f, 0.979855052f,
+    0.195603833f, 0.980682997f,
+    0.191494254f, 0.981493734f,
+    0.187381315f, 0.982287251f,
+    0.183265088f, 0.983063532f,
+    0.179145645f, 0.983822564f,
+    0.175023059f, 0.984564335f,
+    0.170897402f, 0.985288830f,
+    0.166768747f, 0.985996037f,
+    0.162637165f, 0.986685944f,
+    0.158502730f, 0.987358539f,
+    0.154365514f, 0.988013810f,
+    0.150225589f, 0.988651745f,
+    0.146083029f, 0.989272333f,
+    0.141937905f, 0.989875563f,
+    0.137790291f, 0.990461426f,
+    0.133640259f, 0.991029909f,
+    0.129487882f, 0.991581004f,
+    0.125333234f, 0.992114701f,
+    0.121176386f, 0.992630991f,
+    0.117017412f, 0.993129863f,
+    0.112856385f, 0.993611311f,
+    0.108693378f, 0.994075324f,
+    0.104528463f, 0.994521895f,
+    0.100361715f, 0.994951017f,
+    0.096193205f, 0.995362681f,
+    0.092023008f, 0.995756881f,
+    0.087851197f, 0.996133609f,
+    0.083677843f, 0.996492859f,
+    0.079503022f, 0.996834625f,
+    0.075326806f, 0.997158900f,
+    0.071149267f, 0.997465679f,
+    0.066970481f, 0.997754957f,
+    0.062790520f, 0.998026728f,
+    0.058609456f, 0.998280988f,
+    0.054427365f, 0.998517732f,
+    0.050244318f, 0.998736957f,
+    0.046060390f, 0.998938657f,
+    0.041875654f, 0.999122830f,
+    0.037690183f, 0.999289473f,
+    0.033504050f, 0.999438582f,
+    0.029317330f, 0.999570155f,
+    0.025130095f, 0.999684189f,
+    0.020942420f, 0.999780683f,
+    0.016754377f, 0.999859636f,
+    0.012566040f, 0.999921044f,
+    0.008377482f, 0.999964908f,
+    0.004188778f, 0.999991227f,
+    0.000000000f, 1.000000000f,
+    -0.004188778f, 0.999991227f,
+    -0.008377482f, 0.999964908f,
+    -0.012566040f, 0.999921044f,
+    -0.016754377f, 0.999859636f,
+    -0.020942420f, 0.999780683f,
+    -0.025130095f, 0.999684189f,
+    -0.029317330f, 0.999570155f,
+    -0.033504050f, 0.999438582f,
+    -0.037690183f, 0.999289473f,
+    -0.041875654f, 0.999122830f,
+    -0.046060390f, 0.998938657f,
+    -0.050244318f, 0.998736957f,
+    -0.054427365f, 0.998517732f,
+    -0.058609456f, 0.998280988f,
+    -0.062790520f, 0.998026728f,
+    -0.066970481f, 0.997754957f,
+    -0.071149267f, 0.997465679f,
+    -0.075326806f, 0.997158900f,
+    -0.079503022f, 0.996834625f,
+    -0.083677843f, 0.996492859f,
+    -0.087851197f, 0.996133609f,
+    -0.092023008f, 0.995756881f,
+    -0.096193205f, 0.995362681f,
+    -0.100361715f, 0.994951017f,
+    -0.104528463f, 0.994521895f,
+    -0.108693378f, 0.994075324f,
+    -0.112856385f, 0.993611311f,
+    -0.117017412f, 0.993129863f,
+    -0.121176386f, 0.992630991f,
+    -0.125333234f, 0.992114701f,
+    -0.129487882f, 0.991581004f,
+    -0.133640259f, 0.991029909f,
+    -0.137790291f, 0.990461426f,
+    -0.141937905f, 0.989875563f,
+    -0.146083029f, 0.989272333f,
+    -0.150225589f, 0.988651745f,
+    -0.154365514f, 0.988013810f,
+    -0.158502730f, 0.987358539f,
+    -0.162637165f, 0.986685944f,
+    -0.166768747f, 0.985996037f,
+    -0.170897402f, 0.985288830f,
+    -0.175023059f, 0.984564335f,
+    -0.179145645f, 0.983822564f,
+    -0.183265088f, 0.983063532f,
+    -0.187381315f, 0.982287251f,
+    -0.191494254f, 0.981493734f,
+    -0.195603833f, 0.980682997f,
+    -0.199709981f, 0.979855052f,
+    -0.203812624f, 0.979009915f,
+    -0.207911691f, 0.978147601f,
+    -0.212007110f, 0.977268124f,
+    -0.216098809f, 0.976371499f,
+    -0.220186717f, 0.975457744f,
+    -0.224270761f, 0.974526873f,
+    -0.228350870f, 0.973578903f,
+    -0.232426973f, 0.972613851f,
+    -0.236498997f, 0.971631733f,
+    -0.240566872f, 0.970632567f,
+    -0.244630526f, 0.969616370f,
+    -0.248689887f, 0.968583161f,
+    -0.252744885f, 0.967532957f,
+    -0.256795449f, 0.966465777f,
+    -0.260841506f, 0.965381639f,
+    -0.264882987f, 0.964280562f,
+    -0.268919821f, 0.963162567f,
+    -0.272951936f, 0.962027672f,
+    -0.276979261f, 0.960875897f,
+    -0.281001727f, 0.959707262f,
+    -0.285019262f, 0.958521789f,
+    -0.289031797f, 0.957319498f,
+    -0.293039260f, 0.956100409f,
+    -0.297041582f, 0.954864545f,
+    -0.301038691f, 0.953611927f,
+    -0.305030519f, 0.952342576f,
+    -0.309016994f, 0.951056516f,
+    -0.312998048f, 0.949753769f,
+    -0.316973610f, 0.948434358f,
+    -0.320943610f, 0.947098305f,
+    -0.324907979f, 0.945745635f,
+    -0.328866647f, 0.944376370f,
+    -0.332819545f, 0.942990536f,
+    -0.336766603f, 0.941588156f,
+    -0.340707752f, 0.940169255f,
+    -0.344642923f, 0.938733858f,
+    -0.348572047f, 0.937281989f,
+    -0.352495055f, 0.935813676f,
+    -0.356411879f, 0.934328942f,
+    -0.360322448f, 0.932827815f,
+    -0.364226696f, 0.931310321f,
+    -0.368124553f, 0.929776486f,
+    -0.372015950f, 0.928226337f,
+    -0.375900821f, 0.926659901f,
+    -0.379779096f, 0.925077207f,
+    -0.383650707f, 0.923478281f,
+    -0.387515586f, 0.921863152f,
+    -0.391373667f, 0.920231847f,
+    -0.395224880f, 0.918584397f,
+    -0.399069159f, 0.916920829f,
+    -0.402906436f, 0.915241173f,
+    -0.406736643f, 0.913545458f,
+    -0.410559714f, 0.911833714f,
+    -0.414375581f, 0.910105971f,
+    -0.418184178f, 0.908362259f,
+    -0.421985437f, 0.906602609f,
+    -0.425779292f, 0.904827052f,
+    -0.429565676f, 0.903035620f,
+    -0.433344523f, 0.901228342f,
+    -0.437115767f, 0.899405252f,
+    -0.440879341f, 0.897566380f,
+    -0.444635179f, 0.895711760f,
+    -0.448383216f, 0.893841424f,
+    -0.452123386f, 0.891955405f,
+    -0.455855622f, 0.890053735f,
+    -0.459579861f, 0.888136449f,
+    -0.463296035f, 0.886203579f,
+    -0.467004081f, 0.884255160f,
+    -0.470703932f, 0.882291226f,
+    -0.474395525f, 0.880311812f,
+    -0.478078794f, 0.878316951f,
+    -0.481753674f, 0.876306680f,
+    -0.485420102f, 0.874281033f,
+    -0.489078012f, 0.872240046f,
+    -0.492727342f, 0.870183755f,
+    -0.496368025f, 0.868112195f,
+    -0.500000000f, 0.866025404f,
+    -0.503623202f, 0.863923417f,
+    -0.507237567f, 0.861806272f,
+    -0.510843032f, 0.859674006f,
+    -0.514439534f, 0.857526656f,
+    -0.518027009f, 0.855364260f,
+    -0.521605396f, 0.853186856f,
+    -0.525174630f, 0.850994482f,
+    -0.528734650f, 0.848787176f,
+    -0.532285392f, 0.846564978f,
+    -0.535826795f, 0.844327926f,
+    -0.539358796f, 0.842076059f,
+    -0.542881334f, 0.839809417f,
+    -0.546394347f, 0.837528040f,
+    -0.549897772f, 0.835231968f,
+    -0.553391549f, 0.832921241f,
+    -0.556875616f, 0.830595899f,
+    -0.560349913f, 0.828255984f,
+    -0.563814377f, 0.825901536f,
+    -0.567268949f, 0.823532598f,
+    -0.570713568f, 0.821149209f,
+    -0.574148173f, 0.818751413f,
+    -0.577572703f, 0.816339251f,
+    -0.580987100f, 0.813912765f,
+    -0.584391303f, 0.811471999f,
+    -0.587785252f, 0.809016994f,
+    -0.591168888f, 0.806547795f,
+    -0.594542152f, 0.804064444f,
+    -0.597904983f, 0.801566985f,
+    -0.601257324f, 0.799055462f,
+    -0.604599115f, 0.796529918f,
+    -0.607930298f, 0.793990399f,
+    -0.611250814f, 0.791436948f,
+    -0.614560605f, 0.788869611f,
+    -0.617859613f, 0.786288432f,
+    -0.621147780f, 0.783693457f,
+    -0.624425049f, 0.781084732f,
+    -0.627691361f, 0.778462302f,
+    -0.630946660f, 0.775826212f,
+    -0.634190889f, 0.773176511f,
+    -0.637423990f, 0.770513243f,
+    -0.640645907f, 0.767836456f,
+    -0.643856583f, 0.765146196f,
+    -0.647055962f, 0.762442511f,
+    -0.650243987f, 0.759725448f,
+    -0.653420604f, 0.756995056f,
+    -0.656585756f, 0.754251381f,
+    -0.659739387f, 0.751494472f,
+    -0.662881443f, 0.748724377f,
+    -0.666011867f, 0.745941145f,
+    -0.669130606f, 0.743144825f,
+    -0.672237605f, 0.740335466f,
+    -0.675332808f, 0.737513117f,
+    -0.678416162f, 0.734677828f,
+    -0.681487613f, 0.731829648f,
+    -0.684547106f, 0.728968627f,
+    -0.687594588f, 0.726094816f,
+    -0.690630006f, 0.723208265f,
+    -0.693653306f, 0.720309025f,
+    -0.696664435f, 0.717397146f,
+    -0.699663341f, 0.714472680f,
+    -0.702649970f, 0.711535677f,
+    -0.705624270f, 0.708586190f,
+    -0.708586190f, 0.705624270f,
+    -0.711535677f, 0.702649970f,
+    -0.714472680f, 0.699663341f,
+    -0.717397146f, 0.696664435f,
+    -0.720309025f, 0.693653306f,
+    -0.723208265f, 0.690630006f,
+    -0.726094816f, 0.687594588f,
+    -0.728968627f, 0.684547106f,
+    -0.731829648f, 0.681487613f,
+    -0.734677828f, 0.678416162f,
+    -0.737513117f, 0.675332808f,
+    -0.740335466f, 0.672237605f,
+    -0.743144825f, 0.669130606f,
+    -0.745941145f, 0.666011867f,
+    -0.748724377f, 0.662881443f,
+    -0.751494472f, 0.659739387f,
+    -0.754251381f, 0.656585756f,
+    -0.756995056f, 0.653420604f,
+    -0.759725448f, 0.650243987f,
+    -0.762442511f, 0.647055962f,
+    -0.765146196f, 0.643856583f,
+    -0.767836456f, 0.640645907f,
+    -0.770513243f, 0.637423990f,
+    -0.773176511f, 0.634190889f,
+    -0.775826212f, 0.630946660f,
+    -0.778462302f, 0.627691361f,
+    -0.781084732f, 0.624425049f,
+    -0.783693457f, 0.621147780f,
+    -0.786288432f, 0.617859613f,
+    -0.788869611f, 0.614560605f,
+    -0.791436948f, 0.611250814f,
+    -0.793990399f, 0.607930298f,
+    -0.796529918f, 0.604599115f,
+    -0.799055462f, 0.601257324f,
+    -0.801566985f, 0.597904983f,
+    -0.804064444f, 0.594542152f,
+    -0.806547795f, 0.591168888f,
+    -0.809016994f, 0.587785252f,
+    -0.811471999f, 0.584391303f,
+    -0.813912765f, 0.580987100f,
+    -0.816339251f, 0.577572703f,
+    -0.818751413f, 0.574148173f,
+    -0.821149209f, 0.570713568f,
+    -0.823532598f, 0.567268949f,
+    -0.825901536f, 0.563814377f,
+    -0.828255984f, 0.560349913f,
+    -0.830595899f, 0.556875616f,
+    -0.832921241f, 0.553391549f,
+    -0.835231968f, 0.549897772f,
+    -0.837528040f, 0.546394347f,
+    -0.839809417f, 0.542881334f,
+    -0.842076059f, 0.539358796f,
+    -0.844327926f, 0.535826795f,
+    -0.846564978f, 0.532285392f,
+    -0.848787176f, 0.528734650f,
+    -0.850994482f, 0.525174630f,
+    -0.853186856f, 0.521605396f,
+    -0.855364260f, 0.518027009f,
+    -0.857526656f, 0.514439534f,
+    -0.859674006f, 0.510843032f,
+    -0.861806272f, 0.507237567f,
+    -0.863923417f, 0.503623202f,
+    -0.866025404f, 0.500000000f,
+    -0.868112195f, 0.496368025f,
+    -0.870183755f, 0.492727342f,
+    -0.872240046f, 0.489078012f,
+    -0.874281033f, 0.485420102f,
+    -0.876306680f, 0.481753674f,
+    -0.878316951f, 0.478078794f,
+    -0.880311812f, 0.474395525f,
+    -0.882291226f, 0.470703932f,
+    -0.884255160f, 0.467004081f,
+    -0.886203579f, 0.463296035f,
+    -0.888136449f, 0.459579861f,
+    -0.890053735f, 0.455855622f,
+    -0.891955405f, 0.452123386f,
+    -0.893841424f, 0.448383216f,
+    -0.895711760f, 0.444635179f,
+    -0.897566380f, 0.440879341f,
+    -0.899405252f, 0.437115767f,
+    -0.901228342f, 0.433344523f,
+    -0.903035620f, 0.429565676f,
+    -0.904827052f, 0.425779292f,
+    -0.906602609f, 0.421985437f,
+    -0.908362259f, 0.418184178f,
+    -0.910105971f, 0.414375581f,
+    -0.911833714f, 0.410559714f,
+    -0.913545458f, 0.406736643f,
+    -0.915241173f, 0.402906436f,
+    -0.916920829f, 0.399069159f,
+    -0.918584397f, 0.395224880f,
+    -0.920231847f, 0.391373667f,
+    -0.921863152f, 0.387515586f,
+    -0.923478281f, 0.383650707f,
+    -0.925077207f, 0.379779096f,
+    -0.926659901f, 0.375900821f,
+    -0.928226337f, 0.372015950f,
+    -0.929776486f, 0.368124553f,
+    -0.931310321f, 0.364226696f,
+    -0.932827815f, 0.360322448f,
+    -0.934328942f, 0.356411879f,
+    -0.935813676f, 0.352495055f,
+    -0.937281989f, 0.348572047f,
+    -0.938733858f, 0.344642923f,
+    -0.940169255f, 0.340707752f,
+    -0.941588156f, 0.336766603f,
+    -0.942990536f, 0.332819545f,
+    -0.944376370f, 0.328866647f,
+    -0.945745635f, 0.324907979f,
+    -0.947098305f, 0.320943610f,
+    -0.948434358f, 0.316973610f,
+    -0.949753769f, 0.312998048f,
+    -0.951056516f, 0.309016994f,
+    -0.952342576f, 0.305030519f,
+    -0.953611927f, 0.301038691f,
+    -0.954864545f, 0.297041582f,
+    -0.956100409f, 0.293039260f,
+    -0.957319498f, 0.289031797f,
+    -0.958521789f, 0.285019262f,
+    -0.959707262f, 0.281001727f,
+    -0.960875897f, 0.276979261f,
+    -0.962027672f, 0.272951936f,
+    -0.963162567f, 0.268919821f,
+    -0.964280562f, 0.264882987f,
+    -0.965381639f, 0.260841506f,
+    -0.966465777f, 0.256795449f,
+    -0.967532957f, 0.252744885f,
+    -0.968583161f, 0.248689887f,
+    -0.969616370f, 0.244630526f,
+    -0.970632567f, 0.240566872f,
+    -0.971631733f, 0.236498997f,
+    -0.972613851f, 0.232426973f,
+    -0.973578903f, 0.228350870f,
+    -0.974526873f, 0.224270761f,
+    -0.975457744f, 0.220186717f,
+    -0.976371499f, 0.216098809f,
+    -0.977268124f, 0.212007110f,
+    -0.978147601f, 0.207911691f,
+    -0.979009915f, 0.203812624f,
+    -0.979855052f, 0.199709981f,
+    -0.980682997f, 0.195603833f,
+    -0.981493734f, 0.191494254f,
+    -0.982287251f, 0.187381315f,
+    -0.983063532f, 0.183265088f,
+    -0.983822564f, 0.179145645f,
+    -0.984564335f, 0.175023059f,
+    -0.985288830f, 0.170897402f,
+    -0.985996037f, 0.166768747f,
+    -0.986685944f, 0.162637165f,
+    -0.987358539f, 0.158502730f,
+    -0.988013810f, 0.154365514f,
+    -0.988651745f, 0.150225589f,
+    -0.989272333f, 0.146083029f,
+    -0.989875563f, 0.141937905f,
+    -0.990461426f, 0.137790291f,
+    -0.991029909f, 0.133640259f,
+    -0.991581004f, 0.129487882f,
+    -0.992114701f, 0.125333234f,
+    -0.992630991f, 0.121176386f,
+    -0.993129863f, 0.117017412f,
+    -0.993611311f, 0.112856385f,
+    -0.994075324f, 0.108693378f,
+    -0.994521895f, 0.104528463f,
+    -0.994951017f, 0.100361715f,
+    -0.995362681f, 0.096193205f,
+    -0.995756881f, 0.092023008f,
+    -0.996133609f, 0.087851197f,
+    -0.996492859f, 0.083677843f,
+    -0.996834625f, 0.079503022f,
+    -0.997158900f, 0.075326806f,
+    -0.997465679f, 0.071149267f,
+    -0.997754957f, 0.066970481f,
+    -0.998026728f, 0.062790520f,
+    -0.998280988f, 0.058609456f,
+    -0.998517732f, 0.054427365f,
+    -0.998736957f, 0.050244318f,
+    -0.998938657f, 0.046060390f,
+    -0.999122830f, 0.041875654f,
+    -0.999289473f, 0.037690183f,
+    -0.999438582f, 0.033504050f,
+    -0.999570155f, 0.029317330f,
+    -0.999684189f, 0.025130095f,
+    -0.999780683f, 0.020942420f,
+    -0.999859636f, 0.016754377f,
+    -0.999921044f, 0.012566040f,
+    -0.999964908f, 0.008377482f,
+    -0.999991227f, 0.004188778f,
+    -1.000000000f, 0.000000000f,
+    -0.999991227f, -0.004188778f,
+    -0.999964908f, -0.008377482f,
+    -0.999921044f, -0.012566040f,
+    -0.999859636f, -0.016754377f,
+    -0.999780683f, -0.020942420f,
+    -0.999684189f, -0.025130095f,
+    -0.999570155f, -0.029317330f,
+    -0.999438582f, -0.033504050f,
+    -0.999289473f, -0.037690183f,
+    -0.999122830f, -0.041875654f,
+    -0.998938657f, -0.046060390f,
+    -0.998736957f, -0.050244318f,
+    -0.998517732f, -0.054427365f,
+    -0.998280988f, -0.058609456f,
+    -0.998026728f, -0.062790520f,
+    -0.997754957f, -0.066970481f,
+    -0.997465679f, -0.071149267f,
+    -0.997158900f, -0.075326806f,
+    -0.996834625f, -0.079503022f,
+    -0.996492859f, -0.083677843f,
+    -0.996133609f, -0.087851197f,
+    -0.995756881f, -0.092023008f,
+    -0.995362681f, -0.096193205f,
+    -0.994951017f, -0.100361715f,
+    -0.994521895f, -0.104528463f,
+    -0.994075324f, -0.108693378f,
+    -0.993611311f, -0.112856385f,
+    -0.993129863f, -0.117017412f,
+    -0.992630991f, -0.121176386f,
+    -0.992114701f, -0.125333234f,
+    -0.991581004f, -0.129487882f,
+    -0.991029909f, -0.133640259f,
+    -0.990461426f, -0.137790291f,
+    -0.989875563f, -0.141937905f,
+    -0.989272333f, -0.146083029f,
+    -0.988651745f, -0.150225589f,
+    -0.988013810f, -0.154365514f,
+    -0.987358539f, -0.158502730f,
+    -0.986685944f, -0.162637165f,
+    -0.985996037f, -0.166768747f,
+    -0.985288830f, -0.170897402f,
+    -0.984564335f, -0.175023059f,
+    -0.983822564f, -0.179145645f,
+    -0.983063532f, -0.183265088f,
+    -0.982287251f, -0.187381315f,
+    -0.981493734f, -0.191494254f,
+    -0.980682997f, -0.195603833f,
+    -0.979855052f, -0.199709981f,
+    -0.979009915f, -0.203812624f,
+    -0.978147601f, -0.207911691f,
+    -0.977268124f, -0.212007110f,
+    -0.976371499f, -0.216098809f,
+    -0.975457744f, -0.220186717f,
+    -0.974526873f, -0.224270761f,
+    -0.973578903f, -0.228350870f,
+    -0.972613851f, -0.232426973f,
+    -0.971631733f, -0.236498997f,
+    -0.970632567f, -0.240566872f,
+    -0.969616370f, -0.244630526f,
+    -0.968583161f, -0.248689887f,
+    -0.967532957f, -0.252744885f,
+    -0.966465777f, -0.256795449f,
+    -0.965381639f, -0.260841506f,
+    -0.964280562f, -0.264882987f,
+    -0.963162567f, -0.268919821f,
+    -0.962027672f, -0.272951936f,
+    -0.960875897f, -0.276979261f,
+    -0.959707262f, -0.281001727f,
+    -0.958521789f, -0.285019262f,
+    -0.957319498f, -0.289031797f,
+    -0.956100409f, -0.293039260f,
+    -0.954864545f, -0.297041582f,
+    -0.953611927f, -0.301038691f,
+    -0.952342576f, -0.305030519f,
+    -0.951056516f, -0.309016994f,
+    -0.949753769f, -0.312998048f,
+    -0.948434358f, -0.316973610f,
+    -0.947098305f, -0.320943610f,
+    -0.945745635f, -0.324907979f,
+    -0.944376370f, -0.328866647f,
+    -0.942990536f, -0.332819545f,
+    -0.941588156f, -0.336766603f,
+    -0.940169255f, -0.340707752f,
+    -0.938733858f, -0.344642923f,
+    -0.937281989f, -0.348572047f,
+    -0.935813676f, -0.352495055f,
+    -0.934328942f, -0.356411879f,
+    -0.932827815f, -0.360322448f,
+    -0.931310321f, -0.364226696f,
+    -0.929776486f, -0.368124553f,
+    -0.928226337f, -0.372015950f,
+    -0.926659901f, -0.375900821f,
+    -0.925077207f, -0.379779096f,
+    -0.923478281f, -0.383650707f,
+    -0.921863152f, -0.387515586f,
+    -0.920231847f, -0.391373667f,
+    -0.918584397f, -0.395224880f,
+    -0.916920829f, -0.399069159f,
+    -0.915241173f, -0.402906436f,
+    -0.913545458f, -0.406736643f,
+    -0.911833714f, -0.410559714f,
+    -0.910105971f, -0.414375581f,
+    -0.908362259f, -0.418184178f,
+    -0.906602609f, -0.421985437f,
+    -0.904827052f, -0.425779292f,
+    -0.903035620f, -0.429565676f,
+    -0.901228342f, -0.433344523f,
+    -0.899405252f, -0.437115767f,
+    -0.897566380f, -0.440879341f,
+    -0.895711760f, -0.444635179f,
+    -0.893841424f, -0.448383216f,
+    -0.891955405f, -0.452123386f,
+    -0.890053735f, -0.455855622f,
+    -0.888136449f, -0.459579861f,
+    -0.886203579f, -0.463296035f,
+    -0.884255160f, -0.467004081f,
+    -0.882291226f, -0.470703932f,
+    -0.880311812f, -0.474395525f,
+    -0.878316951f, -0.478078794f,
+    -0.876306680f, -0.481753674f,
+    -0.874281033f, -0.485420102f,
+    -0.872240046f, -0.489078012f,
+    -0.870183755f, -0.492727342f,
+    -0.868112195f, -0.496368025f,
+    -0.866025404f, -0.500000000f,
+    -0.863923417f, -0.503623202f,
+    -0.861806272f, -0.507237567f,
+    -0.859674006f, -0.510843032f,
+    -0.857526656f, -0.514439534f,
+    -0.855364260f, -0.518027009f,
+    -0.853186856f, -0.521605396f,
+    -0.850994482f, -0.525174630f,
+    -0.848787176f, -0.528734650f,
+    -0.846564978f, -0.532285392f,
+    -0.844327926f, -0.535826795f,
+    -0.842076059f, -0.539358796f,
+    -0.839809417f, -0.542881334f,
+    -0.837528040f, -0.546394347f,
+    -0.835231968f, -0.549897772f,
+    -0.832921241f, -0.553391549f,
+    -0.830595899f, -0.556875616f,
+    -0.828255984f, -0.560349913f,
+    -0.825901536f, -0.563814377f,
+    -0.823532598f, -0.567268949f,
+    -0.821149209f, -0.570713568f,
+    -0.818751413f, -0.574148173f,
+    -0.816339251f, -0.577572703f,
+    -0.813912765f, -0.580987100f,
+    -0.811471999f, -0.584391303f,
+    -0.809016994f, -0.587785252f,
+    -0.806547795f, -0.591168888f,
+    -0.804064444f, -0.594542152f,
+    -0.801566985f, -0.597904983f,
+    -0.799055462f, -0.601257324f,
+    -0.796529918f, -0.604599115f,
+    -0.793990399f, -0.607930298f,
+    -0.791436948f, -0.611250814f,
+    -0.788869611f, -0.614560605f,
+    -0.786288432f, -0.617859613f,
+    -0.783693457f, -0.621147780f,
+    -0.781084732f, -0.624425049f,
+    -0.778462302f, -0.627691361f,
+    -0.775826212f, -0.630946660f,
+    -0.773176511f, -0.634190889f,
+    -0.770513243f, -0.637423990f,
+    -0.767836456f, -0.640645907f,
+    -0.765146196f, -0.643856583f,
+    -0.762442511f, -0.647055962f,
+    -0.759725448f, -0.650243987f,
+    -0.756995056f, -0.653420604f,
+    -0.754251381f, -0.656585756f,
+    -0.751494472f, -0.659739387f,
+    -0.748724377f, -0.662881443f,
+    -0.745941145f, -0.666011867f,
+    -0.743144825f, -0.669130606f,
+    -0.740335466f, -0.672237605f,
+    -0.737513117f, -0.675332808f,
+    -0.734677828f, -0.678416162f,
+    -0.731829648f, -0.681487613f,
+    -0.728968627f, -0.684547106f,
+    -0.726094816f, -0.687594588f,
+    -0.723208265f, -0.690630006f,
+    -0.720309025f, -0.693653306f,
+    -0.717397146f, -0.696664435f,
+    -0.714472680f, -0.699663341f,
+    -0.711535677f, -0.702649970f,
+    -0.708586190f, -0.705624270f,
+    -0.705624270f, -0.708586190f,
+    -0.702649970f, -0.711535677f,
+    -0.699663341f, -0.714472680f,
+    -0.696664435f, -0.717397146f,
+    -0.693653306f, -0.720309025f,
+    -0.690630006f, -0.723208265f,
+    -0.687594588f, -0.726094816f,
+    -0.684547106f, -0.728968627f,
+    -0.681487613f, -0.731829648f,
+    -0.678416162f, -0.734677828f,
+    -0.675332808f, -0.737513117f,
+    -0.672237605f, -0.740335466f,
+    -0.669130606f, -0.743144825f,
+    -0.666011867f, -0.745941145f,
+    -0.662881443f, -0.748724377f,
+    -0.659739387f, -0.751494472f,
+    -0.656585756f, -0.754251381f,
+    -0.653420604f, -0.756995056f,
+    -0.650243987f, -0.759725448f,
+    -0.647055962f, -0.762442511f,
+    -0.643856583f, -0.765146196f,
+    -0.640645907f, -0.767836456f,
+    -0.637423990f, -0.770513243f,
+    -0.634190889f, -0.773176511f,
+    -0.630946660f, -0.775826212f,
+    -0.627691361f, -0.778462302f,
+    -0.624425049f, -0.781084732f,
+    -0.621147780f, -0.783693457f,
+    -0.617859613f, -0.786288432f,
+    -0.614560605f, -0.788869611f,
+    -0.611250814f, -0.791436948f,
+    -0.607930298f, -0.793990399f,
+    -0.604599115f, -0.796529918f,
+    -0.601257324f, -0.799055462f,
+    -0.597904983f, -0.801566985f,
+    -0.594542152f, -0.804064444f,
+    -0.591168888f, -0.806547795f,
+    -0.587785252f, -0.809016994f,
+    -0.584391303f, -0.811471999f,
+    -0.580987100f, -0.813912765f,
+    -0.577572703f, -0.816339251f,
+    -0.574148173f, -0.818751413f,
+    -0.570713568f, -0.821149209f,
+    -0.567268949f, -0.823532598f,
+    -0.563814377f, -0.825901536f,
+    -0.560349913f, -0.828255984f,
+    -0.556875616f, -0.830595899f,
+    -0.553391549f, -0.832921241f,
+    -0.549897772f, -0.835231968f,
+    -0.546394347f, -0.837528040f,
+    -0.542881334f, -0.839809417f,
+    -0.539358796f, -0.842076059f,
+    -0.535826795f, -0.844327926f,
+    -0.532285392f, -0.846564978f,
+    -0.528734650f, -0.848787176f,
+    -0.525174630f, -0.850994482f,
+    -0.521605396f, -0.853186856f,
+    -0.518027009f, -0.855364260f,
+    -0.514439534f, -0.857526656f,
+    -0.510843032f, -0.859674006f,
+    -0.507237567f, -0.861806272f,
+    -0.503623202f, -0.863923417f,
+    -0.500000000f, -0.866025404f,
+    -0.496368025f, -0.868112195f,
+    -0.492727342f, -0.870183755f,
+    -0.489078012f, -0.872240046f,
+    -0.485420102f, -0.874281033f,
+    -0.481753674f, -0.876306680f,
+    -0.478078794f, -0.878316951f,
+    -0.474395525f, -0.880311812f,
+    -0.470703932f, -0.882291226f,
+    -0.467004081f, -0.884255160f,
+    -0.463296035f, -0.886203579f,
+    -0.459579861f, -0.888136449f,
+    -0.455855622f, -0.890053735f,
+    -0.452123386f, -0.891955405f,
+    -0.448383216f, -0.893841424f,
+    -0.444635179f, -0.895711760f,
+    -0.440879341f, -0.897566380f,
+    -0.437115767f, -0.899405252f,
+    -0.433344523f, -0.901228342f,
+    -0.429565676f, -0.903035620f,
+    -0.425779292f, -0.904827052f,
+    -0.421985437f, -0.906602609f,
+    -0.418184178f, -0.908362259f,
+    -0.414375581f, -0.910105971f,
+    -0.410559714f, -0.911833714f,
+    -0.406736643f, -0.913545458f,
+    -0.402906436f, -0.915241173f,
+    -0.399069159f, -0.916920829f,
+    -0.395224880f, -0.918584397f,
+    -0.391373667f, -0.920231847f,
+    -0.387515586f, -0.921863152f,
+    -0.383650707f, -0.923478281f,
+    -0.379779096f, -0.925077207f,
+    -0.375900821f, -0.926659901f,
+    -0.372015950f, -0.928226337f,
+    -0.368124553f, -0.929776486f,
+    -0.364226696f, -0.931310321f,
+    -0.360322448f, -0.932827815f,
+    -0.356411879f, -0.934328942f,
+    -0.352495055f, -0.935813676f,
+    -0.348572047f, -0.937281989f,
+    -0.344642923f, -0.938733858f,
+    -0.340707752f, -0.940169255f,
+    -0.336766603f, -0.941588156f,
+    -0.332819545f, -0.942990536f,
+    -0.328866647f, -0.944376370f,
+    -0.324907979f, -0.945745635f,
+    -0.320943610f, -0.947098305f,
+    -0.316973610f, -0.948434358f,
+    -0.312998048f, -0.949753769f,
+    -0.309016994f, -0.951056516f,
+    -0.305030519f, -0.952342576f,
+    -0.301038691f, -0.953611927f,
+    -0.297041582f, -0.954864545f,
+    -0.293039260f, -0.956100409f,
+    -0.289031797f, -0.957319498f,
+    -0.285019262f, -0.958521789f,
+    -0.281001727f, -0.959707262f,
+    -0.276979261f, -0.960875897f,
+    -0.272951936f, -0.962027672f,
+    -0.268919821f, -0.963162567f,
+    -0.264882987f, -0.964280562f,
+    -0.260841506f, -0.965381639f,
+    -0.256795449f, -0.966465777f,
+    -0.252744885f, -0.967532957f,
+    -0.248689887f, -0.968583161f,
+    -0.244630526f, -0.969616370f,
+    -0.240566872f, -0.970632567f,
+    -0.236498997f, -0.971631733f,
+    -0.232426973f, -0.972613851f,
+    -0.228350870f, -0.973578903f,
+    -0.224270761f, -0.974526873f,
+    -0.220186717f, -0.975457744f,
+    -0.216098809f, -0.976371499f,
+    -0.212007110f, -0.977268124f,
+    -0.207911691f, -0.978147601f,
+    -0.203812624f, -0.979009915f,
+    -0.199709981f, -0.979855052f,
+    -0.195603833f, -0.980682997f,
+    -0.191494254f, -0.981493734f,
+    -0.187381315f, -0.982287251f,
+    -0.183265088f, -0.983063532f,
+    -0.179145645f, -0.983822564f,
+    -0.175023059f, -0.984564335f,
+    -0.170897402f, -0.985288830f,
+    -0.166768747f, -0.985996037f,
+    -0.162637165f, -0.986685944f,
+    -0.158502730f, -0.987358539f,
+    -0.154365514f, -0.988013810f,
+    -0.150225589f, -0.988651745f,
+    -0.146083029f, -0.989272333f,
+    -0.141937905f, -0.989875563f,
+    -0.137790291f, -0.990461426f,
+    -0.133640259f, -0.991029909f,
+    -0.129487882f, -0.991581004f,
+    -0.125333234f, -0.992114701f,
+    -0.121176386f, -0.992630991f,
+    -0.117017412f, -0.993129863f,
+    -0.112856385f, -0.993611311f,
+    -0.108693378f, -0.994075324f,
+    -0.104528463f, -0.994521895f,
+    -0.100361715f, -0.994951017f,
+    -0.096193205f, -0.995362681f,
+    -0.092023008f, -0.995756881f,
+    -0.087851197f, -0.996133609f,
+    -0.083677843f, -0.996492859f,
+    -0.079503022f, -0.996834625f,
+    -0.075326806f, -0.997158900f,
+    -0.071149267f, -0.997465679f,
+    -0.066970481f, -0.997754957f,
+    -0.062790520f, -0.998026728f,
+    -0.058609456f, -0.998280988f,
+    -0.054427365f, -0.998517732f,
+    -0.050244318f, -0.998736957f,
+    -0.046060390f, -0.998938657f,
+    -0.041875654f, -0.999122830f,
+    -0.037690183f, -0.999289473f,
+    -0.033504050f, -0.999438582f,
+    -0.029317330f, -0.999570155f,
+    -0.025130095f, -0.999684189f,
+    -0.020942420f, -0.999780683f,
+    -0.016754377f, -0.999859636f,
+    -0.012566040f, -0.999921044f,
+    -0.008377482f, -0.999964908f,
+    -0.004188778f, -0.999991227f,
+    0.000000000f, -1.000000000f,
+    0.004188778f, -0.999991227f,
+    0.008377482f, -0.999964908f,
+    0.012566040f, -0.999921044f,
+    0.016754377f, -0.999859636f,
+    0.020942420f, -0.999780683f,
+    0.025130095f, -0.999684189f,
+    0.029317330f, -0.999570155f,
+    0.033504050f, -0.999438582f,
+    0.037690183f, -0.999289473f,
+    0.041875654f, -0.999122830f,
+    0.046060390f, -0.998938657f,
+    0.050244318f, -0.998736957f,
+    0.054427365f, -0.998517732f,
+    0.058609456f, -0.998280988f,
+    0.062790520f, -0.998026728f,
+    0.066970481f, -0.997754957f,
+    0.071149267f, -0.997465679f,
+    0.075326806f, -0.997158900f,
+    0.079503022f, -0.996834625f,
+    0.083677843f, -0.996492859f,
+    0.087851197f, -0.996133609f,
+    0.092023008f, -0.995756881f,
+    0.096193205f, -0.995362681f,
+    0.100361715f, -0.994951017f,
+    0.104528463f, -0.994521895f,
+    0.108693378f, -0.994075324f,
+    0.112856385f, -0.993611311f,
+    0.117017412f, -0.993129863f,
+    0.121176386f, -0.992630991f,
+    0.125333234f, -0.992114701f,
+    0.129487882f, -0.991581004f,
+    0.133640259f, -0.991029909f,
+    0.137790291f, -0.990461426f,
+    0.141937905f, -0.989875563f,
+    0.146083029f, -0.989272333f,
+    0.150225589f, -0.988651745f,
+    0.154365514f, -0.988013810f,
+    0.158502730f, -0.987358539f,
+    0.162637165f, -0.986685944f,
+    0.166768747f, -0.985996037f,
+    0.170897402f, -0.985288830f,
+    0.175023059f, -0.984564335f,
+    0.179145645f, -0.983822564f,
+    0.183265088f, -0.983063532f,
+    0.187381315f, -0.982287251f,
+    0.191494254f, -0.981493734f,
+    0.195603833f, -0.980682997f,
+    0.199709981f, -0.979855052f,
+    0.203812624f, -0.979009915f,
+    0.207911691f, -0.978147601f,
+    0.212007110f, -0.977268124f,
+    0.216098809f, -0.976371499f,
+    0.220186717f, -0.975457744f,
+    0.224270761f, -0.974526873f,
+    0.228350870f, -0.973578903f,
+    0.232426973f, -0.972613851f,
+    0.236498997f, -0.971631733f,
+    0.240566872f, -0.970632567f,
+    0.244630526f, -0.969616370f,
+    0.248689887f, -0.968583161f,
+    0.252744885f, -0.967532957f,
+    0.256795449f, -0.966465777f,
+    0.260841506f, -0.965381639f,
+    0.264882987f, -0.964280562f,
+    0.268919821f, -0.963162567f,
+    0.272951936f, -0.962027672f,
+    0.276979261f, -0.960875897f,
+    0.281001727f, -0.959707262f,
+    0.285019262f, -0.958521789f,
+    0.289031797f, -0.957319498f,
+    0.293039260f, -0.956100409f,
+    0.297041582f, -0.954864545f,
+    0.301038691f, -0.953611927f,
+    0.305030519f, -0.952342576f,
+    0.309016994f, -0.951056516f,
+    0.312998048f, -0.949753769f,
+    0.316973610f, -0.948434358f,
+    0.320943610f, -0.947098305f,
+    0.324907979f, -0.945745635f,
+    0.328866647f, -0.944376370f,
+    0.332819545f, -0.942990536f,
+    0.336766603f, -0.941588156f,
+    0.340707752f, -0.940169255f,
+    0.344642923f, -0.938733858f,
+    0.348572047f, -0.937281989f,
+    0.352495055f, -0.935813676f,
+    0.356411879f, -0.934328942f,
+    0.360322448f, -0.932827815f,
+    0.364226696f, -0.931310321f,
+    0.368124553f, -0.929776486f,
+    0.372015950f, -0.928226337f,
+    0.375900821f, -0.926659901f,
+    0.379779096f, -0.925077207f,
+    0.383650707f, -0.923478281f,
+    0.387515586f, -0.921863152f,
+    0.391373667f, -0.920231847f,
+    0.395224880f, -0.918584397f,
+    0.399069159f, -0.916920829f,
+    0.402906436f, -0.915241173f,
+    0.406736643f, -0.913545458f,
+    0.410559714f, -0.911833714f,
+    0.414375581f, -0.910105971f,
+    0.418184178f, -0.908362259f,
+    0.421985437f, -0.906602609f,
+    0.425779292f, -0.904827052f,
+    0.429565676f, -0.903035620f,
+    0.433344523f, -0.901228342f,
+    0.437115767f, -0.899405252f,
+    0.440879341f, -0.897566380f,
+    0.444635179f, -0.895711760f,
+    0.448383216f, -0.893841424f,
+    0.452123386f, -0.891955405f,
+    0.455855622f, -0.890053735f,
+    0.459579861f, -0.888136449f,
+    0.463296035f, -0.886203579f,
+    0.467004081f, -0.884255160f,
+    0.470703932f, -0.882291226f,
+    0.474395525f, -0.880311812f,
+    0.478078794f, -0.878316951f,
+    0.481753674f, -0.876306680f,
+    0.485420102f, -0.874281033f,
+    0.489078012f, -0.872240046f,
+    0.492727342f, -0.870183755f,
+    0.496368025f, -0.868112195f,
+    0.500000000f, -0.866025404f,
+    0.503623202f, -0.863923417f,
+    0.507237567f, -0.861806272f,
+    0.510843032f, -0.859674006f,
+    0.514439534f, -0.857526656f,
+    0.518027009f, -0.855364260f,
+    0.521605396f, -0.853186856f,
+    0.525174630f, -0.850994482f,
+    0.528734650f, -0.848787176f,
+    0.532285392f, -0.846564978f,
+    0.535826795f, -0.844327926f,
+    0.539358796f, -0.842076059f,
+    0.542881334f, -0.839809417f,
+    0.546394347f, -0.837528040f,
+    0.549897772f, -0.835231968f,
+    0.553391549f, -0.832921241f,
+    0.556875616f, -0.830595899f,
+    0.560349913f, -0.828255984f,
+    0.563814377f, -0.825901536f,
+    0.567268949f, -0.823532598f,
+    0.570713568f, -0.821149209f,
+    0.574148173f, -0.818751413f,
+    0.577572703f, -0.816339251f,
+    0.580987100f, -0.813912765f,
+    0.584391303f, -0.811471999f,
+    0.587785252f, -0.809016994f,
+    0.591168888f, -0.806547795f,
+    0.594542152f, -0.804064444f,
+    0.597904983f, -0.801566985f,
+    0.601257324f, -0.799055462f,
+    0.604599115f, -0.796529918f,
+    0.607930298f, -0.793990399f,
+    0.611250814f, -0.791436948f,
+    0.614560605f, -0.788869611f,
+    0.617859613f, -0.786288432f,
+    0.621147780f, -0.783693457f,
+    0.624425049f, -0.781084732f,
+    0.627691361f, -0.778462302f,
+    0.630946660f, -0.775826212f,
+    0.634190889f, -0.773176511f,
+    0.637423990f, -0.770513243f,
+    0.640645907f, -0.767836456f,
+    0.643856583f, -0.765146196f,
+    0.647055962f, -0.762442511f,
+    0.650243987f, -0.759725448f,
+    0.653420604f, -0.756995056f,
+    0.656585756f, -0.754251381f,
+    0.659739387f, -0.751494472f,
+    0.662881443f, -0.748724377f,
+    0.666011867f, -0.745941145f,
+    0.669130606f, -0.743144825f,
+    0.672237605f, -0.740335466f,
+    0.675332808f, -0.737513117f,
+    0.678416162f, -0.734677828f,
+    0.681487613f, -0.731829648f,
+    0.684547106f, -0.728968627f,
+    0.687594588f, -0.726094816f,
+    0.690630006f, -0.723208265f,
+    0.693653306f, -0.720309025f,
+    0.696664435f, -0.717397146f,
+    0.699663341f, -0.714472680f,
+    0.702649970f, -0.711535677f,
+    0.705624270f, -0.708586190f,
+    0.708586190f, -0.705624270f,
+    0.711535677f, -0.702649970f,
+    0.714472680f, -0.699663341f,
+    0.717397146f, -0.696664435f,
+    0.720309025f, -0.693653306f,
+    0.723208265f, -0.690630006f,
+    0.726094816f, -0.687594588f,
+    0.728968627f, -0.684547106f,
+    0.731829648f, -0.681487613f,
+    0.734677828f, -0.678416162f,
+    0.737513117f, -0.675332808f,
+    0.740335466f, -0.672237605f,
+    0.743144825f, -0.669130606f,
+    0.745941145f, -0.666011867f,
+    0.748724377f, -0.662881443f,
+    0.751494472f, -0.659739387f,
+    0.754251381f, -0.656585756f,
+    0.756995056f, -0.653420604f,
+    0.759725448f, -0.650243987f,
+    0.762442511f, -0.647055962f,
+    0.765146196f, -0.643856583f,
+    0.767836456f, -0.640645907f,
+    0.770513243f, -0.637423990f,
+    0.773176511f, -0.634190889f,
+    0.775826212f, -0.630946660f,
+    0.778462302f, -0.627691361f,
+    0.781084732f, -0.624425049f,
+    0.783693457f, -0.621147780f,
+    0.786288432f, -0.617859613f,
+    0.788869611f, -0.614560605f,
+    0.791436948f, -0.611250814f,
+    0.793990399f, -0.607930298f,
+    0.796529918f, -0.604599115f,
+    0.799055462f, -0.601257324f,
+    0.801566985f, -0.597904983f,
+    0.804064444f, -0.594542152f,
+    0.806547795f, -0.591168888f,
+    0.809016994f, -0.587785252f,
+    0.811471999f, -0.584391303f,
+    0.813912765f, -0.580987100f,
+    0.816339251f, -0.577572703f,
+    0.818751413f, -0.574148173f,
+    0.821149209f, -0.570713568f,
+    0.823532598f, -0.567268949f,
+    0.825901536f, -0.563814377f,
+    0.828255984f, -0.560349913f,
+    0.830595899f, -0.556875616f,
+    0.832921241f, -0.553391549f,
+    0.835231968f, -0.549897772f,
+    0.837528040f, -0.546394347f,
+    0.839809417f, -0.542881334f,
+    0.842076059f, -0.539358796f,
+    0.844327926f, -0.535826795f,
+    0.846564978f, -0.532285392f,
+    0.848787176f, -0.528734650f,
+    0.850994482f, -0.525174630f,
+    0.853186856f, -0.521605396f,
+    0.855364260f, -0.518027009f,
+    0.857526656f, -0.514439534f,
+    0.859674006f, -0.510843032f,
+    0.861806272f, -0.507237567f,
+    0.863923417f, -0.503623202f,
+    0.866025404f, -0.500000000f,
+    0.868112195f, -0.496368025f,
+    0.870183755f, -0.492727342f,
+    0.872240046f, -0.489078012f,
+    0.874281033f, -0.485420102f,
+    0.876306680f, -0.481753674f,
+    0.878316951f, -0.478078794f,
+    0.880311812f, -0.474395525f,
+    0.882291226f, -0.470703932f,
+    0.884255160f, -0.467004081f,
+    0.886203579f, -0.463296035f,
+    0.888136449f, -0.459579861f,
+    0.890053735f, -0.455855622f,
+    0.891955405f, -0.452123386f,
+    0.893841424f, -0.448383216f,
+    0.895711760f, -0.444635179f,
+    0.897566380f, -0.440879341f,
+    0.899405252f, -0.437115767f,
+    0.901228342f, -0.433344523f,
+    0.903035620f, -0.429565676f,
+    0.904827052f, -0.425779292f,
+    0.906602609f, -0.421985437f,
+    0.908362259f, -0.418184178f,
+    0.910105971f, -0.414375581f,
+    0.911833714f, -0.410559714f,
+    0.913545458f, -0.406736643f,
+    0.915241173f, -0.402906436f,
+    0.916920829f, -0.399069159f,
+    0.918584397f, -0.395224880f,
+    0.920231847f, -0.391373667f,
+    0.921863152f, -0.387515586f,
+    0.923478281f, -0.383650707f,
+    0.925077207f, -0.379779096f,
+    0.926659901f, -0.375900821f,
+    0.928226337f, -0.372015950f,
+    0.929776486f, -0.368124553f,
+    0.931310321f, -0.364226696f,
+    0.932827815f, -0.360322448f,
+    0.934328942f, -0.356411879f,
+    0.935813676f, -0.352495055f,
+    0.937281989f, -0.348572047f,
+    0.938733858f, -0.344642923f,
+    0.940169255f, -0.340707752f,
+    0.941588156f, -0.336766603f,
+    0.942990536f, -0.332819545f,
+    0.944376370f, -0.328866647f,
+    0.945745635f, -0.324907979f,
+    0.947098305f, -0.320943610f,
+    0.948434358f, -0.316973610f,
+    0.949753769f, -0.312998048f,
+    0.951056516f, -0.309016994f,
+    0.952342576f, -0.305030519f,
+    0.953611927f, -0.301038691f,
+    0.954864545f, -0.297041582f,
+    0.956100409f, -0.293039260f,
+    0.957319498f, -0.289031797f,
+    0.958521789f, -0.285019262f,
+    0.959707262f, -0.281001727f,
+    0.960875897f, -0.276979261f,
+    0.962027672f, -0.272951936f,
+    0.963162567f, -0.268919821f,
+    0.964280562f, -0.264882987f,
+    0.965381639f, -0.260841506f,
+    0.966465777f, -0.256795449f,
+    0.967532957f, -0.252744885f,
+    0.968583161f, -0.248689887f,
+    0.969616370f, -0.244630526f,
+    0.970632567f, -0.240566872f,
+    0.971631733f, -0.236498997f,
+    0.972613851f, -0.232426973f,
+    0.973578903f, -0.228350870f,
+    0.974526873f, -0.224270761f,
+    0.975457744f, -0.220186717f,
+    0.976371499f, -0.216098809f,
+    0.977268124f, -0.212007110f,
+    0.978147601f, -0.207911691f,
+    0.979009915f, -0.203812624f,
+    0.979855052f, -0.199709981f,
+    0.980682997f, -0.195603833f,
+    0.981493734f, -0.191494254f,
+    0.982287251f, -0.187381315f,
+    0.983063532f, -0.183265088f,
+    0.983822564f, -0.179145645f,
+    0.984564335f, -0.175023059f,
+    0.985288830f, -0.170897402f,
+    0.985996037f, -0.166768747f,
+    0.986685944f, -0.162637165f,
+    0.987358539f, -0.158502730f,
+    0.988013810f, -0.154365514f,
+    0.988651745f, -0.150225589f,
+    0.989272333f, -0.146083029f,
+    0.989875563f, -0.141937905f,
+    0.990461426f, -0.137790291f,
+    0.991029909f, -0.133640259f,
+    0.991581004f, -0.129487882f,
+    0.992114701f, -0.125333234f,
+    0.992630991f, -0.121176386f,
+    0.993129863f, -0.117017412f,
+    0.993611311f, -0.112856385f,
+    0.994075324f, -0.108693378f,
+    0.994521895f, -0.104528463f,
+    0.994951017f, -0.100361715f,
+    0.995362681f, -0.096193205f,
+    0.995756881f, -0.092023008f,
+    0.996133609f, -0.087851197f,
+    0.996492859f, -0.083677843f,
+    0.996834625f, -0.079503022f,
+    0.997158900f, -0.075326806f,
+    0.997465679f, -0.071149267f,
+    0.997754957f, -0.066970481f,
+    0.998026728f, -0.062790520f,
+    0.998280988f, -0.058609456f,
+    0.998517732f, -0.054427365f,
+    0.998736957f, -0.050244318f,
+    0.998938657f, -0.046060390f,
+    0.999122830f, -0.041875654f,
+    0.999289473f, -0.037690183f,
+    0.999438582f, -0.033504050f,
+    0.999570155f, -0.029317330f,
+    0.999684189f, -0.025130095f,
+    0.999780683f, -0.020942420f,
+    0.999859636f, -0.016754377f,
+    0.999921044f, -0.012566040f,
+    0.999964908f, -0.008377482f,
+    0.999991227f, -0.004188778f
+};
+#endif /* !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) */
+
+/**
+  @} end of MixedRadixCFFT group
+ */
@@ -26,12 +26,16 @@
  * limitations under the License.
  */
 
+#include "arm_pid_bank_f32.c"
+#include "arm_pid_bank_init_f32.c"
+#include "arm_pid_bank_reset_f32.c"
 #include "arm_pid_init_f32.c"
 #include "arm_pid_init_q15.c"
 #include "arm_pid_init_q31.c"
 #include "arm_pid_reset_f32.c"
 #include "arm_pid_reset_q15.c"
 #include "arm_pid_reset_q31.c"
+#include "arm_state_space_init_f32.c"
 
 #if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_FAST_ALLOW_TABLES)
 
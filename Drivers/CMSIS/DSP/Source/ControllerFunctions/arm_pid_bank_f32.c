@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_bank_f32.c
+ * Description:  Processing function for the floating-point batched PID controllers
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup PIDBank
+  @{
+ */
+
+/**
+  @brief         Process function for the floating-point batched PID controllers.
+  @param[in,out] S          points to an instance of the PID bank structure
+  @param[in]     pSetpoint  points to the setpoints, one per controller
+  @param[in]     pMeasure   points to the measurements, one per controller
+  @param[out]    pOut       points to the outputs, one per controller
+  @return        none
+
+  @par           Details
+                   All controllers of the bank are updated in one pass. The loop body has no
+                   dependency between controllers and only uses select operations for the
+                   saturation so that it can be vectorized by the compiler.
+ */
+void arm_pid_bank_f32(
+        arm_pid_bank_instance_f32 * S,
+  const float32_t * pSetpoint,
+  const float32_t * pMeasure,
+        float32_t * pOut)
+{
+        uint32_t n = S->numControllers;          /* Number of controllers */
+  const float32_t *pKp = S->pCoeffs;             /* Proportional gains */
+  const float32_t *pKi = pKp + n;                /* Integral gains */
+  const float32_t *pKd = pKi + n;                /* Derivative gains */
+  const float32_t *pB = pKd + n;                 /* Proportional setpoint weights */
+  const float32_t *pC = pB + n;                  /* Derivative setpoint weights */
+  const float32_t *pAlpha = pC + n;              /* Derivative filter coefficients */
+  const float32_t *pMin = pAlpha + n;            /* Lower output limits */
+  const float32_t *pMax = pMin + n;              /* Upper output limits */
+        float32_t *pI = S->pState;               /* Integral terms */
+        float32_t *pDIn = pI + n;                /* Previous derivative inputs */
+        float32_t *pD = pDIn + n;                /* Filtered derivative terms */
+        float32_t r, y, inc, integ, dIn, d, u, out;
+        uint32_t i;
+
+  for (i = 0U; i < n; i++)
+  {
+    r = pSetpoint[i];
+    y = pMeasure[i];
+
+    /* I[n] = I[n-1] + Ki * e[n] */
+    inc = pKi[i] * (r - y);
+    integ = pI[i] + inc;
+
+    /* D[n] = alpha * D[n-1] + (1 - alpha) * Kd * (dIn[n] - dIn[n-1]) */
+    dIn = (pC[i] * r) - y;
+    d = (pAlpha[i] * pD[i]) + ((1.0f - pAlpha[i]) * pKd[i] * (dIn - pDIn[i]));
+
+    /* u[n] = P[n] + I[n] + D[n] */
+    u = (pKp[i] * ((pB[i] * r) - y)) + integ + d;
+
+    /* Saturation */
+    out = (u > pMax[i]) ? pMax[i] : u;
+    out = (out < pMin[i]) ? pMin[i] : out;
+
+    /* Conditional integration: the integrator is kept when the
+       increment would push the output further into saturation */
+    integ = (((u > pMax[i]) && (inc > 0.0f)) || ((u < pMin[i]) && (inc < 0.0f))) ? pI[i] : integ;
+
+    /* Update state */
+    pI[i] = integ;
+    pDIn[i] = dIn;
+    pD[i] = d;
+
+    pOut[i] = out;
+  }
+}
+
+/**
+  @} end of PIDBank group
+ */
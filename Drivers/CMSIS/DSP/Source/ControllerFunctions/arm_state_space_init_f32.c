@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_state_space_init_f32.c
+ * Description:  Floating-point state space model initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup StateSpace
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point state space model.
+  @param[in,out] S          points to an instance of the state space structure
+  @param[in]     numStates  number of states of the model
+  @param[in]     pCoeffs    points to the coefficient array
+  @param[in]     pState     points to the state array
+  @return        none
+
+  @par           Details
+                   <code>pCoeffs</code> has a length of <code>numStates * (numStates + 2) + 1</code> values
+                   ordered as {A, B, C, D}.
+                   <code>pState</code> has a length of <code>2 * numStates</code> values and is cleared.
+ */
+void arm_state_space_init_f32(
+        arm_state_space_instance_f32 * S,
+        uint16_t numStates,
+  const float32_t * pCoeffs,
+        float32_t * pState)
+{
+  /* Assign model order */
+  S->numStates = numStates;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer, the size is always 2 * numStates */
+  memset(pState, 0, (2U * (uint32_t) numStates) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @} end of StateSpace group
+ */
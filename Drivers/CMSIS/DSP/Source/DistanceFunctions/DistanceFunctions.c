@@ -49,3 +49,10 @@
 #include "arm_sokalmichener_distance.c"
 #include "arm_sokalsneath_distance.c"
 #include "arm_yule_distance.c"
+#include "arm_distance_sqnorms_f32.c"
+#include "arm_euclidean_distance_matrix_f32.c"
+#include "arm_cosine_distance_matrix_f32.c"
+#include "arm_cityblock_distance_matrix_f32.c"
+#include "arm_hamming_distance_matrix.c"
+#include "arm_jaccard_distance_matrix.c"
+#include "arm_knn_select_f32.c"
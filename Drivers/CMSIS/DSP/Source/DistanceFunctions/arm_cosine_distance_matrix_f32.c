@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cosine_distance_matrix_f32.c
+ * Description:  Cosine distance matrix
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+#include "arm_distance_matrix_kernels.h"
+
+/**
+  @addtogroup DistanceMatrix
+  @{
+ */
+
+/**
+ * @brief        Cosine distance matrix
+ *
+ * @param[in]    pA          Vectors of the first set
+ * @param[in]    pNormA      Squared norms of the first set (\ref arm_distance_sqnorms_f32)
+ * @param[in]    numA        Number of vectors of the first set
+ * @param[in]    pB          Vectors of the second set
+ * @param[in]    pNormB      Squared norms of the second set (\ref arm_distance_sqnorms_f32)
+ * @param[in]    numB        Number of vectors of the second set
+ * @param[in]    dimension   Length of the vectors
+ * @param[out]   pDst        numA x numB distances
+ * @return none
+ *
+ * @par           Description
+ *                  Like \ref arm_cosine_distance_f32, the distance of u and v is
+ *                  1 - u . v / (Norm(u) Norm(v)).
+ */
+
+void arm_cosine_distance_matrix_f32(
+    const float32_t *pA,
+    const float32_t *pNormA,
+    uint32_t numA,
+    const float32_t *pB,
+    const float32_t *pNormB,
+    uint32_t numB,
+    uint32_t dimension,
+    float32_t *pDst)
+{
+    float32_t dot[ARM_DIST_BLOCK];
+    float32_t tmp;
+    uint32_t i, j, l;
+
+    for (i = 0U; i < numA; i++)
+    {
+        const float32_t *pRowA = pA + i * dimension;
+        const float32_t *pRowB = pB;
+
+        for (j = 0U; j + ARM_DIST_BLOCK <= numB; j += ARM_DIST_BLOCK)
+        {
+            arm_dist_dot4_f32(pRowA, pRowB, dimension, dot);
+
+            for (l = 0U; l < ARM_DIST_BLOCK; l++)
+            {
+                arm_sqrt_f32(pNormA[i] * pNormB[j + l], &tmp);
+                pDst[j + l] = 1.0f - dot[l] / tmp;
+            }
+            pRowB += ARM_DIST_BLOCK * dimension;
+        }
+
+        for (; j < numB; j++)
+        {
+            arm_dot_prod_f32(pRowA, pRowB, dimension, &dot[0]);
+
+            arm_sqrt_f32(pNormA[i] * pNormB[j], &tmp);
+            pDst[j] = 1.0f - dot[0] / tmp;
+            pRowB += dimension;
+        }
+
+        pDst += numB;
+    }
+}
+
+/**
+ * @} end of DistanceMatrix group
+ */
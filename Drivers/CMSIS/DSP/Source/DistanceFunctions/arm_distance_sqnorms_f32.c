@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_distance_sqnorms_f32.c
+ * Description:  Squared norms of a set of vectors for the distance matrices
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+
+/**
+  @addtogroup DistanceMatrix
+  @{
+ */
+
+/**
+ * @brief        Squared norms of a set of vectors
+ *
+ * @param[in]    pSrc        Vectors, one after the other
+ * @param[in]    numVectors  Number of vectors
+ * @param[in]    dimension   Length of the vectors
+ * @param[out]   pNorms      Squared norm of each vector
+ * @return none
+ *
+ * @par           Description
+ *                  The norms of a set of stored vectors (the reference signatures
+ *                  of a nearest neighbor search) can be computed once and reused
+ *                  by every \ref arm_euclidean_distance_matrix_f32 and
+ *                  \ref arm_cosine_distance_matrix_f32 call.
+ */
+
+void arm_distance_sqnorms_f32(const float32_t *pSrc, uint32_t numVectors, uint32_t dimension, float32_t *pNorms)
+{
+    while (numVectors > 0U)
+    {
+        arm_power_f32(pSrc, dimension, pNorms);
+
+        pSrc += dimension;
+        pNorms++;
+        numVectors--;
+    }
+}
+
+/**
+ * @} end of DistanceMatrix group
+ */
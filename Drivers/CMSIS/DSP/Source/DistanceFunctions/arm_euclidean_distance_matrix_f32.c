@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_euclidean_distance_matrix_f32.c
+ * Description:  Euclidean distance matrix
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+#include "arm_distance_matrix_kernels.h"
+
+/**
+ * @ingroup groupDistance
+ */
+
+/**
+  @defgroup DistanceMatrix Distance matrices and nearest neighbors
+
+  Distances between all the vectors of a set A and all the vectors of a
+  set B, for instance a measured signature against hundreds of stored ones
+  (set A of one vector) or a batch of measurements against them.
+
+  The vectors of a set are stored one after the other and the distance
+  between the vector i of A and the vector j of B is written at
+  <code>pDst[i * numB + j]</code>.
+
+  The euclidean and cosine distances are expanded so that the work is
+  a product of matrices (the dot products between the vectors) plus the
+  norms of the vectors, which are computed once by \ref arm_distance_sqnorms_f32:
+  <pre>
+      |a - b|^2 = |a|^2 + |b|^2 - 2 a.b
+  </pre>
+  Each vector of A is compared with 4 vectors of B at once, so an element
+  of A is loaded once for 4 multiply-accumulates.
+
+  The boolean distances work on the packed layout of \ref BoolDist
+  and count 32 booleans at once with a population count.
+
+  \ref arm_knn_select_f32 then selects the nearest neighbors from a row
+  of the distance matrix.
+ */
+
+/**
+  @addtogroup DistanceMatrix
+  @{
+ */
+
+/**
+ * @brief        Euclidean distance matrix
+ *
+ * @param[in]    pA          Vectors of the first set
+ * @param[in]    pNormA      Squared norms of the first set (\ref arm_distance_sqnorms_f32)
+ * @param[in]    numA        Number of vectors of the first set
+ * @param[in]    pB          Vectors of the second set
+ * @param[in]    pNormB      Squared norms of the second set (\ref arm_distance_sqnorms_f32)
+ * @param[in]    numB        Number of vectors of the second set
+ * @param[in]    dimension   Length of the vectors
+ * @param[out]   pDst        numA x numB distances
+ * @return none
+ *
+ * @par           Precision
+ *                  The expansion loses the low bits of the distances which are
+ *                  small compared to the norms of the vectors. The squared distance
+ *                  is clamped to 0 when the rounding makes it negative.
+ *                  \ref arm_euclidean_distance_f32 does not have this limitation.
+ */
+
+void arm_euclidean_distance_matrix_f32(
+    const float32_t *pA,
+    const float32_t *pNormA,
+    uint32_t numA,
+    const float32_t *pB,
+    const float32_t *pNormB,
+    uint32_t numB,
+    uint32_t dimension,
+    float32_t *pDst)
+{
+    float32_t dot[ARM_DIST_BLOCK];
+    float32_t d2;
+    uint32_t i, j, l;
+
+    for (i = 0U; i < numA; i++)
+    {
+        const float32_t *pRowA = pA + i * dimension;
+        const float32_t *pRowB = pB;
+
+        for (j = 0U; j + ARM_DIST_BLOCK <= numB; j += ARM_DIST_BLOCK)
+        {
+            arm_dist_dot4_f32(pRowA, pRowB, dimension, dot);
+
+            for (l = 0U; l < ARM_DIST_BLOCK; l++)
+            {
+                d2 = pNormA[i] + pNormB[j + l] - 2.0f * dot[l];
+                arm_sqrt_f32((d2 > 0.0f) ? d2 : 0.0f, &pDst[j + l]);
+            }
+            pRowB += ARM_DIST_BLOCK * dimension;
+        }
+
+        for (; j < numB; j++)
+        {
+            arm_dot_prod_f32(pRowA, pRowB, dimension, &dot[0]);
+
+            d2 = pNormA[i] + pNormB[j] - 2.0f * dot[0];
+            arm_sqrt_f32((d2 > 0.0f) ? d2 : 0.0f, &pDst[j]);
+            pRowB += dimension;
+        }
+
+        pDst += numB;
+    }
+}
+
+/**
+ * @} end of DistanceMatrix group
+ */
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_hamming_distance_matrix.c
+ * Description:  Hamming distance matrix of packed boolean vectors
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+#include "arm_distance_matrix_kernels.h"
+
+/**
+  @addtogroup DistanceMatrix
+  @{
+ */
+
+/**
+ * @brief        Hamming distance matrix of packed boolean vectors
+ *
+ * @param[in]    pA              Vectors of packed booleans of the first set
+ * @param[in]    numA            Number of vectors of the first set
+ * @param[in]    pB              Vectors of packed booleans of the second set
+ * @param[in]    numB            Number of vectors of the second set
+ * @param[in]    numberOfBools   Number of booleans of a vector
+ * @param[out]   pDst            numA x numB distances
+ * @return none
+ *
+ * @par           Description
+ *                  A vector takes (numberOfBools + 31) / 32 words and is packed like
+ *                  for \ref arm_hamming_distance. The distance is the number of
+ *                  differing booleans divided by numberOfBools.
+ *
+ * @par           numberOfBools must be greater than 0. Nothing is written to pDst
+ *                  when it is 0.
+ */
+
+void arm_hamming_distance_matrix(
+    const uint32_t *pA,
+    uint32_t numA,
+    const uint32_t *pB,
+    uint32_t numB,
+    uint32_t numberOfBools,
+    float32_t *pDst)
+{
+    uint32_t numWords = arm_dist_bool_words(numberOfBools);
+    uint32_t lastMask = arm_dist_bool_last_mask(numberOfBools);
+    float32_t scale;
+    uint32_t i, j, k;
+
+    if (numberOfBools == 0U)
+    {
+        return;
+    }
+
+    scale = 1.0f / (float32_t) numberOfBools;
+
+    for (i = 0U; i < numA; i++)
+    {
+        const uint32_t *pRowA = pA + i * numWords;
+        const uint32_t *pRowB = pB;
+
+        for (j = 0U; j < numB; j++)
+        {
+            uint32_t diff = 0U;
+
+            for (k = 0U; k < numWords - 1U; k++)
+            {
+                diff += arm_dist_popcount_u32(pRowA[k] ^ pRowB[k]);
+            }
+            diff += arm_dist_popcount_u32((pRowA[k] ^ pRowB[k]) & lastMask);
+
+            pDst[j] = (float32_t) diff * scale;
+            pRowB += numWords;
+        }
+
+        pDst += numB;
+    }
+}
+
+/**
+ * @} end of DistanceMatrix group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_knn_select_f32.c
+ * Description:  Selection of the nearest neighbors from a row of distances
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+
+/**
+  @addtogroup DistanceMatrix
+  @{
+ */
+
+/* Restores the max-heap of k (distance, index) pairs below node i */
+static void arm_knn_sift_f32(float32_t *pDist, uint32_t *pIndex, uint32_t k, uint32_t i)
+{
+    float32_t d = pDist[i];
+    uint32_t idx = pIndex[i];
+    uint32_t child;
+
+    while ((child = 2U * i + 1U) < k)
+    {
+        if ((child + 1U < k) && (pDist[child + 1U] > pDist[child]))
+        {
+            child++;
+        }
+        if (!(pDist[child] > d))
+        {
+            break;
+        }
+        pDist[i] = pDist[child];
+        pIndex[i] = pIndex[child];
+        i = child;
+    }
+    pDist[i] = d;
+    pIndex[i] = idx;
+}
+
+/**
+ * @brief        Nearest neighbors selection
+ *
+ * @param[in]    pSrc        Distances to the candidates (a row of a distance matrix)
+ * @param[in]    numDist     Number of candidates
+ * @param[in]    k           Number of neighbors to select
+ * @param[out]   pIndex      Indexes of the k nearest candidates
+ * @param[out]   pDist       Distances of the k nearest candidates
+ * @return       execution status
+ *                 - \ref ARM_MATH_SUCCESS        : Operation successful
+ *                 - \ref ARM_MATH_ARGUMENT_ERROR : k is 0 or greater than numDist
+ *
+ * @par           Description
+ *                  The outputs are sorted by increasing distance. The selection keeps
+ *                  a max-heap of the k nearest candidates seen so far in the outputs,
+ *                  so it reads the distances once and takes O(numDist log k).
+ *                  The order of candidates at equal distance is not specified.
+ */
+
+arm_status arm_knn_select_f32(
+    const float32_t *pSrc,
+    uint32_t numDist,
+    uint32_t k,
+    uint32_t *pIndex,
+    float32_t *pDist)
+{
+    float32_t d;
+    uint32_t i, idx;
+
+    if ((k == 0U) || (k > numDist))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (i = 0U; i < k; i++)
+    {
+        pDist[i] = pSrc[i];
+        pIndex[i] = i;
+    }
+    for (i = k / 2U; i > 0U; i--)
+    {
+        arm_knn_sift_f32(pDist, pIndex, k, i - 1U);
+    }
+
+    /* Candidates nearer than the farthest selected one replace it */
+    for (i = k; i < numDist; i++)
+    {
+        if (pSrc[i] < pDist[0])
+        {
+            pDist[0] = pSrc[i];
+            pIndex[0] = i;
+            arm_knn_sift_f32(pDist, pIndex, k, 0U);
+        }
+    }
+
+    /* Heap sort to increasing distances */
+    for (i = k - 1U; i > 0U; i--)
+    {
+        d = pDist[0];
+        idx = pIndex[0];
+        pDist[0] = pDist[i];
+        pIndex[0] = pIndex[i];
+        pDist[i] = d;
+        pIndex[i] = idx;
+        arm_knn_sift_f32(pDist, pIndex, i, 0U);
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of DistanceMatrix group
+ */
@@ -73,3 +73,10 @@
 #include "arm_atan2_f32.c"
 #include "arm_atan2_q31.c"
 #include "arm_atan2_q15.c"
+#include "arm_vsin_f32.c"
+#include "arm_vcos_f32.c"
+#include "arm_vsincos_f32.c"
+#include "arm_vatan2_f32.c"
+#include "arm_vtanh_f32.c"
+#include "arm_vsigmoid_f32.c"
+#include "arm_vsqrt_f32.c"
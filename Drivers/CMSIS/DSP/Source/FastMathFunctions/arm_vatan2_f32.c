@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vatan2_f32.c
+ * Description:  Floating-point vector arc tangent of y/x
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+#include "arm_fast_math_kernels_f32.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vecElementary
+  @{
+ */
+
+/**
+  @brief         Floating-point vector of arc tangents of y/x in the right quadrant.
+  @param[in]     pSrcY      points to the input vector of y coordinates
+  @param[in]     pSrcX      points to the input vector of x coordinates
+  @param[out]    pDst       points to the output vector of angles in [-pi, pi]
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     accuracy   accuracy tier
+  @return        none
+  @par           Unlike \ref arm_atan2_f32, the angle of (0, 0) is 0 and no
+                 status is returned.
+ */
+void arm_vatan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+        float32_t * pDst,
+        uint32_t blockSize,
+        arm_math_accuracy accuracy)
+{
+  uint32_t blkCnt = blockSize;
+
+  if (accuracy == ARM_ACCURACY_FAST)
+  {
+    while (blkCnt > 0U)
+    {
+      *pDst++ = arm_fm_atan2_f32(*pSrcY++, *pSrcX++, 0);
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while (blkCnt > 0U)
+    {
+      *pDst++ = arm_fm_atan2_f32(*pSrcY++, *pSrcX++, 1);
+      blkCnt--;
+    }
+  }
+}
+
+/**
+  @} end of vecElementary group
+ */
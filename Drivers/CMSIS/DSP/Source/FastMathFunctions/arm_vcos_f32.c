@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vcos_f32.c
+ * Description:  Floating-point vector cosine
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+#include "arm_fast_math_kernels_f32.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vecElementary
+  @{
+ */
+
+/**
+  @brief         Floating-point vector of cosine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     accuracy   accuracy tier
+  @return        none
+ */
+void arm_vcos_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        arm_math_accuracy accuracy)
+{
+  uint32_t blkCnt = blockSize;
+
+  if (accuracy == ARM_ACCURACY_FAST)
+  {
+    while (blkCnt > 0U)
+    {
+      float32_t s, c;
+
+      arm_fm_sincos_f32(*pSrc++, &s, &c, 0);
+      *pDst++ = c;
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while (blkCnt > 0U)
+    {
+      float32_t s, c;
+
+      arm_fm_sincos_f32(*pSrc++, &s, &c, 1);
+      *pDst++ = c;
+      blkCnt--;
+    }
+  }
+}
+
+/**
+  @} end of vecElementary group
+ */
@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsin_f32.c
+ * Description:  Floating-point vector sine
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+#include "arm_fast_math_kernels_f32.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vecElementary Vector Elementary Functions
+
+  Elementary functions computed on arrays of floating-point values.
+
+  Each function takes an accuracy tier:
+  - \ref ARM_ACCURACY_PRECISE computes results within a few ULP;
+  - \ref ARM_ACCURACY_FAST uses lower degree polynomials, with an
+    absolute error below 1e-4, for control loops and feature extraction
+    which do not need full single precision.
+
+  The sine and cosine reduce the argument modulo pi/2; the precise tier
+  keeps an absolute error below 1e-7 for |x| up to 8192 and below 1e-6 for
+  |x| up to 65536. The valid range of the argument is [-65536, 65536]:
+  arguments out of this range are saturated to it, and a NaN argument gives
+  a NaN result. The exponential
+  used by \ref arm_vtanh_f32 and \ref arm_vsigmoid_f32 is saturated to the
+  normal range, so large arguments give +/-1 for the hyperbolic tangent and
+  0 or 1 within 1e-38 for the sigmoid, without overflow.
+
+  The implementations only use arithmetic, comparisons, selects, integer
+  conversions and the square root: there are no other library calls and no
+  branches in the loops, so compilers vectorize them on cores with SIMD
+  units and the code runs at a constant cost per sample on cores with a
+  scalar FPU such as the Cortex-M33.
+
+  Maximum errors measured on the host against double precision:
+  <pre>
+  Function    Range               Precise              Fast (absolute)
+  vsin, vcos  [-pi, pi]           1.5 ULP              1.0e-5
+  vsin, vcos  [-8192, 8192]       9.1e-8 absolute      1.0e-5
+  vsin, vcos  [-65536, 65536]     9.6e-7 absolute      1.1e-5
+  vatan2      all                 2.9 ULP              8.6e-5
+  vtanh       all                 1.3 ULP              3.7e-5
+  vsigmoid    all                 2.3 ULP              1.9e-5
+  vsqrt       x >= 0              0.5 ULP              4.8e-6 relative
+  </pre>
+
+  The fast square root replaces the hardware square root by a reciprocal
+  square root estimate and two Newton steps: it is only faster on cores
+  without a floating-point square root instruction.
+ */
+
+/**
+  @addtogroup vecElementary
+  @{
+ */
+
+/**
+  @brief         Floating-point vector of sine values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     accuracy   accuracy tier
+  @return        none
+ */
+void arm_vsin_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        arm_math_accuracy accuracy)
+{
+  uint32_t blkCnt = blockSize;
+
+  if (accuracy == ARM_ACCURACY_FAST)
+  {
+    while (blkCnt > 0U)
+    {
+      float32_t s, c;
+
+      arm_fm_sincos_f32(*pSrc++, &s, &c, 0);
+      *pDst++ = s;
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while (blkCnt > 0U)
+    {
+      float32_t s, c;
+
+      arm_fm_sincos_f32(*pSrc++, &s, &c, 1);
+      *pDst++ = s;
+      blkCnt--;
+    }
+  }
+}
+
+/**
+  @} end of vecElementary group
+ */
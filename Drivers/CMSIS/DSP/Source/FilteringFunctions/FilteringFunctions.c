@@ -40,6 +40,9 @@
 #include "arm_biquad_cascade_df2T_f64.c"
 #include "arm_biquad_cascade_df2T_init_f32.c"
 #include "arm_biquad_cascade_df2T_init_f64.c"
+#include "arm_biquad_cascade_df2T_swap_f32.c"
+#include "arm_biquad_cascade_df2T_swap_init_f32.c"
+#include "arm_biquad_cascade_df2T_swap_update_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_init_f32.c"
 #include "arm_conv_f32.c"
@@ -134,6 +137,13 @@
 #include "arm_lms_norm_q31.c"
 #include "arm_lms_q15.c"
 #include "arm_lms_q31.c"
+#include "arm_rls_init_f32.c"
+#include "arm_rls_f32.c"
+#include "arm_fdaf_init_f32.c"
+#include "arm_fdaf_f32.c"
 
 #include "arm_levinson_durbin_f32.c"
 #include "arm_levinson_durbin_q31.c"
+
+#include "arm_kalman_f32.c"
+#include "arm_kalman_init_f32.c"
@@ -0,0 +1,223 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_df2T_swap_f32.c
+ * Description:  Processing function for floating-point transposed direct form II Biquad cascade filter
+ *               with double-buffered coefficients
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+*/
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @par           Runtime coefficient update
+                   The arm_biquad_cascade_df2T_swap_f32() variant lets the coefficients be changed
+                   while the filter is running, without resetting the state.
+                   Two coefficient banks are kept in the instance. The processing function works on
+                   the active bank while arm_biquad_cascade_df2T_swap_update_f32() writes the new
+                   coefficients into the other one. The switch happens at the start of the next block.
+  @par
+                   When <code>interpolate</code> is set in the instance, the block following an update
+                   is filtered with coefficients that move linearly, sample by sample, from the old
+                   bank to the new one. This avoids the click caused by an abrupt change in the
+                   recursive part of the filter. Since the stability domain of (a1, a2) is convex,
+                   interpolating between two stable sections gives stable sections.
+  @par
+                   The update function and the processing function can run in different contexts
+                   (for instance a task and an interrupt) on the same core. Only one context may
+                   call the update function and only one context may call the processing function.
+                   An update is refused with ARM_MATH_BUSY while the previous one has not been
+                   taken into account by the processing function.
+  @par
+                   The accesses to the banks are ordered with the <code>pending</code> flag by data
+                   memory barriers (__DMB()) in both functions: the processing function only reads
+                   a bank after it has seen the flag set, and only clears the flag after its last read
+                   of the old bank.
+ */
+
+/**
+  @brief         Processing function for the floating-point transposed direct form II Biquad cascade filter
+                 with double-buffered coefficients.
+  @param[in,out] S         points to an instance of the filter data structure
+  @param[in]     pSrc      points to the block of input data
+  @param[out]    pDst      points to the block of output data
+  @param[in]     blockSize number of samples to process
+  @return        none
+
+  @par           Neon
+                   With Neon, the coefficient banks use the standard layout. The filtering is done
+                   by the scalar code of this function instead of the Neon kernel.
+ */
+void arm_biquad_cascade_df2T_swap_f32(
+        arm_biquad_cascade_df2T_swap_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        float32_t *pOut = pDst;                        /* Destination pointer */
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pOld;                               /* Coefficients at the start of the block */
+  const float32_t *pNew;                               /* Coefficients at the end of the block */
+        float32_t acc1;                                /* Accumulator */
+        float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+        float32_t db0, db1, db2, da1, da2;             /* Coefficient increments */
+        float32_t Xn1;                                 /* Temporary input */
+        float32_t d1, d2;                              /* State variables */
+        float32_t invBlockSize;                        /* Interpolation step */
+        uint32_t sample, stage = S->numStages;         /* Loop counters */
+        uint32_t active = S->activeBank;               /* Bank in use */
+        uint32_t pending = S->pending;                 /* An update is waiting */
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  pOld = S->pCoeffs + active * 5U * stage;
+
+  if (pending)
+  {
+    active ^= 1U;
+
+    /* The coefficients of the new bank are read after the flag */
+    __DMB();
+  }
+
+  pNew = S->pCoeffs + active * 5U * stage;
+
+#if !defined(ARM_MATH_NEON)
+  if (!pending || !S->interpolate)
+  {
+    arm_biquad_cascade_df2T_instance_f32 filt;
+
+    filt.numStages = S->numStages;
+    filt.pState = pState;
+    filt.pCoeffs = pNew;
+
+    arm_biquad_cascade_df2T_f32(&filt, pSrc, pDst, blockSize);
+  }
+  else
+#endif
+  {
+    /* When there is no interpolation, old and new coefficients are the same */
+    if (!S->interpolate)
+    {
+      pOld = pNew;
+    }
+
+    invBlockSize = 1.0f / (float32_t) blockSize;
+
+    do
+    {
+       /* Reading the coefficients */
+       b0 = pOld[0];
+       b1 = pOld[1];
+       b2 = pOld[2];
+       a1 = pOld[3];
+       a2 = pOld[4];
+
+       /* Increments reaching the new coefficients on the last sample */
+       db0 = (pNew[0] - b0) * invBlockSize;
+       db1 = (pNew[1] - b1) * invBlockSize;
+       db2 = (pNew[2] - b2) * invBlockSize;
+       da1 = (pNew[3] - a1) * invBlockSize;
+       da2 = (pNew[4] - a2) * invBlockSize;
+
+       /* Reading the state values */
+       d1 = pState[0];
+       d2 = pState[1];
+
+       pOld += 5U;
+       pNew += 5U;
+
+       sample = blockSize;
+
+       while (sample > 0U)
+       {
+         b0 += db0;
+         b1 += db1;
+         b2 += db2;
+         a1 += da1;
+         a2 += da2;
+
+         /* Read the input */
+         Xn1 = *pIn++;
+
+         /* y[n] = b0 * x[n] + d1 */
+         acc1 = (b0 * Xn1) + d1;
+
+         /* Store the result in the accumulator in the destination buffer. */
+         *pOut++ = acc1;
+
+         /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+         d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+
+         /* d2 = b2 * x[n] + a2 * y[n] */
+         d2 = (b2 * Xn1) + (a2 * acc1);
+
+         /* decrement the loop counter */
+         sample--;
+       }
+
+       /* Store the updated state variables back into the state array */
+       *pState++ = d1;
+       *pState++ = d2;
+
+       /* The current stage output is given as the input to the next stage */
+       pIn = pDst;
+
+       /* Reset the output working pointer */
+       pOut = pDst;
+
+       /* decrement the loop counter */
+       stage--;
+
+    } while (stage > 0U);
+  }
+
+  if (pending)
+  {
+    /* The new bank is published before the update function is allowed
+       to write into the old one */
+    S->activeBank = active;
+
+    /* The old bank is no longer read when the update function sees the flag cleared */
+    __DMB();
+
+    S->pending = 0U;
+  }
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_df2T_swap_init_f32.c
+ * Description:  Initialization function for floating-point transposed direct form II Biquad cascade filter
+ *               with double-buffered coefficients
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point transposed direct form II Biquad cascade filter
+                 with double-buffered coefficients.
+  @param[in,out] S            points to an instance of the filter data structure.
+  @param[in]     numStages    number of 2nd order stages in the filter.
+  @param[in]     pCoeffs      points to the initial filter coefficients.
+  @param[in]     pCoeffBanks  points to the coefficient banks.
+  @param[in]     pState       points to the state buffer.
+  @param[in]     interpolate  when non zero, the coefficients are interpolated over the block
+                              following an update.
+  @return        none
+
+  @par           Coefficient and State Ordering
+                   <code>pCoeffs</code> uses the same ordering as for arm_biquad_cascade_df2T_init_f32():
+  <pre>
+      {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+  </pre>
+  @par
+                   It is copied into both banks so the array can be released after the initialization.
+                   <code>pCoeffBanks</code> must have a length of <code>10*numStages</code> values.
+                   It is owned by the instance and must not be written by the caller.
+  @par
+                   The state array has a total length of <code>2*numStages</code> values and is cleared.
+ */
+void arm_biquad_cascade_df2T_swap_init_f32(
+        arm_biquad_cascade_df2T_swap_instance_f32 * S,
+        uint8_t numStages,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffBanks,
+        float32_t * pState,
+        uint8_t interpolate)
+{
+  /* Assign filter stages */
+  S->numStages = numStages;
+  S->interpolate = interpolate;
+
+  /* Both banks start with the same coefficients */
+  memcpy(pCoeffBanks, pCoeffs, (5U * (uint32_t) numStages) * sizeof(float32_t));
+  memcpy(pCoeffBanks + 5U * (uint32_t) numStages, pCoeffs, (5U * (uint32_t) numStages) * sizeof(float32_t));
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffBanks;
+  S->activeBank = 0U;
+  S->pending = 0U;
+
+  /* Clear state buffer and size is always 2 * numStages */
+  memset(pState, 0, (2U * (uint32_t) numStages) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_df2T_swap_update_f32.c
+ * Description:  Coefficient update for floating-point transposed direct form II Biquad cascade filter
+ *               with double-buffered coefficients
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Publish new coefficients for the floating-point transposed direct form II Biquad cascade filter
+                 with double-buffered coefficients.
+  @param[in,out] S        points to an instance of the filter data structure.
+  @param[in]     pCoeffs  points to the new filter coefficients.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS : the coefficients will be used from the next block
+                   - \ref ARM_MATH_BUSY    : the previous update is still pending, nothing was written
+
+  @par           Details
+                   The coefficients are written into the bank which is not used by the processing
+                   function. The state is not modified.
+                   A data memory barrier is executed between the read of <code>pending</code> and the
+                   writes to the bank, and between the writes to the bank and the store publishing the
+                   update, so that neither the compiler nor the core can reorder them.
+ */
+arm_status arm_biquad_cascade_df2T_swap_update_f32(
+        arm_biquad_cascade_df2T_swap_instance_f32 * S,
+  const float32_t * pCoeffs)
+{
+  float32_t *pBank;                             /* Bank not used by the filter */
+  uint32_t i, n = 5U * (uint32_t) S->numStages;  /* Number of coefficients */
+
+  /* The processing function has not yet switched to the last bank written */
+  if (S->pending)
+  {
+    return ARM_MATH_BUSY;
+  }
+
+  /* The filter has stopped reading the inactive bank before it cleared pending */
+  __DMB();
+
+  pBank = S->pCoeffs + (S->activeBank ^ 1U) * n;
+
+  for (i = 0U; i < n; i++)
+  {
+    pBank[i] = pCoeffs[i];
+  }
+
+  /* The new coefficients are written before the update is published */
+  __DMB();
+
+  S->pending = 1U;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
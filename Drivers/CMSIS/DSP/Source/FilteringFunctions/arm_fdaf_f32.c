@@ -0,0 +1,251 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_f32.c
+ * Description:  Floating-point frequency-domain block LMS filter
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FDAF Frequency-Domain Block LMS Filters
+
+  Frequency-domain adaptive filter: normalized block LMS filter computed
+  with real FFTs (constrained overlap-save algorithm).
+
+  The LMS filters cost <code>2*numTaps</code> multiply-accumulates per
+  sample. The frequency-domain block LMS filter processes blocks of
+  <code>numTaps</code> samples with a few real FFTs of length
+  <code>2*numTaps</code>, so its cost per sample grows with
+  <code>log2(numTaps)</code> only. It is intended for long filters
+  (from 64 taps or so), for instance acoustic echo or noise paths.
+
+  The step size of each frequency bin is normalized by a running estimate
+  of the power of the input in this bin. The convergence is then much less
+  dependent on the spectrum of the input than with the time-domain LMS filters.
+
+  @par           Algorithm
+                   For each block of <code>N = numTaps</code> input samples,
+                   with <code>X</code> the spectrum of the last <code>2N</code> input samples:
+  <pre>
+      P = beta * P + (1 - beta) * |X|^2
+      y = last N samples of IFFT(X * W)
+      e = d - y
+      E = FFT([0, e])
+      G = mu * conj(X) * E / (P + delta)
+      W = W + FFT([first N samples of IFFT(G), 0])
+  </pre>
+  @par
+                   The output is identical to the one of an FIR filter whose
+                   coefficients are updated once per block. The last step
+                   (gradient constraint) keeps the coefficients of a linear,
+                   and not circular, convolution of <code>N</code> taps.
+                   The filter introduces no delay: the block length equals the
+                   number of taps, and the block of output is computed from
+                   the block of input of the same call.
+
+  @par           Channels
+                   The spectrum <code>X</code> and its power estimate only depend on the
+                   input signal. With <code>numChannels</code> channels, the filters of the
+                   channels adapt to different reference signals from the same input signal
+                   (for instance the signals of several error microphones in active noise control).
+                   The FFT of the input and the power estimate are computed once for all
+                   the channels. Each channel costs 4 real FFTs per block.
+                   The reference, output and error arrays contain the blocks of
+                   <code>blockSize</code> values of the channels one after the other.
+
+  @par           Memory
+                   All buffers come from a single arena provided to
+                   arm_fdaf_init_f32. Its size, in float32_t words, is
+                   returned by arm_fdaf_get_buffer_size_f32.
+ */
+
+/**
+  @addtogroup FDAF
+  @{
+ */
+
+/*
+   pDst = pA * pB (conj(pA) * pB when conj is set) on spectra in the
+   packed format of arm_rfft_fast_f32: DC and Nyquist real values first,
+   then the complex bins 1 to fftLen/2-1.
+ */
+static void arm_fdaf_spectrum_mult_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+        float32_t * pDst,
+        uint32_t numBins,
+        int32_t conj)
+{
+  float32_t aR, aI, bR, bI;
+  uint32_t k;
+
+  pDst[0] = pA[0] * pB[0];
+  pDst[1] = pA[1] * pB[1];
+
+  for (k = 1U; k < numBins; k++)
+  {
+    aR = pA[2 * k];
+    aI = conj ? -pA[2 * k + 1] : pA[2 * k + 1];
+    bR = pB[2 * k];
+    bI = pB[2 * k + 1];
+
+    pDst[2 * k]     = aR * bR - aI * bI;
+    pDst[2 * k + 1] = aR * bI + aI * bR;
+  }
+}
+
+/*
+   Process one block of numTaps samples
+ */
+static void arm_fdaf_block_f32(
+        arm_fdaf_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr,
+        uint32_t refStride)
+{
+  uint32_t N = S->numTaps;
+  uint32_t fftLen = 2U * N;
+  float32_t *pX = S->pSpectrum;
+  float32_t *pP = S->pPower;
+  float32_t *pA = S->pTmpA;
+  float32_t *pB = S->pTmpB;
+  float32_t *pW = S->pCoeffs;
+  float32_t beta, scale, re, im, e;
+  uint32_t k, ch;
+
+  /* Input buffer holds the previous and the current blocks */
+  memcpy(S->pInput, S->pInput + N, N * sizeof(float32_t));
+  memcpy(S->pInput + N, pSrc, N * sizeof(float32_t));
+
+  memcpy(pA, S->pInput, fftLen * sizeof(float32_t));
+  arm_rfft_fast_f32(&(S->rfft), pA, pX, 0);
+
+  /* Power estimate: running mean of the first blocks, then smoothed */
+  beta = S->beta;
+  if (S->blockCount < 0xFFFFU)
+  {
+    S->blockCount++;
+    scale = 1.0f - 1.0f / (float32_t)S->blockCount;
+    if (scale < beta)
+    {
+      beta = scale;
+    }
+  }
+
+  pP[0] = beta * pP[0] + (1.0f - beta) * (pX[0] * pX[0]);
+  pP[N] = beta * pP[N] + (1.0f - beta) * (pX[1] * pX[1]);
+  for (k = 1U; k < N; k++)
+  {
+    re = pX[2 * k];
+    im = pX[2 * k + 1];
+    pP[k] = beta * pP[k] + (1.0f - beta) * (re * re + im * im);
+  }
+
+  for (ch = 0U; ch < S->numChannels; ch++)
+  {
+    /* Output: last N samples of the circular convolution */
+    arm_fdaf_spectrum_mult_f32(pX, pW, pA, N, 0);
+    arm_rfft_fast_f32(&(S->rfft), pA, pB, 1);
+
+    memset(pA, 0, N * sizeof(float32_t));
+    for (k = 0U; k < N; k++)
+    {
+      pOut[k] = pB[N + k];
+      e = pRef[k] - pB[N + k];
+      pErr[k] = e;
+      pA[N + k] = e;
+    }
+
+    /* Normalized gradient */
+    arm_rfft_fast_f32(&(S->rfft), pA, pB, 0);
+    arm_fdaf_spectrum_mult_f32(pX, pB, pB, N, 1);
+
+    pB[0] *= S->mu / (pP[0] + S->delta);
+    pB[1] *= S->mu / (pP[N] + S->delta);
+    for (k = 1U; k < N; k++)
+    {
+      scale = S->mu / (pP[k] + S->delta);
+      pB[2 * k] *= scale;
+      pB[2 * k + 1] *= scale;
+    }
+
+    /* Gradient constraint: keep the first N taps */
+    arm_rfft_fast_f32(&(S->rfft), pB, pA, 1);
+    memset(pA + N, 0, N * sizeof(float32_t));
+    arm_rfft_fast_f32(&(S->rfft), pA, pB, 0);
+
+    arm_add_f32(pW, pB, pW, fftLen);
+
+    pW += fftLen;
+    pRef += refStride;
+    pOut += refStride;
+    pErr += refStride;
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point frequency-domain block LMS filter.
+  @param[in,out] S          points to an instance of the floating-point frequency-domain block LMS filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     pRef       points to the blocks of reference data of the channels
+  @param[out]    pOut       points to the blocks of output data of the channels
+  @param[out]    pErr       points to the blocks of error data of the channels
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           <code>blockSize</code> must be a multiple of <code>numTaps</code>.
+                 Remaining samples are not processed.
+ */
+void arm_fdaf_f32(
+        arm_fdaf_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize / S->numTaps;
+
+  while (blkCnt > 0U)
+  {
+    arm_fdaf_block_f32(S, pSrc, pRef, pOut, pErr, blockSize);
+
+    pSrc += S->numTaps;
+    pRef += S->numTaps;
+    pOut += S->numTaps;
+    pErr += S->numTaps;
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of FDAF group
+ */
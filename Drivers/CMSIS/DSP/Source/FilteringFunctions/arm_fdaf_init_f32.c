@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_init_f32.c
+ * Description:  Floating-point frequency-domain block LMS filter initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @addtogroup FDAF
+  @{
+ */
+
+/**
+  @brief         Size of the arena needed by the floating-point frequency-domain block LMS filter.
+  @param[in]     numTaps      number of coefficients of each channel
+  @param[in]     numChannels  number of channels
+  @return        arena size in float32_t words
+
+  @par           The arena contains the input buffer, its spectrum and two
+                 working buffers (<code>2*numTaps</code> words each), the
+                 power estimate (<code>numTaps+1</code> words) and the
+                 frequency-domain coefficients of the channels
+                 (<code>2*numTaps*numChannels</code> words).
+ */
+uint32_t arm_fdaf_get_buffer_size_f32(
+  uint16_t numTaps,
+  uint16_t numChannels)
+{
+  return (9U * (uint32_t)numTaps + 1U + 2U * (uint32_t)numTaps * numChannels);
+}
+
+/**
+  @brief         Initialization function for the floating-point frequency-domain block LMS filter.
+  @param[out]    S            points to an instance of the floating-point frequency-domain block LMS filter structure
+  @param[in]     numTaps      number of coefficients of each channel
+  @param[in]     numChannels  number of channels
+  @param[in]     mu           step size that controls filter coefficient updates
+  @param[in]     beta         smoothing factor of the power estimate
+  @param[in]     pBuffer      points to the arena of arm_fdaf_get_buffer_size_f32() words
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : numChannels is 0 or 2*numTaps is not a supported length
+
+  @par           Details
+                   <code>2*numTaps</code> is one of the lengths supported by
+                   arm_rfft_fast_init_f32, so <code>numTaps</code> is a power
+                   of 2 between 16 and 2048.
+                   The coefficients start at zero.
+                   <code>mu</code> is normalized by the input power: values
+                   between 0.1 and 1 are typical.
+                   <code>beta</code> is between 0 and 1, for instance 0.9:
+                   the power estimate averages the last <code>1/(1-beta)</code>
+                   blocks. The regularization <code>delta</code> of the power
+                   estimate is set to 1e-10 and can be changed in the
+                   instance after the initialization.
+ */
+arm_status arm_fdaf_init_f32(
+        arm_fdaf_instance_f32 * S,
+        uint16_t numTaps,
+        uint16_t numChannels,
+        float32_t mu,
+        float32_t beta,
+        float32_t * pBuffer)
+{
+  arm_status status;
+  uint32_t fftLen = 2U * (uint32_t)numTaps;
+
+  if ((numChannels == 0U) || (fftLen > 0xFFFFU))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_rfft_fast_init_f32(&(S->rfft), (uint16_t)fftLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->numTaps = numTaps;
+  S->numChannels = numChannels;
+  S->mu = mu;
+  S->beta = beta;
+  S->delta = 1.0e-10f;
+
+  S->pInput = pBuffer;
+  S->pSpectrum = pBuffer + fftLen;
+  S->pTmpA = pBuffer + 2U * fftLen;
+  S->pTmpB = pBuffer + 3U * fftLen;
+  S->pPower = pBuffer + 4U * fftLen;
+  S->pCoeffs = S->pPower + numTaps + 1U;
+  S->blockCount = 0U;
+
+  memset(S->pInput, 0, fftLen * sizeof(float32_t));
+  memset(S->pPower, 0, (numTaps + 1U) * sizeof(float32_t));
+  memset(S->pCoeffs, 0, fftLen * numChannels * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @brief         Time-domain coefficients of a channel of the floating-point frequency-domain block LMS filter.
+  @param[in,out] S        points to an instance of the floating-point frequency-domain block LMS filter structure
+  @param[in]     channel  channel index
+  @param[out]    pCoeffs  points to the numTaps coefficients in time reversed order
+  @return        none
+
+  @par           The coefficients are in the order of arm_lms_f32 and
+                 arm_fir_f32, so that the adapted filter can be run with
+                 these functions. The working buffers of the instance are
+                 used: the function must not be called during arm_fdaf_f32.
+ */
+void arm_fdaf_get_coeffs_f32(
+        arm_fdaf_instance_f32 * S,
+        uint16_t channel,
+        float32_t * pCoeffs)
+{
+  uint32_t fftLen = 2U * (uint32_t)S->numTaps;
+  uint32_t k;
+
+  memcpy(S->pTmpA, S->pCoeffs + channel * fftLen, fftLen * sizeof(float32_t));
+  arm_rfft_fast_f32(&(S->rfft), S->pTmpA, S->pTmpB, 1);
+
+  for (k = 0U; k < S->numTaps; k++)
+  {
+    pCoeffs[S->numTaps - 1U - k] = S->pTmpB[k];
+  }
+}
+
+/**
+  @} end of FDAF group
+ */
@@ -0,0 +1,371 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_f32.c
+ * Description:  Floating-point Kalman filter predict and update
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup Kalman Kalman Filter
+
+  Predict and update steps of a Kalman filter with <code>n</code> states
+  and <code>m</code> measurements.
+
+  The predict step propagates the state <code>x</code> and its covariance <code>P</code>
+  through the transition matrix <code>F</code> with process noise <code>Q</code>:
+  <pre>
+      x = F * x
+      P = F * P * F' + Q
+  </pre>
+  The update step corrects them with a measurement <code>z</code> observed through
+  <code>H</code> with measurement noise <code>R</code>:
+  <pre>
+      y = z - H * x
+      S = H * P * H' + R
+      K = P * H' * inv(S)
+      x = x + K * y
+      P = (I - K * H) * P * (I - K * H)' + K * R * K'
+  </pre>
+  The covariance update uses the Joseph form which keeps <code>P</code> symmetric
+  and positive definite in single precision, even when the gain is not exactly optimal.
+
+  @par           Implementation
+                   <code>S</code> is never inverted. It is factored with \ref arm_mat_cholesky_f32
+                   and the gain is obtained with two triangular solves.
+                   Since <code>P</code>, <code>S</code> and the updated covariance are symmetric,
+                   only their lower triangle is computed. The upper triangle of <code>P</code> is
+                   then mirrored so that <code>P</code> stays exactly symmetric.
+                   All the temporaries live in the work buffer given to \ref arm_kalman_init_f32.
+
+  @par           Cost
+                   Counted from the matrix operations, a prediction takes about
+                   <code>1.5*n^3 + 1.5*n^2</code> multiply-accumulates and an update about
+                   <code>1.5*n^3 + 2.5*m*n^2 + 2.5*m^2*n + m^3/6</code> multiply-accumulates,
+                   plus <code>m</code> square roots and <code>O(n^2)</code> copies.
+                   For <code>n = 6</code> and <code>m = 3</code>, this is 378 and 734.
+
+  @par           Extended Kalman filter
+                   For an EKF, the application propagates the state with its non-linear model
+                   and calls \ref arm_kalman_predict_cov_f32 with the Jacobian of the model.
+                   It then computes the innovation <code>z - h(x)</code> and calls
+                   \ref arm_kalman_update_innov_f32 with the Jacobian of <code>h</code>.
+
+  @par           Matrix layout
+                   Matrices are row-major \ref arm_matrix_instance_f32 structures:
+                   <code>F</code> and <code>Q</code> are <code>n x n</code>,
+                   <code>H</code> is <code>m x n</code> and <code>R</code> is <code>m x m</code>.
+                   <code>Q</code> and <code>R</code> must be symmetric.
+ */
+
+/**
+  @addtogroup Kalman
+  @{
+ */
+
+/*
+   pC = pC + pA * pB' for a product known to be symmetric.
+   pA and pB have numRows rows of numCols values.
+   Only the lower triangle of pC is updated.
+ */
+static void arm_kalman_sym_mult_trans_acc_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+        float32_t * pC,
+        uint32_t numRows,
+        uint32_t numCols)
+{
+  const float32_t *pRowA, *pRowB;
+        float32_t sum;
+        uint32_t i, j, k;
+
+  for (i = 0U; i < numRows; i++)
+  {
+    pRowA = pA + i * numCols;
+    pRowB = pB;
+
+    for (j = 0U; j <= i; j++)
+    {
+      sum = 0.0f;
+      for (k = 0U; k < numCols; k++)
+      {
+        sum += pRowA[k] * pRowB[k];
+      }
+      pC[i * numRows + j] += sum;
+
+      pRowB += numCols;
+    }
+  }
+}
+
+/* Copy the lower triangle of a square matrix to its upper triangle */
+static void arm_kalman_sym_mirror_f32(
+  float32_t * pC,
+  uint32_t n)
+{
+  uint32_t i, j;
+
+  for (i = 1U; i < n; i++)
+  {
+    for (j = 0U; j < i; j++)
+    {
+      pC[j * n + i] = pC[i * n + j];
+    }
+  }
+}
+
+/**
+  @brief         Kalman filter covariance prediction.
+  @param[in,out] S          points to an instance of the Kalman filter structure
+  @param[in]     pF         points to the transition matrix (or its Jacobian)
+  @param[in]     pQ         points to the process noise covariance
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Computes <code>P = F * P * F' + Q</code> and leaves the state unchanged.
+ */
+arm_status arm_kalman_predict_cov_f32(
+        arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pF,
+  const arm_matrix_instance_f32 * pQ)
+{
+  uint32_t n = S->numStates;
+  float32_t *pFP = S->pScratch + 2U * S->numMeas * (n + S->numMeas);
+  arm_matrix_instance_f32 P, FP;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pF->numRows != n) || (pF->numCols != n) ||
+      (pQ->numRows != n) || (pQ->numCols != n)   )
+  {
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  arm_mat_init_f32(&P, n, n, S->pCov);
+  arm_mat_init_f32(&FP, n, n, pFP);
+
+  /* FP = F * P */
+  arm_mat_mult_f32(pF, &P, &FP);
+
+  /* P = Q + FP * F', lower triangle */
+  arm_copy_f32(pQ->pData, S->pCov, n * n);
+  arm_kalman_sym_mult_trans_acc_f32(pFP, pF->pData, S->pCov, n, n);
+  arm_kalman_sym_mirror_f32(S->pCov, n);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @brief         Kalman filter prediction.
+  @param[in,out] S          points to an instance of the Kalman filter structure
+  @param[in]     pF         points to the transition matrix
+  @param[in]     pQ         points to the process noise covariance
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Computes <code>x = F * x</code> and <code>P = F * P * F' + Q</code>.
+ */
+arm_status arm_kalman_predict_f32(
+        arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pF,
+  const arm_matrix_instance_f32 * pQ)
+{
+  uint32_t n = S->numStates;
+  float32_t *pTmp = S->pScratch + 2U * S->numMeas * (n + S->numMeas) + n * n;
+  arm_status status;
+
+  status = arm_kalman_predict_cov_f32(S, pF, pQ);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    /* x = F * x */
+    arm_mat_vec_mult_f32(pF, S->pState, pTmp);
+    arm_copy_f32(pTmp, S->pState, n);
+  }
+
+  return (status);
+}
+
+/**
+  @brief         Kalman filter update from an innovation.
+  @param[in,out] S          points to an instance of the Kalman filter structure
+  @param[in]     pH         points to the observation matrix (or its Jacobian)
+  @param[in]     pR         points to the measurement noise covariance
+  @param[in]     pInnov     points to the innovation <code>z - H * x</code> (m values)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH          : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE  : Innovation covariance is not positive definite
+
+  @par           The state and covariance are left unchanged when
+                   <code>H * P * H' + R</code> cannot be factored.
+ */
+arm_status arm_kalman_update_innov_f32(
+        arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pH,
+  const arm_matrix_instance_f32 * pR,
+  const float32_t * pInnov)
+{
+  uint32_t n = S->numStates;
+  uint32_t m = S->numMeas;
+  float32_t *pHP = S->pScratch;                 /* H * P, then K', then K * R */
+  float32_t *pS = pHP + m * n;                  /* Innovation covariance, then L' */
+  float32_t *pL = pS + m * m;                   /* Cholesky factor of S */
+  float32_t *pY = pL + m * m;                   /* Forward substitution result, then K */
+  float32_t *pA = pY + m * n;                   /* I - K * H */
+  float32_t *pAP = pA + n * n;                  /* (I - K * H) * P */
+  arm_matrix_instance_f32 P, HP, Sm, L, Y, Kt, K, KR, A, AP;
+  float32_t sum;
+  uint32_t i, j;
+  arm_status status;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pH->numRows != m) || (pH->numCols != n) ||
+      (pR->numRows != m) || (pR->numCols != m)   )
+  {
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  arm_mat_init_f32(&P, n, n, S->pCov);
+  arm_mat_init_f32(&HP, m, n, pHP);
+  arm_mat_init_f32(&Sm, m, m, pS);
+  arm_mat_init_f32(&L, m, m, pL);
+  arm_mat_init_f32(&Y, m, n, pY);
+
+  /* HP = H * P, which is also (P * H')' since P is symmetric */
+  arm_mat_mult_f32(pH, &P, &HP);
+
+  /* S = R + HP * H', lower triangle */
+  arm_copy_f32(pR->pData, pS, m * m);
+  arm_kalman_sym_mult_trans_acc_f32(pHP, pH->pData, pS, m, n);
+
+  /* S = L * L' */
+  status = arm_mat_cholesky_f32(&Sm, &L);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  /* K' = inv(S) * HP = inv(L') * inv(L) * HP */
+  arm_mat_trans_f32(&L, &Sm);
+  arm_mat_solve_lower_triangular_f32(&L, &HP, &Y);
+  arm_mat_init_f32(&Kt, m, n, pHP);
+  arm_mat_solve_upper_triangular_f32(&Sm, &Y, &Kt);
+
+  /* x = x + K * y */
+  for (i = 0U; i < n; i++)
+  {
+    sum = 0.0f;
+    for (j = 0U; j < m; j++)
+    {
+      sum += pHP[j * n + i] * pInnov[j];
+    }
+    S->pState[i] += sum;
+  }
+
+  /* K, then KR = K * R */
+  arm_mat_init_f32(&K, n, m, pY);
+  arm_mat_trans_f32(&Kt, &K);
+  arm_mat_init_f32(&KR, n, m, pHP);
+  arm_mat_mult_f32(&K, pR, &KR);
+
+  /* A = I - K * H */
+  arm_mat_init_f32(&A, n, n, pA);
+  arm_mat_mult_f32(&K, pH, &A);
+  arm_negate_f32(pA, pA, n * n);
+  for (i = 0U; i < n; i++)
+  {
+    pA[i * n + i] += 1.0f;
+  }
+
+  /* AP = A * P */
+  arm_mat_init_f32(&AP, n, n, pAP);
+  arm_mat_mult_f32(&A, &P, &AP);
+
+  /* P = AP * A' + K * R * K', lower triangle then mirrored */
+  arm_fill_f32(0.0f, S->pCov, n * n);
+  arm_kalman_sym_mult_trans_acc_f32(pAP, pA, S->pCov, n, n);
+  arm_kalman_sym_mult_trans_acc_f32(pY, pHP, S->pCov, n, m);
+  arm_kalman_sym_mirror_f32(S->pCov, n);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @brief         Kalman filter update.
+  @param[in,out] S          points to an instance of the Kalman filter structure
+  @param[in]     pH         points to the observation matrix
+  @param[in]     pR         points to the measurement noise covariance
+  @param[in]     pZ         points to the measurement (m values)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH          : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE  : Innovation covariance is not positive definite
+
+  @par           Computes the innovation <code>z - H * x</code> and calls \ref arm_kalman_update_innov_f32.
+ */
+arm_status arm_kalman_update_f32(
+        arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pH,
+  const arm_matrix_instance_f32 * pR,
+  const float32_t * pZ)
+{
+  uint32_t n = S->numStates;
+  uint32_t m = S->numMeas;
+  float32_t *pInnov = S->pScratch + 2U * m * (n + m) + 2U * n * n;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pH->numRows != m) || (pH->numCols != n))
+  {
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  /* y = z - H * x */
+  arm_mat_vec_mult_f32(pH, S->pState, pInnov);
+  arm_sub_f32(pZ, pInnov, pInnov, m);
+
+  return (arm_kalman_update_innov_f32(S, pH, pR, pInnov));
+}
+
+/**
+  @} end of Kalman group
+ */
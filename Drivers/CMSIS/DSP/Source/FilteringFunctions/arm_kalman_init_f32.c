@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_init_f32.c
+ * Description:  Floating-point Kalman filter initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @addtogroup Kalman
+  @{
+ */
+
+/**
+  @brief         Size of the work buffer of the floating-point Kalman filter.
+  @param[in]     numStates  number of states n
+  @param[in]     numMeas    number of measurements m
+  @return        number of float32_t values of the work buffer
+
+  @par           The buffer holds <code>2*n*n + 2*m*n + 2*m*m + m</code> values
+                   and is shared by the predict and update steps.
+ */
+uint32_t arm_kalman_get_buffer_size_f32(
+  uint16_t numStates,
+  uint16_t numMeas)
+{
+  uint32_t n = numStates;
+  uint32_t m = numMeas;
+
+  return (2U * n * n + 2U * m * (n + m) + m);
+}
+
+/**
+  @brief         Initialization function for the floating-point Kalman filter.
+  @param[in,out] S          points to an instance of the Kalman filter structure
+  @param[in]     numStates  number of states n
+  @param[in]     numMeas    number of measurements m
+  @param[in]     pState     points to the state vector of n values
+  @param[in]     pCov       points to the n x n state covariance matrix
+  @param[in]     pScratch   points to the work buffer
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numStates</code> or <code>numMeas</code> is zero
+
+  @par           Details
+                   <code>pState</code> and <code>pCov</code> must contain the initial estimate
+                   and are updated in place by the filter. <code>pCov</code> must be symmetric.
+                   <code>pScratch</code> must hold \ref arm_kalman_get_buffer_size_f32 values.
+ */
+arm_status arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  float32_t * pState,
+  float32_t * pCov,
+  float32_t * pScratch)
+{
+  if ((numStates == 0U) || (numMeas == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numStates = numStates;
+  S->numMeas = numMeas;
+  S->pState = pState;
+  S->pCov = pCov;
+  S->pScratch = pScratch;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of Kalman group
+ */
@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rls_f32.c
+ * Description:  Processing function for the floating-point RLS filter
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup RLS Recursive Least Squares (RLS) Filters
+
+  RLS filters are adaptive filters with the same inputs and outputs as the
+  LMS filters. Each coefficient update uses an estimate of the inverse of the
+  correlation matrix of the input, so the convergence does not depend on the
+  spread of the input spectrum and is an order of magnitude faster than
+  with the (normalized) LMS filters.
+
+  The cost is <code>O(numTaps^2)</code> operations per sample instead of
+  <code>O(numTaps)</code>: the RLS filters are intended for short filters
+  (up to 32 taps or so). Long filters are better adapted with the
+  frequency-domain block LMS filter.
+
+  @par           Algorithm
+                   With <code>x[n]</code> the vector of the last <code>numTaps</code>
+                   input samples and <code>P</code> the inverse correlation matrix:
+  <pre>
+      p    = P * x[n]
+      k    = p / (lambda + x[n]' * p)
+      e[n] = d[n] - b' * x[n]
+      b    = b + k * e[n]
+      P    = (P - k * p') / lambda
+  </pre>
+  @par
+                   <code>P</code> is symmetric: only its upper triangle is
+                   computed and it is mirrored to the lower triangle, which
+                   halves the update cost and keeps <code>P</code> exactly
+                   symmetric in float32_t.
+
+  @par           Channels
+                   <code>P</code> and the gain <code>k</code> only depend on the input signal.
+                   With <code>numChannels</code> channels, the filters of the channels adapt
+                   to different reference signals from the same input signal
+                   (for instance the signals of several error microphones in active noise control).
+                   <code>P</code> and <code>k</code> are computed once for all the channels
+                   and each additional channel only costs <code>O(numTaps)</code> operations per sample.
+                   The reference, output and error arrays contain the blocks of
+                   <code>blockSize</code> values of the channels one after the other.
+ */
+
+/**
+  @addtogroup RLS
+  @{
+ */
+
+/**
+  @brief         Processing function for floating-point RLS filter.
+  @param[in,out] S          points to an instance of the floating-point RLS filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     pRef       points to the blocks of reference data of the channels
+  @param[out]    pOut       points to the blocks of output data of the channels
+  @param[out]    pErr       points to the blocks of error data of the channels
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_rls_f32(
+  const arm_rls_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+        float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+        float32_t *pP = S->pInvCorr;                   /* Inverse correlation matrix */
+        float32_t *pG = S->pGain;                      /* P * x */
+  const float32_t *px, *pRow;                          /* Temporary pointers */
+        float32_t *pb;                                 /* Coefficient pointer */
+        float32_t invLambda = 1.0f / S->lambda;        /* Inverse of the forgetting factor */
+        float32_t acc, e, invAlpha, ki, v;             /* Temporary variables */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t i, j, ch, n;                          /* Loop counters */
+
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U)]);
+
+  for (n = 0U; n < blockSize; n++)
+  {
+    /* Copy the new input sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    px = pState;
+
+    /* p = P * x and alpha = lambda + x' * p */
+    acc = 0.0f;
+    pRow = pP;
+    for (i = 0U; i < numTaps; i++)
+    {
+      v = 0.0f;
+      for (j = 0U; j < numTaps; j++)
+      {
+        v += pRow[j] * px[j];
+      }
+      pG[i] = v;
+      acc += px[i] * v;
+      pRow += numTaps;
+    }
+    invAlpha = 1.0f / (S->lambda + acc);
+
+    /* Filter and coefficient update of each channel: b = b + k * e */
+    pb = S->pCoeffs;
+    for (ch = 0U; ch < S->numChannels; ch++)
+    {
+      acc = 0.0f;
+      for (i = 0U; i < numTaps; i++)
+      {
+        acc += pb[i] * px[i];
+      }
+
+      pOut[ch * blockSize + n] = acc;
+      e = pRef[ch * blockSize + n] - acc;
+      pErr[ch * blockSize + n] = e;
+
+      e = e * invAlpha;
+      for (i = 0U; i < numTaps; i++)
+      {
+        pb[i] += pG[i] * e;
+      }
+
+      pb += numTaps;
+    }
+
+    /* P = (P - k * p') / lambda on the upper triangle, mirrored */
+    for (i = 0U; i < numTaps; i++)
+    {
+      ki = pG[i] * invAlpha;
+      for (j = i; j < numTaps; j++)
+      {
+        v = (pP[i * numTaps + j] - ki * pG[j]) * invLambda;
+        pP[i * numTaps + j] = v;
+        pP[j * numTaps + i] = v;
+      }
+    }
+
+    /* Advance state pointer by 1 for the next sample */
+    pState++;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  memmove(S->pState, pState, (numTaps - 1U) * sizeof(float32_t));
+}
+
+/**
+  @} end of RLS group
+ */
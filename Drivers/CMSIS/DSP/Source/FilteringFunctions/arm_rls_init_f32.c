@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rls_init_f32.c
+ * Description:  Floating-point RLS filter initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @addtogroup RLS
+  @{
+ */
+
+/**
+  @brief         Initialization function for floating-point RLS filter.
+  @param[out]    S            points to an instance of the floating-point RLS filter structure
+  @param[in]     numTaps      number of coefficients of each channel
+  @param[in]     numChannels  number of channels
+  @param[in]     pCoeffs      points to coefficient buffer
+  @param[in]     pState       points to state buffer
+  @param[in]     pInvCorr     points to the inverse correlation matrix buffer
+  @param[in]     pGain        points to a working buffer of numTaps values
+  @param[in]     lambda       forgetting factor
+  @param[in]     delta        initial value of the diagonal of the inverse correlation matrix
+  @param[in]     blockSize    number of samples to process
+  @return        none
+
+  @par           Details
+                   <code>pCoeffs</code> points to <code>numChannels</code> arrays of
+                   <code>numTaps</code> filter coefficients, one after the other,
+                   each stored in time reversed order as for arm_lms_f32.
+                   The initial filter coefficients serve as a starting point for the adaptive filter.
+                   <code>pState</code> points to an array of length <code>numTaps+blockSize-1</code> samples,
+                   shared by the channels.
+                   <code>pInvCorr</code> points to an array of <code>numTaps*numTaps</code> values.
+                   It is initialized to <code>delta</code> times the identity matrix.
+                   A large <code>delta</code> (100 to 1000 times the inverse of the input power)
+                   gives the fastest initial convergence.
+                   <code>lambda</code> is usually between 0.98 and 1: the filter
+                   tracks the last <code>1/(1-lambda)</code> samples or so.
+ */
+void arm_rls_init_f32(
+        arm_rls_instance_f32 * S,
+        uint16_t numTaps,
+        uint16_t numChannels,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t * pInvCorr,
+        float32_t * pGain,
+        float32_t lambda,
+        float32_t delta,
+        uint32_t blockSize)
+{
+  uint32_t i;
+
+  /* Assign filter taps and channels */
+  S->numTaps = numTaps;
+  S->numChannels = numChannels;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always blockSize + numTaps - 1 */
+  memset(pState, 0, (numTaps + (blockSize - 1U)) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+  /* Inverse correlation matrix is delta * I */
+  memset(pInvCorr, 0, (uint32_t)numTaps * numTaps * sizeof(float32_t));
+  for (i = 0U; i < numTaps; i++)
+  {
+    pInvCorr[i * numTaps + i] = delta;
+  }
+  S->pInvCorr = pInvCorr;
+  S->pGain = pGain;
+
+  /* Assign forgetting factor */
+  S->lambda = lambda;
+}
+
+/**
+  @} end of RLS group
+ */
@@ -36,6 +36,15 @@
 #include "arm_linear_interp_q7.c"
 #include "arm_spline_interp_f32.c"
 #include "arm_spline_interp_init_f32.c"
+#include "arm_interp_axis_init_f32.c"
+#include "arm_nonuniform_interp_init_f32.c"
+#include "arm_nonuniform_interp_f32.c"
+#include "arm_nonuniform_bilinear_interp_init_f32.c"
+#include "arm_nonuniform_bilinear_interp_f32.c"
+#include "arm_spline_stream_init_f32.c"
+#include "arm_spline_stream_f32.c"
+#include "arm_spline_uniform_init_f32.c"
+#include "arm_spline_uniform_f32.c"
 
 
 
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_interp_axis_init_f32.c
+ * Description:  Floating-point non-uniform interpolation axis initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup NonUniformInterpolate
+  @{
+ */
+
+/**
+  @brief         Initialization function for a non-uniform interpolation axis.
+  @param[out]    A           points to the axis structure.
+  @param[in]     pValues     points to the strictly increasing breakpoints.
+  @param[in]     nValues     number of breakpoints.
+  @param[out]    pBucket     points to the bucket index of numBuckets values (NULL when numBuckets is 0).
+  @param[in]     numBuckets  number of buckets of the index, 0 for a binary search.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : less than 2 breakpoints or more than 65536
+                                                    with a bucket index
+
+  @par           Bucket index
+                   The range of the axis is cut into numBuckets buckets of equal width and
+                   pBucket[b] is the segment containing the start of bucket b.
+                   A query does a binary search on the breakpoints falling in its bucket.
+                   With about as many buckets as breakpoints and a regular spacing, a bucket
+                   holds one or two breakpoints and the search takes a constant time. On a
+                   clustered axis, the search is logarithmic in the number of breakpoints of
+                   the bucket, so it is never slower than a binary search on the whole axis.
+ */
+arm_status arm_interp_axis_init_f32(
+        arm_interp_axis_f32 * A,
+  const float32_t * pValues,
+        uint32_t nValues,
+        uint16_t * pBucket,
+        uint32_t numBuckets)
+{
+  float32_t range, width;
+  uint32_t b, seg;
+
+  if ((nValues < 2U) || ((numBuckets > 0U) && (nValues > 65536U)))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  A->nValues = nValues;
+  A->pValues = pValues;
+  A->numBuckets = numBuckets;
+  A->pBucket = pBucket;
+  A->invBucketWidth = 0.0f;
+  A->segment = 0U;
+
+  if (numBuckets > 0U)
+  {
+    range = pValues[nValues - 1U] - pValues[0];
+    width = range / (float32_t) numBuckets;
+    A->invBucketWidth = (float32_t) numBuckets / range;
+
+    /* Last breakpoint not above the start of each bucket */
+    seg = 0U;
+    for (b = 0U; b < numBuckets; b++)
+    {
+      float32_t start = pValues[0] + (float32_t) b * width;
+
+      while ((seg < (nValues - 2U)) && (pValues[seg + 1U] <= start))
+      {
+        seg++;
+      }
+      pBucket[b] = (uint16_t) seg;
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of NonUniformInterpolate group
+ */
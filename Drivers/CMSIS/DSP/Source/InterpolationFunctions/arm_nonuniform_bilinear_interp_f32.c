@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nonuniform_bilinear_interp_f32.c
+ * Description:  Floating-point non-uniform bilinear interpolation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+#include "arm_interp_search_f32.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup NonUniformInterpolate
+  @{
+ */
+
+__STATIC_FORCEINLINE float32_t arm_nonuniform_bilinear_point_f32(
+  arm_nonuniform_bilinear_interp_instance_f32 * S,
+  float32_t X,
+  float32_t Y)
+{
+  uint32_t xSeg = arm_interp_axis_search_f32(&S->xAxis, X);
+  uint32_t ySeg = arm_interp_axis_search_f32(&S->yAxis, Y);
+  float32_t xdiff = arm_interp_axis_frac_f32(&S->xAxis, xSeg, X);
+  float32_t ydiff = arm_interp_axis_frac_f32(&S->yAxis, ySeg, Y);
+  const float32_t *pRow = S->pData + xSeg + ySeg * S->xAxis.nValues;
+  float32_t f00, f01, f10, f11;
+
+  /* Two nearest points in X-direction on the rows YF and YF+1 */
+  f00 = pRow[0];
+  f01 = pRow[1];
+  f10 = pRow[S->xAxis.nValues];
+  f11 = pRow[S->xAxis.nValues + 1U];
+
+  return f00 + (f01 - f00) * xdiff + (f10 - f00) * ydiff
+             + (f00 - f01 - f10 + f11) * xdiff * ydiff;
+}
+
+/**
+  @brief         Floating-point non-uniform bilinear interpolation of one point.
+  @param[in,out] S  points to an instance of the non-uniform bilinear interpolation structure.
+  @param[in]     X  interpolation coordinate.
+  @param[in]     Y  interpolation coordinate.
+  @return        interpolated value
+ */
+float32_t arm_nonuniform_bilinear_interp_f32(
+  arm_nonuniform_bilinear_interp_instance_f32 * S,
+  float32_t X,
+  float32_t Y)
+{
+  return arm_nonuniform_bilinear_point_f32(S, X, Y);
+}
+
+/**
+  @brief         Floating-point non-uniform bilinear interpolation of a block of points.
+  @param[in,out] S          points to an instance of the non-uniform bilinear interpolation structure.
+  @param[in]     pX         points to the block of x coordinates.
+  @param[in]     pY         points to the block of y coordinates.
+  @param[out]    pDst       points to the block of interpolated values.
+  @param[in]     blockSize  number of points to process.
+ */
+void arm_nonuniform_bilinear_interp_block_f32(
+        arm_nonuniform_bilinear_interp_instance_f32 * S,
+  const float32_t * pX,
+  const float32_t * pY,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    *pDst++ = arm_nonuniform_bilinear_point_f32(S, *pX++, *pY++);
+
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of NonUniformInterpolate group
+ */
@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nonuniform_bilinear_interp_init_f32.c
+ * Description:  Floating-point non-uniform bilinear interpolation initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup NonUniformInterpolate
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point non-uniform bilinear interpolation.
+  @param[out]    S            points to an instance of the non-uniform bilinear interpolation structure.
+  @param[in]     pXValues     points to the numCols strictly increasing x breakpoints.
+  @param[in]     numCols      number of columns of the table.
+  @param[in]     pYValues     points to the numRows strictly increasing y breakpoints.
+  @param[in]     numRows      number of rows of the table.
+  @param[in]     pData        points to the numRows*numCols table, element (x,y) at pData[x + y*numCols].
+  @param[out]    pXBucket     points to the bucket index of the x axis (NULL when numXBuckets is 0).
+  @param[in]     numXBuckets  number of buckets of the x axis.
+  @param[out]    pYBucket     points to the bucket index of the y axis (NULL when numYBuckets is 0).
+  @param[in]     numYBuckets  number of buckets of the y axis.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : an axis with less than 2 breakpoints or more
+                                                    than 65536 with a bucket index
+ */
+arm_status arm_nonuniform_bilinear_interp_init_f32(
+        arm_nonuniform_bilinear_interp_instance_f32 * S,
+  const float32_t * pXValues,
+        uint32_t numCols,
+  const float32_t * pYValues,
+        uint32_t numRows,
+  const float32_t * pData,
+        uint16_t * pXBucket,
+        uint32_t numXBuckets,
+        uint16_t * pYBucket,
+        uint32_t numYBuckets)
+{
+  arm_status status;
+
+  S->pData = pData;
+
+  status = arm_interp_axis_init_f32(&S->xAxis, pXValues, numCols, pXBucket, numXBuckets);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  return arm_interp_axis_init_f32(&S->yAxis, pYValues, numRows, pYBucket, numYBuckets);
+}
+
+/**
+  @} end of NonUniformInterpolate group
+ */
@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nonuniform_interp_f32.c
+ * Description:  Floating-point non-uniform linear interpolation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+#include "arm_interp_search_f32.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @defgroup NonUniformInterpolate Non-uniform Linear and Bilinear Interpolation
+
+  Linear and bilinear interpolation of tables sampled on non-uniform axes,
+  like calibration maps whose breakpoints are denser where the characteristic
+  bends.
+
+  @par Algorithm
+  Each axis is a list of strictly increasing breakpoints. The segment
+  <code>x(i) <= x < x(i+1)</code> of a query is found by:
+  - the segment of the previous query of the instance, or the next one.
+    A monotonic stream of queries is located in constant time;
+  - otherwise a bucket index: the axis range is cut into buckets of equal
+    width which store the segment of their start. About one bucket per
+    breakpoint gives a constant time search on any spacing;
+  - otherwise, when the instance has no bucket index, a binary search.
+
+  The value is then interpolated as:
+  <pre>
+      t = (x - x(i)) / (x(i+1) - x(i))
+      y = y(i) + t * (y(i+1) - y(i))
+  </pre>
+  and the 2D tables apply the same to both axes like \ref BilinearInterpolate.
+
+  @par
+  Queries outside of an axis are clamped to its first or last breakpoint,
+  so the tables return their edge values instead of extrapolating.
+
+  @par
+  The instances cache the last segment, so they are modified by the
+  processing functions and one instance must not be shared by concurrent
+  callers.
+ */
+
+/**
+  @addtogroup NonUniformInterpolate
+  @{
+ */
+
+/**
+  @brief         Floating-point non-uniform linear interpolation of one point.
+  @param[in,out] S  points to an instance of the non-uniform interpolation structure.
+  @param[in]     x  input sample to process
+  @return        interpolated value
+ */
+float32_t arm_nonuniform_interp_f32(
+  arm_nonuniform_interp_instance_f32 * S,
+  float32_t x)
+{
+  uint32_t seg = arm_interp_axis_search_f32(&S->axis, x);
+  float32_t t = arm_interp_axis_frac_f32(&S->axis, seg, x);
+  float32_t y0 = S->pYData[seg];
+  float32_t y1 = S->pYData[seg + 1U];
+
+  return y0 + t * (y1 - y0);
+}
+
+/**
+  @brief         Floating-point non-uniform linear interpolation of a block of points.
+  @param[in,out] S          points to an instance of the non-uniform interpolation structure.
+  @param[in]     pSrc       points to the block of input samples.
+  @param[out]    pDst       points to the block of interpolated values.
+  @param[in]     blockSize  number of samples to process.
+ */
+void arm_nonuniform_interp_block_f32(
+        arm_nonuniform_interp_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  arm_interp_axis_f32 *A = &S->axis;
+  const float32_t *pY = S->pYData;
+  uint32_t blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    float32_t x = *pSrc++;
+    uint32_t seg = arm_interp_axis_search_f32(A, x);
+    float32_t t = arm_interp_axis_frac_f32(A, seg, x);
+
+    *pDst++ = pY[seg] + t * (pY[seg + 1U] - pY[seg]);
+
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of NonUniformInterpolate group
+ */
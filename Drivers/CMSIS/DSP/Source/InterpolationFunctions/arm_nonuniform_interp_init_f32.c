@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nonuniform_interp_init_f32.c
+ * Description:  Floating-point non-uniform linear interpolation initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup NonUniformInterpolate
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point non-uniform linear interpolation.
+  @param[out]    S           points to an instance of the non-uniform interpolation structure.
+  @param[in]     pXData      points to the strictly increasing x breakpoints.
+  @param[in]     pYData      points to the y values at the breakpoints.
+  @param[in]     nValues     number of breakpoints.
+  @param[out]    pBucket     points to the bucket index of numBuckets values (NULL when numBuckets is 0).
+  @param[in]     numBuckets  number of buckets of the index, 0 for a binary search.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : less than 2 breakpoints or more than 65536
+                                                    with a bucket index
+ */
+arm_status arm_nonuniform_interp_init_f32(
+        arm_nonuniform_interp_instance_f32 * S,
+  const float32_t * pXData,
+  const float32_t * pYData,
+        uint32_t nValues,
+        uint16_t * pBucket,
+        uint32_t numBuckets)
+{
+  S->pYData = pYData;
+
+  return arm_interp_axis_init_f32(&S->axis, pXData, nValues, pBucket, numBuckets);
+}
+
+/**
+  @} end of NonUniformInterpolate group
+ */
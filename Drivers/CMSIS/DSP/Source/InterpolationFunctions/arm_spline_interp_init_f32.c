@@ -27,6 +27,7 @@
  */
 
 #include "dsp/interpolation_functions.h"
+#include "dsp/matrix_functions.h"
 
 /**
   @ingroup groupInterpolation
@@ -45,6 +46,11 @@
 
   @par
 
+  The tridiagonal system giving the c coefficients is solved with
+  \ref arm_mat_band_lu_f32 and \ref arm_mat_band_lu_solve_f32.
+
+  @par
+
   The x input array must be strictly sorted in ascending order and it must
   not contain twice the same value (x(i)<x(i+1)).
  
@@ -81,87 +87,89 @@ void arm_spline_init_f32(
     float32_t * c = coeffs+(n-1);
     float32_t * d = coeffs+(2*(n-1));    
 
-    float32_t * u = tempBuffer;   /* (n-1)-long scratch buffer for u elements */
-    float32_t * z = tempBuffer+(n-1); /* n-long scratch buffer for z elements */
+    float32_t * cx = tempBuffer;      /* n-long scratch buffer for c(i) at all the points */
+    float32_t * B = tempBuffer+n;     /* (n-2)-long scratch buffer for the B(i) elements */
+
+    arm_matrix_band_instance_f32 A;   /* Tridiagonal matrix of the interior points */
 
     float32_t hi, hm1; /* h(i) and h(i-1) */
-    float32_t Bi; /* B(i), i-th element of matrix B=LZ */
-    float32_t li; /* l(i), i-th element of matrix L    */
-    float32_t cp1; /* Temporary value for c(i+1) */
+    float32_t ai;      /* a(i,i), diagonal element of matrix A */
 
     int32_t i; /* Loop counter */
+    int32_t m = (int32_t)n-2; /* Number of interior points */
 
     S->x = x;
     S->y = y;
     S->n_x = n;
 
-    /* == Solve LZ=B to obtain z(i) and u(i) == */
-
-    /* -- Row 1 -- */
-    /* B(0) = 0, not computed */
-    /* u(1,2) = a(1,2)/a(1,1) = a(1,2) */
-    if(type == ARM_SPLINE_NATURAL)
-        u[0] = 0;  /* a(1,2) = 0 */
-    else if(type == ARM_SPLINE_PARABOLIC_RUNOUT)
-        u[0] = -1; /* a(1,2) = -1 */
-
-    z[0] = 0;  /* z(1) = B(1)/a(1,1) = 0 always */
+    /* == Solve A c = B for the c(i) of the interior points == */
 
-    /* -- Rows 2 to N-1 (N=n+1) -- */
-    hm1 = x[1] - x[0]; /* Initialize h(i-1) = h(1) = x(2)-x(1) */
+    /* The boundary conditions give c(1) and c(N) from their neighbours,
+       so they are substituted in the first and last rows and the system is
+       tridiagonal. The band of A is stored in the coeffs buffer, which is not
+       used yet: it needs 3(n-2)-2 values out of 3(n-1). */
+    cx[0] = 0;
+    cx[n-1] = 0;
 
-    for (i=1; i<(int32_t)n-1; i++)
+    if (m > 0)
     {
-        /* Compute B(i) */
-        hi = x[i+1]-x[i];
-        Bi = 3*(y[i+1]-y[i])/hi - 3*(y[i]-y[i-1])/hm1;
-
-        /* l(i) = a(i)-a(i,i-1)*u(i-1) = 2[h(i-1)+h(i)]-h(i-1)*u(i-1) */
-        li = 2*(hi+hm1) - hm1*u[i-1];
-
-        /* u(i) = a(i,i+1)/l(i) = h(i)/l(i) */
-        u[i] = hi/li;
-
-        /* z(i) = [B(i)-h(i-1)*z(i-1)]/l(i) */
-        z[i] = (Bi-hm1*z[i-1])/li;
-
-        /* Update h(i-1) for next iteration */
-        hm1 = hi;
+        arm_mat_band_init_f32(&A, (uint16_t)m, 1, 1, coeffs);
+
+        hm1 = x[1] - x[0]; /* Initialize h(i-1) = h(1) = x(2)-x(1) */
+
+        for (i=1; i<(int32_t)n-1; i++)
+        {
+            hi = x[i+1]-x[i];
+
+            /* B(i) */
+            B[i-1] = 3*(y[i+1]-y[i])/hi - 3*(y[i]-y[i-1])/hm1;
+
+            /* a(i,i) = 2[h(i-1)+h(i)] */
+            ai = 2*(hi+hm1);
+            if(type == ARM_SPLINE_PARABOLIC_RUNOUT)
+            {
+                /* c(1) = c(2) and c(N) = c(N-1) */
+                if (i == 1)
+                    ai += hm1;
+                if (i == (int32_t)n-2)
+                    ai += hi;
+            }
+
+            /* Row i-1 of the band: a(i,i-1) = h(i-1), a(i,i), a(i,i+1) = h(i) */
+            if (i > 1)
+                coeffs[3*(i-1)-1] = hm1;
+            coeffs[3*(i-1)] = ai;
+            if (i < (int32_t)n-2)
+                coeffs[3*(i-1)+1] = hi;
+
+            /* Update h(i-1) for next iteration */
+            hm1 = hi;
+        }
+
+        /* A is diagonally dominant, no pivoting is needed */
+        arm_mat_band_lu_f32(&A);
+        arm_mat_band_lu_solve_f32(&A, B, cx+1);
+
+        if(type == ARM_SPLINE_PARABOLIC_RUNOUT)
+        {
+            cx[0] = cx[1];
+            cx[n-1] = cx[n-2];
+        }
     }
 
-    /* -- Row N -- */
-    /* l(N) = a(N,N)-a(N,N-1)u(N-1) */
-    /* z(N) = [-a(N,N-1)z(N-1)]/l(N) */
-    if(type == ARM_SPLINE_NATURAL)
-    {
-        /* li = 1;     a(N,N) = 1; a(N,N-1) = 0 */
-        z[n-1] = 0; /* a(N,N-1) = 0 */
-    }
-    else if(type == ARM_SPLINE_PARABOLIC_RUNOUT)
-    {
-        li = 1+u[n-2];      /* a(N,N) = 1; a(N,N-1) = -1 */
-        z[n-1] = z[n-2]/li; /* a(N,N-1) = -1 */
-    }
-
-    /* == Solve UX = Z to obtain c(i) and    */
-    /*    compute b(i) and d(i) from c(i) == */
+    /* == Compute b(i) and d(i) from c(i) == */
 
-    cp1 = z[n-1]; /* Initialize c(i+1) = c(N) = z(N) */
-
-    for (i=n-2; i>=0; i--) 
+    for (i=0; i<(int32_t)n-1; i++) 
     {
-        /* c(i) = z(i)-u(i+1)c(i+1) */
-        c[i] = z[i]-u[i]*cp1;
-
         hi = x[i+1]-x[i];
+
+        c[i] = cx[i];
+
         /* b(i) = [y(i+1)-y(i)]/h(i)-h(i)*[c(i+1)+2*c(i)]/3 */
-        b[i] = (y[i+1]-y[i])/hi-hi*(cp1+2*c[i])/3;
+        b[i] = (y[i+1]-y[i])/hi-hi*(cx[i+1]+2*cx[i])/3;
 
         /* d(i) = [c(i+1)-c(i)]/[3*h(i)] */
-        d[i] = (cp1-c[i])/(3*hi);
-
-        /* Update c(i+1) for next iteration */
-        cp1 = c[i];
+        d[i] = (cx[i+1]-cx[i])/(3*hi);
     }
 
     /* == Finally, store the coefficients in the instance == */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_stream_f32.c
+ * Description:  Floating-point streaming cubic spline evaluation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+#include "arm_interp_search_f32.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+  @brief         Streaming evaluation of a floating-point cubic spline.
+  @param[in,out] S          points to an instance of the streaming spline structure.
+  @param[in]     xq         points to the x values of the interpolated data points.
+  @param[out]    pDst       points to the block of output data.
+  @param[in]     blockSize  number of samples of output data.
+
+  @par           Details
+                   Unlike \ref arm_spline_f32, the x values do not need to be sorted and
+                   the segment of the last sample is kept in the instance, so a stream
+                   of increasing x values split over many calls (a trajectory sampled
+                   in time) does not search the knots again at each call.
+  @par
+                   The samples are split into runs falling in one segment and each run
+                   is evaluated in Horner form by a loop without branches, which the
+                   compiler can vectorize over the samples.
+  @par
+                   Like \ref arm_spline_f32, x values outside of the knots are extrapolated
+                   with the polynomial of the first or last segment.
+ */
+void arm_spline_stream_f32(
+        arm_spline_stream_instance_f32 * S,
+  const float32_t * xq,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const arm_spline_instance_f32 *pSpline = S->pSpline;
+  const float32_t *pX = pSpline->x;
+  const float32_t *pY = pSpline->y;
+  uint32_t n = pSpline->n_x;
+  uint32_t last = n - 2U;
+
+  /* Coefficients (a==y for i<=n-1) */
+  const float32_t *pB = pSpline->coeffs;
+  const float32_t *pC = pSpline->coeffs + (n - 1U);
+  const float32_t *pD = pSpline->coeffs + (2U * (n - 1U));
+
+  uint32_t blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    uint32_t seg = arm_interp_axis_search_f32(&S->axis, *xq);
+    float32_t lo = (seg == 0U) ? -INFINITY : pX[seg];
+    float32_t hi = (seg == last) ? INFINITY : pX[seg + 1U];
+    float32_t xi = pX[seg];
+    float32_t ai = pY[seg];
+    float32_t bi = pB[seg];
+    float32_t ci = pC[seg];
+    float32_t di = pD[seg];
+    uint32_t run, k;
+
+    /* Samples following in the same segment */
+    run = 1U;
+    while ((run < blkCnt) && (xq[run] >= lo) && (xq[run] < hi))
+    {
+      run++;
+    }
+
+    for (k = 0U; k < run; k++)
+    {
+      float32_t dx = xq[k] - xi;
+
+      pDst[k] = ai + dx * (bi + dx * (ci + dx * di));
+    }
+
+    xq += run;
+    pDst += run;
+    blkCnt -= run;
+  }
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_stream_init_f32.c
+ * Description:  Floating-point streaming cubic spline evaluation initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+  @brief         Initialization function for the streaming evaluation of a floating-point cubic spline.
+  @param[out]    S           points to an instance of the streaming spline structure.
+  @param[in]     pSpline     points to an initialized spline instance.
+  @param[out]    pBucket     points to the bucket index of numBuckets values (NULL when numBuckets is 0).
+  @param[in]     numBuckets  number of buckets of the knot index, 0 for a binary search.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : less than 2 knots or more than 65536 with a bucket index
+
+  @par           Details
+                   The spline instance is shared, not copied: it must stay initialized
+                   as long as the streaming instance is used. The cursor starts on the
+                   first segment. The bucket index is only used when a sample jumps
+                   away from the cursor, see \ref NonUniformInterpolate.
+ */
+arm_status arm_spline_stream_init_f32(
+        arm_spline_stream_instance_f32 * S,
+  const arm_spline_instance_f32 * pSpline,
+        uint16_t * pBucket,
+        uint32_t numBuckets)
+{
+  S->pSpline = pSpline;
+
+  return arm_interp_axis_init_f32(&S->axis, pSpline->x, pSpline->n_x, pBucket, numBuckets);
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_uniform_f32.c
+ * Description:  Floating-point uniform knots cubic spline evaluation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+  @brief         Evaluation of a floating-point cubic spline on uniform knots.
+  @param[in]     S          points to an instance of the uniform spline structure.
+  @param[in]     xq         points to the x values of the interpolated data points.
+  @param[out]    pDst       points to the block of output data.
+  @param[in]     blockSize  number of samples of output data.
+
+  @par           Details
+                   The segment of each sample is computed from its position on the
+                   uniform grid, so the evaluation takes a constant time per sample
+                   and the x values can be in any order.
+                   Like \ref arm_spline_f32, x values outside of the knots are
+                   extrapolated with the polynomial of the first or last segment.
+ */
+void arm_spline_uniform_f32(
+  const arm_spline_uniform_instance_f32 * S,
+  const float32_t * xq,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const arm_spline_instance_f32 *pSpline = S->pSpline;
+  const float32_t *pX = pSpline->x;
+  const float32_t *pY = pSpline->y;
+  uint32_t n = pSpline->n_x;
+  float32_t last = (float32_t) (n - 2U);
+  float32_t x1 = S->x1;
+  float32_t invSpacing = S->invSpacing;
+
+  /* Coefficients (a==y for i<=n-1) */
+  const float32_t *pB = pSpline->coeffs;
+  const float32_t *pC = pSpline->coeffs + (n - 1U);
+  const float32_t *pD = pSpline->coeffs + (2U * (n - 1U));
+
+  uint32_t blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    float32_t x = *xq++;
+    float32_t pos = (x - x1) * invSpacing;
+    int32_t i;
+    float32_t dx;
+
+    /* Segment of x, clamped to the first and last ones (NaN to the first) */
+    pos = (pos > 0.0f) ? pos : 0.0f;
+    pos = (pos > last) ? last : pos;
+    i = (int32_t) pos;
+
+    dx = x - pX[i];
+    *pDst++ = pY[i] + dx * (pB[i] + dx * (pC[i] + dx * pD[i]));
+
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_uniform_init_f32.c
+ * Description:  Floating-point uniform knots cubic spline evaluation initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+  @brief         Initialization function for the evaluation of a floating-point cubic spline on uniform knots.
+  @param[out]    S        points to an instance of the uniform spline structure.
+  @param[in]     pSpline  points to an initialized spline instance with uniformly spaced knots.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : knots are not uniformly spaced
+
+  @par           Details
+                   The knots are accepted as uniform when each one is within 1e-3 spacing
+                   of its ideal position, so rounded knot values like 0.1*i are accepted.
+                   The spline instance is shared, not copied.
+ */
+arm_status arm_spline_uniform_init_f32(
+        arm_spline_uniform_instance_f32 * S,
+  const arm_spline_instance_f32 * pSpline)
+{
+  const float32_t *pX = pSpline->x;
+  uint32_t n = pSpline->n_x;
+  float32_t spacing;
+  uint32_t i;
+
+  if (n < 2U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  spacing = (pX[n - 1U] - pX[0]) / (float32_t) (n - 1U);
+  if (!(spacing > 0.0f))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 1U; i < n - 1U; i++)
+  {
+    if (fabsf(pX[i] - (pX[0] + (float32_t) i * spacing)) > 1e-3f * spacing)
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+  }
+
+  S->pSpline = pSpline;
+  S->x1 = pX[0];
+  S->invSpacing = 1.0f / spacing;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
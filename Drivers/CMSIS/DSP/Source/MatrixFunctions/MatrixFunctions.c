@@ -45,6 +45,7 @@
 #include "arm_mat_mult_q15.c"
 #include "arm_mat_mult_q31.c"
 #include "arm_mat_mult_opt_q31.c"
+#include "arm_mat_mult_trans_acc_f32.c"
 #include "arm_mat_scale_f32.c"
 #include "arm_mat_scale_q15.c"
 #include "arm_mat_scale_q31.c"
@@ -72,3 +73,17 @@
 #include "arm_mat_solve_lower_triangular_f64.c"
 #include "arm_mat_ldlt_f32.c"
 #include "arm_mat_ldlt_f64.c"
+#include "arm_mat_sym_init_f32.c"
+#include "arm_mat_sym_vec_mult_f32.c"
+#include "arm_mat_sym_cholesky_f32.c"
+#include "arm_mat_sym_cholesky_solve_f32.c"
+#include "arm_mat_band_init_f32.c"
+#include "arm_mat_band_vec_mult_f32.c"
+#include "arm_mat_band_lu_f32.c"
+#include "arm_mat_band_lu_solve_f32.c"
+#include "arm_mat_band_cholesky_f32.c"
+#include "arm_mat_band_cholesky_solve_f32.c"
+#include "arm_mat_mult_batch_f32.c"
+#include "arm_mat_vec_mult_batch_f32.c"
+#include "arm_mat_inverse_batch_f32.c"
+#include "arm_mat_trans_batch_f32.c"
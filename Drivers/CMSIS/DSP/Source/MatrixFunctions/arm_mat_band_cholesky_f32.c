@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_band_cholesky_f32.c
+ * Description:  Floating-point Cholesky decomposition of a banded matrix
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBand
+  @{
+ */
+
+/**
+  @brief         Floating-point Cholesky decomposition of a symmetric positive-definite banded matrix.
+  @param[in]     src  points to the instance of the input matrix structure
+  @param[out]    dst  points to the instance of the banded lower triangular factor
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH          : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE  : Input matrix cannot be decomposed
+
+  @par           Computes L such that A = L * L'. L has the same bandwidth as A.
+                   Only the lower part of the band of src is read and only the lower part
+                   of the band of dst is written, so the decomposition can be done in-place.
+                   src and dst must have the same dimensions.
+ */
+arm_status arm_mat_band_cholesky_f32(
+  const arm_matrix_band_instance_f32 * src,
+        arm_matrix_band_instance_f32 * dst)
+{
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((src->numRows != dst->numRows)   ||
+      (src->numLower != dst->numLower) ||
+      (src->numUpper != dst->numUpper)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const float32_t *pA = src->pData;
+          float32_t *pL = dst->pData;
+          uint32_t n = src->numRows;
+          uint32_t p = src->numLower;
+          uint32_t w = src->numLower + src->numUpper;
+          uint32_t first, lastRow;
+          float32_t sum, invDiag;
+          uint32_t i, j, k;
+
+    for (j = 0U; j < n; j++)
+    {
+      lastRow = ((j + p) < n) ? (j + p) : (n - 1U);
+      invDiag = 0.0f;
+
+      for (i = j; i <= lastRow; i++)
+      {
+        /* L(i,k) and L(j,k) are both inside the band for k >= i - p */
+        first = (i > p) ? (i - p) : 0U;
+
+        sum = pA[i * w + j];
+        for (k = first; k < j; k++)
+        {
+          sum -= pL[i * w + k] * pL[j * w + k];
+        }
+
+        if (i == j)
+        {
+          if (sum <= 0.0f)
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+          pL[j * w + j] = sqrtf(sum);
+          invDiag = 1.0f / pL[j * w + j];
+        }
+        else
+        {
+          pL[i * w + j] = sum * invDiag;
+        }
+      }
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixBand group
+ */
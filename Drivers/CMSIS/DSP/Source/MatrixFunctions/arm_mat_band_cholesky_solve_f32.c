@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_band_cholesky_solve_f32.c
+ * Description:  Floating-point solve from the Cholesky factor of a banded matrix
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBand
+  @{
+ */
+
+/**
+  @brief         Solve A x = b from the banded Cholesky factor of A.
+  @param[in]     l    points to the factor computed by \ref arm_mat_band_cholesky_f32
+  @param[in]     pB   points to the right hand side vector
+  @param[out]    pX   points to the solution vector
+  @return        none
+
+  @par           Only the lower part of the band of l is read.
+                   pX can be the same buffer as pB.
+ */
+void arm_mat_band_cholesky_solve_f32(
+  const arm_matrix_band_instance_f32 * l,
+  const float32_t * pB,
+        float32_t * pX)
+{
+  const float32_t *pL = l->pData;            /* Band values of L */
+        uint32_t n = l->numRows;             /* Order of the matrix */
+        uint32_t p = l->numLower;            /* Number of sub-diagonals */
+        uint32_t w = l->numLower + l->numUpper; /* Row stride minus one */
+        uint32_t first;                      /* Band limit of the current row */
+        float32_t sum, xi;                   /* Temporary variables */
+        uint32_t i, j;                       /* Loop counters */
+
+  /* L y = b */
+  for (i = 0U; i < n; i++)
+  {
+    first = (i > p) ? (i - p) : 0U;
+
+    sum = pB[i];
+    for (j = first; j < i; j++)
+    {
+      sum -= pL[i * w + j] * pX[j];
+    }
+    pX[i] = sum / pL[i * w + i];
+  }
+
+  /* L' x = y, row i of L is column i of L' */
+  for (i = n; i > 0U; i--)
+  {
+    first = (i - 1U > p) ? (i - 1U - p) : 0U;
+
+    xi = pX[i - 1U] / pL[(i - 1U) * w + (i - 1U)];
+    pX[i - 1U] = xi;
+
+    for (j = first; j < i - 1U; j++)
+    {
+      pX[j] -= pL[(i - 1U) * w + j] * xi;
+    }
+  }
+}
+
+/**
+  @} end of MatrixBand group
+ */
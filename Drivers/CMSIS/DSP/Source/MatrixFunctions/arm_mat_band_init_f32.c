@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_band_init_f32.c
+ * Description:  Floating-point banded matrix initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixBand Banded Matrices
+
+  Banded matrices, like the tridiagonal systems of splines and smoothers, are stored
+  in \ref arm_matrix_band_instance_f32. Only the <code>numLower</code> sub-diagonals,
+  the diagonal and the <code>numUpper</code> super-diagonals are stored.
+
+  Each row keeps its band values contiguous and consecutive rows are shifted
+  by one column, so element (i,j) is at <code>pData[i*(numLower+numUpper) + j]</code>.
+  A tridiagonal matrix is stored as:
+  <pre>
+      a00 a01 a10 a11 a12 a21 a22 a23 ...
+  </pre>
+  An n x n matrix uses <code>(n-1)*(numLower+numUpper+1) + 1</code> values.
+  Positions of elements which would fall outside of the matrix are never accessed.
+  The multiplication and solve functions run in O(n * bandwidth) operations and
+  the decompositions in O(n * bandwidth^2) operations.
+ */
+
+/**
+  @addtogroup MatrixBand
+  @{
+ */
+
+/**
+  @brief         Floating-point banded matrix initialization.
+  @param[in,out] S          points to an instance of the banded matrix structure
+  @param[in]     nRows      number of rows and columns of the matrix
+  @param[in]     numLower   number of sub-diagonals
+  @param[in]     numUpper   number of super-diagonals
+  @param[in]     pData      points to the band values
+  @return        none
+ */
+void arm_mat_band_init_f32(
+  arm_matrix_band_instance_f32 * S,
+  uint16_t nRows,
+  uint16_t numLower,
+  uint16_t numUpper,
+  float32_t * pData)
+{
+  /* Assign order of the matrix */
+  S->numRows = nRows;
+
+  /* Assign bandwidths */
+  S->numLower = numLower;
+  S->numUpper = numUpper;
+
+  /* Assign Data pointer */
+  S->pData = pData;
+}
+
+/**
+  @} end of MatrixBand group
+ */
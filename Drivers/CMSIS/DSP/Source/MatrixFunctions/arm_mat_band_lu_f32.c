@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_band_lu_f32.c
+ * Description:  Floating-point LU decomposition of a banded matrix
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBand
+  @{
+ */
+
+/**
+  @brief         In-place LU decomposition without pivoting of a banded matrix.
+  @param[in,out] S    points to the banded matrix, overwritten by its L and U factors
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS   : Operation successful
+                   - \ref ARM_MATH_SINGULAR  : A pivot is zero
+
+  @par           Computes A = L * U where L is unit lower triangular with
+                   <code>numLower</code> sub-diagonals and U is upper triangular with
+                   <code>numUpper</code> super-diagonals. Without pivoting, there is no
+                   fill-in outside of the band and both factors replace A in its storage.
+                   The unit diagonal of L is not stored.
+
+  @par           Pivoting is not done, so the decomposition is meant for diagonally dominant
+                   or positive-definite matrices, which is the case of spline systems.
+ */
+arm_status arm_mat_band_lu_f32(
+  arm_matrix_band_instance_f32 * S)
+{
+  float32_t *pA = S->pData;                  /* Band values */
+  uint32_t n = S->numRows;                   /* Order of the matrix */
+  uint32_t kl = S->numLower;                 /* Number of sub-diagonals */
+  uint32_t ku = S->numUpper;                 /* Number of super-diagonals */
+  uint32_t w = kl + ku;                      /* Row stride minus one */
+  uint32_t lastRow, lastCol;                 /* Band limits */
+  float32_t pivot, l;                        /* Temporary variables */
+  uint32_t i, j, k;                          /* Loop counters */
+
+  for (k = 0U; k < n; k++)
+  {
+    pivot = pA[k * w + k];
+    if (pivot == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    lastRow = ((k + kl) < n) ? (k + kl) : (n - 1U);
+    lastCol = ((k + ku) < n) ? (k + ku) : (n - 1U);
+
+    for (i = k + 1U; i <= lastRow; i++)
+    {
+      l = pA[i * w + k] / pivot;
+      pA[i * w + k] = l;
+
+      for (j = k + 1U; j <= lastCol; j++)
+      {
+        pA[i * w + j] -= l * pA[k * w + j];
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MatrixBand group
+ */
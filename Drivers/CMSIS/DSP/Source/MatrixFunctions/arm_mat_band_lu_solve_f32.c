@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_band_lu_solve_f32.c
+ * Description:  Floating-point solve from the LU factors of a banded matrix
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBand
+  @{
+ */
+
+/**
+  @brief         Solve A x = b from the banded LU factors of A.
+  @param[in]     lu   points to the factors computed by \ref arm_mat_band_lu_f32
+  @param[in]     pB   points to the right hand side vector
+  @param[out]    pX   points to the solution vector
+  @return        none
+
+  @par           pX can be the same buffer as pB.
+ */
+void arm_mat_band_lu_solve_f32(
+  const arm_matrix_band_instance_f32 * lu,
+  const float32_t * pB,
+        float32_t * pX)
+{
+  const float32_t *pA = lu->pData;           /* Band values of L and U */
+        uint32_t n = lu->numRows;            /* Order of the matrix */
+        uint32_t kl = lu->numLower;          /* Number of sub-diagonals */
+        uint32_t ku = lu->numUpper;          /* Number of super-diagonals */
+        uint32_t w = kl + ku;                /* Row stride minus one */
+        uint32_t first, last;                /* Band limits of the current row */
+        float32_t sum;                       /* Accumulator */
+        uint32_t i, j;                       /* Loop counters */
+
+  /* L y = b, L has a unit diagonal */
+  for (i = 0U; i < n; i++)
+  {
+    first = (i > kl) ? (i - kl) : 0U;
+
+    sum = pB[i];
+    for (j = first; j < i; j++)
+    {
+      sum -= pA[i * w + j] * pX[j];
+    }
+    pX[i] = sum;
+  }
+
+  /* U x = y */
+  for (i = n; i > 0U; i--)
+  {
+    last = ((i - 1U + ku) < n) ? (i - 1U + ku) : (n - 1U);
+
+    sum = pX[i - 1U];
+    for (j = i; j <= last; j++)
+    {
+      sum -= pA[(i - 1U) * w + j] * pX[j];
+    }
+    pX[i - 1U] = sum / pA[(i - 1U) * w + (i - 1U)];
+  }
+}
+
+/**
+  @} end of MatrixBand group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_band_vec_mult_f32.c
+ * Description:  Floating-point banded matrix and vector multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBand
+  @{
+ */
+
+/**
+  @brief         Floating-point banded matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to input vector
+  @param[out]    pDst     points to output vector
+  @return        none
+ */
+void arm_mat_band_vec_mult_f32(
+  const arm_matrix_band_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst)
+{
+  const float32_t *pA = pSrcMat->pData;      /* Band values */
+        uint32_t n = pSrcMat->numRows;       /* Order of the matrix */
+        uint32_t kl = pSrcMat->numLower;     /* Number of sub-diagonals */
+        uint32_t ku = pSrcMat->numUpper;     /* Number of super-diagonals */
+        uint32_t first, last;                /* Band limits of the current row */
+        float32_t sum;                       /* Accumulator */
+        uint32_t i, j;                       /* Loop counters */
+
+  for (i = 0U; i < n; i++)
+  {
+    first = (i > kl) ? (i - kl) : 0U;
+    last = ((i + ku) < n) ? (i + ku) : (n - 1U);
+
+    sum = 0.0f;
+    for (j = first; j <= last; j++)
+    {
+      sum += pA[i * (kl + ku) + j] * pVec[j];
+    }
+
+    pDst[i] = sum;
+  }
+}
+
+/**
+  @} end of MatrixBand group
+ */
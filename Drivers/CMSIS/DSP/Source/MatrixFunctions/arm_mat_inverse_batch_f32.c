@@ -0,0 +1,277 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_inverse_batch_f32.c
+ * Description:  Floating-point batched inversion of small matrices
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBatch
+  @{
+ */
+
+/* Number of matrices computed together */
+#define ARM_MAT_BATCH_LANES 4U
+
+/* Inverse of numLanes consecutive 3x3 matrices, returns non zero if one is singular */
+__STATIC_FORCEINLINE uint32_t arm_mat_inverse_batch_3x3_block_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t N,
+        uint32_t numLanes)
+{
+  float32_t tile[9][ARM_MAT_BATCH_LANES];
+  float32_t tileInv[9][ARM_MAT_BATCH_LANES];
+  float32_t a00, a01, a02, a10, a11, a12, a20, a21, a22;
+  float32_t c00, c01, c02;                       /* Cofactors of the first row */
+  float32_t det, invDet, zero;
+  uint32_t singular = 0U;
+  uint32_t i, l;
+
+  for (i = 0U; i < 9U; i++)
+  {
+    for (l = 0U; l < numLanes; l++)
+    {
+      tile[i][l] = pSrc[l];
+    }
+    pSrc += N;
+  }
+
+  for (l = 0U; l < numLanes; l++)
+  {
+    a00 = tile[0][l]; a01 = tile[1][l]; a02 = tile[2][l];
+    a10 = tile[3][l]; a11 = tile[4][l]; a12 = tile[5][l];
+    a20 = tile[6][l]; a21 = tile[7][l]; a22 = tile[8][l];
+
+    c00 = a11 * a22 - a12 * a21;
+    c01 = a12 * a20 - a10 * a22;
+    c02 = a10 * a21 - a11 * a20;
+
+    det = a00 * c00 + a01 * c01 + a02 * c02;
+    /* invDet is 1/det, or 0 when det is 0, computed without branch */
+    zero = (float32_t)(det == 0.0f);
+    singular |= (det == 0.0f);
+    invDet = (1.0f - zero) / (det + zero);
+
+    tileInv[0][l] = c00 * invDet;
+    tileInv[1][l] = (a02 * a21 - a01 * a22) * invDet;
+    tileInv[2][l] = (a01 * a12 - a02 * a11) * invDet;
+    tileInv[3][l] = c01 * invDet;
+    tileInv[4][l] = (a00 * a22 - a02 * a20) * invDet;
+    tileInv[5][l] = (a02 * a10 - a00 * a12) * invDet;
+    tileInv[6][l] = c02 * invDet;
+    tileInv[7][l] = (a01 * a20 - a00 * a21) * invDet;
+    tileInv[8][l] = (a00 * a11 - a01 * a10) * invDet;
+  }
+
+  for (i = 0U; i < 9U; i++)
+  {
+    for (l = 0U; l < numLanes; l++)
+    {
+      pDst[l] = tileInv[i][l];
+    }
+    pDst += N;
+  }
+
+  return (singular);
+}
+
+/* Inverse of numLanes consecutive 4x4 matrices, returns non zero if one is singular */
+__STATIC_FORCEINLINE uint32_t arm_mat_inverse_batch_4x4_block_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t N,
+        uint32_t numLanes)
+{
+  float32_t tile[16][ARM_MAT_BATCH_LANES];
+  float32_t tileInv[16][ARM_MAT_BATCH_LANES];
+  float32_t a00, a01, a02, a03, a10, a11, a12, a13;
+  float32_t a20, a21, a22, a23, a30, a31, a32, a33;
+  float32_t s0, s1, s2, s3, s4, s5;              /* 2x2 minors of the upper rows */
+  float32_t c0, c1, c2, c3, c4, c5;              /* 2x2 minors of the lower rows */
+  float32_t det, invDet, zero;
+  uint32_t singular = 0U;
+  uint32_t i, l;
+
+  for (i = 0U; i < 16U; i++)
+  {
+    for (l = 0U; l < numLanes; l++)
+    {
+      tile[i][l] = pSrc[l];
+    }
+    pSrc += N;
+  }
+
+  for (l = 0U; l < numLanes; l++)
+  {
+    a00 = tile[0][l]; a01 = tile[1][l]; a02 = tile[2][l]; a03 = tile[3][l];
+    a10 = tile[4][l]; a11 = tile[5][l]; a12 = tile[6][l]; a13 = tile[7][l];
+    a20 = tile[8][l]; a21 = tile[9][l]; a22 = tile[10][l]; a23 = tile[11][l];
+    a30 = tile[12][l]; a31 = tile[13][l]; a32 = tile[14][l]; a33 = tile[15][l];
+
+    s0 = a00 * a11 - a10 * a01;
+    s1 = a00 * a12 - a10 * a02;
+    s2 = a00 * a13 - a10 * a03;
+    s3 = a01 * a12 - a11 * a02;
+    s4 = a01 * a13 - a11 * a03;
+    s5 = a02 * a13 - a12 * a03;
+
+    c0 = a20 * a31 - a30 * a21;
+    c1 = a20 * a32 - a30 * a22;
+    c2 = a20 * a33 - a30 * a23;
+    c3 = a21 * a32 - a31 * a22;
+    c4 = a21 * a33 - a31 * a23;
+    c5 = a22 * a33 - a32 * a23;
+
+    det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    /* invDet is 1/det, or 0 when det is 0, computed without branch */
+    zero = (float32_t)(det == 0.0f);
+    singular |= (det == 0.0f);
+    invDet = (1.0f - zero) / (det + zero);
+
+    tileInv[0][l] = ( a11 * c5 - a12 * c4 + a13 * c3) * invDet;
+    tileInv[1][l] = (-a01 * c5 + a02 * c4 - a03 * c3) * invDet;
+    tileInv[2][l] = ( a31 * s5 - a32 * s4 + a33 * s3) * invDet;
+    tileInv[3][l] = (-a21 * s5 + a22 * s4 - a23 * s3) * invDet;
+
+    tileInv[4][l] = (-a10 * c5 + a12 * c2 - a13 * c1) * invDet;
+    tileInv[5][l] = ( a00 * c5 - a02 * c2 + a03 * c1) * invDet;
+    tileInv[6][l] = (-a30 * s5 + a32 * s2 - a33 * s1) * invDet;
+    tileInv[7][l] = ( a20 * s5 - a22 * s2 + a23 * s1) * invDet;
+
+    tileInv[8][l] = ( a10 * c4 - a11 * c2 + a13 * c0) * invDet;
+    tileInv[9][l] = (-a00 * c4 + a01 * c2 - a03 * c0) * invDet;
+    tileInv[10][l] = ( a30 * s4 - a31 * s2 + a33 * s0) * invDet;
+    tileInv[11][l] = (-a20 * s4 + a21 * s2 - a23 * s0) * invDet;
+
+    tileInv[12][l] = (-a10 * c3 + a11 * c1 - a12 * c0) * invDet;
+    tileInv[13][l] = ( a00 * c3 - a01 * c1 + a02 * c0) * invDet;
+    tileInv[14][l] = (-a30 * s3 + a31 * s1 - a32 * s0) * invDet;
+    tileInv[15][l] = ( a20 * s3 - a21 * s1 + a22 * s0) * invDet;
+  }
+
+  for (i = 0U; i < 16U; i++)
+  {
+    for (l = 0U; l < numLanes; l++)
+    {
+      pDst[l] = tileInv[i][l];
+    }
+    pDst += N;
+  }
+
+  return (singular);
+}
+
+/**
+  @brief         Floating-point batched 3x3 matrix inversion.
+  @param[in]     pSrc         points to the batch of input matrices
+  @param[out]    pDst         points to the batch of output matrices
+  @param[in]     numMatrices  number of matrices in the batch
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS   : Operation successful
+                   - \ref ARM_MATH_SINGULAR  : At least one of the matrices is singular
+
+  @par           The inverse is the adjugate divided by the determinant, which has no
+                   data dependent branch. The inverse of a singular matrix is set to zero
+                   and the other matrices of the batch are still inverted.
+                   pDst must not overlap pSrc.
+ */
+arm_status arm_mat_inverse_batch_3x3_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numMatrices)
+{
+  uint32_t singular = 0U;
+  uint32_t blkCnt = numMatrices / ARM_MAT_BATCH_LANES;
+
+  while (blkCnt > 0U)
+  {
+    singular |= arm_mat_inverse_batch_3x3_block_f32(pSrc, pDst, numMatrices, ARM_MAT_BATCH_LANES);
+
+    pSrc += ARM_MAT_BATCH_LANES;
+    pDst += ARM_MAT_BATCH_LANES;
+
+    blkCnt--;
+  }
+
+  blkCnt = numMatrices % ARM_MAT_BATCH_LANES;
+  if (blkCnt > 0U)
+  {
+    singular |= arm_mat_inverse_batch_3x3_block_f32(pSrc, pDst, numMatrices, blkCnt);
+  }
+
+  return ((singular != 0U) ? ARM_MATH_SINGULAR : ARM_MATH_SUCCESS);
+}
+
+/**
+  @brief         Floating-point batched 4x4 matrix inversion.
+  @param[in]     pSrc         points to the batch of input matrices
+  @param[out]    pDst         points to the batch of output matrices
+  @param[in]     numMatrices  number of matrices in the batch
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS   : Operation successful
+                   - \ref ARM_MATH_SINGULAR  : At least one of the matrices is singular
+
+  @par           The inverse is computed from the 2x2 minors of the two upper rows and
+                   of the two lower rows (Laplace expansion), which has no data dependent
+                   branch. The inverse of a singular matrix is set to zero and the other
+                   matrices of the batch are still inverted.
+                   pDst must not overlap pSrc.
+ */
+arm_status arm_mat_inverse_batch_4x4_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numMatrices)
+{
+  uint32_t singular = 0U;
+  uint32_t blkCnt = numMatrices / ARM_MAT_BATCH_LANES;
+
+  while (blkCnt > 0U)
+  {
+    singular |= arm_mat_inverse_batch_4x4_block_f32(pSrc, pDst, numMatrices, ARM_MAT_BATCH_LANES);
+
+    pSrc += ARM_MAT_BATCH_LANES;
+    pDst += ARM_MAT_BATCH_LANES;
+
+    blkCnt--;
+  }
+
+  blkCnt = numMatrices % ARM_MAT_BATCH_LANES;
+  if (blkCnt > 0U)
+  {
+    singular |= arm_mat_inverse_batch_4x4_block_f32(pSrc, pDst, numMatrices, blkCnt);
+  }
+
+  return ((singular != 0U) ? ARM_MATH_SINGULAR : ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MatrixBatch group
+ */
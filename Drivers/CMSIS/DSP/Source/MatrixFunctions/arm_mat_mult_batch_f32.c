@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_batch_f32.c
+ * Description:  Floating-point batched multiplication of small matrices
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixBatch Batched Small Matrices
+
+  Operations on many independent 3x3 or 4x4 matrices with a single call.
+  The instance setup, size checks and loop setup of the generic functions
+  are paid once for the whole batch.
+
+  The matrices are stored as a structure of arrays: element (i,j) of all
+  the matrices is contiguous, so element (i,j) of matrix b of a batch of
+  <code>numMatrices</code> d x d matrices is at
+  <pre>
+      pData[(i*d + j)*numMatrices + b]
+  </pre>
+  and component i of vector b is at <code>pData[i*numMatrices + b]</code>.
+
+  The sizes are fixed at compile time so the per-matrix arithmetic is fully
+  unrolled. The matrices are processed by blocks of 4 whose results are kept
+  in a local tile: the same element of the 4 matrices is contiguous in memory,
+  so a vectorizing compiler computes one matrix per lane of a 128-bit vector
+  (see ARM_MATH_AUTOVECTORIZE).
+ */
+
+/**
+  @addtogroup MatrixBatch
+  @{
+ */
+
+/* Number of matrices computed together */
+#define ARM_MAT_BATCH_LANES 4U
+
+/* C = A * B for numLanes consecutive matrices of size dim x dim, dim being a constant.
+   The operands are copied in local tiles so that the arithmetic cannot alias
+   the memory and the lanes of a tile map onto vector registers. */
+__STATIC_FORCEINLINE void arm_mat_mult_batch_block_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t dim,
+        uint32_t stride,
+        uint32_t numLanes)
+{
+  float32_t tileA[16][ARM_MAT_BATCH_LANES];
+  float32_t tileB[16][ARM_MAT_BATCH_LANES];
+  float32_t tileC[16][ARM_MAT_BATCH_LANES];
+  uint32_t e, i, j, k, l;
+
+  for (e = 0U; e < dim * dim; e++)
+  {
+    for (l = 0U; l < numLanes; l++)
+    {
+      tileA[e][l] = pSrcA[l];
+      tileB[e][l] = pSrcB[l];
+    }
+    pSrcA += stride;
+    pSrcB += stride;
+  }
+
+  for (i = 0U; i < dim; i++)
+  {
+    for (j = 0U; j < dim; j++)
+    {
+      for (l = 0U; l < numLanes; l++)
+      {
+        tileC[i * dim + j][l] = tileA[i * dim][l] * tileB[j][l];
+      }
+      for (k = 1U; k < dim; k++)
+      {
+        for (l = 0U; l < numLanes; l++)
+        {
+          tileC[i * dim + j][l] += tileA[i * dim + k][l] * tileB[k * dim + j][l];
+        }
+      }
+    }
+  }
+
+  for (e = 0U; e < dim * dim; e++)
+  {
+    for (l = 0U; l < numLanes; l++)
+    {
+      pDst[l] = tileC[e][l];
+    }
+    pDst += stride;
+  }
+}
+
+/* C = A * B for numMatrices matrices of size dim x dim, dim being a constant */
+__STATIC_FORCEINLINE void arm_mat_mult_batch_dim_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t dim,
+        uint32_t numMatrices)
+{
+  uint32_t blkCnt = numMatrices / ARM_MAT_BATCH_LANES;
+
+  while (blkCnt > 0U)
+  {
+    arm_mat_mult_batch_block_f32(pSrcA, pSrcB, pDst, dim, numMatrices, ARM_MAT_BATCH_LANES);
+
+    pSrcA += ARM_MAT_BATCH_LANES;
+    pSrcB += ARM_MAT_BATCH_LANES;
+    pDst += ARM_MAT_BATCH_LANES;
+
+    blkCnt--;
+  }
+
+  blkCnt = numMatrices % ARM_MAT_BATCH_LANES;
+  if (blkCnt > 0U)
+  {
+    arm_mat_mult_batch_block_f32(pSrcA, pSrcB, pDst, dim, numMatrices, blkCnt);
+  }
+}
+
+/**
+  @brief         Floating-point batched 3x3 matrix multiplication.
+  @param[in]     pSrcA        points to the first batch of input matrices
+  @param[in]     pSrcB        points to the second batch of input matrices
+  @param[out]    pDst         points to the batch of output matrices
+  @param[in]     numMatrices  number of matrices in each batch
+  @return        none
+
+  @par           Computes <code>pDst[b] = pSrcA[b] * pSrcB[b]</code> for each matrix b.
+                   pDst must not overlap the inputs.
+ */
+void arm_mat_mult_batch_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t numMatrices)
+{
+  arm_mat_mult_batch_dim_f32(pSrcA, pSrcB, pDst, 3U, numMatrices);
+}
+
+/**
+  @brief         Floating-point batched 4x4 matrix multiplication.
+  @param[in]     pSrcA        points to the first batch of input matrices
+  @param[in]     pSrcB        points to the second batch of input matrices
+  @param[out]    pDst         points to the batch of output matrices
+  @param[in]     numMatrices  number of matrices in each batch
+  @return        none
+
+  @par           Computes <code>pDst[b] = pSrcA[b] * pSrcB[b]</code> for each matrix b.
+                   pDst must not overlap the inputs.
+ */
+void arm_mat_mult_batch_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t numMatrices)
+{
+  arm_mat_mult_batch_dim_f32(pSrcA, pSrcB, pDst, 4U, numMatrices);
+}
+
+/**
+  @} end of MatrixBatch group
+ */
@@ -853,6 +853,102 @@ arm_status arm_mat_mult_f32(
   return (status);
 }
 #else
+
+/*
+   Fixed-size kernels for the small square matrices found in filters.
+   The products are accumulated in the same order as the generic loop.
+ */
+__STATIC_INLINE void arm_mat_mult_f32_3x3(
+  const float32_t * pInA,
+  const float32_t * pInB,
+        float32_t * pOut)
+{
+  float32_t b00 = pInB[0], b01 = pInB[1], b02 = pInB[2];
+  float32_t b10 = pInB[3], b11 = pInB[4], b12 = pInB[5];
+  float32_t b20 = pInB[6], b21 = pInB[7], b22 = pInB[8];
+  float32_t a0, a1, a2;
+  uint32_t  row;
+
+  for (row = 0U; row < 3U; row++)
+  {
+    a0 = *pInA++;
+    a1 = *pInA++;
+    a2 = *pInA++;
+
+    *pOut++ = a0 * b00 + a1 * b10 + a2 * b20;
+    *pOut++ = a0 * b01 + a1 * b11 + a2 * b21;
+    *pOut++ = a0 * b02 + a1 * b12 + a2 * b22;
+  }
+}
+
+__STATIC_INLINE void arm_mat_mult_f32_4x4(
+  const float32_t * pInA,
+  const float32_t * pInB,
+        float32_t * pOut)
+{
+  float32_t b00 = pInB[0],  b01 = pInB[1],  b02 = pInB[2],  b03 = pInB[3];
+  float32_t b10 = pInB[4],  b11 = pInB[5],  b12 = pInB[6],  b13 = pInB[7];
+  float32_t b20 = pInB[8],  b21 = pInB[9],  b22 = pInB[10], b23 = pInB[11];
+  float32_t b30 = pInB[12], b31 = pInB[13], b32 = pInB[14], b33 = pInB[15];
+  float32_t a0, a1, a2, a3;
+  uint32_t  row;
+
+  for (row = 0U; row < 4U; row++)
+  {
+    a0 = *pInA++;
+    a1 = *pInA++;
+    a2 = *pInA++;
+    a3 = *pInA++;
+
+    *pOut++ = a0 * b00 + a1 * b10 + a2 * b20 + a3 * b30;
+    *pOut++ = a0 * b01 + a1 * b11 + a2 * b21 + a3 * b31;
+    *pOut++ = a0 * b02 + a1 * b12 + a2 * b22 + a3 * b32;
+    *pOut++ = a0 * b03 + a1 * b13 + a2 * b23 + a3 * b33;
+  }
+}
+
+__STATIC_INLINE void arm_mat_mult_f32_6x6(
+  const float32_t * pInA,
+  const float32_t * pInB,
+        float32_t * pOut)
+{
+  const float32_t *pB;
+        float32_t a, c0, c1, c2, c3, c4, c5;
+        uint32_t  row, k;
+
+  for (row = 0U; row < 6U; row++)
+  {
+    /* One row of the output is kept in registers */
+    a = *pInA++;
+    pB = pInB;
+    c0 = a * pB[0];
+    c1 = a * pB[1];
+    c2 = a * pB[2];
+    c3 = a * pB[3];
+    c4 = a * pB[4];
+    c5 = a * pB[5];
+
+    for (k = 1U; k < 6U; k++)
+    {
+      a = *pInA++;
+      pB += 6;
+      c0 += a * pB[0];
+      c1 += a * pB[1];
+      c2 += a * pB[2];
+      c3 += a * pB[3];
+      c4 += a * pB[4];
+      c5 += a * pB[5];
+    }
+
+    *pOut++ = c0;
+    *pOut++ = c1;
+    *pOut++ = c2;
+    *pOut++ = c3;
+    *pOut++ = c4;
+    *pOut++ = c5;
+  }
+}
+
 /**
  * @brief Floating-point matrix multiplication.
  * @param[in]       *pSrcA points to the first input matrix structure
@@ -860,6 +956,17 @@ arm_status arm_mat_mult_f32(
  * @param[out]      *pDst points to output matrix structure
  * @return          The function returns either
  * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @par             Square matrices of size 3, 4 and 6 use dedicated kernels.
+ *                  When ARM_MATH_LOOPUNROLL is defined, other sizes are computed
+ *                  by tiles of 2 rows x 4 columns of the output kept in registers.
+ *                  The tiles are processed one panel of 4 columns of B at a time,
+ *                  so the panel stays in the data cache of cores which have one
+ *                  while it is used by all the rows of A.
+ *                  The result is the same as with the row x column loop since
+ *                  the products are accumulated in the same order.
+ *                  Without ARM_MATH_LOOPUNROLL, other sizes use the row x column
+ *                  loop: the speedup of the tiles needs ARM_MATH_LOOPUNROLL.
  */
 arm_status arm_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcA,
@@ -876,7 +983,10 @@ arm_status arm_mat_mult_f32(
   uint16_t numRowsA = pSrcA->numRows;            /* Number of rows of input matrix A */
   uint16_t numColsB = pSrcB->numCols;            /* Number of columns of input matrix B */
   uint16_t numColsA = pSrcA->numCols;            /* Number of columns of input matrix A */
-  uint32_t col, i = 0U, row = numRowsA, colCnt;  /* Loop counters */
+  uint32_t col, row = numRowsA, colCnt;          /* Loop counters */
+#if !defined (ARM_MATH_LOOPUNROLL)
+  uint32_t i = 0U;                               /* Output row offset */
+#endif
   arm_status status;                             /* Status of matrix multiplication */
 
 #ifdef ARM_MATH_MATRIX_CHECK
@@ -894,6 +1004,154 @@ arm_status arm_mat_mult_f32(
 #endif /* #ifdef ARM_MATH_MATRIX_CHECK */
 
   {
+    /* small squared matrix specialized routines */
+    if ((numRowsA == numColsB) && (numColsB == numColsA))
+    {
+      if (numRowsA == 3U)
+      {
+        arm_mat_mult_f32_3x3(pInA, pInB, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+      else if (numRowsA == 4U)
+      {
+        arm_mat_mult_f32_4x4(pInA, pInB, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+      else if (numRowsA == 6U)
+      {
+        arm_mat_mult_f32_6x6(pInA, pInB, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+    }
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    {
+      float32_t *pA0, *pA1;                      /* Pointers to the two rows of A */
+      float32_t a0, a1, b0, b1, b2, b3;          /* Temporary variables */
+      float32_t c00, c01, c02, c03;              /* Accumulators of the first row of the tile */
+      float32_t c10, c11, c12, c13;              /* Accumulators of the second row of the tile */
+
+      /* Panels of 4 columns of B */
+      for (col = 0U; (col + 4U) <= numColsB; col += 4U)
+      {
+        pInA = pSrcA->pData;
+        px = pOut + col;
+
+        /* Tiles of 2 rows x 4 columns */
+        row = numRowsA >> 1U;
+        while (row > 0U)
+        {
+          pA0 = pInA;
+          pA1 = pInA + numColsA;
+          pIn2 = pInB + col;
+
+          c00 = c01 = c02 = c03 = 0.0f;
+          c10 = c11 = c12 = c13 = 0.0f;
+
+          colCnt = numColsA;
+          while (colCnt > 0U)
+          {
+            a0 = *pA0++;
+            a1 = *pA1++;
+
+            b0 = pIn2[0];
+            b1 = pIn2[1];
+            b2 = pIn2[2];
+            b3 = pIn2[3];
+            pIn2 += numColsB;
+
+            c00 += a0 * b0;
+            c01 += a0 * b1;
+            c02 += a0 * b2;
+            c03 += a0 * b3;
+
+            c10 += a1 * b0;
+            c11 += a1 * b1;
+            c12 += a1 * b2;
+            c13 += a1 * b3;
+
+            colCnt--;
+          }
+
+          px[0] = c00;
+          px[1] = c01;
+          px[2] = c02;
+          px[3] = c03;
+          px += numColsB;
+
+          px[0] = c10;
+          px[1] = c11;
+          px[2] = c12;
+          px[3] = c13;
+          px += numColsB;
+
+          pInA += 2U * numColsA;
+          row--;
+        }
+
+        /* Last row when the number of rows is odd */
+        if ((numRowsA & 1U) != 0U)
+        {
+          pA0 = pInA;
+          pIn2 = pInB + col;
+
+          c00 = c01 = c02 = c03 = 0.0f;
+
+          colCnt = numColsA;
+          while (colCnt > 0U)
+          {
+            a0 = *pA0++;
+
+            c00 += a0 * pIn2[0];
+            c01 += a0 * pIn2[1];
+            c02 += a0 * pIn2[2];
+            c03 += a0 * pIn2[3];
+            pIn2 += numColsB;
+
+            colCnt--;
+          }
+
+          px[0] = c00;
+          px[1] = c01;
+          px[2] = c02;
+          px[3] = c03;
+        }
+      }
+
+      /* Remaining columns of B */
+      for (; col < numColsB; col++)
+      {
+        pInA = pSrcA->pData;
+        px = pOut + col;
+
+        row = numRowsA;
+        while (row > 0U)
+        {
+          pIn1 = pInA;
+          pIn2 = pInB + col;
+          sum = 0.0f;
+
+          colCnt = numColsA;
+          while (colCnt > 0U)
+          {
+            sum += *pIn1++ * *pIn2;
+            pIn2 += numColsB;
+
+            colCnt--;
+          }
+
+          *px = sum;
+          px += numColsB;
+
+          pInA += numColsA;
+          row--;
+        }
+      }
+    }
+
+#else
+
     /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
     /* row loop */
     do
@@ -916,43 +1174,9 @@ arm_status arm_mat_mult_f32(
         /* Initialize pointer pIn1 to point to starting address of column being processed */
         pIn1 = pInA;
 
-#if defined (ARM_MATH_LOOPUNROLL)
-
-        /* Loop unrolling: Compute 4 MACs at a time. */
-        colCnt = numColsA >> 2U;
-
-        /* matrix multiplication */
-        while (colCnt > 0U)
-        {
-          /* c(m,p) = a(m,1) * b(1,p) + a(m,2) * b(2,p) + .... + a(m,n) * b(n,p) */
-
-          /* Perform the multiply-accumulates */
-          sum += *pIn1++ * *pIn2;
-          pIn2 += numColsB;
-
-          sum += *pIn1++ * *pIn2;
-          pIn2 += numColsB;
-
-          sum += *pIn1++ * *pIn2;
-          pIn2 += numColsB;
-
-          sum += *pIn1++ * *pIn2;
-          pIn2 += numColsB;
-
-          /* Decrement loop counter */
-          colCnt--;
-        }
-
-        /* Loop unrolling: Compute remaining MACs */
-        colCnt = numColsA % 0x4U;
-
-#else
-
         /* Initialize cntCnt with number of columns */
         colCnt = numColsA;
 
-#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
-
         while (colCnt > 0U)
         {
           /* c(m,p) = a(m,1) * b(1,p) + a(m,2) * b(2,p) + .... + a(m,n) * b(n,p) */
@@ -985,6 +1209,8 @@ arm_status arm_mat_mult_f32(
 
     } while (row > 0U);
 
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
     /* Set status as ARM_MATH_SUCCESS */
     status = ARM_MATH_SUCCESS;
   }
@@ -0,0 +1,194 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_trans_acc_f32.c
+ * Description:  Floating-point matrix multiplication by a transposed matrix
+ *               with accumulation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/* Largest number of float32_t elements whose offsets in bytes fit in 32 bits */
+#define ARM_MAT_MAX_ELEMENTS_F32 (UINT32_MAX / sizeof(float32_t))
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix multiplication by a transposed matrix with accumulation.
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcB      points to the second input matrix structure
+  @param[in,out] pDst       points to the accumulated output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed, or a matrix
+                                                    has more elements than can be addressed
+
+  @par           Computes <code>pDst = pDst + pSrcA * pSrcB'</code>.
+                 The transposition of B is never materialized: element (i,j)
+                 of the product is the dot product of row i of A and row j of B,
+                 so both operands are read along contiguous rows.
+                 This is the usual update of covariance matrices
+                 (<code>P*H'</code>, <code>F*P*F'</code>) and removes the
+                 call to \ref arm_mat_trans_f32, its temporary buffer and the
+                 separate \ref arm_mat_add_f32.
+
+  @par           The output is computed by tiles of 2 rows x 4 columns kept in registers,
+                 with or without ARM_MATH_LOOPUNROLL.
+                 pDst must not overlap pSrcA or pSrcB.
+
+  @par           With ARM_MATH_MATRIX_CHECK, the number of elements (numRows * numCols)
+                 of each matrix is also checked: its size in bytes must fit in 32 bits
+                 so that the offsets of the rows do not wrap around.
+ */
+arm_status arm_mat_mult_trans_acc_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pInA = pSrcA->pData;         /* Input data matrix pointer A */
+  const float32_t *pInB = pSrcB->pData;         /* Input data matrix pointer B */
+  const float32_t *pA0, *pA1;                   /* Pointers to two rows of A */
+  const float32_t *pB0, *pB1, *pB2, *pB3;       /* Pointers to four rows of B */
+        float32_t *pOut;                        /* Output data matrix pointer */
+        float32_t a0, a1, b0, b1, b2, b3;       /* Temporary variables */
+        float32_t c00, c01, c02, c03;           /* Accumulators of the first row of the tile */
+        float32_t c10, c11, c12, c13;           /* Accumulators of the second row of the tile */
+        uint32_t numRowsA = pSrcA->numRows;     /* Number of rows of input matrix A */
+        uint32_t numRowsB = pSrcB->numRows;     /* Number of rows of input matrix B */
+        uint32_t numCols = pSrcA->numCols;      /* Length of the dot products */
+        uint32_t row, col, k;                   /* Loop counters */
+        arm_status status;                      /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numCols) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numRows != pDst->numCols)  ||
+      (((uint32_t)pSrcA->numRows * pSrcA->numCols) > ARM_MAT_MAX_ELEMENTS_F32) ||
+      (((uint32_t)pSrcB->numRows * pSrcB->numCols) > ARM_MAT_MAX_ELEMENTS_F32) ||
+      (((uint32_t)pDst->numRows  * pDst->numCols)  > ARM_MAT_MAX_ELEMENTS_F32)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* Pairs of rows of A */
+    for (row = 0U; row < numRowsA; row += 2U)
+    {
+      pA0 = pInA + row * numCols;
+      pA1 = (row + 1U < numRowsA) ? pA0 + numCols : pA0;
+      pOut = pDst->pData + row * numRowsB;
+
+      /* Groups of 4 rows of B */
+      for (col = 0U; (col + 4U) <= numRowsB; col += 4U)
+      {
+        pB0 = pInB + col * numCols;
+        pB1 = pB0 + numCols;
+        pB2 = pB1 + numCols;
+        pB3 = pB2 + numCols;
+
+        c00 = c01 = c02 = c03 = 0.0f;
+        c10 = c11 = c12 = c13 = 0.0f;
+
+        for (k = 0U; k < numCols; k++)
+        {
+          a0 = pA0[k];
+          a1 = pA1[k];
+          b0 = pB0[k];
+          b1 = pB1[k];
+          b2 = pB2[k];
+          b3 = pB3[k];
+
+          c00 += a0 * b0;
+          c01 += a0 * b1;
+          c02 += a0 * b2;
+          c03 += a0 * b3;
+
+          c10 += a1 * b0;
+          c11 += a1 * b1;
+          c12 += a1 * b2;
+          c13 += a1 * b3;
+        }
+
+        pOut[col]      += c00;
+        pOut[col + 1U] += c01;
+        pOut[col + 2U] += c02;
+        pOut[col + 3U] += c03;
+
+        /* The second row of the tile is dropped when the number of rows of A is odd */
+        if (pA1 != pA0)
+        {
+          pOut[numRowsB + col]      += c10;
+          pOut[numRowsB + col + 1U] += c11;
+          pOut[numRowsB + col + 2U] += c12;
+          pOut[numRowsB + col + 3U] += c13;
+        }
+      }
+
+      /* Remaining rows of B */
+      for (; col < numRowsB; col++)
+      {
+        pB0 = pInB + col * numCols;
+
+        c00 = 0.0f;
+        c10 = 0.0f;
+
+        for (k = 0U; k < numCols; k++)
+        {
+          b0 = pB0[k];
+          c00 += pA0[k] * b0;
+          c10 += pA1[k] * b0;
+        }
+
+        pOut[col] += c00;
+        if (pA1 != pA0)
+        {
+          pOut[numRowsB + col] += c10;
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
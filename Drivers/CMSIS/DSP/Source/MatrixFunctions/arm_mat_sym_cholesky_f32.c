@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_sym_cholesky_f32.c
+ * Description:  Floating-point Cholesky decomposition of a packed symmetric matrix
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixSym
+  @{
+ */
+
+/**
+  @brief         Floating-point Cholesky decomposition of a packed symmetric positive-definite matrix.
+  @param[in]     src  points to the instance of the input matrix structure
+  @param[out]    dst  points to the instance of the packed lower triangular factor
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH          : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE  : Input matrix cannot be decomposed
+
+  @par           Computes L such that A = L * L'. L is stored in the same packed format.
+                   Row i of L is obtained from dot products of the beginning of row i with
+                   the previous rows, which are all contiguous in the packed storage.
+                   The decomposition can be done in-place.
+ */
+arm_status arm_mat_sym_cholesky_f32(
+  const arm_matrix_sym_instance_f32 * src,
+        arm_matrix_sym_instance_f32 * dst)
+{
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if (src->numRows != dst->numRows)
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const float32_t *pA = src->pData;
+          float32_t *pL = dst->pData;
+          float32_t *pRowI, *pRowJ;
+          float32_t sum;
+          uint32_t n = src->numRows;
+          uint32_t i, j, k;
+
+    for (i = 0U; i < n; i++)
+    {
+      pRowI = pL + ((i * (i + 1U)) >> 1U);
+
+      for (j = 0U; j <= i; j++)
+      {
+        pRowJ = pL + ((j * (j + 1U)) >> 1U);
+
+        sum = pA[((i * (i + 1U)) >> 1U) + j];
+        for (k = 0U; k < j; k++)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+        }
+
+        if (j < i)
+        {
+          pRowI[j] = sum / pRowJ[j];
+        }
+        else
+        {
+          if (sum <= 0.0f)
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+          pRowI[i] = sqrtf(sum);
+        }
+      }
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixSym group
+ */
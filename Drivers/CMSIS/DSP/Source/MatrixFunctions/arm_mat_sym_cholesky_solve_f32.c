@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_sym_cholesky_solve_f32.c
+ * Description:  Floating-point solve from the Cholesky factor of a packed symmetric matrix
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixSym
+  @{
+ */
+
+/**
+  @brief         Solve A x = b from the packed Cholesky factor of A.
+  @param[in]     l    points to the packed lower triangular factor computed by \ref arm_mat_sym_cholesky_f32
+  @param[in]     pB   points to the right hand side vector
+  @param[out]    pX   points to the solution vector
+  @return        none
+
+  @par           Solves L y = b by forward substitution along the packed rows,
+                   then L' x = y by backward substitution along the same rows.
+                   pX can be the same buffer as pB.
+ */
+void arm_mat_sym_cholesky_solve_f32(
+  const arm_matrix_sym_instance_f32 * l,
+  const float32_t * pB,
+        float32_t * pX)
+{
+  const float32_t *pL = l->pData;            /* Packed lower triangular factor */
+  const float32_t *pRow;                     /* Current row of L */
+        uint32_t n = l->numRows;             /* Order of the matrix */
+        float32_t sum, xi;                   /* Temporary variables */
+        uint32_t i, j;                       /* Loop counters */
+
+  /* L y = b */
+  pRow = pL;
+  for (i = 0U; i < n; i++)
+  {
+    sum = pB[i];
+    for (j = 0U; j < i; j++)
+    {
+      sum -= pRow[j] * pX[j];
+    }
+    pX[i] = sum / pRow[i];
+    pRow += i + 1U;
+  }
+
+  /* L' x = y, row i of L is column i of L' */
+  for (i = n; i > 0U; i--)
+  {
+    pRow -= i;
+    xi = pX[i - 1U] / pRow[i - 1U];
+    pX[i - 1U] = xi;
+
+    for (j = 0U; j < i - 1U; j++)
+    {
+      pX[j] -= pRow[j] * xi;
+    }
+  }
+}
+
+/**
+  @} end of MatrixSym group
+ */
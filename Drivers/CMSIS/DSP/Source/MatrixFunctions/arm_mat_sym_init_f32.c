@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_sym_init_f32.c
+ * Description:  Floating-point packed symmetric matrix initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixSym Packed Symmetric Matrices
+
+  Symmetric matrices, like covariance matrices, are stored as their lower
+  triangle packed row by row in \ref arm_matrix_sym_instance_f32.
+  An n x n matrix uses <code>n*(n+1)/2</code> values instead of <code>n*n</code>.
+
+  Element (i,j) with <code>j <= i</code> is at <code>pData[i*(i+1)/2 + j]</code>,
+  so each row of the lower triangle is contiguous in memory:
+  <pre>
+      a00
+      a10 a11
+      a20 a21 a22
+      ...
+  </pre>
+  The multiplication, Cholesky decomposition and solve functions work directly
+  on the packed storage and only touch the stored triangle.
+ */
+
+/**
+  @addtogroup MatrixSym
+  @{
+ */
+
+/**
+  @brief         Floating-point packed symmetric matrix initialization.
+  @param[in,out] S         points to an instance of the packed symmetric matrix structure
+  @param[in]     nRows     number of rows and columns of the matrix
+  @param[in]     pData     points to the packed lower triangle
+  @return        none
+ */
+void arm_mat_sym_init_f32(
+  arm_matrix_sym_instance_f32 * S,
+  uint16_t nRows,
+  float32_t * pData)
+{
+  /* Assign order of the matrix */
+  S->numRows = nRows;
+
+  /* Assign Data pointer */
+  S->pData = pData;
+}
+
+/**
+  @} end of MatrixSym group
+ */
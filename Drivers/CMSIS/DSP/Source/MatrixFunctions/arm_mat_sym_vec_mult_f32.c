@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_sym_vec_mult_f32.c
+ * Description:  Floating-point packed symmetric matrix and vector multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixSym
+  @{
+ */
+
+/**
+  @brief         Floating-point packed symmetric matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to input vector
+  @param[out]    pDst     points to output vector
+  @return        none
+
+  @par           Each stored element a(i,j) is used twice, for row i and for row j,
+                   so the packed triangle is read once.
+                   pDst must not overlap pVec.
+ */
+void arm_mat_sym_vec_mult_f32(
+  const arm_matrix_sym_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst)
+{
+  const float32_t *pA = pSrcMat->pData;      /* Packed lower triangle */
+        uint32_t n = pSrcMat->numRows;       /* Order of the matrix */
+        float32_t xi, a, sum;                /* Temporary variables */
+        uint32_t i, j;                       /* Loop counters */
+
+  for (i = 0U; i < n; i++)
+  {
+    xi = pVec[i];
+    sum = 0.0f;
+
+    /* Strictly lower part of row i, also the upper part of column i */
+    for (j = 0U; j < i; j++)
+    {
+      a = *pA++;
+      sum += a * pVec[j];
+      pDst[j] += a * xi;
+    }
+
+    /* Diagonal element */
+    pDst[i] = sum + *pA++ * xi;
+  }
+}
+
+/**
+  @} end of MatrixSym group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_trans_batch_f32.c
+ * Description:  Floating-point batched transposition of small matrices
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBatch
+  @{
+ */
+
+/* Dst = Src' for numMatrices matrices of size dim x dim, dim being a constant */
+__STATIC_FORCEINLINE void arm_mat_trans_batch_dim_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t dim,
+        uint32_t numMatrices)
+{
+  uint32_t i, j;
+
+  /* With the structure of arrays layout, a transposition moves whole element arrays */
+  for (i = 0U; i < dim; i++)
+  {
+    for (j = 0U; j < dim; j++)
+    {
+      memcpy(&pDst[(j * dim + i) * numMatrices],
+             &pSrc[(i * dim + j) * numMatrices],
+             numMatrices * sizeof(float32_t));
+    }
+  }
+}
+
+/**
+  @brief         Floating-point batched 3x3 matrix transposition.
+  @param[in]     pSrc         points to the batch of input matrices
+  @param[out]    pDst         points to the batch of output matrices
+  @param[in]     numMatrices  number of matrices in the batch
+  @return        none
+
+  @par           pDst must not overlap pSrc.
+ */
+void arm_mat_trans_batch_3x3_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numMatrices)
+{
+  arm_mat_trans_batch_dim_f32(pSrc, pDst, 3U, numMatrices);
+}
+
+/**
+  @brief         Floating-point batched 4x4 matrix transposition.
+  @param[in]     pSrc         points to the batch of input matrices
+  @param[out]    pDst         points to the batch of output matrices
+  @param[in]     numMatrices  number of matrices in the batch
+  @return        none
+
+  @par           pDst must not overlap pSrc.
+ */
+void arm_mat_trans_batch_4x4_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t numMatrices)
+{
+  arm_mat_trans_batch_dim_f32(pSrc, pDst, 4U, numMatrices);
+}
+
+/**
+  @} end of MatrixBatch group
+ */
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_batch_f32.c
+ * Description:  Floating-point batched multiplication of small matrices and vectors
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBatch
+  @{
+ */
+
+/* Number of matrices computed together */
+#define ARM_MAT_BATCH_LANES 4U
+
+/* y = M * x for numLanes consecutive matrices of size dim x dim, dim being a constant.
+   The operands are copied in local tiles so that the arithmetic cannot alias
+   the memory and the lanes of a tile map onto vector registers. */
+__STATIC_FORCEINLINE void arm_mat_vec_mult_batch_block_f32(
+  const float32_t * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst,
+        uint32_t dim,
+        uint32_t stride,
+        uint32_t numLanes)
+{
+  float32_t tileM[16][ARM_MAT_BATCH_LANES];
+  float32_t tileX[4][ARM_MAT_BATCH_LANES];
+  float32_t tileY[4][ARM_MAT_BATCH_LANES];
+  uint32_t e, i, k, l;
+
+  for (e = 0U; e < dim * dim; e++)
+  {
+    for (l = 0U; l < numLanes; l++)
+    {
+      tileM[e][l] = pSrcMat[l];
+    }
+    pSrcMat += stride;
+  }
+
+  for (e = 0U; e < dim; e++)
+  {
+    for (l = 0U; l < numLanes; l++)
+    {
+      tileX[e][l] = pVec[l];
+    }
+    pVec += stride;
+  }
+
+  for (i = 0U; i < dim; i++)
+  {
+    for (l = 0U; l < numLanes; l++)
+    {
+      tileY[i][l] = tileM[i * dim][l] * tileX[0][l];
+    }
+    for (k = 1U; k < dim; k++)
+    {
+      for (l = 0U; l < numLanes; l++)
+      {
+        tileY[i][l] += tileM[i * dim + k][l] * tileX[k][l];
+      }
+    }
+  }
+
+  for (e = 0U; e < dim; e++)
+  {
+    for (l = 0U; l < numLanes; l++)
+    {
+      pDst[l] = tileY[e][l];
+    }
+    pDst += stride;
+  }
+}
+
+/* y = M * x for numMatrices matrices of size dim x dim, dim being a constant */
+__STATIC_FORCEINLINE void arm_mat_vec_mult_batch_dim_f32(
+  const float32_t * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst,
+        uint32_t dim,
+        uint32_t numMatrices)
+{
+  uint32_t blkCnt = numMatrices / ARM_MAT_BATCH_LANES;
+
+  while (blkCnt > 0U)
+  {
+    arm_mat_vec_mult_batch_block_f32(pSrcMat, pVec, pDst, dim, numMatrices, ARM_MAT_BATCH_LANES);
+
+    pSrcMat += ARM_MAT_BATCH_LANES;
+    pVec += ARM_MAT_BATCH_LANES;
+    pDst += ARM_MAT_BATCH_LANES;
+
+    blkCnt--;
+  }
+
+  blkCnt = numMatrices % ARM_MAT_BATCH_LANES;
+  if (blkCnt > 0U)
+  {
+    arm_mat_vec_mult_batch_block_f32(pSrcMat, pVec, pDst, dim, numMatrices, blkCnt);
+  }
+}
+
+/**
+  @brief         Floating-point batched 3x3 matrix and vector multiplication.
+  @param[in]     pSrcMat      points to the batch of input matrices
+  @param[in]     pVec         points to the batch of input vectors
+  @param[out]    pDst         points to the batch of output vectors
+  @param[in]     numMatrices  number of matrices and vectors in each batch
+  @return        none
+
+  @par           pDst must not overlap the inputs.
+ */
+void arm_mat_vec_mult_batch_3x3_f32(
+  const float32_t * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst,
+        uint32_t numMatrices)
+{
+  arm_mat_vec_mult_batch_dim_f32(pSrcMat, pVec, pDst, 3U, numMatrices);
+}
+
+/**
+  @brief         Floating-point batched 4x4 matrix and vector multiplication.
+  @param[in]     pSrcMat      points to the batch of input matrices
+  @param[in]     pVec         points to the batch of input vectors
+  @param[out]    pDst         points to the batch of output vectors
+  @param[in]     numMatrices  number of matrices and vectors in each batch
+  @return        none
+
+  @par           pDst must not overlap the inputs.
+ */
+void arm_mat_vec_mult_batch_4x4_f32(
+  const float32_t * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst,
+        uint32_t numMatrices)
+{
+  arm_mat_vec_mult_batch_dim_f32(pSrcMat, pVec, pDst, 4U, numMatrices);
+}
+
+/**
+  @} end of MatrixBatch group
+ */
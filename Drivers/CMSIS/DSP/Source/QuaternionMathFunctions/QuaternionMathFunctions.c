@@ -32,3 +32,8 @@
 #include "arm_quaternion_product_f32.c"
 #include "arm_quaternion2rotation_f32.c"
 #include "arm_rotation2quaternion_f32.c"
+#include "arm_quaternion_product_soa_f32.c"
+#include "arm_quaternion_normalize_soa_f32.c"
+#include "arm_quaternion2rotation_soa_f32.c"
+#include "arm_attitude_init_f32.c"
+#include "arm_attitude_f32.c"
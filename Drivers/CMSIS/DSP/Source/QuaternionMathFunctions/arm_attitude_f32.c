@@ -0,0 +1,284 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_attitude_f32.c
+ * Description:  Floating-point attitude estimation from gyroscope and accelerometer
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+#include <math.h>
+
+/**
+  @ingroup groupQuaternionMath
+ */
+
+/**
+  @defgroup QuatAttitude Attitude Estimation
+
+  Streaming estimation of the attitude of an inertial measurement unit
+  as a normalized quaternion.
+
+  The attitude q rotates the body frame into the reference frame: the
+  rotation matrix of \ref arm_quaternion2rotation_f32 applied to
+  <code>S->state</code> maps a vector measured in the body frame to the
+  reference frame, whose z axis is vertical.
+
+  Each sample integrates the angular rate w (in rad/s, body frame)
+  with the quaternion derivative
+  <pre>
+      dq/dt = 1/2 q * (0, w)
+  </pre>
+  over one sampling period, and renormalizes q. The product, the
+  integration, the normalization and, for the corrected filters, the
+  gravity direction (last row of the rotation matrix) are computed in a
+  single pass over the state without intermediate arrays.
+
+  Three estimators are provided:
+  - \ref arm_attitude_gyro_f32 integrates the gyroscope only and drifts
+    with the gyroscope bias;
+  - \ref arm_attitude_complementary_f32 corrects the angular rate with the
+    cross product of the measured and estimated gravity directions, scaled
+    by the gain (proportional complementary filter);
+  - \ref arm_attitude_madgwick_f32 corrects the quaternion derivative with
+    a gradient descent step of length gain toward the measured gravity
+    direction (Madgwick filter without magnetometer).
+
+  The accelerometer corrects the roll and the pitch only; the heading
+  follows the gyroscope. An accelerometer sample equal to zero is ignored.
+  The accelerometer unit is not relevant since the measure is normalized.
+
+  The gyroscope and accelerometer samples are interleaved (x, y, z) and the
+  output receives the attitude after each sample (4 values per sample).
+ */
+
+/**
+  @addtogroup QuatAttitude
+  @{
+ */
+
+/* Quaternion derivative 1/2 q * (0, w) */
+__STATIC_FORCEINLINE void arm_attitude_rate_f32(
+  const float32_t *q,
+        float32_t gx,
+        float32_t gy,
+        float32_t gz,
+        float32_t *qDot)
+{
+  qDot[0] = 0.5f * (- q[1] * gx - q[2] * gy - q[3] * gz);
+  qDot[1] = 0.5f * (  q[0] * gx + q[2] * gz - q[3] * gy);
+  qDot[2] = 0.5f * (  q[0] * gy + q[3] * gx - q[1] * gz);
+  qDot[3] = 0.5f * (  q[0] * gz + q[1] * gy - q[2] * gx);
+}
+
+/* q = normalize(q + dt * qDot), copied to pDst */
+__STATIC_FORCEINLINE void arm_attitude_advance_f32(
+        float32_t *q,
+  const float32_t *qDot,
+        float32_t dt,
+        float32_t *pDst)
+{
+  float32_t q0 = q[0] + dt * qDot[0];
+  float32_t q1 = q[1] + dt * qDot[1];
+  float32_t q2 = q[2] + dt * qDot[2];
+  float32_t q3 = q[3] + dt * qDot[3];
+  float32_t invNorm = 1.0f / sqrtf(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+
+  q[0] = q0 * invNorm;
+  q[1] = q1 * invNorm;
+  q[2] = q2 * invNorm;
+  q[3] = q3 * invNorm;
+
+  pDst[0] = q[0];
+  pDst[1] = q[1];
+  pDst[2] = q[2];
+  pDst[3] = q[3];
+}
+
+/**
+  @brief         Floating-point attitude integration of gyroscope samples.
+  @param[in,out] S          points to an instance of the attitude structure
+  @param[in]     pGyro      points to the angular rates (3 values per sample)
+  @param[out]    pDst       points to the attitudes (4 values per sample)
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_attitude_gyro_f32(
+        arm_attitude_instance_f32 * S,
+  const float32_t * pGyro,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  float32_t *q = S->state;
+  float32_t qDot[4];
+
+  while (blockSize > 0U)
+  {
+    arm_attitude_rate_f32(q, pGyro[0], pGyro[1], pGyro[2], qDot);
+    arm_attitude_advance_f32(q, qDot, S->dt, pDst);
+
+    pGyro += 3;
+    pDst += 4;
+    blockSize--;
+  }
+}
+
+/**
+  @brief         Floating-point complementary attitude filter.
+  @param[in,out] S          points to an instance of the attitude structure
+  @param[in]     pGyro      points to the angular rates (3 values per sample)
+  @param[in]     pAccel     points to the accelerations (3 values per sample)
+  @param[out]    pDst       points to the attitudes (4 values per sample)
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par
+  The gain, in rad/s, is the proportional gain applied to the gravity
+  direction error. Its inverse is the time constant of the tilt correction.
+ */
+void arm_attitude_complementary_f32(
+        arm_attitude_instance_f32 * S,
+  const float32_t * pGyro,
+  const float32_t * pAccel,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  float32_t *q = S->state;
+  float32_t qDot[4];
+
+  while (blockSize > 0U)
+  {
+    float32_t gx = pGyro[0];
+    float32_t gy = pGyro[1];
+    float32_t gz = pGyro[2];
+    float32_t ax = pAccel[0];
+    float32_t ay = pAccel[1];
+    float32_t az = pAccel[2];
+    float32_t norm = ax * ax + ay * ay + az * az;
+
+    if (norm > 0.0f)
+    {
+      float32_t vx, vy, vz;
+
+      norm = S->gain / sqrtf(norm);
+      ax *= norm;
+      ay *= norm;
+      az *= norm;
+
+      /* Estimated gravity direction in the body frame */
+      vx = 2.0f * (q[1] * q[3] - q[0] * q[2]);
+      vy = 2.0f * (q[0] * q[1] + q[2] * q[3]);
+      vz = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+
+      /* Rotate toward the measured gravity direction */
+      gx += ay * vz - az * vy;
+      gy += az * vx - ax * vz;
+      gz += ax * vy - ay * vx;
+    }
+
+    arm_attitude_rate_f32(q, gx, gy, gz, qDot);
+    arm_attitude_advance_f32(q, qDot, S->dt, pDst);
+
+    pGyro += 3;
+    pAccel += 3;
+    pDst += 4;
+    blockSize--;
+  }
+}
+
+/**
+  @brief         Floating-point Madgwick attitude filter.
+  @param[in,out] S          points to an instance of the attitude structure
+  @param[in]     pGyro      points to the angular rates (3 values per sample)
+  @param[in]     pAccel     points to the accelerations (3 values per sample)
+  @param[out]    pDst       points to the attitudes (4 values per sample)
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par
+  The gain is the filter beta, in rad/s: the magnitude of the gyroscope
+  error the gradient step compensates for.
+ */
+void arm_attitude_madgwick_f32(
+        arm_attitude_instance_f32 * S,
+  const float32_t * pGyro,
+  const float32_t * pAccel,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  float32_t *q = S->state;
+  float32_t qDot[4];
+
+  while (blockSize > 0U)
+  {
+    float32_t ax = pAccel[0];
+    float32_t ay = pAccel[1];
+    float32_t az = pAccel[2];
+    float32_t norm = ax * ax + ay * ay + az * az;
+
+    arm_attitude_rate_f32(q, pGyro[0], pGyro[1], pGyro[2], qDot);
+
+    if (norm > 0.0f)
+    {
+      float32_t fx, fy, fz;
+      float32_t s0, s1, s2, s3;
+
+      norm = 1.0f / sqrtf(norm);
+      ax *= norm;
+      ay *= norm;
+      az *= norm;
+
+      /* Error between the estimated and the measured gravity directions */
+      fx = 2.0f * (q[1] * q[3] - q[0] * q[2]) - ax;
+      fy = 2.0f * (q[0] * q[1] + q[2] * q[3]) - ay;
+      fz = 1.0f - 2.0f * (q[1] * q[1] + q[2] * q[2]) - az;
+
+      /* Gradient: transposed Jacobian of the error times the error */
+      s0 = -2.0f * q[2] * fx + 2.0f * q[1] * fy;
+      s1 =  2.0f * q[3] * fx + 2.0f * q[0] * fy - 4.0f * q[1] * fz;
+      s2 = -2.0f * q[0] * fx + 2.0f * q[3] * fy - 4.0f * q[2] * fz;
+      s3 =  2.0f * q[1] * fx + 2.0f * q[2] * fy;
+
+      norm = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+      if (norm > 0.0f)
+      {
+        norm = S->gain / sqrtf(norm);
+        qDot[0] -= norm * s0;
+        qDot[1] -= norm * s1;
+        qDot[2] -= norm * s2;
+        qDot[3] -= norm * s3;
+      }
+    }
+
+    arm_attitude_advance_f32(q, qDot, S->dt, pDst);
+
+    pGyro += 3;
+    pAccel += 3;
+    pDst += 4;
+    blockSize--;
+  }
+}
+
+/**
+  @} end of QuatAttitude group
+ */
@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_attitude_init_f32.c
+ * Description:  Floating-point attitude estimation initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+
+/**
+  @ingroup groupQuaternionMath
+ */
+
+/**
+  @addtogroup QuatAttitude
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point attitude estimation.
+  @param[out]    S             points to an instance of the attitude structure
+  @param[in]     samplePeriod  sampling period in seconds
+  @param[in]     gain          correction gain in rad/s (not used by \ref arm_attitude_gyro_f32)
+  @return        none
+
+  @par
+  The attitude is set to the identity quaternion. An initial attitude,
+  for instance computed from a first accelerometer sample, can be written
+  to <code>S->state</code> after the initialization.
+ */
+void arm_attitude_init_f32(
+  arm_attitude_instance_f32 * S,
+  float32_t samplePeriod,
+  float32_t gain)
+{
+  S->state[0] = 1.0f;
+  S->state[1] = 0.0f;
+  S->state[2] = 0.0f;
+  S->state[3] = 0.0f;
+  S->dt = samplePeriod;
+  S->gain = gain;
+}
+
+/**
+  @} end of QuatAttitude group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quaternion2rotation_soa_f32.c
+ * Description:  Floating-point quaternion to rotation conversion in structure of arrays layout
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+
+/**
+  @ingroup groupQuaternionMath
+ */
+
+/**
+  @addtogroup QuatSoa
+  @{
+ */
+
+/* Number of quaternions computed together */
+#define ARM_QUATERNION_SOA_LANES 4U
+
+/* Conversion of numLanes consecutive quaternions */
+__STATIC_FORCEINLINE void arm_quaternion2rotation_soa_block_f32(
+  const float32_t *pSrc,
+        float32_t *pDst,
+        uint32_t stride,
+        uint32_t numLanes)
+{
+   float32_t tileQ[4][ARM_QUATERNION_SOA_LANES];
+   float32_t tileR[9][ARM_QUATERNION_SOA_LANES];
+   uint32_t c, l;
+
+   for (c = 0U; c < 4U; c++)
+   {
+      for (l = 0U; l < numLanes; l++)
+      {
+         tileQ[c][l] = pSrc[l];
+      }
+      pSrc += stride;
+   }
+
+   for (l = 0U; l < numLanes; l++)
+   {
+      float32_t q00 = SQ(tileQ[0][l]);
+      float32_t q11 = SQ(tileQ[1][l]);
+      float32_t q22 = SQ(tileQ[2][l]);
+      float32_t q33 = SQ(tileQ[3][l]);
+      float32_t q01 = tileQ[0][l] * tileQ[1][l];
+      float32_t q02 = tileQ[0][l] * tileQ[2][l];
+      float32_t q03 = tileQ[0][l] * tileQ[3][l];
+      float32_t q12 = tileQ[1][l] * tileQ[2][l];
+      float32_t q13 = tileQ[1][l] * tileQ[3][l];
+      float32_t q23 = tileQ[2][l] * tileQ[3][l];
+
+      tileR[0][l] = q00 + q11 - q22 - q33;
+      tileR[1][l] = 2*(q12 - q03);
+      tileR[2][l] = 2*(q13 + q02);
+      tileR[3][l] = 2*(q12 + q03);
+      tileR[4][l] = q00 - q11 + q22 - q33;
+      tileR[5][l] = 2*(q23 - q01);
+      tileR[6][l] = 2*(q13 - q02);
+      tileR[7][l] = 2*(q23 + q01);
+      tileR[8][l] = q00 - q11 - q22 + q33;
+   }
+
+   for (c = 0U; c < 9U; c++)
+   {
+      for (l = 0U; l < numLanes; l++)
+      {
+         pDst[l] = tileR[c][l];
+      }
+      pDst += stride;
+   }
+}
+
+/**
+  @brief         Conversion of quaternions to equivalent rotation matrices in structure of arrays layout.
+  @param[in]     pInputQuaternions   points to an array of normalized quaternions
+  @param[out]    pOutputRotations    points to an array of 3x3 rotations
+  @param[in]     nbQuaternions       number of quaternions in the array
+  @return        none
+
+  @par
+  The rotation matrices are the ones of \ref arm_quaternion2rotation_f32.
+  Element e = 3*i + j of rotation q is at <code>pOutputRotations[e*nbQuaternions + q]</code>.
+ */
+void arm_quaternion2rotation_soa_f32(const float32_t *pInputQuaternions, 
+    float32_t *pOutputRotations, 
+    uint32_t nbQuaternions)
+{
+   uint32_t blkCnt = nbQuaternions / ARM_QUATERNION_SOA_LANES;
+
+   while (blkCnt > 0U)
+   {
+      arm_quaternion2rotation_soa_block_f32(pInputQuaternions, pOutputRotations,
+                                            nbQuaternions, ARM_QUATERNION_SOA_LANES);
+      pInputQuaternions += ARM_QUATERNION_SOA_LANES;
+      pOutputRotations += ARM_QUATERNION_SOA_LANES;
+      blkCnt--;
+   }
+
+   blkCnt = nbQuaternions % ARM_QUATERNION_SOA_LANES;
+   if (blkCnt > 0U)
+   {
+      arm_quaternion2rotation_soa_block_f32(pInputQuaternions, pOutputRotations,
+                                            nbQuaternions, blkCnt);
+   }
+}
+
+/**
+  @} end of QuatSoa group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quaternion_normalize_soa_f32.c
+ * Description:  Floating-point normalization of quaternions in structure of arrays layout
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+#include <math.h>
+
+/**
+  @ingroup groupQuaternionMath
+ */
+
+/**
+  @addtogroup QuatSoa
+  @{
+ */
+
+/* Number of quaternions computed together */
+#define ARM_QUATERNION_SOA_LANES 4U
+
+/* Normalization of numLanes consecutive quaternions */
+__STATIC_FORCEINLINE void arm_quaternion_normalize_soa_block_f32(
+  const float32_t *pSrc,
+        float32_t *pDst,
+        uint32_t stride,
+        uint32_t numLanes)
+{
+   float32_t tile[4][ARM_QUATERNION_SOA_LANES];
+   float32_t invNorm[ARM_QUATERNION_SOA_LANES];
+   uint32_t c, l;
+
+   for (c = 0U; c < 4U; c++)
+   {
+      for (l = 0U; l < numLanes; l++)
+      {
+         tile[c][l] = pSrc[l];
+      }
+      pSrc += stride;
+   }
+
+   for (l = 0U; l < numLanes; l++)
+   {
+      invNorm[l] = 1.0f / sqrtf(SQ(tile[0][l]) + SQ(tile[1][l]) + SQ(tile[2][l]) + SQ(tile[3][l]));
+   }
+
+   for (c = 0U; c < 4U; c++)
+   {
+      for (l = 0U; l < numLanes; l++)
+      {
+         pDst[l] = tile[c][l] * invNorm[l];
+      }
+      pDst += stride;
+   }
+}
+
+/**
+  @brief         Floating-point normalization of quaternions in structure of arrays layout.
+  @param[in]     pInputQuaternions            points to the input array of quaternions
+  @param[out]    pNormalizedQuaternions       points to the output array of normalized quaternions
+  @param[in]     nbQuaternions                number of quaternions in each array
+  @return        none
+  @par           The normalization can be computed in place.
+ */
+void arm_quaternion_normalize_soa_f32(const float32_t *pInputQuaternions, 
+    float32_t *pNormalizedQuaternions, 
+    uint32_t nbQuaternions)
+{
+   uint32_t blkCnt = nbQuaternions / ARM_QUATERNION_SOA_LANES;
+
+   while (blkCnt > 0U)
+   {
+      arm_quaternion_normalize_soa_block_f32(pInputQuaternions, pNormalizedQuaternions,
+                                             nbQuaternions, ARM_QUATERNION_SOA_LANES);
+      pInputQuaternions += ARM_QUATERNION_SOA_LANES;
+      pNormalizedQuaternions += ARM_QUATERNION_SOA_LANES;
+      blkCnt--;
+   }
+
+   blkCnt = nbQuaternions % ARM_QUATERNION_SOA_LANES;
+   if (blkCnt > 0U)
+   {
+      arm_quaternion_normalize_soa_block_f32(pInputQuaternions, pNormalizedQuaternions,
+                                             nbQuaternions, blkCnt);
+   }
+}
+
+/**
+  @} end of QuatSoa group
+ */
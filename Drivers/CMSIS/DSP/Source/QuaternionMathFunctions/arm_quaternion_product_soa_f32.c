@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quaternion_product_soa_f32.c
+ * Description:  Floating-point product of quaternions in structure of arrays layout
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+
+/**
+  @ingroup groupQuaternionMath
+ */
+
+/**
+  @defgroup QuatSoa Quaternions in Structure of Arrays Layout
+
+  The quaternion functions working on arrays store each quaternion as
+  4 consecutive values. The variants of this group store the arrays as a
+  structure of arrays: the same component of all the quaternions is
+  contiguous, so component c of quaternion q of an array of
+  <code>nbQuaternions</code> quaternions is at
+  <pre>
+      pData[c*nbQuaternions + q]
+  </pre>
+  with the component order (a, b, c, d) of a + ib + jc + kd.
+  A rotation matrix array uses the same layout: element e of rotation q
+  is at <code>pData[e*nbQuaternions + q]</code>.
+
+  The quaternions are processed by blocks of 4 copied in local tiles:
+  the same component of the 4 quaternions is contiguous in memory, so a
+  vectorizing compiler computes one quaternion per lane of a 128-bit vector
+  (see ARM_MATH_AUTOVECTORIZE).
+
+  An array of quaternions in the usual layout is a nbQuaternions x 4 matrix;
+  its transpose computed with \ref arm_mat_trans_f32 is the structure of
+  arrays layout, and conversely.
+ */
+
+/**
+  @addtogroup QuatSoa
+  @{
+ */
+
+/* Number of quaternions computed together */
+#define ARM_QUATERNION_SOA_LANES 4U
+
+/* Product of numLanes consecutive quaternions */
+__STATIC_FORCEINLINE void arm_quaternion_product_soa_block_f32(
+  const float32_t *qa,
+  const float32_t *qb,
+        float32_t *qr,
+        uint32_t stride,
+        uint32_t numLanes)
+{
+   float32_t tileA[4][ARM_QUATERNION_SOA_LANES];
+   float32_t tileB[4][ARM_QUATERNION_SOA_LANES];
+   float32_t tileR[4][ARM_QUATERNION_SOA_LANES];
+   uint32_t c, l;
+
+   for (c = 0U; c < 4U; c++)
+   {
+      for (l = 0U; l < numLanes; l++)
+      {
+         tileA[c][l] = qa[l];
+         tileB[c][l] = qb[l];
+      }
+      qa += stride;
+      qb += stride;
+   }
+
+   for (l = 0U; l < numLanes; l++)
+   {
+      tileR[0][l] = tileA[0][l] * tileB[0][l] - tileA[1][l] * tileB[1][l]
+                  - tileA[2][l] * tileB[2][l] - tileA[3][l] * tileB[3][l];
+      tileR[1][l] = tileA[0][l] * tileB[1][l] + tileA[1][l] * tileB[0][l]
+                  + tileA[2][l] * tileB[3][l] - tileA[3][l] * tileB[2][l];
+      tileR[2][l] = tileA[0][l] * tileB[2][l] + tileA[2][l] * tileB[0][l]
+                  + tileA[3][l] * tileB[1][l] - tileA[1][l] * tileB[3][l];
+      tileR[3][l] = tileA[0][l] * tileB[3][l] + tileA[3][l] * tileB[0][l]
+                  + tileA[1][l] * tileB[2][l] - tileA[2][l] * tileB[1][l];
+   }
+
+   for (c = 0U; c < 4U; c++)
+   {
+      for (l = 0U; l < numLanes; l++)
+      {
+         qr[l] = tileR[c][l];
+      }
+      qr += stride;
+   }
+}
+
+/**
+  @brief         Floating-point elementwise product of quaternions in structure of arrays layout.
+  @param[in]     qa                  First array of quaternions
+  @param[in]     qb                  Second array of quaternions
+  @param[out]    qr                  Elementwise product of quaternions
+  @param[in]     nbQuaternions       Number of quaternions in the array
+  @return        none
+  @par           The product can be computed in place (qr equal to qa or qb).
+ */
+void arm_quaternion_product_soa_f32(const float32_t *qa, 
+    const float32_t *qb, 
+    float32_t *qr,
+    uint32_t nbQuaternions)
+{
+   uint32_t blkCnt = nbQuaternions / ARM_QUATERNION_SOA_LANES;
+
+   while (blkCnt > 0U)
+   {
+      arm_quaternion_product_soa_block_f32(qa, qb, qr, nbQuaternions, ARM_QUATERNION_SOA_LANES);
+      qa += ARM_QUATERNION_SOA_LANES;
+      qb += ARM_QUATERNION_SOA_LANES;
+      qr += ARM_QUATERNION_SOA_LANES;
+      blkCnt--;
+   }
+
+   blkCnt = nbQuaternions % ARM_QUATERNION_SOA_LANES;
+   if (blkCnt > 0U)
+   {
+      arm_quaternion_product_soa_block_f32(qa, qb, qr, nbQuaternions, blkCnt);
+   }
+}
+
+/**
+  @} end of QuatSoa group
+ */
@@ -32,5 +32,9 @@
 #include "arm_svm_polynomial_predict_f32.c"
 #include "arm_svm_rbf_init_f32.c"
 #include "arm_svm_rbf_predict_f32.c"
+#include "arm_svm_rbf_predict_batch_f32.c"
+#include "arm_svm_quantize_q7.c"
+#include "arm_svm_rbf_quantized_init_f32.c"
+#include "arm_svm_rbf_quantized_predict_f32.c"
 #include "arm_svm_sigmoid_init_f32.c"
 #include "arm_svm_sigmoid_predict_f32.c"
@@ -32,5 +32,6 @@
 #include "arm_svm_polynomial_predict_f16.c"
 #include "arm_svm_rbf_init_f16.c"
 #include "arm_svm_rbf_predict_f16.c"
+#include "arm_svm_quantize_f16.c"
 #include "arm_svm_sigmoid_init_f16.c"
 #include "arm_svm_sigmoid_predict_f16.c"
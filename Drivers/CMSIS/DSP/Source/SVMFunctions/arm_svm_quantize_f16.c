@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_quantize_f16.c
+ * Description:  Conversion of SVM support vectors to half precision
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+#include "arm_f16_storage.h"
+
+
+/**
+ * @addtogroup rbfsvm
+ * @{
+ */
+
+
+/**
+ * @brief        Conversion of support vectors to half precision
+ * @param[in]    pSrc       Support vector values
+ * @param[out]   pDst       Half precision values stored as uint16_t
+ * @param[in]    numValues  Number of values
+ * @return none.
+ *
+ * @par           Description
+ *                  Values are rounded to nearest even. The values are stored as
+ *                  uint16_t, the format read by \ref arm_svm_rbf_quantized_predict_f32.
+ */
+void arm_svm_quantize_f16(const float32_t *pSrc,
+  uint16_t *pDst,
+  uint32_t numValues)
+{
+    while (numValues > 0U)
+    {
+        *pDst++ = arm_f32_to_f16_bits(*pSrc++);
+        numValues--;
+    }
+}
+
+
+/**
+ * @} end of rbfsvm group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
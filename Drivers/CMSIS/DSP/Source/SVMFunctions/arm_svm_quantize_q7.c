@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_quantize_q7.c
+ * Description:  Quantization of SVM support vectors to int8
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions.h"
+#include <math.h>
+
+/**
+ * @addtogroup rbfsvm
+ * @{
+ */
+
+
+/**
+ * @brief        Quantization of support vectors to int8 with one scale per vector
+ * @param[in]    pSrc                   Support vectors, one after the other
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[out]   pDst                   Quantized support vectors
+ * @param[out]   pScales                Scale of each support vector
+ * @return none.
+ *
+ * @par           Description
+ *                  Each support vector is scaled by the largest magnitude of its
+ *                  values, s = pScales[i] * q, q in [-127, 127], and rounded to
+ *                  nearest. It is meant to be run offline or at startup to build
+ *                  the tables of \ref arm_svm_rbf_quantized_init_f32.
+ */
+void arm_svm_quantize_q7(const float32_t *pSrc,
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  q7_t *pDst,
+  float32_t *pScales)
+{
+    uint32_t i, k;
+
+    for (i = 0; i < nbOfSupportVectors; i++)
+    {
+        float32_t maxAbs = 0.0f;
+        float32_t invScale;
+
+        for (k = 0; k < vectorDimension; k++)
+        {
+            maxAbs = (fabsf(pSrc[k]) > maxAbs) ? fabsf(pSrc[k]) : maxAbs;
+        }
+
+        pScales[i] = (maxAbs > 0.0f) ? (maxAbs / 127.0f) : 1.0f;
+        invScale = 1.0f / pScales[i];
+
+        for (k = 0; k < vectorDimension; k++)
+        {
+            float32_t q = pSrc[k] * invScale;
+
+            q = (q < 0.0f) ? (q - 0.5f) : (q + 0.5f);
+            q = (q > 127.0f) ? 127.0f : q;
+            q = (q < -127.0f) ? -127.0f : q;
+            pDst[k] = (q7_t) q;
+        }
+
+        pSrc += vectorDimension;
+        pDst += vectorDimension;
+    }
+}
+
+
+/**
+ * @} end of rbfsvm group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_rbf_predict_batch_f32.c
+ * Description:  SVM Radial Basis Function batched classifier
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions.h"
+#include "arm_svm_batch_kernels.h"
+#include <limits.h>
+#include <math.h>
+
+/**
+ * @addtogroup rbfsvm
+ * @{
+ */
+
+
+/**
+ * @brief SVM rbf prediction of a batch of vectors
+ * @param[in]    S           Pointer to an instance of the rbf SVM structure.
+ * @param[in]    in          Pointer to the input vectors, one after the other
+ * @param[in]    numVectors  Number of input vectors
+ * @param[out]   pResult     Decision value of each input vector
+ * @return none.
+ *
+ * @par           Description
+ *                  Gives the same classes as a call of \ref arm_svm_rbf_predict_f32
+ *                  per vector. The input vectors are classified 4 at a time: each
+ *                  support vector is read once for the 4 inputs and the distances
+ *                  are computed from dot products and norms, like in a blocked
+ *                  matrix product.
+ */
+void arm_svm_rbf_predict_batch_f32(
+    const arm_svm_rbf_instance_f32 *S,
+    const float32_t * in,
+    uint32_t numVectors,
+    int32_t * pResult)
+{
+    uint32_t dim = S->vectorDimension;
+    const float32_t *pIn[ARM_SVM_BATCH];
+    float32_t norm[ARM_SVM_BATCH], sum[ARM_SVM_BATCH], dot[ARM_SVM_BATCH];
+    uint32_t v, i, k, b;
+
+    for (v = 0; v < numVectors; v += ARM_SVM_BATCH)
+    {
+        const float32_t *pSupport = S->supportVectors;
+
+        arm_svm_batch_inputs_f32(in, dim, v, numVectors, pIn, norm);
+
+        for (b = 0; b < ARM_SVM_BATCH; b++)
+        {
+            sum[b] = S->intercept;
+        }
+
+        for (i = 0; i < S->nbOfSupportVectors; i++)
+        {
+            float32_t normS = 0.0f;
+            float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+
+            for (k = 0; k < dim; k++)
+            {
+                float32_t s = pSupport[k];
+
+                normS += s * s;
+                acc0 += pIn[0][k] * s;
+                acc1 += pIn[1][k] * s;
+                acc2 += pIn[2][k] * s;
+                acc3 += pIn[3][k] * s;
+            }
+            dot[0] = acc0;
+            dot[1] = acc1;
+            dot[2] = acc2;
+            dot[3] = acc3;
+
+            arm_svm_batch_rbf_term_f32(sum, norm, dot, normS, S->dualCoefficients[i], S->gamma);
+            pSupport += dim;
+        }
+
+        for (b = 0; (b < ARM_SVM_BATCH) && ((v + b) < numVectors); b++)
+        {
+            pResult[v + b] = S->classes[STEP(sum[b])];
+        }
+    }
+}
+
+
+/**
+ * @} end of rbfsvm group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_rbf_quantized_init_f32.c
+ * Description:  SVM Radial Basis Function classifier with quantized support vectors initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions.h"
+#include <limits.h>
+#include <math.h>
+
+/**
+ * @addtogroup rbfsvm
+ * @{
+ */
+
+
+/**
+ * @brief        SVM rbf instance init function with quantized support vectors
+ *
+ * Classes are integer used as output of the function (instead of having -1,1
+ * as class values).
+ *
+ * @param[in]    S                      points to an instance of the quantized rbf SVM structure.
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[in]    intercept              Intercept
+ * @param[in]    dualCoefficients       Array of dual coefficients
+ * @param[in]    format                 Storage format of the support vectors
+ * @param[in]    supportVectors         Array of quantized support vectors (q7_t or uint16_t)
+ * @param[in]    supportScales          Array of support vector scales (NULL : 1)
+ * @param[in]    classes                Array of 2 classes ID
+ * @param[in]    gamma                  gamma (scikit-learn terminology)
+ * @return none.
+ *
+ * @par           Description
+ *                  Support vector i is supportScales[i] times its stored values.
+ *                  The q7 tables are generated by \ref arm_svm_quantize_q7 (4 times
+ *                  smaller than float32_t) and the half precision ones by
+ *                  \ref arm_svm_quantize_f16 (2 times smaller, scales usually NULL).
+ *                  arm_svm_quantize_f16 is only built with half precision support,
+ *                  the half precision tables can also be generated offline.
+ */
+void arm_svm_rbf_quantized_init_f32(arm_svm_rbf_quantized_instance_f32 *S,
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  float32_t intercept,
+  const float32_t *dualCoefficients,
+  arm_svm_sv_format format,
+  const void *supportVectors,
+  const float32_t *supportScales,
+  const int32_t *classes,
+  float32_t gamma
+  )
+{
+   S->nbOfSupportVectors = nbOfSupportVectors;
+   S->vectorDimension = vectorDimension;
+   S->intercept = intercept;
+   S->dualCoefficients = dualCoefficients;
+   S->format = format;
+   S->supportVectors = supportVectors;
+   S->supportScales = supportScales;
+   S->classes = classes;
+   S->gamma = gamma;
+}
+
+
+/**
+ * @} end of rbfsvm group
+ */
@@ -65,6 +65,15 @@
 #include "arm_rms_f32.c"
 #include "arm_rms_q15.c"
 #include "arm_rms_q31.c"
+#include "arm_sliding_stats_f32.c"
+#include "arm_sliding_stats_get_f32.c"
+#include "arm_sliding_stats_get_q15.c"
+#include "arm_sliding_stats_get_q31.c"
+#include "arm_sliding_stats_init_f32.c"
+#include "arm_sliding_stats_init_q15.c"
+#include "arm_sliding_stats_init_q31.c"
+#include "arm_sliding_stats_q15.c"
+#include "arm_sliding_stats_q31.c"
 #include "arm_std_f32.c"
 #include "arm_std_f64.c"
 #include "arm_std_q15.c"
@@ -0,0 +1,294 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_f32.c
+ * Description:  Floating-point sliding window statistics
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup SlidingStats Sliding Window Statistics
+
+  Mean, variance, root mean square, minimum and maximum of the last <code>windowSize</code> samples
+  of a stream.
+
+  The batch functions like arm_mean_f32() or arm_var_f32() do a full pass on the window each time
+  they are called. When the windows of consecutive calls overlap, the sliding window functions
+  only process the new samples, with a cost per sample which does not depend on the window size:
+  - the mean and variance are updated when a sample enters and the oldest one leaves the window
+    (Welford update for the floating-point version, exact integer sums for the fixed-point versions),
+  - for the floating-point version, the Welford updates are done on the samples minus a reference
+    close to the mean of the window (the first sample, then the mean of the window each time the
+    estimates are replaced as explained below). The running mean stays small, so its rounding
+    errors don't depend on the level of the signal,
+  - for the floating-point version, a second Welford accumulator restarts each time the history
+    wraps. It then holds exactly the current window and replaces the sliding estimates, so the
+    rounding errors of the removals cannot build up over more than one window,
+  - for the floating-point version, when the sum of squared differences falls far below the
+    largest value it had since it was last exact (the window leaves a level step or a burst),
+    the removals have cancelled most of its bits. The mean and the sum of squared differences
+    are then recomputed from the history with two passes, like the statistics of the samples
+    received since the last wrap. This costs at most <code>4*windowSize</code> operations and
+    only happens after the variance has dropped by a factor 128,
+  - the minimum and maximum are kept in two monotonic queues. Each sample is inserted and removed
+    at most once from each queue.
+
+  The history of the window and the queues are in buffers provided by the caller:
+  <code>windowSize</code> samples for the history and <code>2*windowSize</code> indexes for the queues.
+
+  Before <code>windowSize</code> samples have been received, the statistics are computed
+  on the samples received so far.
+
+  The variance is normalized by <code>numSamples - 1</code> like in arm_var_f32().
+ */
+
+/* The sliding sum of squared differences is recomputed when it becomes smaller than its
+   largest recent value times this ratio: the relative error of the sliding update is then
+   bounded by a few hundred float32_t epsilons */
+#define ARM_SLIDING_STATS_CANCEL_RATIO_F32 (1.0f / 128.0f)
+
+/* Two pass mean and sum of squared differences of the history. The sum is computed
+   on the samples minus the first one, so that its rounding errors don't depend on
+   the level of the signal. */
+static void arm_sliding_stats_recompute_f32(
+  const float32_t * pHistory,
+        uint32_t numSamples,
+        float32_t * pMean,
+        float32_t * pM2)
+{
+  float32_t first = pHistory[0];
+  float32_t sum = 0.0f, m2 = 0.0f, mean, d;
+  uint32_t i;
+
+  for (i = 0U; i < numSamples; i++)
+  {
+    sum += pHistory[i] - first;
+  }
+  mean = sum / (float32_t) numSamples;
+
+  for (i = 0U; i < numSamples; i++)
+  {
+    d = (pHistory[i] - first) - mean;
+    m2 += d * d;
+  }
+
+  *pMean = first + mean;
+  *pM2 = m2;
+}
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Adds a block of samples to the floating-point sliding window statistics.
+  @param[in,out] S          points to an instance of the sliding window statistics structure
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @return        none
+
+  @par           Details
+                   Each sample is written into the history in place of the oldest one, which
+                   leaves the window once <code>windowSize</code> samples have been received.
+                   The index queues hold the positions in the history of the candidates for the
+                   maximum (decreasing values) and for the minimum (increasing values).
+                   The oldest candidate is at the head of each queue.
+ */
+void arm_sliding_stats_f32(
+        arm_sliding_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t windowSize = S->windowSize;           /* Window length */
+        uint32_t numSamples = S->numSamples;           /* Samples in the window */
+        uint32_t pos = S->writeIndex;                  /* Position of the new sample */
+        float32_t *pHistory = S->pHistory;           /* History of the window */
+        uint32_t *pMaxQueue = S->pQueue;               /* Maximum candidates */
+        uint32_t *pMinQueue = S->pQueue + windowSize;  /* Minimum candidates */
+        uint32_t maxHead = S->maxHead, maxCount = S->maxCount;
+        uint32_t minHead = S->minHead, minCount = S->minCount;
+        uint32_t tail;                                 /* Last element of a queue */
+        float32_t ref = S->reference;                  /* Reference subtracted from the samples */
+        float32_t newRef;                              /* Next reference */
+        float32_t in, old;                             /* Input sample and sample leaving the window, minus the reference */
+        float32_t delta, newMean;                      /* Welford update */
+        float32_t mean = S->mean;                      /* Running mean minus the reference */
+        float32_t m2 = S->m2;                          /* Running sum of squared differences */
+        float32_t m2Max = S->m2Max;                    /* Largest m2 since it was exact */
+        float32_t freshMean = S->freshMean;            /* Mean since the last wrap */
+        float32_t freshM2 = S->freshM2;                /* Sum of squared differences since the last wrap */
+        uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while (blkCnt > 0U)
+  {
+    /* The first sample is the first reference */
+    ref = (numSamples == 0U) ? *pSrc : ref;
+
+    in = *pSrc - ref;
+
+    if (numSamples == windowSize)
+    {
+      old = pHistory[pos] - ref;
+
+      /* The oldest sample leaves the queues */
+      if ((maxCount > 0U) && (pMaxQueue[maxHead] == pos))
+      {
+        maxHead = (maxHead + 1U == windowSize) ? 0U : maxHead + 1U;
+        maxCount--;
+      }
+      if ((minCount > 0U) && (pMinQueue[minHead] == pos))
+      {
+        minHead = (minHead + 1U == windowSize) ? 0U : minHead + 1U;
+        minCount--;
+      }
+
+      /* Sliding Welford update: the oldest sample is replaced by the new one */
+      delta = in - old;
+      newMean = mean + delta * S->invWindowSize;
+      m2 += delta * ((in - newMean) + (old - mean));
+      mean = newMean;
+
+      /* Protect against a negative value due to rounding */
+      m2 = (m2 < 0.0f) ? 0.0f : m2;
+
+      pHistory[pos] = *pSrc;
+
+      /* The removals have cancelled most of the bits of m2: it is recomputed
+         and the mean of the window becomes the reference */
+      if (m2 < m2Max * ARM_SLIDING_STATS_CANCEL_RATIO_F32)
+      {
+        arm_sliding_stats_recompute_f32(pHistory, windowSize, &newRef, &m2);
+        m2Max = m2;
+        ref = newRef;
+        mean = 0.0f;
+
+        /* The samples received since the last wrap are at the start of the history */
+        freshMean = 0.0f;
+        freshM2 = 0.0f;
+        if (pos > 0U)
+        {
+          arm_sliding_stats_recompute_f32(pHistory, pos, &freshMean, &freshM2);
+          freshMean -= ref;
+        }
+      }
+    }
+    else
+    {
+      numSamples++;
+
+      /* Welford update */
+      delta = in - mean;
+      mean += delta / (float32_t) numSamples;
+      m2 += delta * (in - mean);
+
+      pHistory[pos] = *pSrc;
+    }
+
+    m2Max = (m2 > m2Max) ? m2 : m2Max;
+
+    /* Welford update of the samples received since the last wrap: only additions.
+       The reference may have changed above. */
+    in = *pSrc - ref;
+    delta = in - freshMean;
+    freshMean += delta / (float32_t) (pos + 1U);
+    freshM2 += delta * (in - freshMean);
+
+    in = *pSrc++;
+
+    /* Candidates smaller than the new sample can no longer be the maximum */
+    while (maxCount > 0U)
+    {
+      tail = maxHead + maxCount - 1U;
+      tail = (tail >= windowSize) ? tail - windowSize : tail;
+      if (pHistory[pMaxQueue[tail]] > in)
+      {
+        break;
+      }
+      maxCount--;
+    }
+    tail = maxHead + maxCount;
+    tail = (tail >= windowSize) ? tail - windowSize : tail;
+    pMaxQueue[tail] = pos;
+    maxCount++;
+
+    /* Candidates bigger than the new sample can no longer be the minimum */
+    while (minCount > 0U)
+    {
+      tail = minHead + minCount - 1U;
+      tail = (tail >= windowSize) ? tail - windowSize : tail;
+      if (pHistory[pMinQueue[tail]] < in)
+      {
+        break;
+      }
+      minCount--;
+    }
+    tail = minHead + minCount;
+    tail = (tail >= windowSize) ? tail - windowSize : tail;
+    pMinQueue[tail] = pos;
+    minCount++;
+
+    pos = (pos + 1U == windowSize) ? 0U : pos + 1U;
+
+    /* When the history wraps, the window is exactly made of the samples received
+       since the last wrap: the sliding estimates are replaced to cancel
+       the rounding errors accumulated by the removals. The mean of the window
+       becomes the reference. */
+    if (pos == 0U)
+    {
+      newRef = ref + freshMean;
+      mean = freshMean - (newRef - ref);
+      ref = newRef;
+      m2 = freshM2;
+      m2Max = freshM2;
+      freshMean = 0.0f;
+      freshM2 = 0.0f;
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  S->numSamples = numSamples;
+  S->writeIndex = pos;
+  S->maxHead = maxHead;
+  S->maxCount = maxCount;
+  S->minHead = minHead;
+  S->minCount = minCount;
+  S->reference = ref;
+  S->mean = mean;
+  S->m2 = m2;
+  S->m2Max = m2Max;
+  S->freshMean = freshMean;
+  S->freshM2 = freshM2;
+}
+
+/**
+  @} end of SlidingStats group
+ */
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_get_f32.c
+ * Description:  Floating-point sliding window statistics results
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Statistics of the current window for the floating-point sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  points to the statistics of the window
+  @return        none
+
+  @par           Details
+                   The root mean square is derived from the running mean and sum of squared
+                   differences: <code>rms = sqrt(m2 / n + mean * mean)</code>.
+                   The running mean is relative to the reference of the instance.
+ */
+void arm_sliding_stats_get_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        arm_sliding_stats_result_f32 * pResult)
+{
+  uint32_t n = S->numSamples;                      /* Samples in the window */
+
+  if (n == 0U)
+  {
+    pResult->mean = 0.0f;
+    pResult->var = 0.0f;
+    pResult->rms = 0.0f;
+    pResult->min = 0.0f;
+    pResult->max = 0.0f;
+    return;
+  }
+
+  pResult->mean = S->reference + S->mean;
+
+  /* Variance normalized by n - 1 as in arm_var_f32 */
+  pResult->var = (n > 1U) ? S->m2 / (float32_t) (n - 1U) : 0.0f;
+
+  /* Mean of squares = population variance + square of mean */
+  arm_sqrt_f32((S->m2 / (float32_t) n) + (pResult->mean * pResult->mean), &pResult->rms);
+
+  /* The oldest candidates are the extrema of the window */
+  pResult->max = S->pHistory[S->pQueue[S->maxHead]];
+  pResult->min = S->pHistory[S->pQueue[S->windowSize + S->minHead]];
+}
+
+/**
+  @} end of SlidingStats group
+ */
@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_get_q15.c
+ * Description:  Q15 sliding window statistics results
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Statistics of the current window for the Q15 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  points to the statistics of the window
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The sums are exact. The variance and the root mean square are truncated
+                   from 34.30 to 1.15 format as in arm_var_q15() and arm_rms_q15().
+ */
+void arm_sliding_stats_get_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        arm_sliding_stats_result_q15 * pResult)
+{
+  uint32_t n = S->numSamples;                      /* Samples in the window */
+
+  if (n == 0U)
+  {
+    pResult->mean = 0;
+    pResult->var = 0;
+    pResult->rms = 0;
+    pResult->min = 0;
+    pResult->max = 0;
+    return;
+  }
+
+  pResult->mean = (q15_t) (S->sum / (q63_t) n);
+
+  /* Variance in 34.30 format, normalized by n - 1 as in arm_var_q15 */
+  if (n > 1U)
+  {
+    pResult->var = (q15_t) (((S->sumOfSquares - S->sum * (S->sum / (q63_t) n)) / (q63_t) (n - 1U)) >> 15U);
+  }
+  else
+  {
+    pResult->var = 0;
+  }
+
+  /* Convert the mean of squares from 34.30 to 1.15 and saturate */
+  arm_sqrt_q15((q15_t) __SSAT((S->sumOfSquares / (q63_t) n) >> 15, 16), &pResult->rms);
+
+  /* The oldest candidates are the extrema of the window */
+  pResult->max = S->pHistory[S->pQueue[S->maxHead]];
+  pResult->min = S->pHistory[S->pQueue[S->windowSize + S->minHead]];
+}
+
+/**
+  @} end of SlidingStats group
+ */
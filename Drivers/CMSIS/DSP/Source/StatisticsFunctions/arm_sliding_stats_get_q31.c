@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_get_q31.c
+ * Description:  Q31 sliding window statistics results
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Statistics of the current window for the Q31 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  points to the statistics of the window
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   As in arm_var_q31(), the squares are computed on the input right shifted by 8 bits.
+                   The variance and the root mean square have a 1.31 format but only
+                   the 16 most significant bits of their argument are accurate.
+                   The mean is computed on the full precision input.
+ */
+void arm_sliding_stats_get_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        arm_sliding_stats_result_q31 * pResult)
+{
+  uint32_t n = S->numSamples;                      /* Samples in the window */
+
+  q63_t meanScaled;                              /* Mean in 9.23 format */
+
+  if (n == 0U)
+  {
+    pResult->mean = 0;
+    pResult->var = 0;
+    pResult->rms = 0;
+    pResult->min = 0;
+    pResult->max = 0;
+    return;
+  }
+
+  pResult->mean = (q31_t) (S->sum / (q63_t) n);
+
+  /* Variance in 18.46 format, normalized by n - 1 as in arm_var_q31 */
+  if (n > 1U)
+  {
+    meanScaled = S->sumScaled / (q63_t) n;
+    pResult->var = (q31_t) (((S->sumOfSquares - S->sumScaled * meanScaled) / (q63_t) (n - 1U)) >> 15U);
+  }
+  else
+  {
+    pResult->var = 0;
+  }
+
+  /* Convert the mean of squares from 18.46 to 1.31 and saturate */
+  arm_sqrt_q31(clip_q63_to_q31((S->sumOfSquares / (q63_t) n) >> 15U), &pResult->rms);
+
+  /* The oldest candidates are the extrema of the window */
+  pResult->max = S->pHistory[S->pQueue[S->maxHead]];
+  pResult->min = S->pHistory[S->pQueue[S->windowSize + S->minHead]];
+}
+
+/**
+  @} end of SlidingStats group
+ */
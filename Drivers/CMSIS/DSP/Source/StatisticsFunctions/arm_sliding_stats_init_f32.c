@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_init_f32.c
+ * Description:  Floating-point sliding window statistics initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point sliding window statistics.
+  @param[in,out] S           points to an instance of the sliding window statistics structure
+  @param[in]     windowSize  number of samples of the window
+  @param[in]     pHistory    points to the history buffer of length windowSize
+  @param[in]     pQueue      points to the queue buffer of length 2*windowSize
+  @return        none
+ */
+void arm_sliding_stats_init_f32(
+        arm_sliding_stats_instance_f32 * S,
+        uint32_t windowSize,
+        float32_t * pHistory,
+        uint32_t * pQueue)
+{
+  S->windowSize = windowSize;
+  S->numSamples = 0U;
+  S->writeIndex = 0U;
+
+  S->maxHead = 0U;
+  S->maxCount = 0U;
+  S->minHead = 0U;
+  S->minCount = 0U;
+
+  S->reference = 0.0f;
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+  S->m2Max = 0.0f;
+  S->invWindowSize = 1.0f / (float32_t) windowSize;
+  S->freshMean = 0.0f;
+  S->freshM2 = 0.0f;
+
+  S->pHistory = pHistory;
+  S->pQueue = pQueue;
+}
+
+/**
+  @} end of SlidingStats group
+ */
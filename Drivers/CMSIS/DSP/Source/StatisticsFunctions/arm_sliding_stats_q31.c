@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_q31.c
+ * Description:  Q31 sliding window statistics
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Adds a block of samples to the Q31 sliding window statistics.
+  @param[in,out] S          points to an instance of the sliding window statistics structure
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @return        none
+
+  @par           Details
+                   Each sample is written into the history in place of the oldest one, which
+                   leaves the window once <code>windowSize</code> samples have been received.
+                   The index queues hold the positions in the history of the candidates for the
+                   maximum (decreasing values) and for the minimum (increasing values).
+                   The oldest candidate is at the head of each queue.
+ */
+void arm_sliding_stats_q31(
+        arm_sliding_stats_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t windowSize = S->windowSize;           /* Window length */
+        uint32_t numSamples = S->numSamples;           /* Samples in the window */
+        uint32_t pos = S->writeIndex;                  /* Position of the new sample */
+        q31_t *pHistory = S->pHistory;               /* History of the window */
+        uint32_t *pMaxQueue = S->pQueue;               /* Maximum candidates */
+        uint32_t *pMinQueue = S->pQueue + windowSize;  /* Minimum candidates */
+        uint32_t maxHead = S->maxHead, maxCount = S->maxCount;
+        uint32_t minHead = S->minHead, minCount = S->minCount;
+        uint32_t tail;                                 /* Last element of a queue */
+        q31_t in, old;                                 /* Input sample and sample leaving the window */
+        q31_t inScaled, oldScaled;                     /* Samples in 9.23 format */
+        uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (numSamples == windowSize)
+    {
+      old = pHistory[pos];
+
+      /* The oldest sample leaves the queues */
+      if ((maxCount > 0U) && (pMaxQueue[maxHead] == pos))
+      {
+        maxHead = (maxHead + 1U == windowSize) ? 0U : maxHead + 1U;
+        maxCount--;
+      }
+      if ((minCount > 0U) && (pMinQueue[minHead] == pos))
+      {
+        minHead = (minHead + 1U == windowSize) ? 0U : minHead + 1U;
+        minCount--;
+      }
+
+      /* The oldest sample is removed from the sums */
+      oldScaled = old >> 8U;
+      S->sum -= old;
+      S->sumScaled -= oldScaled;
+      S->sumOfSquares -= ((q63_t) oldScaled * oldScaled);
+
+      /* The new sample is added to the sums */
+      inScaled = in >> 8U;
+      S->sum += in;
+      S->sumScaled += inScaled;
+      S->sumOfSquares += ((q63_t) inScaled * inScaled);
+    }
+    else
+    {
+      numSamples++;
+
+      /* The new sample is added to the sums */
+      inScaled = in >> 8U;
+      S->sum += in;
+      S->sumScaled += inScaled;
+      S->sumOfSquares += ((q63_t) inScaled * inScaled);
+    }
+
+    pHistory[pos] = in;
+
+    /* Candidates smaller than the new sample can no longer be the maximum */
+    while (maxCount > 0U)
+    {
+      tail = maxHead + maxCount - 1U;
+      tail = (tail >= windowSize) ? tail - windowSize : tail;
+      if (pHistory[pMaxQueue[tail]] > in)
+      {
+        break;
+      }
+      maxCount--;
+    }
+    tail = maxHead + maxCount;
+    tail = (tail >= windowSize) ? tail - windowSize : tail;
+    pMaxQueue[tail] = pos;
+    maxCount++;
+
+    /* Candidates bigger than the new sample can no longer be the minimum */
+    while (minCount > 0U)
+    {
+      tail = minHead + minCount - 1U;
+      tail = (tail >= windowSize) ? tail - windowSize : tail;
+      if (pHistory[pMinQueue[tail]] < in)
+      {
+        break;
+      }
+      minCount--;
+    }
+    tail = minHead + minCount;
+    tail = (tail >= windowSize) ? tail - windowSize : tail;
+    pMinQueue[tail] = pos;
+    minCount++;
+
+    pos = (pos + 1U == windowSize) ? 0U : pos + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  S->numSamples = numSamples;
+  S->writeIndex = pos;
+  S->maxHead = maxHead;
+  S->maxCount = maxCount;
+  S->minHead = minHead;
+  S->minCount = minCount;
+}
+
+/**
+  @} end of SlidingStats group
+ */
@@ -45,6 +45,21 @@
 #include "arm_merge_sort_init_f32.c"
 #include "arm_quick_sort_f32.c"
 #include "arm_selection_sort_f32.c"
+#include "arm_select_f32.c"
+#include "arm_select_q31.c"
+#include "arm_select_q15.c"
+#include "arm_topk_init_f32.c"
+#include "arm_topk_init_q31.c"
+#include "arm_topk_init_q15.c"
+#include "arm_topk_f32.c"
+#include "arm_topk_q31.c"
+#include "arm_topk_q15.c"
+#include "arm_running_median_init_f32.c"
+#include "arm_running_median_init_q31.c"
+#include "arm_running_median_init_q15.c"
+#include "arm_running_median_f32.c"
+#include "arm_running_median_q31.c"
+#include "arm_running_median_q15.c"
 #include "arm_sort_f32.c"
 #include "arm_sort_init_f32.c"
 #include "arm_weighted_sum_f32.c"
@@ -52,6 +67,7 @@
 #include "arm_float_to_q15.c"
 #include "arm_float_to_q31.c"
 #include "arm_float_to_q7.c"
+#include "arm_float_to_f16s.c"
 #include "arm_q15_to_float.c"
 #include "arm_q15_to_q31.c"
 #include "arm_q15_to_q7.c"
@@ -59,5 +75,6 @@
 #include "arm_q31_to_q15.c"
 #include "arm_q31_to_q7.c"
 #include "arm_q7_to_float.c"
+#include "arm_f16s_to_float.c"
 #include "arm_q7_to_q15.c"
 #include "arm_q7_to_q31.c"
@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_float_to_f16s.c
+ * Description:  Converts the elements of the floating-point vector to f16s vector
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_f16_storage.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup float_to_x
+  @{
+ */
+
+/**
+  @brief         Converts the elements of the floating-point vector to f16s vector.
+  @param[in]     pSrc       points to the f32 input vector
+  @param[out]    pDst       points to the f16s output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The values are rounded to the nearest even binary16 value.
+                   Values above 65504 in magnitude become infinite.
+
+  @par           Storage f16
+                   This function is available on all targets. The f16s kernels
+                   keep their buffers in half precision and compute in single
+                   precision, so they halve the memory of the f32 buffers on
+                   cores without a native float16_t (see ARM_MATH_F16_STORAGE).
+ */
+void arm_float_to_f16s(
+  const float32_t * pSrc,
+        float16s_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    pDst[0] = arm_f32_to_f16_bits(pSrc[0]);
+    pDst[1] = arm_f32_to_f16_bits(pSrc[1]);
+    pDst[2] = arm_f32_to_f16_bits(pSrc[2]);
+    pDst[3] = arm_f32_to_f16_bits(pSrc[3]);
+
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    *pDst++ = arm_f32_to_f16_bits(*pSrc++);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of float_to_x group
+ */
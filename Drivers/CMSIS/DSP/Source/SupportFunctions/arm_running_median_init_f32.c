@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_running_median_init_f32.c
+ * Description:  Floating-point running median initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup RunningMedian
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point running median.
+  @param[out]    S           points to an instance of the running median structure
+  @param[in]     windowSize  number of samples in the sliding window
+  @param[in]     pState      points to the state buffer of 2*windowSize values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : windowSize is 0
+ */
+arm_status arm_running_median_init_f32(
+  arm_running_median_instance_f32 * S,
+  uint32_t windowSize,
+  float32_t * pState)
+{
+  if (windowSize == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->windowSize = windowSize;
+  S->numValues = 0U;
+  S->index = 0U;
+  S->pState = pState;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of RunningMedian group
+ */
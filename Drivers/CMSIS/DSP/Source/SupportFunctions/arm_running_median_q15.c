@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_running_median_q15.c
+ * Description:  Q15 running median over a sliding window
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup RunningMedian
+  @{
+ */
+
+/**
+  @brief         Q15 running median.
+  @param[in,out] S          points to an instance of the running median structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the block of medians
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_running_median_q15(
+        arm_running_median_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  q15_t *pHistory = S->pState;
+  q15_t *pSorted = S->pState + S->windowSize;
+  uint32_t n = S->numValues;
+  uint32_t pos, lo, hi;
+  q15_t x, old;
+
+  while (blockSize > 0U)
+  {
+    x = *pSrc++;
+
+    if (n < S->windowSize)
+    {
+      /* Insert the new sample */
+      pHistory[n] = x;
+      for (pos = n; (pos > 0U) && (pSorted[pos - 1U] > x); pos--)
+      {
+        pSorted[pos] = pSorted[pos - 1U];
+      }
+      pSorted[pos] = x;
+      n++;
+    }
+    else
+    {
+      old = pHistory[S->index];
+      pHistory[S->index] = x;
+      S->index = (S->index + 1U == n) ? 0U : S->index + 1U;
+
+      /* Find the oldest sample in the sorted window */
+      lo = 0U;
+      hi = n - 1U;
+      while (lo < hi)
+      {
+        pos = (lo + hi) / 2U;
+        if (pSorted[pos] < old)
+        {
+          lo = pos + 1U;
+        }
+        else
+        {
+          hi = pos;
+        }
+      }
+
+      /* Replace it by the new sample */
+      pos = lo;
+      if (x > old)
+      {
+        for (; (pos + 1U < n) && (pSorted[pos + 1U] < x); pos++)
+        {
+          pSorted[pos] = pSorted[pos + 1U];
+        }
+      }
+      else
+      {
+        for (; (pos > 0U) && (pSorted[pos - 1U] > x); pos--)
+        {
+          pSorted[pos] = pSorted[pos - 1U];
+        }
+      }
+      pSorted[pos] = x;
+    }
+
+    if (n & 1U)
+    {
+      *pDst++ = pSorted[n / 2U];
+    }
+    else
+    {
+      *pDst++ = (q15_t) (((q31_t) pSorted[n / 2U - 1U] + pSorted[n / 2U]) >> 1);
+    }
+
+    blockSize--;
+  }
+
+  S->numValues = n;
+}
+
+/**
+  @} end of RunningMedian group
+ */
@@ -0,0 +1,226 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_select_f32.c
+ * Description:  Floating-point selection of the k-th smallest value
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/* Ranges shorter than this are finished with an insertion sort */
+#define ARM_SELECT_INSERTION_THRESHOLD 16U
+
+/* Insertion sort of pA[lo..hi] */
+static void arm_select_insertion_f32(float32_t *pA, uint32_t lo, uint32_t hi)
+{
+  uint32_t i, j;
+  float32_t x;
+
+  for (i = lo + 1U; i <= hi; i++)
+  {
+    x = pA[i];
+    for (j = i; (j > lo) && (pA[j - 1U] > x); j--)
+    {
+      pA[j] = pA[j - 1U];
+    }
+    pA[j] = x;
+  }
+}
+
+/* Restore the max-heap order of the n values at pA from the root i */
+static void arm_select_sift_f32(float32_t *pA, uint32_t n, uint32_t i)
+{
+  uint32_t child;
+  float32_t x = pA[i];
+
+  while ((child = 2U * i + 1U) < n)
+  {
+    if ((child + 1U < n) && (pA[child + 1U] > pA[child]))
+    {
+      child++;
+    }
+    if (!(pA[child] > x))
+    {
+      break;
+    }
+    pA[i] = pA[child];
+    i = child;
+  }
+  pA[i] = x;
+}
+
+/* Heap sort of the n values at pA */
+static void arm_select_heap_sort_f32(float32_t *pA, uint32_t n)
+{
+  uint32_t i;
+  float32_t x;
+
+  for (i = n / 2U; i > 0U; i--)
+  {
+    arm_select_sift_f32(pA, n, i - 1U);
+  }
+  for (i = n - 1U; i > 0U; i--)
+  {
+    x = pA[i];
+    pA[i] = pA[0];
+    pA[0] = x;
+    arm_select_sift_f32(pA, i, 0U);
+  }
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Selection Vector selection
+
+  Selection of the k-th smallest value of a vector without sorting it.
+
+  The vector is partitioned in place around pivots chosen as the median
+  of three values, keeping only the side containing the rank k (quickselect).
+  The average cost is linear in the vector length, instead of
+  n log n for a full sort. If the partitioning does not converge after
+  2 log2(n) steps, the remaining range is heap sorted, which bounds the
+  worst case to n log n (introselect).
+
+  After the selection, the vector is reordered so that the values before
+  index k are not greater than the selected value and the values after
+  index k are not smaller. The median of an odd length vector is the rank
+  (blockSize - 1) / 2. The k largest values are the ones after index
+  blockSize - k - 1, in no particular order.
+
+  The floating-point input must not contain NaN.
+ */
+
+/**
+  @addtogroup Selection
+  @{
+ */
+
+/**
+  @brief         Selection of the k-th smallest floating-point value.
+  @param[in,out] pSrc       points to the input vector, reordered by the selection
+  @param[in]     blockSize  number of samples in the vector
+  @param[in]     k          rank of the value to select (0 for the smallest)
+  @param[out]    pResult    k-th smallest value
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : k is not smaller than blockSize
+ */
+arm_status arm_select_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pResult)
+{
+  uint32_t lo, hi, mid, depth;
+  int32_t i, j;
+  float32_t pivot, x;
+
+  if (k >= blockSize)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  depth = 0U;
+  for (mid = blockSize; mid > 1U; mid >>= 1U)
+  {
+    depth += 2U;
+  }
+
+  lo = 0U;
+  hi = blockSize - 1U;
+  while (hi - lo >= ARM_SELECT_INSERTION_THRESHOLD)
+  {
+    if (depth == 0U)
+    {
+      arm_select_heap_sort_f32(pSrc + lo, hi - lo + 1U);
+      *pResult = pSrc[k];
+      return ARM_MATH_SUCCESS;
+    }
+    depth--;
+
+    /* Median of three: pSrc[lo] <= pSrc[mid] <= pSrc[hi] */
+    mid = lo + (hi - lo) / 2U;
+    if (pSrc[mid] < pSrc[lo])
+    {
+      x = pSrc[mid]; pSrc[mid] = pSrc[lo]; pSrc[lo] = x;
+    }
+    if (pSrc[hi] < pSrc[mid])
+    {
+      x = pSrc[hi]; pSrc[hi] = pSrc[mid]; pSrc[mid] = x;
+      if (pSrc[mid] < pSrc[lo])
+      {
+        x = pSrc[mid]; pSrc[mid] = pSrc[lo]; pSrc[lo] = x;
+      }
+    }
+    pivot = pSrc[mid];
+
+    /* Partition: pSrc[lo..j] <= pivot <= pSrc[i..hi] */
+    i = (int32_t)lo;
+    j = (int32_t)hi;
+    while (i <= j)
+    {
+      while (pSrc[i] < pivot)
+      {
+        i++;
+      }
+      while (pSrc[j] > pivot)
+      {
+        j--;
+      }
+      if (i <= j)
+      {
+        x = pSrc[i]; pSrc[i] = pSrc[j]; pSrc[j] = x;
+        i++;
+        j--;
+      }
+    }
+
+    if ((int32_t)k <= j)
+    {
+      hi = (uint32_t)j;
+    }
+    else if ((int32_t)k >= i)
+    {
+      lo = (uint32_t)i;
+    }
+    else
+    {
+      /* The values between j and i are equal to the pivot */
+      *pResult = pSrc[k];
+      return ARM_MATH_SUCCESS;
+    }
+  }
+
+  arm_select_insertion_f32(pSrc, lo, hi);
+  *pResult = pSrc[k];
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Selection group
+ */
@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_topk_f32.c
+ * Description:  Floating-point streaming selection of the largest values
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/* Restore the min-heap order of the n values at pA from the root i */
+static void arm_topk_sift_f32(float32_t *pA, uint32_t n, uint32_t i)
+{
+  uint32_t child;
+  float32_t x = pA[i];
+
+  while ((child = 2U * i + 1U) < n)
+  {
+    if ((child + 1U < n) && (pA[child + 1U] < pA[child]))
+    {
+      child++;
+    }
+    if (!(pA[child] < x))
+    {
+      break;
+    }
+    pA[i] = pA[child];
+    i = child;
+  }
+  pA[i] = x;
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup TopK Vector streaming top-k
+
+  Tracking of the numTop largest values of a stream of samples.
+
+  The kept values are stored in a heap whose root is the smallest of them.
+  A new sample not larger than the root is rejected with one comparison,
+  which is the usual case once the heap is full. A larger sample replaces
+  the root and is moved down the heap in log2(numTop) steps. Only numTop
+  values are stored whatever the length of the stream.
+
+  The smallest k values are tracked by negating the samples.
+ */
+
+/**
+  @addtogroup TopK
+  @{
+ */
+
+/**
+  @brief         Streaming selection of the largest floating-point values.
+  @param[in,out] S          points to an instance of the top-k structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_topk_f32(
+        arm_topk_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+  float32_t *pHeap = S->pHeap;
+  uint32_t numTop = S->numTop;
+  uint32_t n = S->numValues;
+  uint32_t i, parent;
+  float32_t x;
+
+  /* Fill the heap */
+  while ((n < numTop) && (blockSize > 0U))
+  {
+    x = *pSrc++;
+    i = n++;
+    while (i > 0U)
+    {
+      parent = (i - 1U) / 2U;
+      if (!(x < pHeap[parent]))
+      {
+        break;
+      }
+      pHeap[i] = pHeap[parent];
+      i = parent;
+    }
+    pHeap[i] = x;
+    blockSize--;
+  }
+  S->numValues = n;
+
+  /* Replace the smallest kept value */
+  if (numTop > 0U)
+  {
+    while (blockSize > 0U)
+    {
+      x = *pSrc++;
+      if (x > pHeap[0])
+      {
+        pHeap[0] = x;
+        arm_topk_sift_f32(pHeap, numTop, 0U);
+      }
+      blockSize--;
+    }
+  }
+}
+
+/**
+  @brief         Largest floating-point values of the stream.
+  @param[in]     S          points to an instance of the top-k structure
+  @param[out]    pDst       points to the output vector of S->numValues values
+  @return        none
+
+  @par
+  The S->numValues kept values, at most numTop, are written in descending
+  order. The instance is not modified and the stream can be continued.
+ */
+void arm_topk_get_f32(
+  const arm_topk_instance_f32 * S,
+        float32_t * pDst)
+{
+  uint32_t n = S->numValues;
+  uint32_t i;
+  float32_t x;
+
+  memcpy(pDst, S->pHeap, n * sizeof(float32_t));
+
+  /* Moving the smallest value to the end sorts in descending order */
+  for (i = n; i > 1U; i--)
+  {
+    x = pDst[i - 1U];
+    pDst[i - 1U] = pDst[0];
+    pDst[0] = x;
+    arm_topk_sift_f32(pDst, i - 1U, 0U);
+  }
+}
+
+/**
+  @} end of TopK group
+ */
@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_topk_init_q15.c
+ * Description:  Q15 streaming top-k initialization
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup TopK
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 streaming top-k.
+  @param[out]    S          points to an instance of the top-k structure
+  @param[in]     numTop     number of largest values to keep
+  @param[in]     pHeap      points to a buffer of numTop values
+  @return        none
+
+  @par
+  The initialization also restarts a stream.
+ */
+void arm_topk_init_q15(
+  arm_topk_instance_q15 * S,
+  uint32_t numTop,
+  q15_t * pHeap)
+{
+  S->numTop = numTop;
+  S->numValues = 0U;
+  S->pHeap = pHeap;
+}
+
+/**
+  @} end of TopK group
+ */
@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_topk_q31.c
+ * Description:  Q31 streaming selection of the largest values
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/* Restore the min-heap order of the n values at pA from the root i */
+static void arm_topk_sift_q31(q31_t *pA, uint32_t n, uint32_t i)
+{
+  uint32_t child;
+  q31_t x = pA[i];
+
+  while ((child = 2U * i + 1U) < n)
+  {
+    if ((child + 1U < n) && (pA[child + 1U] < pA[child]))
+    {
+      child++;
+    }
+    if (!(pA[child] < x))
+    {
+      break;
+    }
+    pA[i] = pA[child];
+    i = child;
+  }
+  pA[i] = x;
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup TopK
+  @{
+ */
+
+/**
+  @brief         Streaming selection of the largest Q31 values.
+  @param[in,out] S          points to an instance of the top-k structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_topk_q31(
+        arm_topk_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+  q31_t *pHeap = S->pHeap;
+  uint32_t numTop = S->numTop;
+  uint32_t n = S->numValues;
+  uint32_t i, parent;
+  q31_t x;
+
+  /* Fill the heap */
+  while ((n < numTop) && (blockSize > 0U))
+  {
+    x = *pSrc++;
+    i = n++;
+    while (i > 0U)
+    {
+      parent = (i - 1U) / 2U;
+      if (!(x < pHeap[parent]))
+      {
+        break;
+      }
+      pHeap[i] = pHeap[parent];
+      i = parent;
+    }
+    pHeap[i] = x;
+    blockSize--;
+  }
+  S->numValues = n;
+
+  /* Replace the smallest kept value */
+  if (numTop > 0U)
+  {
+    while (blockSize > 0U)
+    {
+      x = *pSrc++;
+      if (x > pHeap[0])
+      {
+        pHeap[0] = x;
+        arm_topk_sift_q31(pHeap, numTop, 0U);
+      }
+      blockSize--;
+    }
+  }
+}
+
+/**
+  @brief         Largest Q31 values of the stream.
+  @param[in]     S          points to an instance of the top-k structure
+  @param[out]    pDst       points to the output vector of S->numValues values
+  @return        none
+
+  @par
+  The S->numValues kept values, at most numTop, are written in descending
+  order. The instance is not modified and the stream can be continued.
+ */
+void arm_topk_get_q31(
+  const arm_topk_instance_q31 * S,
+        q31_t * pDst)
+{
+  uint32_t n = S->numValues;
+  uint32_t i;
+  q31_t x;
+
+  memcpy(pDst, S->pHeap, n * sizeof(q31_t));
+
+  /* Moving the smallest value to the end sorts in descending order */
+  for (i = n; i > 1U; i--)
+  {
+    x = pDst[i - 1U];
+    pDst[i - 1U] = pDst[0];
+    pDst[0] = x;
+    arm_topk_sift_q31(pDst, i - 1U, 0U);
+  }
+}
+
+/**
+  @} end of TopK group
+ */
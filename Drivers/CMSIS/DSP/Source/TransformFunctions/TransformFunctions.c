@@ -36,6 +36,9 @@
 #include "arm_cfft_init_f64.c"
 #include "arm_cfft_init_q15.c"
 #include "arm_cfft_init_q31.c"
+#include "arm_cfft_mixed_f32.c"
+#include "arm_cfft_mixed_init_f32.c"
+#include "arm_cfft_bluestein_init_f32.c"
 #include "arm_cfft_radix2_f32.c"
 #include "arm_cfft_radix2_q15.c"
 #include "arm_cfft_radix2_q31.c"
@@ -47,15 +50,31 @@
 #include "arm_rfft_fast_f64.c"
 #include "arm_rfft_fast_init_f32.c"
 #include "arm_rfft_fast_init_f64.c"
+#include "arm_rfft_fast_inplace_f32.c"
+#include "arm_rfft_fast_f16s.c"
 
 #include "arm_mfcc_init_f32.c"
 #include "arm_mfcc_f32.c"
+#include "arm_mfcc_logmel_f32.c"
+#include "arm_mfcc_stream_init_f32.c"
+#include "arm_mfcc_stream_f32.c"
 
 #include "arm_mfcc_init_q31.c"
 #include "arm_mfcc_q31.c"
 
 #include "arm_mfcc_init_q15.c"
 #include "arm_mfcc_q15.c"
+#include "arm_mfcc_logmel_q15.c"
+#include "arm_mfcc_stream_init_q15.c"
+#include "arm_mfcc_stream_q15.c"
+
+#include "arm_stft_init_f32.c"
+#include "arm_stft_f32.c"
+
+#include "arm_goertzel_init_f32.c"
+#include "arm_goertzel_f32.c"
+#include "arm_goertzel_init_q31.c"
+#include "arm_goertzel_q31.c"
 
 /* Deprecated */
 
@@ -69,6 +88,7 @@
 #include "arm_rfft_f32.c"
 #include "arm_rfft_q15.c"
 #include "arm_rfft_q31.c"
+#include "arm_rfft_inplace_q31.c"
 
 #include "arm_rfft_init_f32.c"
 #include "arm_rfft_init_q15.c"
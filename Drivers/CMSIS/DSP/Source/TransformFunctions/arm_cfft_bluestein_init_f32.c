@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_bluestein_init_f32.c
+ * Description:  Initialization function for the Bluestein floating-point complex FFT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include <math.h>
+
+/**
+  @addtogroup MixedRadixCFFT
+  @{
+ */
+
+/*
+   Smallest power of two length supported by arm_cfft_f32
+   which is greater than or equal to 2*fftLen-1.
+   Return 0 if there is none.
+ */
+static uint32_t arm_cfft_bluestein_conv_len(
+  uint16_t fftLen)
+{
+  uint32_t convLen = 16U;
+
+  if ((fftLen < 2U) || (fftLen > 2048U))
+  {
+    return (0U);
+  }
+
+  while (convLen < (2U * (uint32_t)fftLen - 1U))
+  {
+    convLen <<= 1U;
+  }
+
+  return (convLen);
+}
+
+/**
+  @brief         Size of the buffer needed by the Bluestein cfft f32 function
+  @param[in]     fftLen         fft length (number of complex samples)
+  @return        buffer size in float32_t words (0 if the length is not supported)
+
+  @par           The buffer contains the chirp (<code>2*fftLen</code> words)
+                 followed by the transform of the convolution kernel
+                 (<code>2*convLen</code> words).
+ */
+uint32_t arm_cfft_bluestein_get_buffer_size_f32(
+  uint16_t fftLen)
+{
+  uint32_t convLen = arm_cfft_bluestein_conv_len(fftLen);
+
+  if (convLen == 0U)
+  {
+    return (0U);
+  }
+
+  return (2U * (uint32_t)fftLen + 2U * convLen);
+}
+
+/**
+  @brief         Initialization function for the Bluestein cfft f32 function
+  @param[in,out] S              points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in]     fftLen         fft length (number of complex samples)
+  @param[in]     pBuffer        points to a buffer of arm_cfft_bluestein_get_buffer_size_f32() words
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen is not between 2 and 2048, or the
+                                                    power of two CFFT of length convLen is not available
+
+  @par           Any length between 2 and 2048 is supported. The chirp
+                 and the transform of the convolution kernel are computed
+                 in pBuffer which must stay valid while the instance is used.
+                 This initialization uses cosf, sinf and arm_cfft_f32 and is
+                 not meant to be called in a real time path.
+ */
+arm_status arm_cfft_bluestein_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer)
+{
+  arm_status status;
+  uint32_t convLen = arm_cfft_bluestein_conv_len(fftLen);
+  float32_t *pChirp = pBuffer;
+  float32_t *pKernel;
+  float32_t phase;
+  uint32_t n, nn;
+
+  /* An instance whose initialization fails is left empty */
+  S->fftLen = fftLen;
+  S->numStages = 0U;
+  S->pTwiddle = NULL;
+  S->convLen = 0U;
+  S->pChirp = NULL;
+  S->pChirpFft = NULL;
+
+  if (convLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_cfft_init_f32(&(S->cfft), (uint16_t)convLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->convLen = (uint16_t)convLen;
+
+  pKernel = pBuffer + 2U * (uint32_t)fftLen;
+
+  /* chirp[n] = exp(-i*pi*n^2/fftLen), n^2 taken modulo 2*fftLen to keep the phase accurate */
+  for (n = 0U; n < fftLen; n++)
+  {
+    nn = (n * n) % (2U * (uint32_t)fftLen);
+    phase = PI * (float32_t)nn / (float32_t)fftLen;
+
+    pChirp[2U * n]      =  cosf(phase);
+    pChirp[2U * n + 1U] = -sinf(phase);
+  }
+
+  /* Kernel is conj(chirp) placed for a circular convolution of length convLen */
+  memset(pKernel, 0, 2U * convLen * sizeof(float32_t));
+
+  pKernel[0] = pChirp[0];
+  pKernel[1] = -pChirp[1];
+  for (n = 1U; n < fftLen; n++)
+  {
+    pKernel[2U * n]                 =  pChirp[2U * n];
+    pKernel[2U * n + 1U]            = -pChirp[2U * n + 1U];
+    pKernel[2U * (convLen - n)]      =  pChirp[2U * n];
+    pKernel[2U * (convLen - n) + 1U] = -pChirp[2U * n + 1U];
+  }
+
+  arm_cfft_f32(&(S->cfft), pKernel, 0, 1);
+
+  S->pChirp = pChirp;
+  S->pChirpFft = pKernel;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MixedRadixCFFT group
+ */
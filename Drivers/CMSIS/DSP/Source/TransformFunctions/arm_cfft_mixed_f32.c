@@ -0,0 +1,527 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_f32.c
+ * Description:  Mixed-radix and Bluestein floating-point complex FFT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/complex_math_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup MixedRadixCFFT Mixed-Radix Complex FFT Functions
+
+  @par
+                   Complex FFT for lengths which are not a power of two.
+                   The data layout, the in-place operation and the scaling
+                   of the inverse transform are the same as for
+                   arm_cfft_f32.
+  @par Mixed-radix algorithm
+                   Lengths which are a product of 2, 3 and 5 are computed
+                   with a self-sorting (Stockham) algorithm made of radix-4,
+                   radix-2, radix-3 and radix-5 stages. No bit reversal is
+                   needed, but a temporary buffer of <code>2*fftLen</code>
+                   values is used.
+                   Each length uses a twiddle factor table of
+                   <code>fftLen</code> complex values. Tables are provided for
+                   120, 240, 360, 480, 720, 1000, 1200 and 1500 and are
+                   selected with the ARM_TABLE_TWIDDLECOEF_MIXED_F32_<i>N</i>
+                   defines when ARM_DSP_CONFIG_TABLES is used.
+  @par Bluestein algorithm
+                   Any other length up to 2048 is computed with the Bluestein
+                   algorithm, as a circular convolution with a chirp done with
+                   the power of two arm_cfft_f32 of length <code>convLen</code>,
+                   the smallest power of two greater than or equal to
+                   <code>2*fftLen-1</code>. The chirp and the transform of the
+                   convolution kernel are computed by
+                   arm_cfft_bluestein_init_f32 in a buffer provided by the user.
+                   The temporary buffer must contain <code>2*convLen</code>
+                   values. The Bluestein algorithm costs about three power of
+                   two FFTs of length <code>convLen</code>.
+  @par
+                   For both algorithms, the transform is not bit exact
+                   with a direct DFT but the error is of the same order as
+                   for arm_cfft_f32.
+ */
+
+/**
+  @addtogroup MixedRadixCFFT
+  @{
+ */
+
+#define ARM_CFFT_MIXED_C3    0.866025404f  /* sin(2*pi/3) */
+#define ARM_CFFT_MIXED_C51   0.309016994f  /* cos(2*pi/5) */
+#define ARM_CFFT_MIXED_C52  -0.809016994f  /* cos(4*pi/5) */
+#define ARM_CFFT_MIXED_S51   0.951056516f  /* sin(2*pi/5) */
+#define ARM_CFFT_MIXED_S52   0.587785252f  /* sin(4*pi/5) */
+
+/*
+   Stockham stages.
+
+   A stage of radix p transforms sub-sequences of length n = p * m with a
+   stride of s (product of the radix of the previous stages):
+   y[s0 + s*(p*q + j)] = W_n^(q*j) * sum_r x[s0 + s*(q + r*m)] * W_p^(r*j)
+
+   dir is -1 for the forward transform and +1 for the inverse one.
+   The twiddle table holds cos and sin of 2*pi*k/fftLen.
+ */
+
+static void arm_cfft_mixed_radix2_f32(
+  const float32_t * pTw,
+        uint32_t twStride,
+        uint32_t m,
+        uint32_t s,
+  const float32_t * x,
+        float32_t * y,
+        float32_t dir)
+{
+  const float32_t *pA, *pB;
+        float32_t *pY0, *pY1;
+        float32_t w1r, w1i;
+        float32_t ar, ai, br, bi, tr, ti;
+        uint32_t q, s0;
+
+  for (q = 0U; q < m; q++)
+  {
+    w1r = pTw[2U * (q * twStride)];
+    w1i = dir * pTw[2U * (q * twStride) + 1U];
+
+    pA = x + 2U * (s * q);
+    pB = x + 2U * (s * (q + m));
+    pY0 = y + 2U * (s * (2U * q));
+    pY1 = y + 2U * (s * (2U * q + 1U));
+
+    for (s0 = 0U; s0 < s; s0++)
+    {
+      ar = *pA++;
+      ai = *pA++;
+      br = *pB++;
+      bi = *pB++;
+
+      *pY0++ = ar + br;
+      *pY0++ = ai + bi;
+
+      tr = ar - br;
+      ti = ai - bi;
+      *pY1++ = tr * w1r - ti * w1i;
+      *pY1++ = tr * w1i + ti * w1r;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix3_f32(
+  const float32_t * pTw,
+        uint32_t twStride,
+        uint32_t m,
+        uint32_t s,
+  const float32_t * x,
+        float32_t * y,
+        float32_t dir)
+{
+  const float32_t *pA, *pB, *pC;
+        float32_t *pY0, *pY1, *pY2;
+        float32_t w1r, w1i, w2r, w2i;
+        float32_t ar, ai, br, bi, cr, ci;
+        float32_t t1r, t1i, t2r, t2i, ur, ui, vr, vi;
+        float32_t c3 = dir * ARM_CFFT_MIXED_C3;
+        uint32_t q, s0;
+
+  for (q = 0U; q < m; q++)
+  {
+    w1r = pTw[2U * (q * twStride)];
+    w1i = dir * pTw[2U * (q * twStride) + 1U];
+    w2r = pTw[2U * (2U * q * twStride)];
+    w2i = dir * pTw[2U * (2U * q * twStride) + 1U];
+
+    pA = x + 2U * (s * q);
+    pB = x + 2U * (s * (q + m));
+    pC = x + 2U * (s * (q + 2U * m));
+    pY0 = y + 2U * (s * (3U * q));
+    pY1 = y + 2U * (s * (3U * q + 1U));
+    pY2 = y + 2U * (s * (3U * q + 2U));
+
+    for (s0 = 0U; s0 < s; s0++)
+    {
+      ar = *pA++;
+      ai = *pA++;
+      br = *pB++;
+      bi = *pB++;
+      cr = *pC++;
+      ci = *pC++;
+
+      t1r = br + cr;
+      t1i = bi + ci;
+      t2r = br - cr;
+      t2i = bi - ci;
+
+      *pY0++ = ar + t1r;
+      *pY0++ = ai + t1i;
+
+      ur = ar - 0.5f * t1r;
+      ui = ai - 0.5f * t1i;
+
+      /* v = dir * i * sin(2*pi/3) * (b - c) */
+      vr = -c3 * t2i;
+      vi =  c3 * t2r;
+
+      t1r = ur + vr;
+      t1i = ui + vi;
+      *pY1++ = t1r * w1r - t1i * w1i;
+      *pY1++ = t1r * w1i + t1i * w1r;
+
+      t1r = ur - vr;
+      t1i = ui - vi;
+      *pY2++ = t1r * w2r - t1i * w2i;
+      *pY2++ = t1r * w2i + t1i * w2r;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix4_f32(
+  const float32_t * pTw,
+        uint32_t twStride,
+        uint32_t m,
+        uint32_t s,
+  const float32_t * x,
+        float32_t * y,
+        float32_t dir)
+{
+  const float32_t *pA, *pB, *pC, *pD;
+        float32_t *pY0, *pY1, *pY2, *pY3;
+        float32_t w1r, w1i, w2r, w2i, w3r, w3i;
+        float32_t ar, ai, br, bi, cr, ci, dr, di;
+        float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+        uint32_t q, s0;
+
+  for (q = 0U; q < m; q++)
+  {
+    w1r = pTw[2U * (q * twStride)];
+    w1i = dir * pTw[2U * (q * twStride) + 1U];
+    w2r = pTw[2U * (2U * q * twStride)];
+    w2i = dir * pTw[2U * (2U * q * twStride) + 1U];
+    w3r = pTw[2U * (3U * q * twStride)];
+    w3i = dir * pTw[2U * (3U * q * twStride) + 1U];
+
+    pA = x + 2U * (s * q);
+    pB = x + 2U * (s * (q + m));
+    pC = x + 2U * (s * (q + 2U * m));
+    pD = x + 2U * (s * (q + 3U * m));
+    pY0 = y + 2U * (s * (4U * q));
+    pY1 = y + 2U * (s * (4U * q + 1U));
+    pY2 = y + 2U * (s * (4U * q + 2U));
+    pY3 = y + 2U * (s * (4U * q + 3U));
+
+    for (s0 = 0U; s0 < s; s0++)
+    {
+      ar = *pA++;
+      ai = *pA++;
+      br = *pB++;
+      bi = *pB++;
+      cr = *pC++;
+      ci = *pC++;
+      dr = *pD++;
+      di = *pD++;
+
+      t0r = ar + cr;
+      t0i = ai + ci;
+      t1r = ar - cr;
+      t1i = ai - ci;
+      t2r = br + dr;
+      t2i = bi + di;
+      /* t3 = dir * i * (b - d) */
+      t3r = -dir * (bi - di);
+      t3i =  dir * (br - dr);
+
+      *pY0++ = t0r + t2r;
+      *pY0++ = t0i + t2i;
+
+      ar = t1r + t3r;
+      ai = t1i + t3i;
+      *pY1++ = ar * w1r - ai * w1i;
+      *pY1++ = ar * w1i + ai * w1r;
+
+      ar = t0r - t2r;
+      ai = t0i - t2i;
+      *pY2++ = ar * w2r - ai * w2i;
+      *pY2++ = ar * w2i + ai * w2r;
+
+      ar = t1r - t3r;
+      ai = t1i - t3i;
+      *pY3++ = ar * w3r - ai * w3i;
+      *pY3++ = ar * w3i + ai * w3r;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix5_f32(
+  const float32_t * pTw,
+        uint32_t twStride,
+        uint32_t m,
+        uint32_t s,
+  const float32_t * x,
+        float32_t * y,
+        float32_t dir)
+{
+  const float32_t *pA, *pB, *pC, *pD, *pE;
+        float32_t *pY0, *pY1, *pY2, *pY3, *pY4;
+        float32_t w1r, w1i, w2r, w2i, w3r, w3i, w4r, w4i;
+        float32_t ar, ai, br, bi, cr, ci, dr, di, er, ei;
+        float32_t t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;
+        float32_t b1r, b1i, b2r, b2i, d1r, d1i, d2r, d2i;
+        float32_t s51 = dir * ARM_CFFT_MIXED_S51;
+        float32_t s52 = dir * ARM_CFFT_MIXED_S52;
+        uint32_t q, s0;
+
+  for (q = 0U; q < m; q++)
+  {
+    w1r = pTw[2U * (q * twStride)];
+    w1i = dir * pTw[2U * (q * twStride) + 1U];
+    w2r = pTw[2U * (2U * q * twStride)];
+    w2i = dir * pTw[2U * (2U * q * twStride) + 1U];
+    w3r = pTw[2U * (3U * q * twStride)];
+    w3i = dir * pTw[2U * (3U * q * twStride) + 1U];
+    w4r = pTw[2U * (4U * q * twStride)];
+    w4i = dir * pTw[2U * (4U * q * twStride) + 1U];
+
+    pA = x + 2U * (s * q);
+    pB = x + 2U * (s * (q + m));
+    pC = x + 2U * (s * (q + 2U * m));
+    pD = x + 2U * (s * (q + 3U * m));
+    pE = x + 2U * (s * (q + 4U * m));
+    pY0 = y + 2U * (s * (5U * q));
+    pY1 = y + 2U * (s * (5U * q + 1U));
+    pY2 = y + 2U * (s * (5U * q + 2U));
+    pY3 = y + 2U * (s * (5U * q + 3U));
+    pY4 = y + 2U * (s * (5U * q + 4U));
+
+    for (s0 = 0U; s0 < s; s0++)
+    {
+      ar = *pA++;
+      ai = *pA++;
+      br = *pB++;
+      bi = *pB++;
+      cr = *pC++;
+      ci = *pC++;
+      dr = *pD++;
+      di = *pD++;
+      er = *pE++;
+      ei = *pE++;
+
+      t1r = br + er;
+      t1i = bi + ei;
+      t2r = cr + dr;
+      t2i = ci + di;
+      t3r = br - er;
+      t3i = bi - ei;
+      t4r = cr - dr;
+      t4i = ci - di;
+
+      *pY0++ = ar + t1r + t2r;
+      *pY0++ = ai + t1i + t2i;
+
+      b1r = ar + ARM_CFFT_MIXED_C51 * t1r + ARM_CFFT_MIXED_C52 * t2r;
+      b1i = ai + ARM_CFFT_MIXED_C51 * t1i + ARM_CFFT_MIXED_C52 * t2i;
+      b2r = ar + ARM_CFFT_MIXED_C52 * t1r + ARM_CFFT_MIXED_C51 * t2r;
+      b2i = ai + ARM_CFFT_MIXED_C52 * t1i + ARM_CFFT_MIXED_C51 * t2i;
+
+      /* d1 = dir * i * (s1 * t3 + s2 * t4), d2 = dir * i * (s2 * t3 - s1 * t4) */
+      d1r = -(s51 * t3i + s52 * t4i);
+      d1i =  (s51 * t3r + s52 * t4r);
+      d2r = -(s52 * t3i - s51 * t4i);
+      d2i =  (s52 * t3r - s51 * t4r);
+
+      ar = b1r + d1r;
+      ai = b1i + d1i;
+      *pY1++ = ar * w1r - ai * w1i;
+      *pY1++ = ar * w1i + ai * w1r;
+
+      ar = b2r + d2r;
+      ai = b2i + d2i;
+      *pY2++ = ar * w2r - ai * w2i;
+      *pY2++ = ar * w2i + ai * w2r;
+
+      ar = b2r - d2r;
+      ai = b2i - d2i;
+      *pY3++ = ar * w3r - ai * w3i;
+      *pY3++ = ar * w3i + ai * w3r;
+
+      ar = b1r - d1r;
+      ai = b1i - d1i;
+      *pY4++ = ar * w4r - ai * w4i;
+      *pY4++ = ar * w4i + ai * w4r;
+    }
+  }
+}
+
+static void arm_cfft_mixed_stockham_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag,
+        float32_t * pTmp)
+{
+  const float32_t *x = p1;
+        float32_t *y = pTmp;
+        float32_t *t;
+        float32_t dir = (ifftFlag != 0U) ? 1.0f : -1.0f;
+        uint32_t fftLen = S->fftLen;
+        uint32_t n = fftLen;
+        uint32_t s = 1U;
+        uint32_t stage, radix, m;
+
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    radix = S->factors[stage];
+    m = n / radix;
+
+    switch (radix)
+    {
+      case 2U:
+        arm_cfft_mixed_radix2_f32(S->pTwiddle, fftLen / n, m, s, x, y, dir);
+        break;
+      case 3U:
+        arm_cfft_mixed_radix3_f32(S->pTwiddle, fftLen / n, m, s, x, y, dir);
+        break;
+      case 4U:
+        arm_cfft_mixed_radix4_f32(S->pTwiddle, fftLen / n, m, s, x, y, dir);
+        break;
+      default:
+        arm_cfft_mixed_radix5_f32(S->pTwiddle, fftLen / n, m, s, x, y, dir);
+        break;
+    }
+
+    n = m;
+    s = s * radix;
+
+    t = y;
+    y = (float32_t *)x;
+    x = t;
+  }
+
+  /* The result is in x */
+  if (ifftFlag != 0U)
+  {
+    arm_scale_f32(x, 1.0f / (float32_t)fftLen, p1, 2U * fftLen);
+  }
+  else if (x != p1)
+  {
+    memcpy(p1, x, 2U * fftLen * sizeof(float32_t));
+  }
+}
+
+static void arm_cfft_mixed_bluestein_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag,
+        float32_t * pTmp)
+{
+  const float32_t *pC = S->pChirp;
+        float32_t *pSrc = p1;
+        float32_t *pDst = pTmp;
+        float32_t xr, xi, cr, ci;
+        float32_t sign = (ifftFlag != 0U) ? -1.0f : 1.0f;
+        float32_t scale = (ifftFlag != 0U) ? 1.0f / (float32_t)S->fftLen : 1.0f;
+        uint32_t blkCnt;
+
+  /* Inverse transform computed as conj(DFT(conj(x))) / fftLen */
+
+  /* a[n] = x[n] * chirp[n] */
+  blkCnt = S->fftLen;
+  while (blkCnt > 0U)
+  {
+    xr = *pSrc++;
+    xi = sign * *pSrc++;
+    cr = *pC++;
+    ci = *pC++;
+
+    *pDst++ = xr * cr - xi * ci;
+    *pDst++ = xr * ci + xi * cr;
+
+    blkCnt--;
+  }
+
+  memset(pDst, 0, 2U * ((uint32_t)S->convLen - S->fftLen) * sizeof(float32_t));
+
+  /* Circular convolution with the conjugate chirp */
+  arm_cfft_f32(&(S->cfft), pTmp, 0, 1);
+  arm_cmplx_mult_cmplx_f32(pTmp, S->pChirpFft, pTmp, S->convLen);
+  arm_cfft_f32(&(S->cfft), pTmp, 1, 1);
+
+  /* X[k] = chirp[k] * (a * conj(chirp))[k] */
+  pC = S->pChirp;
+  pSrc = pTmp;
+  pDst = p1;
+  blkCnt = S->fftLen;
+  while (blkCnt > 0U)
+  {
+    xr = *pSrc++;
+    xi = *pSrc++;
+    cr = *pC++;
+    ci = *pC++;
+
+    *pDst++ = scale * (xr * cr - xi * ci);
+    *pDst++ = sign * scale * (xr * ci + xi * cr);
+
+    blkCnt--;
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point mixed-radix and Bluestein complex FFT.
+  @param[in]     S              points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in,out] p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @param[in,out] pTmp           points to a temporary buffer of <code>2*fftLen</code> values
+                                (<code>2*convLen</code> values when the Bluestein algorithm is used)
+  @return        none
+
+  @par           The Bluestein algorithm is used when the instance was initialized by
+                 arm_cfft_bluestein_init_f32 (its chirp is set). When the initialization
+                 of the instance failed, the function returns without modifying p1.
+ */
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag,
+        float32_t * pTmp)
+{
+  if (S->pChirp != NULL)
+  {
+    arm_cfft_mixed_bluestein_f32(S, p1, ifftFlag, pTmp);
+  }
+  else if (S->numStages != 0U)
+  {
+    arm_cfft_mixed_stockham_f32(S, p1, ifftFlag, pTmp);
+  }
+}
+
+/**
+  @} end of MixedRadixCFFT group
+ */
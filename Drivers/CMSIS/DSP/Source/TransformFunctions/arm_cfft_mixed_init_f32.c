@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_init_f32.c
+ * Description:  Initialization function for the mixed-radix floating-point complex FFT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "arm_common_tables.h"
+
+#define MIXEDINIT(SIZE)                   \
+  S->pTwiddle = twiddleCoef_mixed_##SIZE;
+
+/**
+  @addtogroup MixedRadixCFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the mixed-radix cfft f32 function
+  @param[in,out] S              points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in]     fftLen         fft length (number of complex samples)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen has no twiddle table or
+                                                    is not a product of 2, 3 and 5
+
+  @par           Supported lengths are 120, 240, 360, 480, 720, 1000, 1200
+                 and 1500 (when the corresponding tables are built).
+                 Other lengths can use arm_cfft_bluestein_init_f32.
+ */
+arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+  uint32_t n = fftLen;
+  uint32_t stage = 0U;
+
+  /*  Initialise the FFT length */
+  S->fftLen = fftLen;
+
+  /*  Initialise the Twiddle coefficient pointer */
+  S->pTwiddle = NULL;
+
+  S->convLen = 0U;
+  S->pChirp = NULL;
+  S->pChirpFft = NULL;
+
+  switch (S->fftLen)
+  {
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_1500)
+    case 1500U:
+      MIXEDINIT(1500);
+      break;
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_1200)
+    case 1200U:
+      MIXEDINIT(1200);
+      break;
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_1000)
+    case 1000U:
+      MIXEDINIT(1000);
+      break;
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_720)
+    case 720U:
+      MIXEDINIT(720);
+      break;
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_480)
+    case 480U:
+      MIXEDINIT(480);
+      break;
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_360)
+    case 360U:
+      MIXEDINIT(360);
+      break;
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_240)
+    case 240U:
+      MIXEDINIT(240);
+      break;
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_MIXED_F32_120)
+    case 120U:
+      MIXEDINIT(120);
+      break;
+#endif
+
+    default:
+      /*  Reporting argument error if fftSize is not valid value */
+      status = ARM_MATH_ARGUMENT_ERROR;
+      break;
+  }
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    S->numStages = 0U;
+    return (status);
+  }
+
+  /* Factorize the length: radix-4 stages first, then 2, 3 and 5 */
+  while ((n % 4U) == 0U)
+  {
+    S->factors[stage++] = 4U;
+    n = n / 4U;
+  }
+  while ((n % 2U) == 0U)
+  {
+    S->factors[stage++] = 2U;
+    n = n / 2U;
+  }
+  while ((n % 3U) == 0U)
+  {
+    S->factors[stage++] = 3U;
+    n = n / 3U;
+  }
+  while ((n % 5U) == 0U)
+  {
+    S->factors[stage++] = 5U;
+    n = n / 5U;
+  }
+
+  S->numStages = (uint16_t)stage;
+
+  if (n != 1U)
+  {
+    S->numStages = 0U;
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  return (status);
+}
+
+/**
+  @} end of MixedRadixCFFT group
+ */
@@ -0,0 +1,275 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel bank
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup Goertzel Goertzel Bank
+
+  Evaluation of a few DFT bins at arbitrary frequencies.
+
+  Each bin runs the Goertzel recurrence on every input sample:
+  <pre>
+      s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2]
+  </pre>
+  and, every <code>blockLen</code> samples, outputs
+  <pre>
+      X = (cos(w) * s[N-1] - s[N-2]) + j * sin(w) * s[N-1]
+  </pre>
+  which is the DFT of the last <code>blockLen</code> samples at the
+  frequency <code>w = 2*pi*f/fs</code>, with the phase referenced to the
+  sample following the block:
+  <pre>
+      X = sum(x[n] * exp(-j * w * (n - N)), n = 0 .. N-1) = exp(j * w * N) * DFT(w)
+  </pre>
+  where <code>N</code> is <code>blockLen</code>. When <code>f/fs = k/blockLen</code>
+  the factor <code>exp(j * w * N)</code> is 1 and X is identical to the bin k
+  of a DFT of length <code>blockLen</code>. For other frequencies, X must be
+  multiplied by <code>exp(-j * w * N)</code> to get the phase of the DFT
+  (referenced to the first sample of the block), or by <code>exp(-j * w)</code>
+  to reference it to the last sample. The floating-point and Q31 versions use the
+  same convention. The state is then cleared and a new block starts.
+
+  Input samples are pushed in blocks of any size. Frequencies do not need to
+  be on the DFT grid and can be changed at run time with
+  arm_goertzel_set_freq_f32 or arm_goertzel_set_freq_q31.
+
+  @par           Cost
+                   A bin costs one multiply and two additions per sample,
+                   so <code>3*blockLen</code> operations per block, whereas a
+                   real FFT of the same length costs about
+                   <code>2.5*blockLen*log2(blockLen)</code> operations plus the
+                   magnitude computation. The bank is cheaper than
+                   arm_rfft_fast_f32 as long as the number of bins is below
+                   about <code>log2(blockLen)</code> (10 bins for 1024 samples).
+                   This is an operation count estimate: the actual crossover
+                   depends on the core and on memory wait states. The Goertzel
+                   example (arm_goertzel_example_f32.c) measures it on the target.
+                   The recurrences of several bins are independent: with
+                   ARM_MATH_LOOPUNROLL, a group of 4 bins costs little more than a
+                   single bin on cores where the floating point latency dominates.
+
+  @par           Output
+                   For each completed block, <code>numBins</code> complex values
+                   {real, imag} are written to the output buffer. The floating
+                   point version is not scaled. The Q31 version is scaled by
+                   <code>1/blockLen</code>.
+  @par           Accuracy
+                   In floating point, the error of the recurrence grows with
+                   <code>blockLen</code> and is largest for low frequencies. For a
+                   block of 1024 samples and a tone at 20/1024, the error is about
+                   1e-4 of the magnitude of the bin, against 1e-7 for arm_rfft_fast_f32.
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/*
+   Run the recurrence of all bins over n samples.
+ */
+static void arm_goertzel_run_f32(
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t numBins,
+  const float32_t * pSrc,
+        uint32_t n)
+{
+  const float32_t *px;
+        float32_t c0, a0, a1, a2;
+        uint32_t binCnt, sampCnt;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        float32_t x, c1, c2, c3;
+        float32_t b0, b1, b2, d0, d1, d2, e0, e1, e2;
+
+  /* Four independent recurrences are interleaved to hide the FPU latency */
+  binCnt = numBins >> 2U;
+  while (binCnt > 0U)
+  {
+    c0 = pCoeffs[0];
+    c1 = pCoeffs[3];
+    c2 = pCoeffs[6];
+    c3 = pCoeffs[9];
+
+    a1 = pState[0];
+    a2 = pState[1];
+    b1 = pState[2];
+    b2 = pState[3];
+    d1 = pState[4];
+    d2 = pState[5];
+    e1 = pState[6];
+    e2 = pState[7];
+
+    px = pSrc;
+    sampCnt = n;
+    while (sampCnt > 0U)
+    {
+      x = *px++;
+
+      a0 = x + c0 * a1 - a2;
+      b0 = x + c1 * b1 - b2;
+      d0 = x + c2 * d1 - d2;
+      e0 = x + c3 * e1 - e2;
+
+      a2 = a1;
+      a1 = a0;
+      b2 = b1;
+      b1 = b0;
+      d2 = d1;
+      d1 = d0;
+      e2 = e1;
+      e1 = e0;
+
+      sampCnt--;
+    }
+
+    pState[0] = a1;
+    pState[1] = a2;
+    pState[2] = b1;
+    pState[3] = b2;
+    pState[4] = d1;
+    pState[5] = d2;
+    pState[6] = e1;
+    pState[7] = e2;
+
+    pCoeffs += 12;
+    pState += 8;
+    binCnt--;
+  }
+
+  binCnt = numBins & 0x3U;
+
+#else
+
+  binCnt = numBins;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (binCnt > 0U)
+  {
+    c0 = pCoeffs[0];
+    a1 = pState[0];
+    a2 = pState[1];
+
+    px = pSrc;
+    sampCnt = n;
+    while (sampCnt > 0U)
+    {
+      a0 = *px++ + c0 * a1 - a2;
+      a2 = a1;
+      a1 = a0;
+
+      sampCnt--;
+    }
+
+    pState[0] = a1;
+    pState[1] = a2;
+
+    pCoeffs += 3;
+    pState += 2;
+    binCnt--;
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point Goertzel bank.
+  @param[in,out] S          points to an instance of the floating-point Goertzel structure.
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of samples to process
+  @param[out]    pDst       points to the output buffer (2*numBins complex values per completed block)
+  @return        number of completed blocks written to pDst
+
+  @par           Phase
+                   The phase of each output is referenced to the sample following
+                   the block. The output is the DFT of the block multiplied by
+                   <code>exp(j*w*blockLen)</code>, which is 1 for the frequencies
+                   <code>k/blockLen</code> of the DFT grid.
+  @par           pDst must be large enough for all the blocks which can be
+                 completed by the new samples:
+                 <code>2*numBins*ceil(blockSize/blockLen)</code> values.
+ */
+uint32_t arm_goertzel_f32(
+        arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst)
+{
+  const float32_t *pC;
+        float32_t *pS;
+        uint32_t nbBlocks = 0U;
+        uint32_t n, i;
+
+  while (blockSize > 0U)
+  {
+    /* Samples up to the end of the current evaluation */
+    n = (uint32_t)S->blockLen - S->sampleCount;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    arm_goertzel_run_f32(S->pCoeffs, S->pState, S->numBins, pSrc, n);
+
+    pSrc += n;
+    blockSize -= n;
+    S->sampleCount += (uint16_t)n;
+
+    if (S->sampleCount == S->blockLen)
+    {
+      pC = S->pCoeffs;
+      pS = S->pState;
+
+      for (i = 0U; i < S->numBins; i++)
+      {
+        *pDst++ = pC[1] * pS[0] - pS[1];
+        *pDst++ = pC[2] * pS[0];
+
+        pS[0] = 0.0f;
+        pS[1] = 0.0f;
+
+        pC += 3;
+        pS += 2;
+      }
+
+      S->sampleCount = 0U;
+      nbBlocks++;
+    }
+  }
+
+  return (nbBlocks);
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_f32.c
+ * Description:  Initialization function for the floating-point Goertzel bank
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Retune one bin of the floating-point Goertzel bank.
+  @param[in,out] S          points to an instance of the floating-point Goertzel structure.
+  @param[in]     bin        index of the bin
+  @param[in]     freq       new normalized frequency (f/fs in [0, 0.5))
+  @return        none
+
+  @par           The new frequency is used from the next sample. To get an
+                 exact result for this bin, retune it just after a block
+                 has been completed by arm_goertzel_f32.
+ */
+void arm_goertzel_set_freq_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t bin,
+  float32_t freq)
+{
+  float32_t *pC = S->pCoeffs + 3U * (uint32_t)bin;
+  float32_t sinVal, cosVal;
+
+  /* w = 2*pi*freq, converted to degrees */
+  arm_sin_cos_f32(360.0f * freq, &sinVal, &cosVal);
+
+  pC[0] = 2.0f * cosVal;
+  pC[1] = cosVal;
+  pC[2] = sinVal;
+}
+
+/**
+  @brief         Initialization function for the floating-point Goertzel bank.
+  @param[out]    S          points to an instance of the floating-point Goertzel structure.
+  @param[in]     numBins    number of tracked frequencies
+  @param[in]     blockLen   number of samples of each evaluation
+  @param[in]     pFreqs     points to numBins normalized frequencies (f/fs in [0, 0.5))
+  @param[in]     pCoeffs    points to the coefficient buffer of 3*numBins values
+  @param[in]     pState     points to the state buffer of 2*numBins values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : numBins or blockLen is 0
+ */
+arm_status arm_goertzel_init_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t numBins,
+        uint16_t blockLen,
+  const float32_t * pFreqs,
+        float32_t * pCoeffs,
+        float32_t * pState)
+{
+  uint16_t i;
+
+  if ((numBins == 0U) || (blockLen == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numBins = numBins;
+  S->blockLen = blockLen;
+  S->sampleCount = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  for (i = 0U; i < numBins; i++)
+  {
+    arm_goertzel_set_freq_f32(S, i, pFreqs[i]);
+  }
+
+  /* Clear state buffer */
+  memset(pState, 0, 2U * (uint32_t)numBins * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of Goertzel group
+ */
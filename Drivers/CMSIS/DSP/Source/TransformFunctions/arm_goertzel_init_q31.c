@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q31.c
+ * Description:  Initialization function for the Q31 Goertzel bank
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Retune one bin of the Q31 Goertzel bank.
+  @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+  @param[in]     bin        index of the bin
+  @param[in]     freq       new normalized frequency (f/fs in [0, 0.5))
+  @return        none
+
+  @par           The new frequency is used from the next sample. To get an
+                 exact result for this bin, retune it just after a block
+                 has been completed by arm_goertzel_q31.
+ */
+void arm_goertzel_set_freq_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t bin,
+  q31_t freq)
+{
+  q31_t *pC = S->pCoeffs + 2U * (uint32_t)bin;
+
+  /* arm_sin_cos_q31 maps [-1, 1) to [-180, 180) degrees so the angle 2*pi*freq is 2*freq */
+  arm_sin_cos_q31((q31_t)((uint32_t)freq << 1U), &pC[1], &pC[0]);
+}
+
+/**
+  @brief         Initialization function for the Q31 Goertzel bank.
+  @param[out]    S          points to an instance of the Q31 Goertzel structure.
+  @param[in]     numBins    number of tracked frequencies
+  @param[in]     blockLen   number of samples of each evaluation
+  @param[in]     pFreqs     points to numBins normalized frequencies (f/fs in [0, 0.5))
+  @param[in]     pCoeffs    points to the coefficient buffer of 2*numBins values
+  @param[in]     pState     points to the state buffer of 2*numBins values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : numBins or blockLen is 0
+ */
+arm_status arm_goertzel_init_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t numBins,
+        uint16_t blockLen,
+  const q31_t * pFreqs,
+        q31_t * pCoeffs,
+        q63_t * pState)
+{
+  uint16_t i;
+
+  if ((numBins == 0U) || (blockLen == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numBins = numBins;
+  S->blockLen = blockLen;
+  S->sampleCount = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  for (i = 0U; i < numBins; i++)
+  {
+    arm_goertzel_set_freq_q31(S, i, pFreqs[i]);
+  }
+
+  /* Clear state buffer */
+  memset(pState, 0, 2U * (uint32_t)numBins * sizeof(q63_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of Goertzel group
+ */
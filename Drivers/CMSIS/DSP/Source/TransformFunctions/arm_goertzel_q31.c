@@ -0,0 +1,210 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel bank
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/*
+   Run the recurrence of all bins over n samples.
+   The state is a 64-bit value with the scaling of the input and
+   2*cos(w) is the Q31 cos(w) read as a Q30 value.
+ */
+static void arm_goertzel_run_q31(
+  const q31_t * pCoeffs,
+        q63_t * pState,
+        uint32_t numBins,
+  const q31_t * pSrc,
+        uint32_t n)
+{
+  const q31_t *px;
+        q31_t c0;
+        q63_t a0, a1, a2;
+        uint32_t binCnt, sampCnt;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        q31_t c1;
+        q63_t b0, b1, b2;
+        q63_t x;
+
+  /* Two independent recurrences are interleaved */
+  binCnt = numBins >> 1U;
+  while (binCnt > 0U)
+  {
+    c0 = pCoeffs[0];
+    c1 = pCoeffs[2];
+
+    a1 = pState[0];
+    a2 = pState[1];
+    b1 = pState[2];
+    b2 = pState[3];
+
+    px = pSrc;
+    sampCnt = n;
+    while (sampCnt > 0U)
+    {
+      x = (q63_t) *px++;
+
+      a0 = x + (mult32x64(a1, c0) << 2) - a2;
+      b0 = x + (mult32x64(b1, c1) << 2) - b2;
+
+      a2 = a1;
+      a1 = a0;
+      b2 = b1;
+      b1 = b0;
+
+      sampCnt--;
+    }
+
+    pState[0] = a1;
+    pState[1] = a2;
+    pState[2] = b1;
+    pState[3] = b2;
+
+    pCoeffs += 4;
+    pState += 4;
+    binCnt--;
+  }
+
+  binCnt = numBins & 0x1U;
+
+#else
+
+  binCnt = numBins;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (binCnt > 0U)
+  {
+    c0 = pCoeffs[0];
+    a1 = pState[0];
+    a2 = pState[1];
+
+    px = pSrc;
+    sampCnt = n;
+    while (sampCnt > 0U)
+    {
+      a0 = (q63_t) *px++ + (mult32x64(a1, c0) << 2) - a2;
+      a2 = a1;
+      a1 = a0;
+
+      sampCnt--;
+    }
+
+    pState[0] = a1;
+    pState[1] = a2;
+
+    pCoeffs += 2;
+    pState += 2;
+    binCnt--;
+  }
+}
+
+/**
+  @brief         Processing function for the Q31 Goertzel bank.
+  @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of samples to process
+  @param[out]    pDst       points to the output buffer (2*numBins complex values per completed block)
+  @return        number of completed blocks written to pDst
+
+  @par           Scaling and Overflow Behavior
+                   The state is kept in 64-bit and can grow up to
+                   <code>blockLen/(2*sin(w))</code> times the input amplitude.
+                   The output is divided by <code>blockLen</code> and saturated
+                   to Q31, so a full scale sinusoid on a bin gives a magnitude of 0.5.
+  @par           Phase
+                   As in arm_goertzel_f32(), the phase of each output is referenced
+                   to the sample following the block. The output is the scaled DFT
+                   of the block multiplied by <code>exp(j*w*blockLen)</code>, which
+                   is 1 for the frequencies <code>k/blockLen</code> of the DFT grid.
+  @par           pDst must be large enough for all the blocks which can be
+                 completed by the new samples:
+                 <code>2*numBins*ceil(blockSize/blockLen)</code> values.
+ */
+uint32_t arm_goertzel_q31(
+        arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        q31_t * pDst)
+{
+  const q31_t *pC;
+        q63_t *pS;
+        q63_t re, im;
+        uint32_t nbBlocks = 0U;
+        uint32_t n, i;
+
+  while (blockSize > 0U)
+  {
+    /* Samples up to the end of the current evaluation */
+    n = (uint32_t)S->blockLen - S->sampleCount;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    arm_goertzel_run_q31(S->pCoeffs, S->pState, S->numBins, pSrc, n);
+
+    pSrc += n;
+    blockSize -= n;
+    S->sampleCount += (uint16_t)n;
+
+    if (S->sampleCount == S->blockLen)
+    {
+      pC = S->pCoeffs;
+      pS = S->pState;
+
+      for (i = 0U; i < S->numBins; i++)
+      {
+        re = (mult32x64(pS[0], pC[0]) << 1) - pS[1];
+        im = (mult32x64(pS[0], pC[1]) << 1);
+
+        *pDst++ = clip_q63_to_q31(re / (q63_t)S->blockLen);
+        *pDst++ = clip_q63_to_q31(im / (q63_t)S->blockLen);
+
+        pS[0] = 0;
+        pS[1] = 0;
+
+        pC += 2;
+        pS += 2;
+      }
+
+      S->sampleCount = 0U;
+      nbBlocks++;
+    }
+  }
+
+  return (nbBlocks);
+}
+
+/**
+  @} end of Goertzel group
+ */
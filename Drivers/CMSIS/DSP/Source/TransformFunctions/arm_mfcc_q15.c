@@ -34,11 +34,6 @@
 #include "dsp/complex_math_functions.h"
 #include "dsp/fast_math_functions.h"
 #include "dsp/matrix_functions.h"
-
-/* Constants for Q15 implementation */
-#define LOG2TOLOG_Q15 0x02C5C860
-#define MICRO_Q15 0x00000219
-#define SHIFT_MELFILTER_SATURATION_Q15 10
 /**
   @ingroup groupTransforms
  */
@@ -89,109 +84,18 @@ arm_status arm_mfcc_q15(
   q31_t *pTmp
   )
 {
-    q15_t m;
-    uint32_t index;
-    uint32_t fftShift=0;
-    q31_t logExponent;
-    q63_t result;
     arm_matrix_instance_q15 pDctMat;
-    uint32_t i;
-    uint32_t coefsPos;
-    uint32_t filterLimit;
-    q15_t *pTmp2=(q15_t*)pTmp;
 
     arm_status status = ARM_MATH_SUCCESS;
     
-    // q15
-    arm_absmax_q15(pSrc,S->fftLen,&m,&index);
-
-    if (m !=0)
-    {
-       q15_t quotient;
-       int16_t shift;
-
-       status = arm_divide_q15(0x7FFF,m,&quotient,&shift);
-       if (status != ARM_MATH_SUCCESS)
-       {
-          return(status);
-       }
- 
-       arm_scale_q15(pSrc,quotient,shift,pSrc,S->fftLen);
-    }
-
-
-    // q15
-    arm_mult_q15(pSrc,S->windowCoefs, pSrc, S->fftLen);
-
-
-    /* Compute spectrum magnitude 
-    */
-    fftShift = 31 - __CLZ(S->fftLen);
-#if defined(ARM_MFCC_CFFT_BASED)
-    /* some HW accelerator for CMSIS-DSP used in some boards
-       are only providing acceleration for CFFT.
-       With ARM_MFCC_CFFT_BASED enabled, CFFT is used and the MFCC
-       will be accelerated on those boards.
- 
-       The default is to use RFFT
-    */
-    /* Convert from real to complex */
-    for(i=0; i < S->fftLen ; i++)
-    {
-      pTmp2[2*i] = pSrc[i];
-      pTmp2[2*i+1] = 0;
-    }
-    arm_cfft_q15(&(S->cfft),pTmp2,0,1);
-#else
-    /* Default RFFT based implementation */
-    arm_rfft_q15(&(S->rfft),pSrc,pTmp2);
-#endif
-    filterLimit = 1 + (S->fftLen >> 1);
-
-
-    // q15 - fftShift
-    arm_cmplx_mag_q15(pTmp2,pSrc,filterLimit);
-    // q14 - fftShift
-
-    /* Apply MEL filters */
-    coefsPos = 0;
-    for(i=0; i<S->nbMelFilters; i++)
+    /* Log of the Mel energies in q8.7 */
+    status = arm_mfcc_logmel_q15(S,pSrc,pSrc,pTmp);
+    if (status != ARM_MATH_SUCCESS)
     {
-      arm_dot_prod_q15(pSrc+S->filterPos[i],
-        &(S->filterCoefs[coefsPos]),
-        S->filterLengths[i],
-        &result);
-
-      coefsPos += S->filterLengths[i];
-
-      // q34.29 - fftShift
-      result += MICRO_Q15;
-      result >>= SHIFT_MELFILTER_SATURATION_Q15;
-      // q34.29 - fftShift - satShift
-      pTmp[i] = __SSAT(result,31) ;
-
+       return(status);
     }
 
 
-    // q34.29 - fftShift - satShift
-    /* Compute the log */
-    arm_vlog_q31(pTmp,pTmp,S->nbMelFilters);
-
-
-    // q5.26
-   
-    logExponent = fftShift + 2 + SHIFT_MELFILTER_SATURATION_Q15;
-    logExponent = logExponent * LOG2TOLOG_Q15;
-
-
-    // q8.26
-    arm_offset_q31(pTmp,logExponent,pTmp,S->nbMelFilters);
-    arm_shift_q31(pTmp,-19,pTmp,S->nbMelFilters);
-    for(i=0; i<S->nbMelFilters; i++)
-    { 
-      pSrc[i] = __SSAT((q15_t)pTmp[i],16);
-    }
-
     // q8.7
 
     pDctMat.numRows=S->nbDctOutputs;
@@ -0,0 +1,193 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_stream_f32.c
+ * Description:  Streaming MFCC (F32) with frame reuse
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup MFCCStream Streaming MFCC
+
+  Streaming MFCC or log-Mel feature extractor writing the input tensor of
+  a keyword spotting or audio classification network.
+
+  Input samples are pushed in blocks of any size. Each time
+  <code>hopSize</code> new samples have been received (and at least
+  <code>fftLen</code> samples since initialization), the last
+  <code>fftLen</code> samples are copied out of the circular input history
+  and the features of the frame are computed with arm_mfcc_f32 (or
+  arm_mfcc_logmel_f32). With overlapping frames, only the features of the
+  new frame are computed: the features of the previous frames are kept in
+  the output tensor.
+
+  @par           Output tensor
+                   The output tensor has <code>numFrames</code> rows of
+                   <code>numFeatures</code> values (HWC layout with H = frames,
+                   W = features and C = 1), the oldest frame first.
+                   Each frame is written twice, at row <code>n % numFrames</code>
+                   and at row <code>n % numFrames + numFrames</code>, so the last
+                   <code>numFrames</code> frames are always contiguous in memory.
+                   arm_mfcc_stream_get_tensor_f32 returns a pointer to them that
+                   can be passed to the network without any copy.
+                   The write of a frame costs <code>numFeatures</code> copies
+                   instead of the <code>numFrames * numFeatures</code> copies
+                   of a shift of the whole tensor.
+
+  @par           Memory
+                   All buffers come from a single arena provided to
+                   arm_mfcc_stream_init_f32. Its size, in float32_t words, is
+                   returned by arm_mfcc_stream_get_buffer_size_f32.
+ */
+
+/**
+  @addtogroup MFCCStream
+  @{
+ */
+
+/*
+   Copy the last fftLen samples of the history to the frame buffer,
+   oldest sample first, and compute the features of the frame.
+ */
+static void arm_mfcc_stream_frame_f32(
+  const arm_mfcc_stream_instance_f32 * S,
+        float32_t * pOut)
+{
+  uint32_t fftLen = S->pMfcc->fftLen;
+
+  /* Oldest sample is at the write position of the circular history */
+  memcpy(S->pFrame, S->pHistory + S->historyIndex,
+         (fftLen - S->historyIndex) * sizeof(float32_t));
+  memcpy(S->pFrame + fftLen - S->historyIndex, S->pHistory,
+         S->historyIndex * sizeof(float32_t));
+
+  if (S->feature == ARM_MFCC_STREAM_LOGMEL)
+  {
+    arm_mfcc_logmel_f32(S->pMfcc, S->pFrame, pOut, S->pTmp);
+  }
+  else
+  {
+    arm_mfcc_f32(S->pMfcc, S->pFrame, pOut, S->pTmp);
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point streaming MFCC.
+  @param[in,out] S          points to an instance of the floating-point streaming MFCC structure.
+  @param[in]     pSrc       points to the block of new input samples
+  @param[in]     blockSize  number of samples to process
+  @return        number of frames written to the output tensor
+
+  @par           Frame timing
+                   The first frame is produced once <code>fftLen</code>
+                   samples have been received, then every
+                   <code>hopSize</code> samples.
+ */
+uint32_t arm_mfcc_stream_f32(
+        arm_mfcc_stream_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+  uint32_t fftLen = S->pMfcc->fftLen;
+  uint32_t frameSize = (uint32_t)S->numFeatures;
+  uint32_t nbFrames = 0U;
+  uint32_t blkCnt;
+  float32_t *pRow;
+
+  while (blockSize > 0U)
+  {
+    /* Copy up to the next frame, the end of the block or the end of the history */
+    blkCnt = S->samplesToFrame;
+    if (blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+    if (blkCnt > fftLen - S->historyIndex)
+    {
+      blkCnt = fftLen - S->historyIndex;
+    }
+
+    memcpy(S->pHistory + S->historyIndex, pSrc, blkCnt * sizeof(float32_t));
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    S->samplesToFrame -= blkCnt;
+    S->historyIndex += blkCnt;
+    if (S->historyIndex == fftLen)
+    {
+      S->historyIndex = 0U;
+    }
+
+    if (S->samplesToFrame == 0U)
+    {
+      S->samplesToFrame = S->hopSize;
+
+      pRow = S->pTensor + S->writeRow * frameSize;
+      arm_mfcc_stream_frame_f32(S, pRow);
+
+      /* Mirror so that the last numFrames frames are contiguous */
+      memcpy(pRow + (uint32_t)S->numFrames * frameSize, pRow, frameSize * sizeof(float32_t));
+
+      S->writeRow++;
+      if (S->writeRow == S->numFrames)
+      {
+        S->writeRow = 0U;
+      }
+      if (S->frameCount < S->numFrames)
+      {
+        S->frameCount++;
+      }
+      nbFrames++;
+    }
+  }
+
+  return (nbFrames);
+}
+
+/**
+  @brief         Output tensor of the floating-point streaming MFCC.
+  @param[in]     S          points to an instance of the floating-point streaming MFCC structure.
+  @return        points to the last numFrames frames or NULL when fewer frames were produced
+
+  @par           The tensor stays valid until the next call to arm_mfcc_stream_f32.
+ */
+const float32_t *arm_mfcc_stream_get_tensor_f32(
+  const arm_mfcc_stream_instance_f32 * S)
+{
+  if (S->frameCount < S->numFrames)
+  {
+    return (NULL);
+  }
+
+  return (S->pTensor + S->writeRow * (uint32_t)S->numFeatures);
+}
+
+/**
+  @} end of MFCCStream group
+ */
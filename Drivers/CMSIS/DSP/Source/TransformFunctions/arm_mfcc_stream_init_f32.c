@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_stream_init_f32.c
+ * Description:  Initialization of the floating-point streaming MFCC
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @addtogroup MFCCStream
+  @{
+ */
+
+/**
+  @brief         Size of the arena needed by the floating-point streaming MFCC.
+  @param[in]     fftLen       FFT length of the MFCC instance
+  @param[in]     numFeatures  number of features per frame
+  @param[in]     numFrames    number of frames of the output tensor
+  @return        arena size in float32_t words
+
+  @par           The arena contains the input history and the frame buffer
+                 (<code>fftLen</code> words each), the FFT working buffer
+                 (<code>2*fftLen</code> words) and the mirrored output tensor
+                 (<code>2 * numFrames * numFeatures</code> words).
+ */
+uint32_t arm_mfcc_stream_get_buffer_size_f32(
+  uint32_t fftLen,
+  uint16_t numFeatures,
+  uint16_t numFrames)
+{
+  return (4U * fftLen + 2U * (uint32_t)numFrames * numFeatures);
+}
+
+/**
+  @brief         Initialization function for the floating-point streaming MFCC.
+  @param[out]    S          points to an instance of the floating-point streaming MFCC structure.
+  @param[in]     pMfcc      points to an initialized MFCC instance
+  @param[in]     hopSize    number of new samples between two frames
+  @param[in]     feature    MFCC or log-Mel features
+  @param[in]     numFrames  number of frames of the output tensor
+  @param[in]     pBuffer    points to the arena of arm_mfcc_stream_get_buffer_size_f32() words
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : hopSize or numFrames is not supported
+
+  @par           Description
+                   <code>hopSize</code> must be between 1 and the FFT length
+                   of the MFCC instance.
+                   The number of features per frame is <code>nbDctOutputs</code>
+                   for ARM_MFCC_STREAM_MFCC and <code>nbMelFilters</code> for
+                   ARM_MFCC_STREAM_LOGMEL. The arena must be sized with this
+                   number of features.
+                   The MFCC instance is not copied and must stay valid while
+                   the streaming instance is used.
+ */
+arm_status arm_mfcc_stream_init_f32(
+        arm_mfcc_stream_instance_f32 * S,
+  const arm_mfcc_instance_f32 * pMfcc,
+        uint16_t hopSize,
+        arm_mfcc_stream_feature feature,
+        uint16_t numFrames,
+        float32_t * pBuffer)
+{
+  uint32_t fftLen = pMfcc->fftLen;
+
+  if ((hopSize == 0U) || (hopSize > fftLen) || (numFrames == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->pMfcc = pMfcc;
+  S->hopSize = hopSize;
+  S->numFrames = numFrames;
+  S->feature = (uint16_t)feature;
+  S->numFeatures = (feature == ARM_MFCC_STREAM_LOGMEL) ? (uint16_t)pMfcc->nbMelFilters
+                                                       : (uint16_t)pMfcc->nbDctOutputs;
+
+  S->pHistory = pBuffer;
+  S->pFrame = pBuffer + fftLen;
+  S->pTmp = pBuffer + 2U * fftLen;
+  S->pTensor = pBuffer + 4U * fftLen;
+
+  S->historyIndex = 0U;
+  S->samplesToFrame = fftLen;
+  S->writeRow = 0U;
+  S->frameCount = 0U;
+
+  memset(S->pHistory, 0, fftLen * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MFCCStream group
+ */
@@ -0,0 +1,158 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_stream_q15.c
+ * Description:  Streaming MFCC (Q15) with frame reuse
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @addtogroup MFCCStream
+  @{
+ */
+
+/*
+   Copy the last fftLen samples of the history to the frame buffer,
+   oldest sample first, and compute the features of the frame.
+   The Q15 MFCC can only fail on a division by zero, which it
+   already excludes, so its status is not checked.
+ */
+static void arm_mfcc_stream_frame_q15(
+  const arm_mfcc_stream_instance_q15 * S,
+        q15_t * pOut)
+{
+  uint32_t fftLen = S->pMfcc->fftLen;
+
+  /* Oldest sample is at the write position of the circular history */
+  memcpy(S->pFrame, S->pHistory + S->historyIndex,
+         (fftLen - S->historyIndex) * sizeof(q15_t));
+  memcpy(S->pFrame + fftLen - S->historyIndex, S->pHistory,
+         S->historyIndex * sizeof(q15_t));
+
+  if (S->feature == ARM_MFCC_STREAM_LOGMEL)
+  {
+    (void)arm_mfcc_logmel_q15(S->pMfcc, S->pFrame, pOut, S->pTmp);
+  }
+  else
+  {
+    (void)arm_mfcc_q15(S->pMfcc, S->pFrame, pOut, S->pTmp);
+  }
+}
+
+/**
+  @brief         Processing function for the Q15 streaming MFCC.
+  @param[in,out] S          points to an instance of the Q15 streaming MFCC structure.
+  @param[in]     pSrc       points to the block of new input samples
+  @param[in]     blockSize  number of samples to process
+  @return        number of frames written to the output tensor
+
+  @par           Frame timing
+                   The first frame is produced once <code>fftLen</code>
+                   samples have been received, then every
+                   <code>hopSize</code> samples.
+                   The features are in q8.7 format.
+ */
+uint32_t arm_mfcc_stream_q15(
+        arm_mfcc_stream_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize)
+{
+  uint32_t fftLen = S->pMfcc->fftLen;
+  uint32_t frameSize = (uint32_t)S->numFeatures;
+  uint32_t nbFrames = 0U;
+  uint32_t blkCnt;
+  q15_t *pRow;
+
+  while (blockSize > 0U)
+  {
+    /* Copy up to the next frame, the end of the block or the end of the history */
+    blkCnt = S->samplesToFrame;
+    if (blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+    if (blkCnt > fftLen - S->historyIndex)
+    {
+      blkCnt = fftLen - S->historyIndex;
+    }
+
+    memcpy(S->pHistory + S->historyIndex, pSrc, blkCnt * sizeof(q15_t));
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    S->samplesToFrame -= blkCnt;
+    S->historyIndex += blkCnt;
+    if (S->historyIndex == fftLen)
+    {
+      S->historyIndex = 0U;
+    }
+
+    if (S->samplesToFrame == 0U)
+    {
+      S->samplesToFrame = S->hopSize;
+
+      pRow = S->pTensor + S->writeRow * frameSize;
+      arm_mfcc_stream_frame_q15(S, pRow);
+
+      /* Mirror so that the last numFrames frames are contiguous */
+      memcpy(pRow + (uint32_t)S->numFrames * frameSize, pRow, frameSize * sizeof(q15_t));
+
+      S->writeRow++;
+      if (S->writeRow == S->numFrames)
+      {
+        S->writeRow = 0U;
+      }
+      if (S->frameCount < S->numFrames)
+      {
+        S->frameCount++;
+      }
+      nbFrames++;
+    }
+  }
+
+  return (nbFrames);
+}
+
+/**
+  @brief         Output tensor of the Q15 streaming MFCC.
+  @param[in]     S          points to an instance of the Q15 streaming MFCC structure.
+  @return        points to the last numFrames frames in q8.7 or NULL when fewer frames were produced
+
+  @par           The tensor stays valid until the next call to arm_mfcc_stream_q15.
+ */
+const q15_t *arm_mfcc_stream_get_tensor_q15(
+  const arm_mfcc_stream_instance_q15 * S)
+{
+  if (S->frameCount < S->numFrames)
+  {
+    return (NULL);
+  }
+
+  return (S->pTensor + S->writeRow * (uint32_t)S->numFeatures);
+}
+
+/**
+  @} end of MFCCStream group
+ */
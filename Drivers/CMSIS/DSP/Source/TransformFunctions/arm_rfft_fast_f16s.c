@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_f16s.c
+ * Description:  RFFT processing function for storage f16 data
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "arm_f16_storage.h"
+
+/**
+  @addtogroup RealFFT
+  @{
+*/
+
+/**
+  @brief         Processing function for the real FFT of storage f16 data.
+  @param[in]     S         points to an arm_rfft_fast_instance_f32 structure
+  @param[in]     p         points to the input buffer of fftLen f16s values
+  @param[out]    pOut      points to the output buffer of fftLen f16s values
+  @param[in,out] pTmp      points to a temporary buffer of fftLen float32_t values
+  @param[in]     ifftFlag
+                   - value = 0: RFFT
+                   - value = 1: RIFFT
+  @return        none
+
+  @par           Storage f16
+                   The data is converted to single precision in pTmp,
+                   transformed in-place by \ref arm_rfft_fast_inplace_f32
+                   and rounded back to half precision. The result has the
+                   format of \ref arm_rfft_fast_f32.
+  @par
+                   The input buffer is not modified and pOut may be p.
+                   Only pTmp is in single precision and it can be shared by
+                   all the transforms of an application, so the signal and
+                   spectrum buffers use half the memory of the f32 version.
+  @par
+                   The forward transform is not scaled: with inputs in [-1, 1]
+                   the bins stay below fftLen and are in the range of half
+                   precision (65504) for all the supported lengths.
+  @par
+                   This function is available on all targets and uses the f32
+                   instance, initialized with \ref arm_rfft_fast_init_f32.
+*/
+void arm_rfft_fast_f16s(
+  const arm_rfft_fast_instance_f32 * S,
+  const float16s_t * p,
+        float16s_t * pOut,
+        float32_t * pTmp,
+        uint8_t ifftFlag)
+{
+   uint32_t i;
+   uint32_t fftLen = S->fftLenRFFT;
+
+   for (i = 0; i < fftLen; i++)
+   {
+      pTmp[i] = arm_f16_bits_to_f32(p[i]);
+   }
+
+   arm_rfft_fast_inplace_f32(S, pTmp, ifftFlag);
+
+   for (i = 0; i < fftLen; i++)
+   {
+      pOut[i] = arm_f32_to_f16_bits(pTmp[i]);
+   }
+}
+
+/**
+* @} end of RealFFT group
+*/
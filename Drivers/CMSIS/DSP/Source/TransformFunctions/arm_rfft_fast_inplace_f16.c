@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_inplace_f16.c
+ * Description:  In-place RFFT processing function for f16
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+void stage_rfft_inplace_f16(
+  const arm_rfft_fast_instance_f16 * S,
+        float16_t * p);
+
+void merge_rfft_inplace_f16(
+  const arm_rfft_fast_instance_f16 * S,
+        float16_t * p);
+
+/*
+   Bins k and fftLen/2-k of the real FFT extraction only depend on the
+   CFFT outputs k and fftLen/2-k. Computing them together allows to
+   write the result over the CFFT output.
+ */
+__STATIC_FORCEINLINE void stage_rfft_bin_f16(
+  const float16_t * pA,
+  const float16_t * pB,
+  const float16_t * pTw,
+        float16_t * pR,
+        float16_t * pI)
+{
+  float16_t t1a, t1b, p0, p1, p2, p3;
+
+  t1a = (_Float16)pB[0] - (_Float16)pA[0];
+  t1b = (_Float16)pB[1] + (_Float16)pA[1];
+
+  p0 = (_Float16)pTw[0] * (_Float16)t1a;
+  p1 = (_Float16)pTw[1] * (_Float16)t1a;
+  p2 = (_Float16)pTw[0] * (_Float16)t1b;
+  p3 = (_Float16)pTw[1] * (_Float16)t1b;
+
+  *pR = 0.5f16 * ((_Float16)pA[0] + (_Float16)pB[0] + (_Float16)p0 + (_Float16)p3);
+  *pI = 0.5f16 * ((_Float16)pA[1] - (_Float16)pB[1] + (_Float16)p1 - (_Float16)p2);
+}
+
+__STATIC_FORCEINLINE void merge_rfft_bin_f16(
+  const float16_t * pA,
+  const float16_t * pB,
+  const float16_t * pTw,
+        float16_t * pR,
+        float16_t * pI)
+{
+  float16_t t1a, t1b, r, s, t, u;
+
+  t1a = (_Float16)pA[0] - (_Float16)pB[0];
+  t1b = (_Float16)pA[1] + (_Float16)pB[1];
+
+  r = (_Float16)pTw[0] * (_Float16)t1a;
+  s = (_Float16)pTw[1] * (_Float16)t1b;
+  t = (_Float16)pTw[1] * (_Float16)t1a;
+  u = (_Float16)pTw[0] * (_Float16)t1b;
+
+  *pR = 0.5f16 * ((_Float16)pA[0] + (_Float16)pB[0] - (_Float16)r - (_Float16)s);
+  *pI = 0.5f16 * ((_Float16)pA[1] - (_Float16)pB[1] + (_Float16)t - (_Float16)u);
+}
+
+/* Real FFT extraction done over the CFFT output */
+void stage_rfft_inplace_f16(
+  const arm_rfft_fast_instance_f16 * S,
+        float16_t * p)
+{
+        uint32_t  k;                                /* Loop Counter */
+        uint32_t  L = (S->Sint).fftLen;             /* Length of the complex FFT */
+  const float16_t * pCoeff = S->pTwiddleRFFT;       /* Points to RFFT Twiddle factors */
+        float16_t *pA, *pB;                         /* increasing and decreasing pointers */
+        float16_t aR, aI, bR, bI;                   /* temporary variables */
+        float16_t t1a, t1b;                         /* temporary variables */
+
+  /* Pack first and last sample of the frequency domain together */
+  t1a = (_Float16)p[0] + (_Float16)p[0];
+  t1b = (_Float16)p[1] + (_Float16)p[1];
+
+  p[0] = 0.5f16 * ((_Float16)t1a + (_Float16)t1b);
+  p[1] = 0.5f16 * ((_Float16)t1a - (_Float16)t1b);
+
+  pA = p + 2;
+  pB = p + 2U * (L - 1U);
+
+  for (k = 1U; k < (L >> 1U); k++)
+  {
+    stage_rfft_bin_f16(pA, pB, pCoeff + 2U * k, &aR, &aI);
+    stage_rfft_bin_f16(pB, pA, pCoeff + 2U * (L - k), &bR, &bI);
+
+    pA[0] = aR;
+    pA[1] = aI;
+    pB[0] = bR;
+    pB[1] = bI;
+
+    pA += 2;
+    pB -= 2;
+  }
+
+  /* Middle bin is its own mirror */
+  stage_rfft_bin_f16(pA, pA, pCoeff + L, &aR, &aI);
+  pA[0] = aR;
+  pA[1] = aI;
+}
+
+/* Preparation of the inverse CFFT input done over the spectrum */
+void merge_rfft_inplace_f16(
+  const arm_rfft_fast_instance_f16 * S,
+        float16_t * p)
+{
+        uint32_t  k;                                /* Loop Counter */
+        uint32_t  L = (S->Sint).fftLen;             /* Length of the complex FFT */
+  const float16_t * pCoeff = S->pTwiddleRFFT;       /* Points to RFFT Twiddle factors */
+        float16_t *pA, *pB;                         /* increasing and decreasing pointers */
+        float16_t aR, aI, bR, bI;                   /* temporary variables */
+
+  aR = p[0];
+  aI = p[1];
+
+  p[0] = 0.5f16 * ((_Float16)aR + (_Float16)aI);
+  p[1] = 0.5f16 * ((_Float16)aR - (_Float16)aI);
+
+  pA = p + 2;
+  pB = p + 2U * (L - 1U);
+
+  for (k = 1U; k < (L >> 1U); k++)
+  {
+    merge_rfft_bin_f16(pA, pB, pCoeff + 2U * k, &aR, &aI);
+    merge_rfft_bin_f16(pB, pA, pCoeff + 2U * (L - k), &bR, &bI);
+
+    pA[0] = aR;
+    pA[1] = aI;
+    pB[0] = bR;
+    pB[1] = bI;
+
+    pA += 2;
+    pB -= 2;
+  }
+
+  merge_rfft_bin_f16(pA, pA, pCoeff + L, &aR, &aI);
+  pA[0] = aR;
+  pA[1] = aI;
+}
+
+/**
+  @addtogroup RealFFT
+  @{
+*/
+
+/**
+  @brief         In-place processing function for the f16 real FFT.
+  @param[in]     S         points to an arm_rfft_fast_instance_f16 structure
+  @param[in,out] p         points to the data buffer of fftLen values. Processing occurs in-place
+  @param[in]     ifftFlag
+                   - value = 0: RFFT
+                   - value = 1: RIFFT
+  @return        none
+
+  @par           The result has the same format as arm_rfft_fast_f16 but is
+                 written over the input.
+*/
+void arm_rfft_fast_inplace_f16(
+  const arm_rfft_fast_instance_f16 * S,
+        float16_t * p,
+        uint8_t ifftFlag)
+{
+   const arm_cfft_instance_f16 * Sint = &(S->Sint);
+
+   if (ifftFlag)
+   {
+      merge_rfft_inplace_f16(S, p);
+      arm_cfft_f16( Sint, p, ifftFlag, 1);
+   }
+   else
+   {
+      arm_cfft_f16( Sint, p, ifftFlag, 1);
+      stage_rfft_inplace_f16(S, p);
+   }
+}
+
+/**
+* @} end of RealFFT group
+*/
+
+#endif /*  #if defined(ARM_FLOAT16_SUPPORTED) */
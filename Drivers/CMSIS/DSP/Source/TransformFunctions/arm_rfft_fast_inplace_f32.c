@@ -0,0 +1,212 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_inplace_f32.c
+ * Description:  In-place RFFT processing function for floating-point
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+void stage_rfft_inplace_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * p);
+
+void merge_rfft_inplace_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * p);
+
+/*
+   Bins k and fftLen/2-k of the real FFT extraction only depend on the
+   CFFT outputs k and fftLen/2-k. Computing them together allows to
+   write the result over the CFFT output.
+ */
+__STATIC_FORCEINLINE void stage_rfft_bin_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  const float32_t * pTw,
+        float32_t * pR,
+        float32_t * pI)
+{
+  float32_t t1a, t1b, p0, p1, p2, p3;
+
+  t1a = pB[0] - pA[0];
+  t1b = pB[1] + pA[1];
+
+  p0 = pTw[0] * t1a;
+  p1 = pTw[1] * t1a;
+  p2 = pTw[0] * t1b;
+  p3 = pTw[1] * t1b;
+
+  *pR = 0.5f * (pA[0] + pB[0] + p0 + p3);
+  *pI = 0.5f * (pA[1] - pB[1] + p1 - p2);
+}
+
+__STATIC_FORCEINLINE void merge_rfft_bin_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  const float32_t * pTw,
+        float32_t * pR,
+        float32_t * pI)
+{
+  float32_t t1a, t1b, r, s, t, u;
+
+  t1a = pA[0] - pB[0];
+  t1b = pA[1] + pB[1];
+
+  r = pTw[0] * t1a;
+  s = pTw[1] * t1b;
+  t = pTw[1] * t1a;
+  u = pTw[0] * t1b;
+
+  *pR = 0.5f * (pA[0] + pB[0] - r - s);
+  *pI = 0.5f * (pA[1] - pB[1] + t - u);
+}
+
+/* Real FFT extraction done over the CFFT output */
+void stage_rfft_inplace_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * p)
+{
+        uint32_t  k;                                /* Loop Counter */
+        uint32_t  L = (S->Sint).fftLen;             /* Length of the complex FFT */
+  const float32_t * pCoeff = S->pTwiddleRFFT;       /* Points to RFFT Twiddle factors */
+        float32_t *pA, *pB;                         /* increasing and decreasing pointers */
+        float32_t aR, aI, bR, bI;                   /* temporary variables */
+        float32_t t1a, t1b;                         /* temporary variables */
+
+  /* Pack first and last sample of the frequency domain together */
+  t1a = p[0] + p[0];
+  t1b = p[1] + p[1];
+
+  p[0] = 0.5f * (t1a + t1b);
+  p[1] = 0.5f * (t1a - t1b);
+
+  pA = p + 2;
+  pB = p + 2U * (L - 1U);
+
+  for (k = 1U; k < (L >> 1U); k++)
+  {
+    stage_rfft_bin_f32(pA, pB, pCoeff + 2U * k, &aR, &aI);
+    stage_rfft_bin_f32(pB, pA, pCoeff + 2U * (L - k), &bR, &bI);
+
+    pA[0] = aR;
+    pA[1] = aI;
+    pB[0] = bR;
+    pB[1] = bI;
+
+    pA += 2;
+    pB -= 2;
+  }
+
+  /* Middle bin is its own mirror */
+  stage_rfft_bin_f32(pA, pA, pCoeff + L, &aR, &aI);
+  pA[0] = aR;
+  pA[1] = aI;
+}
+
+/* Preparation of the inverse CFFT input done over the spectrum */
+void merge_rfft_inplace_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * p)
+{
+        uint32_t  k;                                /* Loop Counter */
+        uint32_t  L = (S->Sint).fftLen;             /* Length of the complex FFT */
+  const float32_t * pCoeff = S->pTwiddleRFFT;       /* Points to RFFT Twiddle factors */
+        float32_t *pA, *pB;                         /* increasing and decreasing pointers */
+        float32_t aR, aI, bR, bI;                   /* temporary variables */
+
+  aR = p[0];
+  aI = p[1];
+
+  p[0] = 0.5f * (aR + aI);
+  p[1] = 0.5f * (aR - aI);
+
+  pA = p + 2;
+  pB = p + 2U * (L - 1U);
+
+  for (k = 1U; k < (L >> 1U); k++)
+  {
+    merge_rfft_bin_f32(pA, pB, pCoeff + 2U * k, &aR, &aI);
+    merge_rfft_bin_f32(pB, pA, pCoeff + 2U * (L - k), &bR, &bI);
+
+    pA[0] = aR;
+    pA[1] = aI;
+    pB[0] = bR;
+    pB[1] = bI;
+
+    pA += 2;
+    pB -= 2;
+  }
+
+  merge_rfft_bin_f32(pA, pA, pCoeff + L, &aR, &aI);
+  pA[0] = aR;
+  pA[1] = aI;
+}
+
+/**
+  @addtogroup RealFFT
+  @{
+*/
+
+/**
+  @brief         In-place processing function for the floating-point real FFT.
+  @param[in]     S         points to an arm_rfft_fast_instance_f32 structure
+  @param[in,out] p         points to the data buffer of fftLen values. Processing occurs in-place
+  @param[in]     ifftFlag
+                   - value = 0: RFFT
+                   - value = 1: RIFFT
+  @return        none
+
+  @par           The result has the same format as arm_rfft_fast_f32 but is
+                 written over the input, so no output buffer is needed.
+                 The real FFT extraction (and the preparation of the inverse
+                 transform) computes bins k and fftLen/2-k together to work
+                 in-place.
+*/
+void arm_rfft_fast_inplace_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * p,
+        uint8_t ifftFlag)
+{
+   const arm_cfft_instance_f32 * Sint = &(S->Sint);
+
+   if (ifftFlag)
+   {
+      merge_rfft_inplace_f32(S, p);
+      arm_cfft_f32( Sint, p, ifftFlag, 1);
+   }
+   else
+   {
+      arm_cfft_f32( Sint, p, ifftFlag, 1);
+      stage_rfft_inplace_f32(S, p);
+   }
+}
+
+/**
+* @} end of RealFFT group
+*/
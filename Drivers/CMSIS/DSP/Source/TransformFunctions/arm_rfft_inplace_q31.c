@@ -0,0 +1,247 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_inplace_q31.c
+ * Description:  In-place RFFT & RIFFT Q31 process function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+void arm_split_rfft_inplace_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pATable,
+  const q31_t * pBTable,
+        uint32_t modifier);
+
+void arm_split_rifft_inplace_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pATable,
+  const q31_t * pBTable,
+        uint32_t modifier);
+
+/*
+   Bins i and fftLen-i of the split processes only depend on the
+   complex values i and fftLen-i of the input. Computing them together
+   allows to write the result over the input.
+   The arithmetic is the one of arm_split_rfft_q31 and arm_split_rifft_q31.
+ */
+__STATIC_FORCEINLINE void arm_split_rfft_bin_q31(
+  const q31_t * pA,
+  const q31_t * pB,
+  const q31_t * pCoefA,
+  const q31_t * pCoefB,
+        q31_t * pR,
+        q31_t * pI)
+{
+  q31_t outR, outI;
+
+  mult_32x32_keep32_R (outR, pA[0], pCoefA[0]);
+  mult_32x32_keep32_R (outI, pA[0], pCoefA[1]);
+  multSub_32x32_keep32_R (outR, pA[1], pCoefA[1]);
+  multAcc_32x32_keep32_R (outI, pA[1], pCoefA[0]);
+  multSub_32x32_keep32_R (outR, pB[1], pCoefA[1]);
+  multSub_32x32_keep32_R (outI, pB[1], pCoefB[0]);
+  multAcc_32x32_keep32_R (outR, pB[0], pCoefB[0]);
+  multSub_32x32_keep32_R (outI, pB[0], pCoefA[1]);
+
+  *pR = outR;
+  *pI = outI;
+}
+
+__STATIC_FORCEINLINE void arm_split_rifft_bin_q31(
+  const q31_t * pA,
+  const q31_t * pB,
+  const q31_t * pCoefA,
+  const q31_t * pCoefB,
+        q31_t * pR,
+        q31_t * pI)
+{
+  q31_t outR, outI;
+
+  mult_32x32_keep32_R (outR, pA[0], pCoefA[0]);
+  mult_32x32_keep32_R (outI, pA[0], -pCoefA[1]);
+  multAcc_32x32_keep32_R (outR, pA[1], pCoefA[1]);
+  multAcc_32x32_keep32_R (outI, pA[1], pCoefA[0]);
+  multAcc_32x32_keep32_R (outR, pB[1], pCoefA[1]);
+  multSub_32x32_keep32_R (outI, pB[1], pCoefB[0]);
+  multAcc_32x32_keep32_R (outR, pB[0], pCoefB[0]);
+  multAcc_32x32_keep32_R (outI, pB[0], pCoefA[1]);
+
+  *pR = outR;
+  *pI = outI;
+}
+
+/**
+  @brief         Core Real FFT process working over the CFFT output
+  @param[in,out] pSrc      points to the CFFT output, buffer of 4*fftLen values
+  @param[in]     fftLen    length of the complex FFT
+  @param[in]     pATable   points to twiddle Coef A buffer
+  @param[in]     pBTable   points to twiddle Coef B buffer
+  @param[in]     modifier  twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table
+  @return        none
+ */
+void arm_split_rfft_inplace_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pATable,
+  const q31_t * pBTable,
+        uint32_t modifier)
+{
+        uint32_t i;                                    /* Loop Counter */
+        q31_t aR, aI, bR, bI;                          /* Temporary variables for output */
+        q31_t *pA = &pSrc[2], *pB = &pSrc[2 * fftLen - 2];
+        q31_t x0 = pSrc[0], x1 = pSrc[1];
+
+  for (i = 1U; i < (fftLen >> 1U); i++)
+  {
+    arm_split_rfft_bin_q31(pA, pB, &pATable[2U * i * modifier], &pBTable[2U * i * modifier], &aR, &aI);
+    arm_split_rfft_bin_q31(pB, pA, &pATable[2U * (fftLen - i) * modifier], &pBTable[2U * (fftLen - i) * modifier], &bR, &bI);
+
+    pA[0] = aR;
+    pA[1] = aI;
+    pB[0] = bR;
+    pB[1] = bI;
+
+    /* complex conjugate outputs */
+    pSrc[2U * (2U * fftLen - i)]      = aR;
+    pSrc[2U * (2U * fftLen - i) + 1U] = -aI;
+    pSrc[2U * (fftLen + i)]           = bR;
+    pSrc[2U * (fftLen + i) + 1U]      = -bI;
+
+    pA += 2;
+    pB -= 2;
+  }
+
+  /* Middle bin is its own mirror */
+  arm_split_rfft_bin_q31(pA, pA, &pATable[fftLen * modifier], &pBTable[fftLen * modifier], &aR, &aI);
+  pA[0] = aR;
+  pA[1] = aI;
+  pSrc[3U * fftLen]      = aR;
+  pSrc[3U * fftLen + 1U] = -aI;
+
+  pSrc[2U * fftLen]      = (x0 - x1) >> 1U;
+  pSrc[2U * fftLen + 1U] = 0;
+
+  pSrc[0] = (x0 + x1) >> 1U;
+  pSrc[1] = 0;
+}
+
+/**
+  @brief         Core Real IFFT process working over the spectrum
+  @param[in,out] pSrc      points to the spectrum, buffer of 2*fftLen+2 values
+  @param[in]     fftLen    length of the complex FFT
+  @param[in]     pATable   points to twiddle Coef A buffer
+  @param[in]     pBTable   points to twiddle Coef B buffer
+  @param[in]     modifier  twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table
+  @return        none
+ */
+void arm_split_rifft_inplace_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pATable,
+  const q31_t * pBTable,
+        uint32_t modifier)
+{
+        uint32_t i;                                    /* Loop Counter */
+        q31_t aR, aI, bR, bI;                          /* Temporary variables for output */
+        q31_t *pA = &pSrc[2], *pB = &pSrc[2 * fftLen - 2];
+
+  /* Bin 0 is paired with the Nyquist bin which is not an output */
+  arm_split_rifft_bin_q31(&pSrc[0], &pSrc[2U * fftLen], &pATable[0], &pBTable[0], &aR, &aI);
+  pSrc[0] = aR;
+  pSrc[1] = aI;
+
+  for (i = 1U; i < (fftLen >> 1U); i++)
+  {
+    arm_split_rifft_bin_q31(pA, pB, &pATable[2U * i * modifier], &pBTable[2U * i * modifier], &aR, &aI);
+    arm_split_rifft_bin_q31(pB, pA, &pATable[2U * (fftLen - i) * modifier], &pBTable[2U * (fftLen - i) * modifier], &bR, &bI);
+
+    pA[0] = aR;
+    pA[1] = aI;
+    pB[0] = bR;
+    pB[1] = bI;
+
+    pA += 2;
+    pB -= 2;
+  }
+
+  arm_split_rifft_bin_q31(pA, pA, &pATable[fftLen * modifier], &pBTable[fftLen * modifier], &aR, &aI);
+  pA[0] = aR;
+  pA[1] = aI;
+}
+
+/**
+  @addtogroup RealFFT
+  @{
+ */
+
+/**
+  @brief         In-place processing function for the Q31 RFFT/RIFFT.
+  @param[in]     S     points to an instance of the Q31 RFFT/RIFFT structure
+  @param[in,out] pSrc  points to the data buffer. Processing occurs in-place
+  @return        none
+
+  @par           The input and output formats are the ones of arm_rfft_q31.
+  @par           For the RFFT, the buffer contains the fftLenReal input
+                 samples and must have length 2*fftLenReal to receive the
+                 full spectrum.
+  @par           For the RIFFT, the buffer contains the fftLenReal + 2 values
+                 of the spectrum and receives the fftLenReal output samples.
+ */
+void arm_rfft_inplace_q31(
+  const arm_rfft_instance_q31 * S,
+        q31_t * pSrc)
+{
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+  const arm_cfft_instance_q31 *S_CFFT = &(S->cfftInst);
+#else
+  const arm_cfft_instance_q31 *S_CFFT = S->pCfft;
+#endif
+        uint32_t L2 = S->fftLenReal >> 1U;
+
+  if (S->ifftFlagR == 1U)
+  {
+     arm_split_rifft_inplace_q31 (pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, S->twidCoefRModifier);
+
+     arm_cfft_q31 (S_CFFT, pSrc, S->ifftFlagR, S->bitReverseFlagR);
+
+     arm_shift_q31(pSrc, 1, pSrc, S->fftLenReal);
+  }
+  else
+  {
+     arm_cfft_q31 (S_CFFT, pSrc, S->ifftFlagR, S->bitReverseFlagR);
+
+     arm_split_rfft_inplace_q31 (pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, S->twidCoefRModifier);
+  }
+}
+
+/**
+  @} end of RealFFT group
+ */
@@ -0,0 +1,308 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_f32.c
+ * Description:  Streaming floating-point short-time Fourier transform
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup STFT Short-Time Fourier Transform
+
+  Streaming short-time Fourier transform of a real signal.
+
+  Input samples are pushed in blocks of any size. Each time
+  <code>hopSize</code> new samples have been received (and at least
+  <code>fftLen</code> samples since initialization), the last
+  <code>fftLen</code> samples are windowed, transformed with a real FFT,
+  and the <code>fftLen/2+1</code> magnitudes (or powers) of the bins from
+  DC to Nyquist are written to an output ring of <code>numFrames</code>
+  frames.
+
+  Compared to the sequence copy, arm_mult_f32, arm_rfft_fast_f32 and
+  arm_cmplx_mag_f32, the processing saves two passes and two scratch buffers:
+  - the copy out of the circular input history and the window multiply are
+    done in the same loop which feeds the complex FFT,
+  - the magnitude (or power) is computed directly in the real FFT split
+    stage, so the complex spectrum is never stored.
+
+  The frame at bin k is identical to the output of arm_cmplx_mag_f32
+  applied to the output of arm_rfft_fast_f32 (with the Nyquist bin unpacked
+  to index <code>fftLen/2</code>).
+
+  @par           Output ring
+                   The output ring is a single producer / single consumer
+                   queue. arm_stft_f32 is the producer and can run in an
+                   interrupt or a different task than the consumer, which
+                   uses arm_stft_get_frame_f32 and arm_stft_release_frame_f32
+                   to drain the frames. When the ring is full, new frames are
+                   dropped and <code>overrunCount</code> is incremented.
+  @par
+                   The accesses to the frames are ordered with the
+                   <code>writeCount</code> and <code>readCount</code> counters
+                   by data memory barriers (__DMB()): a frame is published
+                   after its last write and a slot is released after its last
+                   read.
+
+  @par           Memory
+                   All buffers come from a single arena provided to
+                   arm_stft_init_f32. Its size, in float32_t words, is
+                   returned by arm_stft_get_buffer_size_f32.
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/*
+   Real FFT split stage of arm_rfft_fast_f32 producing
+   the magnitude or the power of each bin.
+ */
+static void arm_stft_split_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  const float32_t * p,
+        float32_t * pOut,
+        uint16_t outputType)
+{
+        uint32_t  k;                                /* Loop Counter */
+        float32_t twR, twI;                         /* RFFT Twiddle coefficients */
+  const float32_t * pCoeff = S->pTwiddleRFFT + 2;   /* Points to RFFT Twiddle factors */
+  const float32_t *pA = p + 2;                      /* increasing pointer */
+  const float32_t *pB;                              /* decreasing pointer */
+        float32_t xAR, xAI, xBR, xBI;               /* temporary variables */
+        float32_t t1a, t1b;                         /* temporary variables */
+        float32_t re, im, pwr;                      /* temporary variables */
+        float32_t *pNyq;                            /* Nyquist bin */
+
+  k = (S->Sint).fftLen - 1;
+  pB = p + 2 * k;
+  pNyq = pOut + (S->Sint).fftLen;
+
+  /* DC and Nyquist are packed in the first complex sample */
+  re = p[0] + p[1];
+  im = p[0] - p[1];
+
+  if (outputType == ARM_STFT_POWER)
+  {
+    *pOut++ = re * re;
+    *pNyq   = im * im;
+  }
+  else
+  {
+    *pOut++ = fabsf(re);
+    *pNyq   = fabsf(im);
+  }
+
+  while (k > 0U)
+  {
+    xAR = pA[0];
+    xAI = pA[1];
+    xBR = pB[0];
+    xBI = pB[1];
+
+    twR = *pCoeff++;
+    twI = *pCoeff++;
+
+    t1a = xBR - xAR;
+    t1b = xBI + xAI;
+
+    re = 0.5f * (xAR + xBR + twR * t1a + twI * t1b);
+    im = 0.5f * (xAI - xBI + twI * t1a - twR * t1b);
+
+    pwr = (re * re) + (im * im);
+
+    if (outputType == ARM_STFT_POWER)
+    {
+      *pOut++ = pwr;
+    }
+    else
+    {
+      arm_sqrt_f32(pwr, pOut++);
+    }
+
+    pA += 2;
+    pB -= 2;
+    k--;
+  }
+}
+
+/*
+   Window the last fftLen samples of the history,
+   transform them and write the frame to pOut.
+ */
+static void arm_stft_frame_f32(
+  const arm_stft_instance_f32 * S,
+        float32_t * pOut)
+{
+  const float32_t *pWin = S->pWindow;
+  const float32_t *pIn;
+        float32_t *pDst = S->pTmp;
+        uint32_t blkCnt;
+
+  /* Oldest sample is at the write position of the circular history */
+  pIn = S->pHistory + S->historyIndex;
+  blkCnt = (uint32_t)S->fftLen - S->historyIndex;
+  while (blkCnt > 0U)
+  {
+    *pDst++ = *pIn++ * *pWin++;
+    blkCnt--;
+  }
+
+  pIn = S->pHistory;
+  blkCnt = S->historyIndex;
+  while (blkCnt > 0U)
+  {
+    *pDst++ = *pIn++ * *pWin++;
+    blkCnt--;
+  }
+
+  arm_cfft_f32(&(S->rfft.Sint), S->pTmp, 0, 1);
+
+  arm_stft_split_f32(&(S->rfft), S->pTmp, pOut, S->outputType);
+}
+
+/**
+  @brief         Processing function for the floating-point STFT.
+  @param[in,out] S          points to an instance of the floating-point STFT structure.
+  @param[in]     pSrc       points to the block of new input samples
+  @param[in]     blockSize  number of samples to process
+  @return        number of frames written to the output ring
+
+  @par           Frame timing
+                   The first frame is produced once <code>fftLen</code>
+                   samples have been received, then every
+                   <code>hopSize</code> samples. Frames dropped because the
+                   output ring is full are not included in the returned count.
+ */
+uint32_t arm_stft_f32(
+        arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+  uint32_t frameLen = ((uint32_t)S->fftLen >> 1U) + 1U;
+  uint32_t nbFrames = 0U;
+  uint32_t blkCnt;
+  uint32_t wr;
+
+  while (blockSize > 0U)
+  {
+    /* Copy up to the next frame, the end of the block or the end of the history */
+    blkCnt = S->samplesToFrame;
+    if (blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+    if (blkCnt > (uint32_t)S->fftLen - S->historyIndex)
+    {
+      blkCnt = (uint32_t)S->fftLen - S->historyIndex;
+    }
+
+    memcpy(S->pHistory + S->historyIndex, pSrc, blkCnt * sizeof(float32_t));
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    S->samplesToFrame -= blkCnt;
+    S->historyIndex += blkCnt;
+    if (S->historyIndex == S->fftLen)
+    {
+      S->historyIndex = 0U;
+    }
+
+    if (S->samplesToFrame == 0U)
+    {
+      S->samplesToFrame = S->hopSize;
+
+      wr = S->writeCount;
+      if ((wr - S->readCount) < S->numFrames)
+      {
+        /* The slot is written after the consumer has released it */
+        __DMB();
+
+        arm_stft_frame_f32(S, S->pFrames + (wr % S->numFrames) * frameLen);
+
+        /* Publish the frame only once it is complete */
+        __DMB();
+
+        S->writeCount = wr + 1U;
+        nbFrames++;
+      }
+      else
+      {
+        S->overrunCount++;
+      }
+    }
+  }
+
+  return (nbFrames);
+}
+
+/**
+  @brief         Oldest frame available in the STFT output ring.
+  @param[in]     S          points to an instance of the floating-point STFT structure.
+  @return        points to fftLen/2+1 bins or NULL when the ring is empty
+
+  @par           The frame stays valid until arm_stft_release_frame_f32 is called.
+ */
+const float32_t *arm_stft_get_frame_f32(
+  const arm_stft_instance_f32 * S)
+{
+  uint32_t rd = S->readCount;
+
+  if (S->writeCount == rd)
+  {
+    return (NULL);
+  }
+
+  /* The frame is read after the count which published it */
+  __DMB();
+
+  return (S->pFrames + (rd % S->numFrames) * (((uint32_t)S->fftLen >> 1U) + 1U));
+}
+
+/**
+  @brief         Release the frame returned by arm_stft_get_frame_f32.
+  @param[in,out] S          points to an instance of the floating-point STFT structure.
+  @return        none
+ */
+void arm_stft_release_frame_f32(
+        arm_stft_instance_f32 * S)
+{
+  if (S->writeCount != S->readCount)
+  {
+    /* The slot is released after the last read of the frame */
+    __DMB();
+
+    S->readCount = S->readCount + 1U;
+  }
+}
+
+/**
+  @} end of STFT group
+ */
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_init_f32.c
+ * Description:  Initialization function for the floating-point STFT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Size of the arena needed by the floating-point STFT.
+  @param[in]     fftLen     FFT length
+  @param[in]     numFrames  number of frames in the output ring
+  @return        arena size in float32_t words
+
+  @par           The arena contains the input history and the FFT working
+                 buffer (<code>fftLen</code> words each) followed by the
+                 output ring (<code>numFrames * (fftLen/2+1)</code> words).
+ */
+uint32_t arm_stft_get_buffer_size_f32(
+  uint16_t fftLen,
+  uint16_t numFrames)
+{
+  return (2U * (uint32_t)fftLen + (uint32_t)numFrames * (((uint32_t)fftLen >> 1U) + 1U));
+}
+
+/**
+  @brief         Initialization function for the floating-point STFT.
+  @param[out]    S           points to an instance of the floating-point STFT structure.
+  @param[in]     fftLen      FFT length
+  @param[in]     hopSize     number of new samples between two frames
+  @param[in]     pWindow     points to the analysis window of fftLen samples
+  @param[in]     numFrames   number of frames in the output ring
+  @param[in]     outputType  magnitude or power output
+  @param[in]     pBuffer     points to the arena of arm_stft_get_buffer_size_f32() words
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : hopSize or numFrames is not supported,
+                                                    or fftLen is not a supported length
+
+  @par           Description
+                   <code>hopSize</code> must be between 1 and <code>fftLen</code>.
+                   <code>fftLen</code> is one of the lengths supported by
+                   arm_rfft_fast_init_f32.
+                   The window is not copied and must stay valid while the
+                   instance is used.
+ */
+arm_status arm_stft_init_f32(
+        arm_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        uint16_t numFrames,
+        arm_stft_output_type outputType,
+        float32_t * pBuffer)
+{
+  arm_status status;
+
+  if ((hopSize == 0U) || (hopSize > fftLen) || (numFrames == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_rfft_fast_init_f32(&(S->rfft), fftLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->numFrames = numFrames;
+  S->outputType = (uint16_t)outputType;
+  S->pWindow = pWindow;
+
+  S->pHistory = pBuffer;
+  S->pTmp = pBuffer + fftLen;
+  S->pFrames = pBuffer + 2U * (uint32_t)fftLen;
+
+  S->historyIndex = 0U;
+  S->samplesToFrame = fftLen;
+  S->overrunCount = 0U;
+  S->writeCount = 0U;
+  S->readCount = 0U;
+
+  memset(S->pHistory, 0, fftLen * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of STFT group
+ */